@@ -0,0 +1,93 @@
+// One BMP280 frame (temperature, pressure, altitude) the way the firmware
+// reads it, one six-byte burst and the compensation once, against the
+// Adafruit library's readTemperature(), readPressure() and readAltitude(),
+// which is five three-byte reads and a pow(). Reports I2C transactions and
+// bytes per frame, bus time per frame at the firmware's 400 kHz clock, and
+// host CPU time per frame. The firmware frame runs through update(); update()
+// without a BMP280 sample is timed too and taken off.
+//
+//   barometer_benchmark [frames]
+
+#include <chrono>
+#include <Arduino.h>
+#include <Adafruit_BMP280.h>
+#include "HostRuntime.h"
+#include "Firmware.h"
+#include "SensorRig.h"
+
+namespace {
+
+struct Frame {
+    uint32_t transactions;
+    uint64_t bytes;
+    double bus_us;
+    double cpu_ns;
+};
+
+struct Run {
+    uint32_t frames;
+    std::function<void()> body;
+    Frame result;
+    bool done;
+};
+
+// Bus time is only charged inside a task, so the frames run in one
+void frameTask(void* param) {
+    Run* run = static_cast<Run*>(param);
+    uint32_t transactions = Wire.getTransactions();
+    uint64_t bytes = Wire.getBytesTransferred();
+    uint64_t start_us = host::nowMicros();
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < run->frames; i++) {
+        run->body();
+    }
+    double cpu_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    run->result.transactions = Wire.getTransactions() - transactions;
+    run->result.bytes = Wire.getBytesTransferred() - bytes;
+    run->result.bus_us = (double)(host::nowMicros() - start_us) / run->frames;
+    run->result.cpu_ns = cpu_ns / run->frames;
+    run->done = true;
+    vTaskDelete(NULL);
+}
+
+Frame measure(uint32_t frames, const std::function<void()>& body) {
+    Run run = { frames, body, {}, false };
+    xTaskCreatePinnedToCore(frameTask, "frames", 4096, &run, 5, NULL, 1);
+    host::runUntil([&] { return run.done; }, UINT32_MAX);
+    return run.result;
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t frames = argc > 1 ? (uint32_t)atoi(argv[1]) : 100000;
+    host::reset();
+    SensorRig rig;
+    SensorModule module;
+    Adafruit_BMP280 library;
+    module.beginBus();
+    Wire.setClock(400000);
+    if (!module.beginBMP() || !library.begin(0x76)) {
+        printf("BMP280 model did not answer\n");
+        return 1;
+    }
+    library.setSampling(Adafruit_BMP280::MODE_NORMAL);
+
+    module.setBMPInterval(UINT32_MAX);
+    Frame idle = measure(frames, [&] { module.update(); });
+    module.setBMPInterval(0);
+    Frame burst = measure(frames, [&] { module.update(); });
+    Frame adafruit = measure(frames, [&] {
+        library.readTemperature();
+        library.readPressure();
+        library.readAltitude(1023);
+    });
+
+    printf("%lu frames, I2C at 400 kHz\n", (unsigned long)frames);
+    printf("  %-10s %13s %11s %11s %11s\n", "", "transactions", "bytes", "bus us", "CPU ns");
+    printf("  %-10s %13.1f %11.1f %11.1f %11.1f\n", "Burst", (double)burst.transactions / frames,
+           (double)burst.bytes / frames, burst.bus_us - idle.bus_us, burst.cpu_ns - idle.cpu_ns);
+    printf("  %-10s %13.1f %11.1f %11.1f %11.1f\n", "Adafruit", (double)adafruit.transactions / frames,
+           (double)adafruit.bytes / frames, adafruit.bus_us, adafruit.cpu_ns);
+    return 0;
+}
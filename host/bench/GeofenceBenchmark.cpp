@@ -0,0 +1,90 @@
+// Geofence check latency with the largest fence accepted (1024 vertices: a
+// jagged 912-vertex keep-in ring and seven keep-out islands), against a
+// full scan of every edge. Queries are uniform over the fence's area, then
+// concentrated in the ring's widest band, where its near-vertical sides put
+// the most edges in one band. Maxima include host preemption.
+//
+//   geofence_benchmark [queries]
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <Arduino.h>
+#include "Geofence.h"
+#include "FenceShapes.h"
+
+namespace {
+
+struct Timing {
+    double mean_ns;
+    double p99_ns;
+    double max_ns;
+};
+
+template <typename Check>
+Timing time(const std::vector<std::pair<double, double>>& points, Check check) {
+    std::vector<double> samples;
+    samples.reserve(points.size());
+    for (const auto& point : points) {
+        auto start = std::chrono::steady_clock::now();
+        check(point.first, point.second);
+        samples.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+    }
+    double sum = 0;
+    for (double sample : samples) {
+        sum += sample;
+    }
+    std::sort(samples.begin(), samples.end());
+    return Timing{ sum / samples.size(), samples[samples.size() * 99 / 100], samples.back() };
+}
+
+void print(const char* name, const Timing& timing) {
+    printf("  %-26s %9.0f %9.0f %9.0f\n", name, timing.mean_ns, timing.p99_ns, timing.max_ns);
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t count = argc > 1 ? (uint32_t)atoi(argv[1]) : 200000;
+
+    FenceShapes shapes(912, 7, 16);
+    ActuatorModule actuators;
+    Geofence fence(actuators);
+    if (!fence.load(shapes.text().c_str())) {
+        printf("Fence did not load\n");
+        return 1;
+    }
+
+    std::mt19937 random(5);
+    std::uniform_real_distribution<double> coordinate(-2100.0, 2100.0);
+    std::uniform_real_distribution<double> band(-1800.0, 1800.0);
+    std::vector<std::pair<double, double>> uniform, worst;
+    for (uint32_t i = 0; i < count; i++) {
+        uniform.push_back({ FenceShapes::latitude(coordinate(random)), FenceShapes::longitude(coordinate(random)) });
+        // The ring's bands near its widest point (y ≈ 0) hold the most edges
+        worst.push_back({ FenceShapes::latitude(band(random) * 0.02), FenceShapes::longitude(band(random)) });
+    }
+
+    Timing indexed = time(uniform, [&](double lat, double lon) { fence.check(lat, lon); });
+    uint32_t edges_uniform = fence.getEdgesTestedMax();
+    Timing indexed_worst = time(worst, [&](double lat, double lon) { fence.check(lat, lon); });
+    double margin;
+    bool sink = false;
+    Timing scan = time(uniform, [&](double lat, double lon) {
+        double x = (lon - FenceShapes::ORIGIN_LONGITUDE) * FenceShapes::metersPerDegLon();
+        double y = (lat - FenceShapes::ORIGIN_LATITUDE) * 111320.0;
+        sink ^= shapes.allowed(x, y, margin);
+    });
+
+    printf("Fence: %d polygons, %d vertices, at most %d edges per polygon per check\n", fence.getPolygonCount(),
+           fence.getVertexCount(), fence.getWorstCaseEdges());
+    printf("Check latency over %lu queries (ns)\n", (unsigned long)count);
+    printf("  %-26s %9s %9s %9s\n", "", "mean", "p99", "max");
+    print("indexed, uniform", indexed);
+    print("indexed, widest band", indexed_worst);
+    print("full scan, uniform", scan);
+    printf("Edges tested per check: %lu max uniform, %lu max overall; %lu breaches, %d\n",
+           (unsigned long)edges_uniform, (unsigned long)fence.getEdgesTestedMax(), (unsigned long)fence.getBreaches(), sink);
+    return 0;
+}
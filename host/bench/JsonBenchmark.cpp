@@ -0,0 +1,209 @@
+// /data serialization: the String builder generateJSON() used before
+// JsonWriter (kept here as the baseline, on the same snapshot) against
+// JsonWriter writing the same fields into a fixed buffer. Reports documents/s,
+// bytes/s, and heap allocations per document, both as the WString stand-in
+// counts them and as operator new sees them.
+//
+//   json_benchmark [documents]
+
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <Arduino.h>
+#include "JsonWriter.h"
+#include "SensorSnapshot.h"
+
+static std::atomic<uint64_t> heap_allocations(0);
+
+void* operator new(size_t size) {
+    heap_allocations++;
+    void* p = malloc(size ? size : 1);
+    if (p == NULL) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+namespace {
+
+SensorSnapshot sampleSnapshot() {
+    SensorSnapshot snapshot = {};
+    snapshot.bmp_temperature = 21.37f;
+    snapshot.bmp_pressure = 1013.42f;
+    snapshot.bmp_altitude = 12.8f;
+    snapshot.mpu_temperature = 27.9f;
+    snapshot.accel_x = 0.12f;
+    snapshot.accel_y = -0.31f;
+    snapshot.accel_z = 9.79f;
+    snapshot.gyro_x = 0.002f;
+    snapshot.gyro_y = -0.013f;
+    snapshot.gyro_z = 0.041f;
+    snapshot.gps.valid = true;
+    snapshot.gps.latitude = -34.544312;
+    snapshot.gps.longitude = -58.439871;
+    snapshot.gps.altitude = 4.2;
+    snapshot.gps.speed = 3.9f;
+    snapshot.gps.satellites = 9;
+    strcpy(snapshot.gps.time, "142305");
+    strcpy(snapshot.gps.date, "161026");
+    return snapshot;
+}
+
+// generateJSON() before JsonWriter, field for field
+String legacyJSON(const SensorSnapshot& snapshot, int servo_position, int motor_speed) {
+    String json = "{";
+
+    json += "\"bmp\":{";
+    json += "\"temperature\":" + String(snapshot.bmp_temperature) + ",";
+    json += "\"pressure\":" + String(snapshot.bmp_pressure) + ",";
+    json += "\"altitude\":" + String(snapshot.bmp_altitude);
+    json += "},";
+
+    json += "\"mpu\":{";
+    json += "\"temperature\":" + String(snapshot.mpu_temperature) + ",";
+    json += "\"acceleration\":{";
+    json += "\"x\":" + String(snapshot.accel_x) + ",";
+    json += "\"y\":" + String(snapshot.accel_y) + ",";
+    json += "\"z\":" + String(snapshot.accel_z);
+    json += "},";
+    json += "\"gyro\":{";
+    json += "\"x\":" + String(snapshot.gyro_x) + ",";
+    json += "\"y\":" + String(snapshot.gyro_y) + ",";
+    json += "\"z\":" + String(snapshot.gyro_z);
+    json += "}";
+    json += "},";
+
+    json += "\"gps\":{";
+    json += "\"valid\":" + String(snapshot.gps.valid ? "true" : "false") + ",";
+    json += "\"latitude\":" + String(snapshot.gps.latitude, 6) + ",";
+    json += "\"longitude\":" + String(snapshot.gps.longitude, 6) + ",";
+    json += "\"altitude\":" + String(snapshot.gps.altitude) + ",";
+    json += "\"speed\":" + String(snapshot.gps.speed) + ",";
+    json += "\"satellites\":" + String(snapshot.gps.satellites) + ",";
+    json += "\"time\":\"" + String(snapshot.gps.time) + "\",";
+    json += "\"date\":\"" + String(snapshot.gps.date) + "\"";
+    json += "},";
+
+    json += "\"actuators\":{";
+    json += "\"servo\":{";
+    json += "\"position\":" + String(servo_position);
+    json += "},";
+    json += "\"motor\":{";
+    json += "\"speed\":" + String(motor_speed);
+    json += "}";
+    json += "}";
+
+    json += "}";
+    return json;
+}
+
+// The same document through JsonWriter
+size_t writerJSON(char* buffer, size_t capacity, const SensorSnapshot& snapshot, int servo_position, int motor_speed) {
+    JsonWriter json(buffer, capacity);
+    json.beginObject();
+    json.beginObject("bmp");
+    json.field("temperature", snapshot.bmp_temperature);
+    json.field("pressure", snapshot.bmp_pressure);
+    json.field("altitude", snapshot.bmp_altitude);
+    json.endObject();
+    json.beginObject("mpu");
+    json.field("temperature", snapshot.mpu_temperature);
+    json.beginObject("acceleration");
+    json.field("x", snapshot.accel_x);
+    json.field("y", snapshot.accel_y);
+    json.field("z", snapshot.accel_z);
+    json.endObject();
+    json.beginObject("gyro");
+    json.field("x", snapshot.gyro_x);
+    json.field("y", snapshot.gyro_y);
+    json.field("z", snapshot.gyro_z);
+    json.endObject();
+    json.endObject();
+    json.beginObject("gps");
+    json.field("valid", snapshot.gps.valid);
+    json.field("latitude", snapshot.gps.latitude, 6);
+    json.field("longitude", snapshot.gps.longitude, 6);
+    json.field("altitude", snapshot.gps.altitude);
+    json.field("speed", snapshot.gps.speed);
+    json.field("satellites", snapshot.gps.satellites);
+    json.field("time", snapshot.gps.time);
+    json.field("date", snapshot.gps.date);
+    json.endObject();
+    json.beginObject("actuators");
+    json.beginObject("servo");
+    json.field("position", servo_position);
+    json.endObject();
+    json.beginObject("motor");
+    json.field("speed", motor_speed);
+    json.endObject();
+    json.endObject();
+    json.endObject();
+    return json.overflowed() ? 0 : json.size();
+}
+
+struct Result {
+    double seconds;
+    size_t bytes;
+    uint64_t heap;
+    uint32_t strings;
+};
+
+template <typename Build>
+Result run(uint32_t documents, Build build) {
+    Result result = {};
+    String::resetAllocations();
+    uint64_t heap_before = heap_allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < documents; i++) {
+        result.bytes += build(i);
+        asm volatile("" ::: "memory");
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.heap = heap_allocations - heap_before;
+    result.strings = String::getAllocations();
+    return result;
+}
+
+void print(const char* name, const Result& result, uint32_t documents) {
+    printf("  %-12s %8.0f %9.1f %9.2f %11.1f %11.1f\n", name, documents / result.seconds,
+           (double)result.bytes / documents, result.bytes / result.seconds / 1e6,
+           (double)result.strings / documents, (double)result.heap / documents);
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t documents = argc > 1 ? (uint32_t)atoi(argv[1]) : 200000;
+    const SensorSnapshot snapshot = sampleSnapshot();
+    char buffer[1536];
+
+    // Same document both ways, or the comparison means nothing
+    String legacy = legacyJSON(snapshot, 90, 120);
+    size_t length = writerJSON(buffer, sizeof(buffer), snapshot, 90, 120);
+    if (length != legacy.length() || memcmp(buffer, legacy.c_str(), length) != 0) {
+        printf("Documents differ:\n  String:     %s\n  JsonWriter: %s\n", legacy.c_str(), buffer);
+        return 1;
+    }
+
+    Result strings = run(documents, [&](uint32_t i) {
+        return legacyJSON(snapshot, 90, (int)(i & 255)).length();
+    });
+    Result writer = run(documents, [&](uint32_t i) {
+        return writerJSON(buffer, sizeof(buffer), snapshot, 90, (int)(i & 255));
+    });
+
+    printf("%lu documents of about %zu bytes\n", (unsigned long)documents, length);
+    printf("  %-12s %8s %9s %9s %11s %11s\n", "", "docs/s", "bytes", "MB/s", "String/doc", "heap/doc");
+    print("String", strings, documents);
+    print("JsonWriter", writer, documents);
+    return writer.heap == 0 ? 0 : 1;
+}
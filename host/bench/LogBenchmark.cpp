@@ -0,0 +1,78 @@
+// Producer-side cost of a LOG_INFO call, which is what the sensor, web and
+// actuator paths pay: claiming a ring slot and copying the format pointer and
+// arguments, with integer, float and string arguments. The ring is drained
+// between batches, outside the timed region, so no call is dropped; the drain
+// (formatting and printing one record) is timed separately.
+//
+//   log_benchmark [calls]
+
+#include <chrono>
+#include <Arduino.h>
+#include "HostRuntime.h"
+#include "Log.h"
+
+namespace {
+
+const uint32_t BATCH = 100;     // Fewer than the ring holds
+
+template <typename Body>
+double nanosPerCall(uint32_t calls, Body body) {
+    double total = 0;
+    for (uint32_t done = 0; done < calls; done += BATCH) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < BATCH; i++) {
+            body(done + i);
+            asm volatile("" ::: "memory");
+        }
+        total += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        Log::drain();
+        host::takeSerialOutput();
+    }
+    return total / ((calls + BATCH - 1) / BATCH * BATCH);
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t calls = argc > 1 ? (uint32_t)atoi(argv[1]) : 2000000;
+    host::reset();
+    host::setSerialEcho(false);
+    Log::begin();
+
+    double none = nanosPerCall(calls, [](uint32_t) { LOG_INFO("Motor stopping"); });
+    double ints = nanosPerCall(calls, [](uint32_t i) {
+        LOG_INFO("Motor target set to %d, %lu targets ignored", (int)(i & 255), (unsigned long)i);
+    });
+    double floats = nanosPerCall(calls, [](uint32_t i) {
+        LOG_INFO("Geofence breached at %.6f, %.6f", 38.7 + i * 1e-7, -9.1 - i * 1e-7);
+    });
+    double strings = nanosPerCall(calls, [](uint32_t i) {
+        LOG_INFO("Boot: %s %s at %lu ms", "barometer", "ready", (unsigned long)i);
+    });
+    double six = nanosPerCall(calls, [](uint32_t i) {
+        LOG_INFO("%d %u %f %s %ld %lu", (int)i, (unsigned)i, i * 0.5f, "six", (long)i, (unsigned long)i);
+    });
+
+    // Formatting and printing, on the drain task in the firmware
+    uint32_t drains = calls / 10 + BATCH;
+    double drain = 0;
+    for (uint32_t done = 0; done < drains; done += BATCH) {
+        for (uint32_t i = 0; i < BATCH; i++) {
+            LOG_INFO("Geofence breached at %.6f, %.6f", 38.7 + i * 1e-7, -9.1 - i * 1e-7);
+        }
+        auto start = std::chrono::steady_clock::now();
+        Log::drain();
+        drain += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        host::takeSerialOutput();
+    }
+    drain /= (drains + BATCH - 1) / BATCH * BATCH;
+
+    printf("LOG_INFO, no arguments:      %7.1f ns\n", none);
+    printf("LOG_INFO, 2 integers:        %7.1f ns\n", ints);
+    printf("LOG_INFO, 2 doubles:         %7.1f ns\n", floats);
+    printf("LOG_INFO, 2 strings + int:   %7.1f ns\n", strings);
+    printf("LOG_INFO, 6 mixed:           %7.1f ns\n", six);
+    printf("Drain, per record:           %7.1f ns (formatting and Serial)\n", drain);
+    printf("Records dropped:             %7lu\n", (unsigned long)Log::getDropped());
+    return Log::getDropped() == 0 ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+// Boots the hardware build of the firmware against the sensor models and a
+// scripted ground station, runs it on the virtual clock with host CPU time
+// charged, and reports task iteration latency and per-stage timings.
+//
+//   loop_benchmark [seconds] [--echo]
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <Arduino.h>
+#include "HostRuntime.h"
+#include "HostNetwork.h"
+#include "Firmware.h"
+#include "Metrics.h"
+#include "SensorRig.h"
+
+namespace {
+
+struct StageSummary {
+    unsigned long count = 0;
+    double sum_seconds = 0;
+    double max_seconds = 0;
+};
+
+// Pulls count, sum and max per stage out of the /metrics text
+std::map<std::string, StageSummary> readStages() {
+    std::map<std::string, StageSummary> stages;
+    char buffer[2048];
+    for (int piece = 0; piece < Metrics::getPieceCount(); piece++) {
+        size_t length = Metrics::writePiece(piece, buffer, sizeof(buffer));
+        std::string text(buffer, length);
+        size_t start = 0;
+        while (start < text.size()) {
+            size_t end = text.find('\n', start);
+            std::string line = text.substr(start, end == std::string::npos ? std::string::npos : end - start);
+            start = end == std::string::npos ? text.size() : end + 1;
+
+            size_t open = line.find("{stage=\"");
+            if (open == std::string::npos) {
+                continue;
+            }
+            size_t close = line.find('"', open + 8);
+            std::string stage = line.substr(open + 8, close - open - 8);
+            double value = atof(line.substr(line.rfind(' ') + 1).c_str());
+            if (line.compare(0, 24, "aleph_stage_seconds_sum{") == 0) {
+                stages[stage].sum_seconds = value;
+            } else if (line.compare(0, 26, "aleph_stage_seconds_count{") == 0) {
+                stages[stage].count = (unsigned long)value;
+            } else if (line.compare(0, 23, "aleph_stage_max_seconds") == 0) {
+                stages[stage].max_seconds = value;
+            }
+        }
+    }
+    return stages;
+}
+
+void printProfiler(const char* name, ProfilerModule& profiler) {
+    printf("  %-8s %9lu %9lu %9lu %9lu %9lu\n", name, (unsigned long)profiler.getIterationCount(),
+           (unsigned long)profiler.getPercentile(50), (unsigned long)profiler.getPercentile(90),
+           (unsigned long)profiler.getPercentile(99), (unsigned long)profiler.getMaxLatency());
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t seconds = 30;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--echo") == 0) {
+            host::setSerialEcho(true);
+        } else {
+            seconds = (uint32_t)atoi(argv[i]);
+        }
+    }
+
+    SensorRig rig;
+    host::reset();
+    rig.start();
+    host::setChargeCpuTime(true);
+    host::bootFirmware();
+
+    // A dashboard polling /data at 5 Hz and one telemetry stream subscriber, once WiFi is up
+    std::shared_ptr<host::TcpPeer> subscriber;
+    uint32_t requests = 0;
+    auto started = std::chrono::steady_clock::now();
+    for (uint32_t ms = 0; ms < seconds * 1000; ms += 200) {
+        host::runFor(200);
+        if (WiFi.status() != WL_CONNECTED) {
+            continue;
+        }
+        if (!subscriber) {
+            subscriber = host::connectTcp(81);
+        } else {
+            subscriber->receive();
+        }
+        host::HttpResponse response;
+        if (host::httpRequest(80, "GET", "/data", response)) {
+            requests++;
+        }
+    }
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    host::takeSerialOutput();
+
+    printf("Simulated %.1f s in %.2f s of wall time, %lu context switches, %lu HTTP requests\n",
+           host::nowMicros() / 1e6, wall, (unsigned long)host::getContextSwitches(), (unsigned long)requests);
+    printf("\nTask iteration latency (us, last %d iterations for percentiles)\n", 512);
+    printf("  %-8s %9s %9s %9s %9s %9s\n", "task", "n", "p50", "p90", "p99", "max");
+    printProfiler("sensor", sensor_profiler);
+    printProfiler("web", web_profiler);
+
+    printf("\nStages (us)\n");
+    printf("  %-20s %9s %9s %9s\n", "stage", "n", "mean", "max");
+    for (auto& stage : readStages()) {
+        if (stage.second.count == 0) {
+            continue;
+        }
+        printf("  %-20s %9lu %9.1f %9.1f\n", stage.first.c_str(), stage.second.count,
+               stage.second.sum_seconds / stage.second.count * 1e6, stage.second.max_seconds * 1e6);
+    }
+    printf("\nLongest critical section: %.1f us over %llu sections\n", host::getCriticalSectionMaxNanos() / 1000.0,
+           (unsigned long long)host::getCriticalSectionCount());
+    printf("String allocations: %lu\n", (unsigned long)String::getAllocations());
+    return 0;
+}
@@ -0,0 +1,54 @@
+// Cost of the instrumentation itself on the host: an empty METRICS_SCOPE
+// (two cycle-counter reads and a histogram update) against an empty loop,
+// Metrics::record() alone over every bucket, and rendering all of /metrics.
+// On the board, aleph_metrics_scope_overhead_cycles reports the first figure.
+//
+//   metrics_benchmark [iterations]
+
+#include <chrono>
+#include <Arduino.h>
+#include "Metrics.h"
+
+namespace {
+
+template <typename Body>
+double nanosPerCall(uint32_t iterations, Body body) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        body(i);
+        asm volatile("" ::: "memory");
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = argc > 1 ? (uint32_t)atoi(argv[1]) : 20000000;
+    Metrics::begin();
+
+    double empty = nanosPerCall(iterations, [](uint32_t) {});
+    double scope = nanosPerCall(iterations, [](uint32_t) { METRICS_SCOPE(STAGE_SENSOR_PRINT); });
+
+    // Spread over every bucket, so the bucket scan runs its full range
+    const uint32_t cycles_per_us = Metrics::getCyclesPerMicro();
+    const uint32_t spread[8] = { 1, 3, 15, 70, 300, 1500, 8000, 70000 };
+    double record = nanosPerCall(iterations, [&](uint32_t i) {
+        Metrics::record(STAGE_MISSION, spread[i & 7] * cycles_per_us);
+    });
+
+    char buffer[2048];
+    size_t bytes = 0;
+    uint32_t renders = iterations / 1000 + 1;
+    double render = nanosPerCall(renders, [&](uint32_t) {
+        for (int piece = 0; piece < Metrics::getPieceCount(); piece++) {
+            bytes += Metrics::writePiece(piece, buffer, sizeof(buffer));
+        }
+    });
+
+    printf("Empty loop iteration:     %7.1f ns\n", empty);
+    printf("Empty METRICS_SCOPE:      %7.1f ns over the loop\n", scope - empty);
+    printf("Metrics::record():        %7.1f ns, all buckets\n", record - empty);
+    printf("Render /metrics:          %7.1f us, %lu bytes\n", render / 1000, (unsigned long)(bytes / renders));
+    return 0;
+}
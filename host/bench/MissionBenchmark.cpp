@@ -0,0 +1,89 @@
+// MissionEngine per-fix navigation cost: a boat sailing a 64-waypoint zigzag
+// at 3 m/s, one fix per 200 ms, through MissionEngine::updateFix() (tangent
+// plane projection, leg switching, the autopilot retarget and the throttle
+// check). Reports navigation updates/s on the host.
+//
+//   mission_benchmark [fixes]
+
+#include <chrono>
+#include <math.h>
+#include <string>
+#include <vector>
+#include <Arduino.h>
+#include "MissionEngine.h"
+
+namespace {
+
+const double START_LATITUDE = -34.5443;
+const double START_LONGITUDE = -58.4399;
+const double METERS_PER_DEG_LAT = 111320.0;
+const int WAYPOINTS = MissionEngine::MAX_WAYPOINTS;
+const double LEG_METERS = 200.0;
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t count = argc > 1 ? (uint32_t)atoi(argv[1]) : 2000000;
+    double meters_per_deg_lon = METERS_PER_DEG_LAT * cos(START_LATITUDE * DEG_TO_RAD);
+
+    // Zigzag north-east and north-west, 200 m legs
+    std::string text;
+    std::vector<double> north(WAYPOINTS + 1, 0.0), east(WAYPOINTS + 1, 0.0);
+    for (int i = 1; i <= WAYPOINTS; i++) {
+        north[i] = north[i - 1] + LEG_METERS * 0.7071;
+        east[i] = east[i - 1] + (i % 2 ? 1 : -1) * LEG_METERS * 0.7071;
+        char line[64];
+        snprintf(line, sizeof(line), "%.7f,%.7f,200\n", START_LATITUDE + north[i] / METERS_PER_DEG_LAT,
+                 START_LONGITUDE + east[i] / meters_per_deg_lon);
+        text += line;
+    }
+
+    // Fixes along the legs, 0.6 m apart with a slow weave across the line
+    std::vector<GPSData> fixes;
+    for (int leg = 0; leg < WAYPOINTS; leg++) {
+        for (double along = 0; along < LEG_METERS; along += 0.6) {
+            double f = along / LEG_METERS;
+            double weave = 3.0 * sin(along * 0.05);
+            double n = north[leg] + f * (north[leg + 1] - north[leg]) + weave * 0.7071;
+            double e = east[leg] + f * (east[leg + 1] - east[leg]) - weave * 0.7071 * (leg % 2 ? -1 : 1);
+            GPSData fix = {};
+            fix.valid = true;
+            fix.latitude = START_LATITUDE + n / METERS_PER_DEG_LAT;
+            fix.longitude = START_LONGITUDE + e / meters_per_deg_lon;
+            fix.speed = 5.8f;
+            fix.velocity_valid = true;
+            fixes.push_back(fix);
+        }
+    }
+
+    SensorModule sensor_module;
+    ActuatorModule actuator_module;
+    actuator_module.beginMotor();
+    HeadingController autopilot(sensor_module, actuator_module);
+    MissionEngine mission(sensor_module, actuator_module, autopilot);
+    if (mission.load(text.c_str()) != WAYPOINTS) {
+        printf("Mission did not load\n");
+        return 1;
+    }
+
+    uint32_t missions = 0, legs = 0;
+    double seconds = 0;
+    for (uint32_t done = 0; done < count; missions++) {
+        mission.start();
+        mission.update();       // Takes the start request
+        auto started = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < fixes.size() && done < count && mission.getState() == MissionEngine::RUNNING; i++, done++) {
+            fixes[i].fix_count = done + 1;
+            mission.updateFix(fixes[i]);
+        }
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        legs += mission.getState() == MissionEngine::COMPLETE ? WAYPOINTS : mission.getLeg();
+        mission.stop();
+        mission.update();
+    }
+
+    printf("%lu navigation updates in %.3f s: %.2f M updates/s, %.1f ns/update\n", (unsigned long)mission.getNavUpdates(),
+           seconds, mission.getNavUpdates() / seconds / 1e6, seconds / mission.getNavUpdates() * 1e9);
+    printf("%lu missions, %lu legs flown\n", (unsigned long)missions, (unsigned long)legs);
+    return 0;
+}
@@ -0,0 +1,84 @@
+// NavigationFilter replay over BoatTrack: 1 kHz IMU through AttitudeEstimator
+// and the filter, 1 Hz fixes with 2 m noise, 10 Hz barometer. Reports filter
+// updates/s (predict only, timed separately from the replay) and the fused
+// position error against holding the last fix.
+//
+//   navigation_benchmark [seconds of track]
+
+#include <chrono>
+#include <math.h>
+#include <vector>
+#include <Arduino.h>
+#include "NavigationFilter.h"
+#include "BoatTrack.h"
+
+int main(int argc, char** argv) {
+    uint32_t seconds = argc > 1 ? (uint32_t)atoi(argv[1]) : 600;
+    uint32_t steps = seconds * 1000;
+
+    // Record the IMU stream and the attitude it produces, so predict() can be timed alone
+    BoatTrack recorder;
+    AttitudeEstimator recorded_attitude;
+    std::vector<ImuSample> samples(steps);
+    std::vector<AttitudeEstimator> attitudes;
+    attitudes.reserve(steps);
+    for (uint32_t i = 0; i < steps; i++) {
+        samples[i] = recorder.step();
+        recorded_attitude.update(samples[i]);
+        attitudes.push_back(recorded_attitude);
+    }
+
+    NavigationFilter timed;
+    GPSData origin = BoatTrack().fix();
+    timed.updateGPS(origin, attitudes[0]);
+    auto started = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < steps; i++) {
+        timed.predict(samples[i], attitudes[i]);
+    }
+    double predict_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+    // Replay with fixes and barometer for the error figures
+    BoatTrack track;
+    AttitudeEstimator attitude;
+    NavigationFilter filter;
+    GPSData held = {};
+    double filter_sum = 0, held_sum = 0, filter_max = 0, held_max = 0;
+    uint32_t measured = 0, fixes = 0;
+    started = std::chrono::steady_clock::now();
+    for (uint32_t i = 1; i <= steps; i++) {
+        ImuSample sample = track.step();
+        attitude.update(sample);
+        filter.predict(sample, attitude);
+        if (i % 100 == 0) {
+            filter.updateBaro(track.baroAltitude());
+        }
+        if (i % 1000 == 0) {
+            held = track.fix();
+            filter.updateGPS(held, attitude);
+            fixes++;
+        }
+        if (fixes < 30) {
+            continue;
+        }
+        NavigationState state;
+        filter.getState(state);
+        double error = track.errorOf(state.latitude, state.longitude);
+        double held_error = track.errorOf(held.latitude, held.longitude);
+        filter_sum += error * error;
+        held_sum += held_error * held_error;
+        filter_max = fmax(filter_max, error);
+        held_max = fmax(held_max, held_error);
+        measured++;
+    }
+    double replay_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+    printf("%lu predicts in %.3f s: %.2f M predicts/s, %.1f ns/predict\n", (unsigned long)timed.getPredictCount(),
+           predict_seconds, timed.getPredictCount() / predict_seconds / 1e6, predict_seconds / timed.getPredictCount() * 1e9);
+    printf("Replayed %lu s of track in %.3f s (%lu fixes, %lu baro updates)\n", (unsigned long)seconds, replay_seconds,
+           (unsigned long)filter.getGPSUpdateCount(), (unsigned long)filter.getBaroUpdateCount());
+    printf("Horizontal error after 30 s (m):\n");
+    printf("  %-10s %8s %8s\n", "", "rms", "max");
+    printf("  %-10s %8.2f %8.2f\n", "fused", sqrt(filter_sum / measured), filter_max);
+    printf("  %-10s %8.2f %8.2f\n", "last fix", sqrt(held_sum / measured), held_max);
+    return 0;
+}
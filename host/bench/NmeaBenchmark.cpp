@@ -0,0 +1,70 @@
+// The NMEA_BENCHMARK_ENABLED boot benchmark on the host: every corpus in
+// NmeaCorpus.h through SensorModule's NMEA or UBX path in 120-byte chunks,
+// timed with the host clock. Reports the same figures the firmware logs, so
+// parser changes can be compared before flashing.
+//
+//   nmea_benchmark [passes]
+
+#include <chrono>
+#include <Arduino.h>
+#include "SensorModule.h"
+#include "NmeaCorpus.h"
+
+namespace {
+
+const size_t CHUNK_BYTES = 120;     // As NmeaBenchmark
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t passes = argc > 1 ? (uint32_t)atoi(argv[1]) : 2000;
+    if (passes == 0) {
+        passes = 1;
+    }
+    SensorModule sensors;
+
+    printf("%-18s %12s %12s %10s %9s %12s  %s\n", "corpus", "chars/s", "sentences/s", "us/fix", "ns/char",
+           "worst chunk", "counts");
+    bool all_expected = true;
+    for (int i = 0; i < NMEA_CORPUS_COUNT; i++) {
+        const NmeaCorpus& corpus = NMEA_CORPORA[i];
+        sensors.resetGPS();
+
+        double worst_chunk_us = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t pass = 0; pass < passes; pass++) {
+            for (size_t offset = 0; offset < corpus.length; offset += CHUNK_BYTES) {
+                size_t length = corpus.length - offset < CHUNK_BYTES ? corpus.length - offset : CHUNK_BYTES;
+                auto chunk_start = std::chrono::steady_clock::now();
+                if (corpus.protocol == CORPUS_UBX) {
+                    sensors.injectUBX((const uint8_t*)corpus.text + offset, length);
+                } else {
+                    sensors.injectNMEA(corpus.text + offset, length);
+                }
+                double chunk_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - chunk_start).count();
+                if (chunk_us > worst_chunk_us) {
+                    worst_chunk_us = chunk_us;
+                }
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        uint32_t chars, passed, failed;
+        sensors.getGPSParserStats(chars, passed, failed);
+        GPSData fix;
+        sensors.getGPSData(fix);
+        bool expected = passed == corpus.sentences_passed * passes && failed == corpus.sentences_failed * passes &&
+                        fix.fix_count == corpus.fixes * passes;
+        all_expected = all_expected && expected;
+
+        printf("%-18s %12.0f %12.0f %10.2f %9.1f %9.1f us  %s\n", corpus.name, chars / seconds,
+               (passed + failed) / seconds, fix.fix_count > 0 ? seconds * 1e6 / fix.fix_count : 0.0,
+               chars > 0 ? seconds * 1e9 / chars : 0.0, worst_chunk_us, expected ? "as expected" : "MISMATCH");
+        if (!expected) {
+            printf("  got %lu/%lu/%lu passed/failed/fixes per pass, the corpus generator expects %lu/%lu/%lu\n",
+                   (unsigned long)(passed / passes), (unsigned long)(failed / passes), (unsigned long)(fix.fix_count / passes),
+                   (unsigned long)corpus.sentences_passed, (unsigned long)corpus.sentences_failed, (unsigned long)corpus.fixes);
+        }
+    }
+    return all_expected ? 0 : 1;
+}
@@ -0,0 +1,136 @@
+// Command-to-PWM latency of the UDP control uplink, through the firmware: the
+// hardware build boots on the sensor models with host CPU time charged, and
+// ControlPacket commands go in through the WiFiUDP stand-in. For each command
+// the benchmark reports
+//   - apply_us from the ack: packet read to actuator target set, on board;
+//   - packet delivered to the first LEDC write that moves the servo, and the
+//     motor, toward the new target: the next 5 ms ramp tick for the servo;
+//     the jerk limit starts the motor so gently that its 8-bit duty first
+//     changes a few ticks later;
+//   - packet delivered to the motor duty reaching the target, which the
+//     acceleration and jerk limits stretch to a few hundred ms by design.
+//
+//   uplink_benchmark [commands]
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include <Arduino.h>
+#include "HostRuntime.h"
+#include "HostNetwork.h"
+#include "Firmware.h"
+#include "SensorRig.h"
+
+namespace {
+
+const uint8_t SERVO_CHANNEL = 0;        // ActuatorModule's defaults, as main.ino uses them
+const uint8_t MOTOR_CHANNEL = 8;
+const uint8_t MOTOR_IN2 = 26;
+
+int motorDrive() {
+    int duty = (int)host::ledcDuty(MOTOR_CHANNEL);
+    return host::pinLevel(MOTOR_IN2) == HIGH ? -duty : duty;
+}
+
+struct Series {
+    const char* name;
+    std::vector<double> values;
+
+    void print() {
+        if (values.empty()) {
+            printf("  %-32s no samples\n", name);
+            return;
+        }
+        std::sort(values.begin(), values.end());
+        double sum = 0;
+        for (double value : values) {
+            sum += value;
+        }
+        printf("  %-32s %6zu %9.1f %9.1f %9.1f %9.1f\n", name, values.size(), sum / values.size(),
+               values[values.size() / 2], values[std::min(values.size() - 1, values.size() * 99 / 100)],
+               values.back());
+    }
+};
+
+}
+
+int main(int argc, char** argv) {
+    uint32_t commands = argc > 1 ? (uint32_t)atoi(argv[1]) : 200;
+
+    SensorRig rig;
+    host::reset();
+    rig.start();
+    host::setChargeCpuTime(true);
+    host::bootFirmware();
+    if (!host::runUntil([]() { return control_uplink.isActive(); }, 20000)) {
+        printf("Control uplink did not start\n");
+        return 1;
+    }
+    host::runFor(500);
+    host::takeDatagrams();
+
+    Series apply{ "apply_us (ack)" }, servo_first{ "packet to servo PWM (us)" }, motor_first{ "packet to motor PWM (us)" };
+    Series motor_done{ "packet to motor at target (ms)" };
+    uint32_t acks = 0, timeouts = 0;
+
+    for (uint32_t i = 0; i < commands; i++) {
+        ControlPacket packet;
+        memset(&packet, 0, sizeof(packet));
+        packet.magic[0] = 'A';
+        packet.magic[1] = 'C';
+        packet.version = ControlUplink::PACKET_VERSION;
+        packet.flags = i == 0 ? 0x01 : 0;
+        packet.sequence = i + 1;
+        packet.sender_time_us = (uint32_t)host::nowMicros();
+        packet.servo_angle = i % 2 ? 70 : 110;
+        packet.motor_speed = i % 2 ? 40 : 120;
+
+        uint32_t servo_duty = host::ledcDuty(SERVO_CHANNEL);
+        int drive = motorDrive();
+        uint64_t sent_us = host::nowMicros();
+        host::sendDatagram(control_uplink.getPort(), &packet, sizeof(packet));
+
+        // Both outputs first move, then the motor arrives; commands stay well inside the 1 s failsafe
+        uint64_t servo_us = 0, motor_us = 0;
+        bool arrived = host::runUntil([&]() {
+            uint64_t now = host::nowMicros();
+            if (servo_us == 0 && host::ledcDuty(SERVO_CHANNEL) != servo_duty) {
+                servo_us = now;
+            }
+            if (motor_us == 0 && motorDrive() != drive) {
+                motor_us = now;
+            }
+            return servo_us != 0 && motorDrive() == packet.motor_speed;
+        }, 900);
+        if (!arrived) {
+            timeouts++;
+            continue;
+        }
+        servo_first.values.push_back((double)(servo_us - sent_us));
+        motor_first.values.push_back((double)(motor_us - sent_us));
+        motor_done.values.push_back((host::nowMicros() - sent_us) / 1000.0);
+
+        for (const host::Datagram& datagram : host::takeDatagrams()) {
+            ControlAck ack;
+            if (datagram.payload.size() == sizeof(ack)) {
+                memcpy(&ack, datagram.payload.data(), sizeof(ack));
+                if (ack.magic[0] == 'A' && ack.magic[1] == 'K' && ack.sequence == packet.sequence) {
+                    apply.values.push_back(ack.apply_us);
+                    acks++;
+                }
+            }
+        }
+        host::runFor(50);
+    }
+
+    printf("%lu commands, %lu acked, %lu did not reach the target in 900 ms, %lu stale, %lu failsafe stops\n",
+           (unsigned long)commands, (unsigned long)acks, (unsigned long)timeouts,
+           (unsigned long)control_uplink.getStaleDropped(), (unsigned long)control_uplink.getFailsafeStops());
+    printf("  %-32s %6s %9s %9s %9s %9s\n", "", "n", "mean", "p50", "p99", "max");
+    apply.print();
+    servo_first.print();
+    motor_first.print();
+    motor_done.print();
+    return acks == commands && timeouts == 0 ? 0 : 1;
+}
@@ -0,0 +1,72 @@
+#include "Bmp280Model.h"
+#include <string.h>
+
+static const uint8_t REG_CALIB = 0x88;
+static const uint8_t REG_CHIP_ID = 0xD0;
+static const uint8_t REG_RESET = 0xE0;
+static const uint8_t REG_CTRL_MEAS = 0xF4;
+static const uint8_t REG_PRESS_MSB = 0xF7;
+
+// Datasheet section 3.12: dig_T1 .. dig_P9
+static const uint16_t CALIBRATION[12] = {
+    27504, 26435, (uint16_t)-1000, 36477, (uint16_t)-10685, 3024, 2855, 140, (uint16_t)-7, 15500, (uint16_t)-14600, 6000
+};
+
+Bmp280Model::Bmp280Model() : pointer(0), adc_pressure(415148), adc_temperature(519888) {
+    memset(registers, 0, sizeof(registers));
+    registers[REG_CHIP_ID] = 0x58;
+    for (int i = 0; i < 12; i++) {
+        registers[REG_CALIB + 2 * i] = (uint8_t)CALIBRATION[i];
+        registers[REG_CALIB + 2 * i + 1] = (uint8_t)(CALIBRATION[i] >> 8);
+    }
+    registers[REG_PRESS_MSB] = 0x80;        // Reset value: no measurement yet
+    registers[REG_PRESS_MSB + 3] = 0x80;
+}
+
+void Bmp280Model::setRaw(int32_t pressure, int32_t temperature) {
+    adc_pressure = pressure;
+    adc_temperature = temperature;
+    if (registers[REG_CTRL_MEAS] & 0x03) {
+        loadData();
+    }
+}
+
+void Bmp280Model::loadData() {
+    registers[REG_PRESS_MSB] = (uint8_t)(adc_pressure >> 12);
+    registers[REG_PRESS_MSB + 1] = (uint8_t)(adc_pressure >> 4);
+    registers[REG_PRESS_MSB + 2] = (uint8_t)((adc_pressure & 0x0F) << 4);
+    registers[REG_PRESS_MSB + 3] = (uint8_t)(adc_temperature >> 12);
+    registers[REG_PRESS_MSB + 4] = (uint8_t)(adc_temperature >> 4);
+    registers[REG_PRESS_MSB + 5] = (uint8_t)((adc_temperature & 0x0F) << 4);
+}
+
+bool Bmp280Model::write(const uint8_t* data, size_t length) {
+    if (length == 0) {
+        return true;
+    }
+    pointer = data[0];
+    // Writes take a register address before every data byte
+    for (size_t i = 1; i < length; i += 2) {
+        uint8_t reg = pointer;
+        uint8_t value = data[i];
+        if (reg == REG_RESET && value == 0xB6) {
+            registers[REG_CTRL_MEAS] = 0;
+        } else if (reg >= 0xF4 && reg <= 0xF5) {
+            registers[reg] = value;
+            if (reg == REG_CTRL_MEAS && (value & 0x03)) {
+                loadData();
+            }
+        }
+        if (i + 1 < length) {
+            pointer = data[i + 1];
+        }
+    }
+    return true;
+}
+
+bool Bmp280Model::read(uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        data[i] = registers[(uint8_t)(pointer + i)];
+    }
+    return true;
+}
@@ -0,0 +1,29 @@
+#ifndef HOST_BMP280_MODEL_H
+#define HOST_BMP280_MODEL_H
+
+#include <stdint.h>
+#include <Wire.h>
+
+// BMP280 register model: chip ID, the datasheet's example trimming
+// parameters, ctrl_meas/config and the 20-bit data registers. The raw ADC
+// values default to the datasheet example (25.08 °C, 1006.53 hPa); the data
+// registers hold their reset value until a measurement mode is set.
+class Bmp280Model : public I2CDevice {
+private:
+    uint8_t registers[256];
+    uint8_t pointer;
+    int32_t adc_pressure;
+    int32_t adc_temperature;
+
+    void loadData();
+
+public:
+    Bmp280Model();
+
+    bool write(const uint8_t* data, size_t length) override;
+    bool read(uint8_t* data, size_t length) override;
+
+    void setRaw(int32_t adc_pressure, int32_t adc_temperature);
+};
+
+#endif // HOST_BMP280_MODEL_H
@@ -0,0 +1,115 @@
+#ifndef HOST_BOAT_TRACK_H
+#define HOST_BOAT_TRACK_H
+
+#include <math.h>
+#include <stdint.h>
+#include <random>
+#include "ImuRingBuffer.h"
+#include "GPSData.h"
+
+// A kinematic boat track for replaying the navigation filter: the hull stays
+// level, and speed and turn rate follow a fixed schedule (accelerate, cruise,
+// turn both ways, slow down). step() advances it by one IMU period and
+// returns what an ideal MPU6050 (x to the bow, z up) would read. Fixes and
+// barometric altitude come with seeded Gaussian noise, so a replay is
+// deterministic.
+class BoatTrack {
+public:
+    static constexpr double ORIGIN_LATITUDE = 41.3851;
+    static constexpr double ORIGIN_LONGITUDE = 2.1734;
+    static constexpr double ALTITUDE = 12.0;            // m
+
+private:
+    static constexpr double METERS_PER_DEG_LAT = 111320.0;
+    static constexpr double G = 9.80665;
+    static constexpr double MPS_TO_KNOTS = 1.0 / 0.514444;
+
+    uint32_t period_us;
+    uint64_t t_us;
+    double north, east;         // m
+    double speed;               // m/s
+    double heading;             // rad, clockwise from north
+    uint32_t fix_count;
+    std::mt19937 random;
+    std::normal_distribution<double> gaussian;
+    double gps_sigma;
+    double baro_sigma;
+
+    // Schedule, by seconds into the track (repeats every 240 s)
+    static double acceleration(double t) {
+        t = fmod(t, 240.0);
+        if (t < 20) return 0.15;            // 0 to 3 m/s
+        if (t > 220) return -0.15;          // Back to rest
+        return 0.0;
+    }
+
+    static double turnRate(double t) {
+        t = fmod(t, 240.0);
+        if (t >= 60 && t < 90) return 6 * DEG_TO_RAD;
+        if (t >= 130 && t < 175) return -4 * DEG_TO_RAD;
+        return 0.0;
+    }
+
+public:
+    explicit BoatTrack(uint32_t imu_period_us = 1000, double gps_noise = 2.0, double baro_noise = 0.3)
+        : period_us(imu_period_us), t_us(0), north(0), east(0), speed(0), heading(45 * DEG_TO_RAD),
+          fix_count(0), random(7), gaussian(0.0, 1.0), gps_sigma(gps_noise), baro_sigma(baro_noise) {}
+
+    ImuSample step() {
+        double t = t_us * 1e-6;
+        double dt = period_us * 1e-6;
+        double accel = acceleration(t);
+        double rate = turnRate(t);
+
+        ImuSample sample;
+        sample.timestamp_us = (uint32_t)(t_us + 1000);
+        sample.accel_x = (float)accel;
+        sample.accel_y = (float)(-speed * rate);    // Centripetal, to starboard (-y) in a right turn
+        sample.accel_z = (float)G;
+        sample.gyro_x = 0.0f;
+        sample.gyro_y = 0.0f;
+        sample.gyro_z = (float)-rate;               // Counter-clockwise positive
+
+        north += speed * cos(heading) * dt;
+        east += speed * sin(heading) * dt;
+        speed = fmax(speed + accel * dt, 0.0);
+        heading += rate * dt;
+        t_us += period_us;
+        return sample;
+    }
+
+    uint64_t getMicros() const { return t_us; }
+    double getNorth() const { return north; }
+    double getEast() const { return east; }
+    double getSpeed() const { return speed; }
+
+    GPSData fix() {
+        GPSData out = {};
+        double meters_per_deg_lon = METERS_PER_DEG_LAT * cos(ORIGIN_LATITUDE * DEG_TO_RAD);
+        out.valid = true;
+        out.latitude = ORIGIN_LATITUDE + (north + gps_sigma * gaussian(random)) / METERS_PER_DEG_LAT;
+        out.longitude = ORIGIN_LONGITUDE + (east + gps_sigma * gaussian(random)) / meters_per_deg_lon;
+        out.altitude = ALTITUDE;
+        out.speed = (float)(fmax(speed + 0.1 * gaussian(random), 0.0) * MPS_TO_KNOTS);
+        double course = fmod(heading * RAD_TO_DEG, 360.0);
+        out.course = (float)(course < 0 ? course + 360.0 : course);
+        out.velocity_valid = true;
+        out.satellites = 8;
+        out.fix_count = ++fix_count;
+        return out;
+    }
+
+    float baroAltitude() {
+        return (float)(ALTITUDE + baro_sigma * gaussian(random));
+    }
+
+    // Horizontal distance from the true position, m
+    double errorOf(double latitude, double longitude) const {
+        double meters_per_deg_lon = METERS_PER_DEG_LAT * cos(ORIGIN_LATITUDE * DEG_TO_RAD);
+        double dn = (latitude - ORIGIN_LATITUDE) * METERS_PER_DEG_LAT - north;
+        double de = (longitude - ORIGIN_LONGITUDE) * meters_per_deg_lon - east;
+        return sqrt(dn * dn + de * de);
+    }
+};
+
+#endif // HOST_BOAT_TRACK_H
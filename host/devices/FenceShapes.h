@@ -0,0 +1,99 @@
+#ifndef HOST_FENCE_SHAPES_H
+#define HOST_FENCE_SHAPES_H
+
+#include <math.h>
+#include <stdio.h>
+#include <random>
+#include <string>
+#include <vector>
+
+// Generated geofences for the geofence test and benchmark: a jagged keep-in
+// ring around a harbour with keep-out islands inside it, as upload text for
+// Geofence::load() and as the same polygons in metres for a reference
+// point-in-polygon test. Seeded, so every run gets the same shapes.
+class FenceShapes {
+public:
+    static constexpr double ORIGIN_LATITUDE = -34.5443;
+    static constexpr double ORIGIN_LONGITUDE = -58.4399;
+
+    struct Shape {
+        bool keep_in;
+        std::vector<double> x, y;   // m east/north of the origin
+    };
+
+    std::vector<Shape> shapes;
+
+    // keep_in_vertices on the ring, and islands of island_vertices each
+    FenceShapes(int keep_in_vertices, int islands, int island_vertices, double radius = 2000.0) {
+        std::mt19937 random(11);
+        std::uniform_real_distribution<double> jitter(0.85, 1.0);
+        shapes.push_back(ring(true, 0, 0, radius, keep_in_vertices, random, jitter));
+        for (int i = 0; i < islands; i++) {
+            double angle = 2 * M_PI * i / islands;
+            shapes.push_back(ring(false, 0.5 * radius * cos(angle), 0.5 * radius * sin(angle), 0.15 * radius,
+                                  island_vertices, random, jitter));
+        }
+    }
+
+    std::string text() const {
+        std::string out;
+        char line[64];
+        for (const Shape& shape : shapes) {
+            out += shape.keep_in ? "in\n" : "out\n";
+            for (size_t i = 0; i < shape.x.size(); i++) {
+                snprintf(line, sizeof(line), "%.8f,%.8f\n", latitude(shape.y[i]), longitude(shape.x[i]));
+                out += line;
+            }
+        }
+        return out;
+    }
+
+    static double latitude(double north) { return ORIGIN_LATITUDE + north / 111320.0; }
+    static double longitude(double east) { return ORIGIN_LONGITUDE + east / metersPerDegLon(); }
+    static double metersPerDegLon() { return 111320.0 * cos(ORIGIN_LATITUDE * M_PI / 180.0); }
+
+    // Reference answer: inside a keep-in (if any) and outside every keep-out; a full
+    // even-odd scan of every edge. Sets margin to the distance to the nearest edge.
+    bool allowed(double x, double y, double& margin) const {
+        bool has_keep_in = false, in_keep_in = false, in_keep_out = false;
+        margin = 1e9;
+        for (const Shape& shape : shapes) {
+            bool inside = false;
+            size_t n = shape.x.size();
+            for (size_t i = 0, j = n - 1; i < n; j = i++) {
+                if ((shape.y[i] > y) != (shape.y[j] > y)
+                    && x < shape.x[i] + (y - shape.y[i]) * (shape.x[j] - shape.x[i]) / (shape.y[j] - shape.y[i])) {
+                    inside = !inside;
+                }
+                margin = fmin(margin, segmentDistance(x, y, shape.x[j], shape.y[j], shape.x[i], shape.y[i]));
+            }
+            has_keep_in |= shape.keep_in;
+            in_keep_in |= shape.keep_in && inside;
+            in_keep_out |= !shape.keep_in && inside;
+        }
+        return (!has_keep_in || in_keep_in) && !in_keep_out;
+    }
+
+private:
+    static Shape ring(bool keep_in, double cx, double cy, double radius, int vertices,
+                      std::mt19937& random, std::uniform_real_distribution<double>& jitter) {
+        Shape shape;
+        shape.keep_in = keep_in;
+        for (int i = 0; i < vertices; i++) {
+            double angle = 2 * M_PI * i / vertices;
+            double r = radius * jitter(random);
+            shape.x.push_back(cx + r * cos(angle));
+            shape.y.push_back(cy + r * sin(angle));
+        }
+        return shape;
+    }
+
+    static double segmentDistance(double px, double py, double ax, double ay, double bx, double by) {
+        double dx = bx - ax, dy = by - ay;
+        double t = ((px - ax) * dx + (py - ay) * dy) / (dx * dx + dy * dy);
+        t = fmax(0.0, fmin(1.0, t));
+        return hypot(px - ax - t * dx, py - ay - t * dy);
+    }
+};
+
+#endif // HOST_FENCE_SHAPES_H
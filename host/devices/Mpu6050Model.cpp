@@ -0,0 +1,236 @@
+#include "Mpu6050Model.h"
+#include <Arduino.h>
+#include <string.h>
+
+static const uint8_t REG_SMPLRT_DIV = 0x19;
+static const uint8_t REG_CONFIG = 0x1A;
+static const uint8_t REG_GYRO_CONFIG = 0x1B;
+static const uint8_t REG_ACCEL_CONFIG = 0x1C;
+static const uint8_t REG_FIFO_EN = 0x23;
+static const uint8_t REG_INT_ENABLE = 0x38;
+static const uint8_t REG_INT_STATUS = 0x3A;
+static const uint8_t REG_ACCEL_OUT = 0x3B;         // Through GYRO_ZOUT_L at 0x48
+static const uint8_t REG_USER_CTRL = 0x6A;
+static const uint8_t REG_PWR_MGMT_1 = 0x6B;
+static const uint8_t REG_FIFO_COUNT_H = 0x72;
+static const uint8_t REG_FIFO_COUNT_L = 0x73;
+static const uint8_t REG_FIFO_R_W = 0x74;
+static const uint8_t REG_WHO_AM_I = 0x75;
+
+static const uint8_t FIFO_EN_ACCEL_GYRO = 0x78;
+static const uint8_t USER_CTRL_FIFO_EN = 0x40;
+static const uint8_t USER_CTRL_FIFO_RESET = 0x04;
+static const uint8_t PWR_MGMT_1_RESET = 0x80;
+static const uint8_t PWR_MGMT_1_SLEEP = 0x40;
+static const uint8_t INT_DATA_RDY = 0x01;
+static const uint8_t INT_FIFO_OFLOW = 0x10;
+
+static int16_t saturate(float value) {
+    if (value > 32767.0f) return 32767;
+    if (value < -32768.0f) return -32768;
+    return (int16_t)lroundf(value);
+}
+
+Mpu6050Model::Mpu6050Model()
+    : temperature(25.0f), next_sample_us(0), int_pin(-1), interrupt_event(0), samples(0), fifo_overflows(0) {
+    motion = [](uint64_t, float accel[3], float gyro[3]) {
+        accel[0] = 0.0f;
+        accel[1] = 0.0f;
+        accel[2] = 9.80665f;
+        gyro[0] = gyro[1] = gyro[2] = 0.0f;
+    };
+    powerOnReset();
+}
+
+Mpu6050Model::~Mpu6050Model() {
+    if (interrupt_event != 0) {
+        host::cancel(interrupt_event);
+    }
+}
+
+void Mpu6050Model::powerOnReset() {
+    memset(registers, 0, sizeof(registers));
+    registers[REG_PWR_MGMT_1] = PWR_MGMT_1_SLEEP;
+    registers[REG_WHO_AM_I] = 0x68;
+    pointer = 0;
+    fifo.clear();
+    next_sample_us = host::nowMicros();
+}
+
+// The 1 kHz internal rate applies with the DLPF on; off, the gyro runs at 8 kHz
+uint32_t Mpu6050Model::samplePeriodUs() const {
+    uint32_t base_us = (registers[REG_CONFIG] & 0x07) == 0 || (registers[REG_CONFIG] & 0x07) == 7 ? 125 : 1000;
+    return base_us * (1 + registers[REG_SMPLRT_DIV]);
+}
+
+void Mpu6050Model::catchUp() {
+    uint64_t now = host::nowMicros();
+    if (registers[REG_PWR_MGMT_1] & PWR_MGMT_1_SLEEP) {
+        next_sample_us = now;
+        return;
+    }
+    uint32_t period = samplePeriodUs();
+    // After a long gap only the last FIFO's worth of samples can matter
+    uint64_t horizon = (uint64_t)period * (FIFO_SIZE / 12 + 2);
+    if (now > next_sample_us + horizon) {
+        uint64_t skipped = (now - horizon - next_sample_us) / period;
+        if (registers[REG_USER_CTRL] & USER_CTRL_FIFO_EN && skipped > 0) {
+            registers[REG_INT_STATUS] |= INT_FIFO_OFLOW;
+        }
+        next_sample_us += skipped * period;
+        samples += (uint32_t)skipped;
+    }
+    while (next_sample_us <= now) {
+        takeSample(next_sample_us);
+        next_sample_us += period;
+    }
+}
+
+void Mpu6050Model::takeSample(uint64_t t_us) {
+    float accel[3], gyro[3];
+    motion(t_us, accel, gyro);
+
+    uint8_t accel_range = (registers[REG_ACCEL_CONFIG] >> 3) & 0x03;
+    uint8_t gyro_range = (registers[REG_GYRO_CONFIG] >> 3) & 0x03;
+    float accel_lsb = 16384.0f / (float)(1 << accel_range) / 9.80665f;      // LSB per m/s²
+    float gyro_lsb = 131.0f / (float)(1 << gyro_range) * 57.2957795f;       // LSB per rad/s
+
+    int16_t raw[7];
+    for (int i = 0; i < 3; i++) {
+        raw[i] = saturate(accel[i] * accel_lsb);
+        raw[4 + i] = saturate(gyro[i] * gyro_lsb);
+    }
+    raw[3] = saturate((temperature - 36.53f) * 340.0f);
+    for (int i = 0; i < 7; i++) {
+        registers[REG_ACCEL_OUT + 2 * i] = (uint8_t)((uint16_t)raw[i] >> 8);
+        registers[REG_ACCEL_OUT + 2 * i + 1] = (uint8_t)raw[i];
+    }
+    samples++;
+    registers[REG_INT_STATUS] |= INT_DATA_RDY;
+
+    if ((registers[REG_USER_CTRL] & USER_CTRL_FIFO_EN) && (registers[REG_FIFO_EN] & FIFO_EN_ACCEL_GYRO) == FIFO_EN_ACCEL_GYRO) {
+        if (fifo.size() + 12 > FIFO_SIZE) {
+            // Overwrites the oldest data, so the FIFO is no longer sample aligned
+            for (int i = 0; i < 12; i++) {
+                fifo.pop_front();
+            }
+            registers[REG_INT_STATUS] |= INT_FIFO_OFLOW;
+            fifo_overflows++;
+        }
+        for (int i = 0; i < 3; i++) {
+            fifo.push_back((uint8_t)((uint16_t)raw[i] >> 8));
+            fifo.push_back((uint8_t)raw[i]);
+        }
+        for (int i = 4; i < 7; i++) {
+            fifo.push_back((uint8_t)((uint16_t)raw[i] >> 8));
+            fifo.push_back((uint8_t)raw[i]);
+        }
+    }
+}
+
+void Mpu6050Model::setInterruptPin(int pin) {
+    int_pin = pin;
+    scheduleInterrupt();
+}
+
+// One event per sample, only while something can receive the pulse
+void Mpu6050Model::scheduleInterrupt() {
+    if (interrupt_event != 0) {
+        host::cancel(interrupt_event);
+        interrupt_event = 0;
+    }
+    if (int_pin < 0) {
+        return;
+    }
+    uint64_t now = host::nowMicros();
+    uint64_t delay_us = next_sample_us > now ? next_sample_us - now : 0;
+    interrupt_event = host::schedule(delay_us, [this]() {
+        interrupt_event = 0;
+        bool asleep = registers[REG_PWR_MGMT_1] & PWR_MGMT_1_SLEEP;
+        catchUp();
+        if (!asleep && (registers[REG_INT_ENABLE] & INT_DATA_RDY)) {
+            host::raiseInterrupt((uint8_t)int_pin);
+        }
+        if (asleep) {
+            next_sample_us = host::nowMicros() + 1000;
+        }
+        scheduleInterrupt();
+    });
+}
+
+bool Mpu6050Model::write(const uint8_t* data, size_t length) {
+    if (length == 0) {
+        return true;
+    }
+    catchUp();
+    pointer = data[0] & 0x7F;
+    for (size_t i = 1; i < length; i++) {
+        uint8_t reg = pointer;
+        uint8_t value = data[i];
+        if (reg == REG_PWR_MGMT_1 && (value & PWR_MGMT_1_RESET)) {
+            powerOnReset();
+            continue;
+        }
+        if (reg == REG_USER_CTRL && (value & USER_CTRL_FIFO_RESET)) {
+            fifo.clear();
+            value &= ~USER_CTRL_FIFO_RESET;
+        }
+        if (reg == REG_WHO_AM_I || reg == REG_INT_STATUS || reg == REG_FIFO_COUNT_H || reg == REG_FIFO_COUNT_L) {
+            // Read only
+        } else if (reg == REG_FIFO_R_W) {
+            // Writes to the FIFO are not modelled
+        } else {
+            bool was_asleep = registers[REG_PWR_MGMT_1] & PWR_MGMT_1_SLEEP;
+            registers[reg] = value;
+            if (reg == REG_PWR_MGMT_1 && was_asleep && !(value & PWR_MGMT_1_SLEEP)) {
+                next_sample_us = host::nowMicros() + samplePeriodUs();
+            }
+        }
+        if (reg != REG_FIFO_R_W) {
+            pointer = (pointer + 1) & 0x7F;
+        }
+    }
+    return true;
+}
+
+uint8_t Mpu6050Model::readRegister(uint8_t reg) {
+    switch (reg) {
+    case REG_FIFO_COUNT_H:
+        return (uint8_t)(fifo.size() >> 8);
+    case REG_FIFO_COUNT_L:
+        return (uint8_t)fifo.size();
+    case REG_FIFO_R_W: {
+        if (fifo.empty()) {
+            return 0xFF;
+        }
+        uint8_t value = fifo.front();
+        fifo.pop_front();
+        return value;
+    }
+    case REG_INT_STATUS: {
+        uint8_t status = registers[REG_INT_STATUS];
+        registers[REG_INT_STATUS] = 0;      // Cleared by reading
+        return status;
+    }
+    default:
+        return registers[reg];
+    }
+}
+
+// Burst reads auto-increment, except in the FIFO where they keep popping it
+bool Mpu6050Model::read(uint8_t* data, size_t length) {
+    catchUp();
+    uint16_t fifo_count = (uint16_t)fifo.size();
+    for (size_t i = 0; i < length; i++) {
+        if (pointer == REG_FIFO_COUNT_L && i > 0) {
+            data[i] = (uint8_t)fifo_count;  // Latched with the high byte
+            pointer++;
+            continue;
+        }
+        data[i] = readRegister(pointer);
+        if (pointer != REG_FIFO_R_W) {
+            pointer = (pointer + 1) & 0x7F;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,56 @@
+#ifndef HOST_MPU6050_MODEL_H
+#define HOST_MPU6050_MODEL_H
+
+#include <stdint.h>
+#include <deque>
+#include <functional>
+#include <Wire.h>
+#include "HostRuntime.h"
+
+// MPU6050 register model on the host I2C bus: WHO_AM_I, the range and filter
+// registers, the data registers and the 1024-byte FIFO with its overflow
+// flag. Samples are taken at 1 kHz / (1 + SMPLRT_DIV) on the virtual clock,
+// from a motion function (at rest, level, by default). With an interrupt pin
+// set, DATA_RDY pulses it when enabled in INT_ENABLE.
+class Mpu6050Model : public I2CDevice {
+public:
+    // Fills specific force (m/s²) and angular rate (rad/s) at t_us
+    typedef std::function<void(uint64_t t_us, float accel[3], float gyro[3])> Motion;
+
+    static const uint16_t FIFO_SIZE = 1024;
+
+private:
+    uint8_t registers[128];
+    uint8_t pointer;
+    std::deque<uint8_t> fifo;
+    Motion motion;
+    float temperature;
+    uint64_t next_sample_us;
+    int int_pin;
+    host::EventId interrupt_event;
+    uint32_t samples;
+    uint32_t fifo_overflows;
+
+    uint32_t samplePeriodUs() const;
+    void catchUp();                     // Takes every sample due by now
+    void takeSample(uint64_t t_us);
+    void scheduleInterrupt();
+    void powerOnReset();
+    uint8_t readRegister(uint8_t reg);
+
+public:
+    Mpu6050Model();
+    ~Mpu6050Model();
+
+    bool write(const uint8_t* data, size_t length) override;
+    bool read(uint8_t* data, size_t length) override;
+
+    void setMotion(const Motion& function) { motion = function; }
+    void setTemperature(float celsius) { temperature = celsius; }
+    void setInterruptPin(int pin);      // -1 leaves INT unconnected
+    uint32_t getSamples() const { return samples; }
+    uint32_t getFifoOverflows() const { return fifo_overflows; }
+    size_t getFifoLevel() { catchUp(); return fifo.size(); }
+};
+
+#endif // HOST_MPU6050_MODEL_H
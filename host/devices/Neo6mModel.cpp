@@ -0,0 +1,335 @@
+#include "Neo6mModel.h"
+#include <math.h>
+#include <stdio.h>
+
+static const uint32_t POWER_ON_BAUD = 9600;
+static const size_t RX_FIFO_THRESHOLD = 120;
+static const uint32_t TX_POLL_US = 2000;
+static const uint64_t GPS_EPOCH_UNIX = 315964800;      // 1980-01-06
+static const uint32_t GPS_LEAP_SECONDS = 18;
+static const uint8_t NAV_IDS[4] = { 0x02, 0x06, 0x12, 0x21 };
+
+namespace {
+
+struct CivilTime {
+    int year, month, day, hour, minute, second, millisecond;
+};
+
+// Howard Hinnant's days-to-civil
+CivilTime toCivil(uint64_t unix_ms) {
+    CivilTime t;
+    int64_t seconds = (int64_t)(unix_ms / 1000);
+    t.millisecond = (int)(unix_ms % 1000);
+    int64_t days = seconds / 86400;
+    int64_t rest = seconds % 86400;
+    t.hour = (int)(rest / 3600);
+    t.minute = (int)(rest / 60 % 60);
+    t.second = (int)(rest % 60);
+    days += 719468;
+    int64_t era = days / 146097;
+    int64_t doe = days - era * 146097;
+    int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int64_t mp = (5 * doy + 2) / 153;
+    t.day = (int)(doy - (153 * mp + 2) / 5 + 1);
+    t.month = (int)(mp < 10 ? mp + 3 : mp - 9);
+    t.year = (int)(yoe + era * 400 + (t.month <= 2 ? 1 : 0));
+    return t;
+}
+
+std::string ddmm(double degrees, int degree_digits) {
+    double magnitude = fabs(degrees);
+    int whole = (int)magnitude;
+    double minutes = (magnitude - whole) * 60.0;
+    char text[32];
+    snprintf(text, sizeof(text), "%0*d%08.5f", degree_digits, whole, minutes);
+    return text;
+}
+
+void putU2(std::string& out, uint16_t value) {
+    out += (char)(value & 0xFF);
+    out += (char)(value >> 8);
+}
+
+void putU4(std::string& out, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        out += (char)((value >> (8 * i)) & 0xFF);
+    }
+}
+
+}
+
+Neo6mModel::Neo6mModel(HardwareSerial& serial)
+    : serial(serial), baud(POWER_ON_BAUD), ubx_output(false), ubx_supported(true), measurement_ms(1000),
+      start_unix(1717243200), line_free_us(0), epoch_event(0), poll_event(0), running(false), epochs(0), acks(0) {
+    for (bool& enabled : nav_enabled) {
+        enabled = false;
+    }
+    Fix fix = { true, 51.5072, -0.1276, 15.0, 0.0, 0.0, 8, 1.1 };
+    setFix(fix);
+}
+
+Neo6mModel::~Neo6mModel() {
+    stop();
+}
+
+void Neo6mModel::setFix(const Fix& fix) {
+    source = [fix](uint64_t) { return fix; };
+}
+
+void Neo6mModel::start() {
+    stop();
+    running = true;
+    baud = POWER_ON_BAUD;
+    ubx_output = false;
+    for (bool& enabled : nav_enabled) {
+        enabled = false;
+    }
+    measurement_ms = 1000;
+    tx_pending.clear();
+    line_free_us = host::nowMicros();
+    scheduleEpoch();
+    poll_event = host::schedule(TX_POLL_US, [this]() { pollTransmit(); });
+}
+
+void Neo6mModel::stop() {
+    if (!running) {
+        return;
+    }
+    running = false;
+    host::cancel(epoch_event);
+    host::cancel(poll_event);
+}
+
+// Solutions are aligned to the measurement period in UTC
+void Neo6mModel::scheduleEpoch() {
+    uint64_t now = host::nowMicros();
+    uint64_t period_us = (uint64_t)measurement_ms * 1000;
+    uint64_t next = (now / period_us + 1) * period_us;
+    epoch_event = host::schedule(next - now, [this]() { emitEpoch(); });
+}
+
+void Neo6mModel::emitEpoch() {
+    uint64_t t_us = host::nowMicros();
+    Fix fix = source(t_us);
+    epochs++;
+    if (ubx_output) {
+        sendUbxEpoch(fix, t_us);
+    } else {
+        sendBytes(nmeaEpoch(fix, t_us));
+    }
+    scheduleEpoch();
+}
+
+// 10 bits a byte on the line; each chunk raises the UART event when its last byte is in
+void Neo6mModel::sendBytes(const std::string& bytes) {
+    uint64_t now = host::nowMicros();
+    if (line_free_us < now) {
+        line_free_us = now;
+    }
+    uint32_t sent_at_baud = baud;
+    for (size_t offset = 0; offset < bytes.size(); offset += RX_FIFO_THRESHOLD) {
+        std::string chunk = bytes.substr(offset, RX_FIFO_THRESHOLD);
+        line_free_us += chunk.size() * 10ULL * 1000000ULL / baud;
+        host::schedule(line_free_us - now, [this, chunk, sent_at_baud]() {
+            if (serial.baudRate() == sent_at_baud) {
+                serial.deliver((const uint8_t*)chunk.data(), chunk.size());
+            }
+        });
+    }
+}
+
+void Neo6mModel::sendUbx(uint8_t message_class, uint8_t message_id, const std::string& payload) {
+    std::string frame;
+    frame += (char)0xB5;
+    frame += (char)0x62;
+    frame += (char)message_class;
+    frame += (char)message_id;
+    putU2(frame, (uint16_t)payload.size());
+    frame += payload;
+    uint8_t a = 0, b = 0;
+    for (size_t i = 2; i < frame.size(); i++) {
+        a += (uint8_t)frame[i];
+        b += a;
+    }
+    frame += (char)a;
+    frame += (char)b;
+    sendBytes(frame);
+}
+
+void Neo6mModel::pollTransmit() {
+    std::string transmitted = serial.takeTransmitted();
+    if (serial.baudRate() == baud) {
+        tx_pending += transmitted;
+    }
+
+    // Whole UBX frames; anything else (NMEA input) is ignored
+    for (;;) {
+        size_t sync = tx_pending.find("\xB5\x62");
+        if (sync == std::string::npos) {
+            tx_pending.clear();
+            break;
+        }
+        tx_pending.erase(0, sync);
+        if (tx_pending.size() < 8) {
+            break;
+        }
+        uint16_t length = (uint8_t)tx_pending[4] | (uint16_t)(uint8_t)tx_pending[5] << 8;
+        if (tx_pending.size() < 8u + length) {
+            break;
+        }
+        uint8_t a = 0, b = 0;
+        for (size_t i = 2; i < 6u + length; i++) {
+            a += (uint8_t)tx_pending[i];
+            b += a;
+        }
+        if (a == (uint8_t)tx_pending[6 + length] && b == (uint8_t)tx_pending[7 + length]) {
+            std::string frame = tx_pending.substr(0, 8 + length);
+            tx_pending.erase(0, 8 + length);
+            handleFrame((uint8_t)frame[2], (uint8_t)frame[3], (const uint8_t*)frame.data() + 6, length);
+        } else {
+            tx_pending.erase(0, 2);
+        }
+    }
+    poll_event = host::schedule(TX_POLL_US, [this]() { pollTransmit(); });
+}
+
+void Neo6mModel::handleFrame(uint8_t message_class, uint8_t message_id, const uint8_t* payload, uint16_t length) {
+    if (!ubx_supported || message_class != 0x06) {
+        return;
+    }
+    bool ok = false;
+    bool acknowledge = true;
+    if (message_id == 0x00 && length == 20 && payload[0] == 1) {            // CFG-PRT, UART1
+        uint32_t new_baud = payload[8] | payload[9] << 8 | payload[10] << 16 | (uint32_t)payload[11] << 24;
+        ubx_output = (payload[14] & 0x01) != 0;
+        baud = new_baud;
+        acknowledge = false;        // Sent at the new baud, if at all
+        ok = true;
+    } else if (message_id == 0x01 && length == 3 && payload[0] == 0x01) {    // CFG-MSG
+        for (int i = 0; i < 4; i++) {
+            if (payload[1] == NAV_IDS[i]) {
+                nav_enabled[i] = payload[2] != 0;
+                ok = true;
+            }
+        }
+    } else if (message_id == 0x08 && length == 6) {                          // CFG-RATE
+        uint16_t period = payload[0] | payload[1] << 8;
+        ok = period >= 200;         // 5 Hz at most
+        if (ok) {
+            measurement_ms = period;
+            host::cancel(epoch_event);
+            scheduleEpoch();
+        }
+    }
+    if (acknowledge) {
+        std::string ack;
+        ack += (char)message_class;
+        ack += (char)message_id;
+        sendUbx(0x05, ok ? 0x01 : 0x00, ack);
+        acks++;
+    }
+}
+
+std::string Neo6mModel::nmeaSentence(const std::string& body) {
+    uint8_t checksum = 0;
+    for (char c : body) {
+        checksum ^= (uint8_t)c;
+    }
+    char tail[8];
+    snprintf(tail, sizeof(tail), "*%02X\r\n", checksum);
+    return "$" + body + tail;
+}
+
+std::string Neo6mModel::nmeaEpoch(const Fix& fix, uint64_t t_us) const {
+    CivilTime t = toCivil(start_unix * 1000 + t_us / 1000);
+    char time[48], date[40];
+    snprintf(time, sizeof(time), "%02d%02d%02d.%02d", t.hour, t.minute, t.second, t.millisecond / 10);
+    snprintf(date, sizeof(date), "%02d%02d%02d", t.day, t.month, t.year % 100);
+    std::string lat = fix.valid ? ddmm(fix.latitude, 2) : "";
+    std::string ns = fix.valid ? (fix.latitude < 0 ? "S" : "N") : "";
+    std::string lon = fix.valid ? ddmm(fix.longitude, 3) : "";
+    std::string ew = fix.valid ? (fix.longitude < 0 ? "W" : "E") : "";
+    char number[64];
+
+    std::string out;
+    snprintf(number, sizeof(number), "%.3f,%.2f", fix.speed_knots, fix.course);
+    std::string speed_course = fix.valid ? number : ",";
+    out += nmeaSentence(std::string("GPRMC,") + time + "," + (fix.valid ? "A" : "V") + "," + lat + "," + ns + "," + lon +
+                        "," + ew + "," + speed_course + "," + date + ",,,A");
+
+    snprintf(number, sizeof(number), "%.2f,T,,M,%.3f,N,%.3f,K", fix.course, fix.speed_knots, fix.speed_knots * 1.852);
+    out += nmeaSentence(std::string("GPVTG,") + (fix.valid ? number : ",T,,M,,N,,K") + ",A");
+
+    char gga_tail[64];
+    snprintf(gga_tail, sizeof(gga_tail), "%02u,%.2f,%.1f,M,46.9,M,,", fix.satellites, fix.hdop, fix.altitude);
+    out += nmeaSentence(std::string("GPGGA,") + time + "," + lat + "," + ns + "," + lon + "," + ew + "," +
+                        (fix.valid ? "1," : "0,") + (fix.valid ? gga_tail : "00,99.99,,,,,,"));
+
+    snprintf(number, sizeof(number), "%.2f,%.2f,%.2f", fix.hdop * 1.6, fix.hdop, fix.hdop * 1.3);
+    out += nmeaSentence(std::string("GPGSA,A,") + (fix.valid ? "3" : "1") + ",02,05,12,13,15,18,21,25,,,,," +
+                        (fix.valid ? number : "99.99,99.99,99.99"));
+
+    out += nmeaSentence(std::string("GPGLL,") + lat + "," + ns + "," + lon + "," + ew + "," + time + "," +
+                        (fix.valid ? "A,A" : "V,N"));
+    return out;
+}
+
+void Neo6mModel::sendUbxEpoch(const Fix& fix, uint64_t t_us) {
+    uint64_t unix_ms = start_unix * 1000 + t_us / 1000;
+    CivilTime t = toCivil(unix_ms);
+    uint32_t itow = (uint32_t)(((unix_ms / 1000 - GPS_EPOCH_UNIX + GPS_LEAP_SECONDS) % 604800) * 1000 + unix_ms % 1000);
+
+    std::string payload;
+
+    if (nav_enabled[0]) {       // NAV-POSLLH
+        payload.clear();
+        putU4(payload, itow);
+        putU4(payload, (uint32_t)(int32_t)lround(fix.longitude * 1e7));
+        putU4(payload, (uint32_t)(int32_t)lround(fix.latitude * 1e7));
+        putU4(payload, (uint32_t)(int32_t)lround((fix.altitude + 46.9) * 1000));
+        putU4(payload, (uint32_t)(int32_t)lround(fix.altitude * 1000));
+        putU4(payload, fix.valid ? 2500 : 0xFFFFFFFF);
+        putU4(payload, fix.valid ? 4000 : 0xFFFFFFFF);
+        sendUbx(0x01, 0x02, payload);
+    }
+    if (nav_enabled[1]) {       // NAV-SOL
+        payload.assign(52, '\0');
+        std::string head;
+        putU4(head, itow);
+        payload.replace(0, 4, head);
+        payload[10] = (char)(fix.valid ? 3 : 0);
+        payload[11] = (char)(fix.valid ? 0x0D : 0x0C);
+        payload[47] = (char)fix.satellites;
+        sendUbx(0x01, 0x06, payload);
+    }
+    if (nav_enabled[2]) {       // NAV-VELNED
+        double speed_cms = fix.speed_knots * 51.444444;
+        double course = fix.course * M_PI / 180.0;
+        payload.clear();
+        putU4(payload, itow);
+        putU4(payload, (uint32_t)(int32_t)lround(speed_cms * cos(course)));
+        putU4(payload, (uint32_t)(int32_t)lround(speed_cms * sin(course)));
+        putU4(payload, 0);
+        putU4(payload, (uint32_t)lround(speed_cms));
+        putU4(payload, (uint32_t)lround(speed_cms));
+        putU4(payload, (uint32_t)(int32_t)lround(fix.course * 1e5));
+        putU4(payload, 50);
+        putU4(payload, 100000);
+        sendUbx(0x01, 0x12, payload);
+    }
+    if (nav_enabled[3]) {       // NAV-TIMEUTC
+        payload.clear();
+        putU4(payload, itow);
+        putU4(payload, 30);
+        putU4(payload, (uint32_t)(t.millisecond * 1000000));
+        putU2(payload, (uint16_t)t.year);
+        payload += (char)t.month;
+        payload += (char)t.day;
+        payload += (char)t.hour;
+        payload += (char)t.minute;
+        payload += (char)t.second;
+        payload += (char)0x07;      // validTOW, validWKN, validUTC
+        sendUbx(0x01, 0x21, payload);
+    }
+}
@@ -0,0 +1,80 @@
+#ifndef HOST_NEO6M_MODEL_H
+#define HOST_NEO6M_MODEL_H
+
+#include <stdint.h>
+#include <string>
+#include <functional>
+#include <HardwareSerial.h>
+#include "HostRuntime.h"
+
+// NEO-6M on a UART stand-in. Powers up sending NMEA (RMC, VTG, GGA, GSA, GLL)
+// once a second at 9600 baud; bytes arrive paced at the line rate, in chunks
+// of at most the 120-byte RX FIFO threshold. It reads what the firmware
+// transmits and follows UBX CFG-PRT (baud and output protocol, applied
+// without an acknowledgement), CFG-MSG (NAV-POSLLH/SOL/VELNED/TIMEUTC) and
+// CFG-RATE (up to 5 Hz), acknowledging the last two. Either end talking at
+// the wrong baud is heard as nothing.
+class Neo6mModel {
+public:
+    struct Fix {
+        bool valid;
+        double latitude;            // Degrees, negative south
+        double longitude;           // Degrees, negative west
+        double altitude;            // m above MSL
+        double speed_knots;
+        double course;              // Degrees true
+        uint8_t satellites;
+        double hdop;
+    };
+
+    // The solution for virtual time t_us
+    typedef std::function<Fix(uint64_t t_us)> Source;
+
+private:
+    HardwareSerial& serial;
+    Source source;
+    uint32_t baud;
+    bool ubx_output;
+    bool ubx_supported;
+    bool nav_enabled[4];            // POSLLH, SOL, VELNED, TIMEUTC
+    uint16_t measurement_ms;
+    uint64_t start_unix;            // UTC at virtual time 0
+    uint64_t line_free_us;          // When the last queued byte finishes arriving
+    std::string tx_pending;         // Partial UBX frame from the firmware
+    host::EventId epoch_event;
+    host::EventId poll_event;
+    bool running;
+    uint32_t epochs;
+    uint32_t acks;
+
+    void scheduleEpoch();
+    void emitEpoch();
+    void pollTransmit();
+    void handleFrame(uint8_t message_class, uint8_t message_id, const uint8_t* payload, uint16_t length);
+    void sendBytes(const std::string& bytes);
+    void sendUbx(uint8_t message_class, uint8_t message_id, const std::string& payload);
+    std::string nmeaEpoch(const Fix& fix, uint64_t t_us) const;
+    void sendUbxEpoch(const Fix& fix, uint64_t t_us);
+
+public:
+    explicit Neo6mModel(HardwareSerial& serial);
+    ~Neo6mModel();
+
+    void start();                   // Power on: NMEA at 9600 baud
+    void stop();
+
+    void setSource(const Source& function) { source = function; }
+    void setFix(const Fix& fix);    // A constant solution
+    void setUbxSupported(bool supported) { ubx_supported = supported; }   // false: CFG messages are ignored
+    void setStartTime(uint64_t unix_seconds) { start_unix = unix_seconds; }
+
+    uint32_t getBaud() const { return baud; }
+    bool isUbxOutput() const { return ubx_output; }
+    uint16_t getMeasurementMs() const { return measurement_ms; }
+    uint32_t getEpochs() const { return epochs; }
+    uint32_t getAcks() const { return acks; }
+
+    static std::string nmeaSentence(const std::string& body);     // Adds $, checksum and CRLF
+};
+
+#endif // HOST_NEO6M_MODEL_H
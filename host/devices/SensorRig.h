@@ -0,0 +1,32 @@
+#ifndef HOST_SENSOR_RIG_H
+#define HOST_SENSOR_RIG_H
+
+#include <Wire.h>
+#include <HardwareSerial.h>
+#include "Mpu6050Model.h"
+#include "Bmp280Model.h"
+#include "Neo6mModel.h"
+
+// The Jorge board's sensors: MPU6050 at 0x68 and BMP280 at 0x76 on Wire,
+// NEO-6M on Serial2. Attached on construction; start() powers the receiver
+// up, and must follow host::reset(), which drops its scheduled output.
+class SensorRig {
+public:
+    Mpu6050Model mpu;
+    Bmp280Model bmp;
+    Neo6mModel gps;
+
+    SensorRig() : gps(Serial2) {
+        Wire.attach(0x68, &mpu);
+        Wire.attach(0x76, &bmp);
+    }
+
+    ~SensorRig() {
+        Wire.detach(0x68);
+        Wire.detach(0x76);
+    }
+
+    void start() { gps.start(); }
+};
+
+#endif // HOST_SENSOR_RIG_H
@@ -0,0 +1,20 @@
+// The sketch compiled as an ordinary translation unit. It already includes
+// Arduino.h and defines everything before use, so no .ino preprocessing is needed.
+#include "main.ino"
+
+#include "Firmware.h"
+
+static void loopTask(void* /* param */) {
+    setup();
+    for (;;) {
+        loop();
+    }
+}
+
+namespace host {
+
+void bootFirmware() {
+    xTaskCreatePinnedToCore(loopTask, "loopTask", 8192, NULL, 1, NULL, 1);
+}
+
+}
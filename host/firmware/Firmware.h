@@ -0,0 +1,50 @@
+#ifndef HOST_FIRMWARE_H
+#define HOST_FIRMWARE_H
+
+// The sketch (main/main.ino) as a host library: its globals, and the loopTask
+// the arduino-esp32 core would start. Link aleph_firmware for the hardware
+// build (sensors on the bus and UART, see devices/SensorRig.h) or
+// aleph_firmware_sim for SIMULATION_ENABLED.
+
+#include <Arduino.h>
+#include "SensorModule.h"
+#include "ActuatorModule.h"
+#include "WebModule.h"
+#include "ProfilerModule.h"
+#include "FlightRecorder.h"
+#include "TelemetryDownlink.h"
+#include "ControlUplink.h"
+#include "HeadingController.h"
+#include "MissionEngine.h"
+#include "Geofence.h"
+#include "BootSequence.h"
+#include "Simulator.h"
+
+extern SensorModule sensor_module;
+extern ActuatorModule actuator_module;
+extern WebModule web_module;
+extern ProfilerModule sensor_profiler;
+extern ProfilerModule web_profiler;
+extern TelemetryDownlink telemetry_downlink;
+extern ControlUplink control_uplink;
+extern FlightRecorder flight_recorder;
+extern HeadingController autopilot;
+extern MissionEngine mission;
+extern Geofence geofence;
+extern BootSequence boot;
+#if SIMULATION_ENABLED
+extern Simulator simulator;
+#endif
+
+void setup();
+void loop();
+
+namespace host {
+
+// Creates loopTask (priority 1, core 1), which runs setup() and then loop()
+// for ever, as the arduino-esp32 core does. Call after host::reset().
+void bootFirmware();
+
+}
+
+#endif // HOST_FIRMWARE_H
@@ -0,0 +1,66 @@
+#include "Arduino.h"
+#include "HostRuntime.h"
+#include <random>
+
+EspClass ESP;
+
+static std::mt19937 generator(1);   // Fixed seed: host runs are reproducible
+
+#if defined(__GLIBC__) && (__GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38))
+size_t strlcpy(char* dst, const char* src, size_t size) {
+    size_t length = strlen(src);
+    if (size > 0) {
+        size_t copied = length < size - 1 ? length : size - 1;
+        memcpy(dst, src, copied);
+        dst[copied] = '\0';
+    }
+    return length;
+}
+#endif
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    if (in_max == in_min) {
+        return out_min;
+    }
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+long random(long howbig) {
+    if (howbig <= 0) {
+        return 0;
+    }
+    return (long)(generator() % (unsigned long)howbig);
+}
+
+long random(long howsmall, long howbig) {
+    if (howsmall >= howbig) {
+        return howsmall;
+    }
+    return random(howbig - howsmall) + howsmall;
+}
+
+void randomSeed(unsigned long seed) {
+    generator.seed(seed);
+}
+
+uint32_t EspClass::getCycleCount() {
+    return (uint32_t)(host::nowMicros() * 240);
+}
+
+// The ESP32's DRAM heap is nowhere near the host's; report a plausible fixed figure
+uint32_t EspClass::getFreeHeap() {
+    return 180 * 1024;
+}
+
+uint32_t EspClass::getMinFreeHeap() {
+    return 160 * 1024;
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+    return 110 * 1024;
+}
+
+void EspClass::restart() {
+    fprintf(stderr, "ESP.restart() called\n");
+    exit(3);
+}
@@ -0,0 +1,80 @@
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <memory>
+#include <string>
+#include "Stream.h"
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+enum SeekMode {
+    SeekSet = 0,
+    SeekCur = 1,
+    SeekEnd = 2,
+};
+
+namespace fs {
+
+class FSImpl;
+struct FileImpl;
+
+// Handle to an open file or directory of a host file system; copies share it
+class File : public Stream {
+private:
+    std::shared_ptr<FileImpl> impl;
+
+public:
+    File() {}
+    explicit File(const std::shared_ptr<FileImpl>& impl) : impl(impl) {}
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    size_t read(uint8_t* buffer, size_t size);
+    int peek() override;
+    size_t readBytes(char* buffer, size_t length) override { return read((uint8_t*)buffer, length); }
+    using Stream::readBytes;
+    void flush() override {}
+    bool seek(uint32_t position, SeekMode mode = SeekSet);
+    size_t position() const;
+    size_t size() const;
+    void close();
+    operator bool() const;
+
+    const char* name() const;           // Without the directory, as arduino-esp32 2.x reports it
+    const char* path() const;
+    bool isDirectory() const;
+    File openNextFile(const char* mode = FILE_READ);
+    void rewindDirectory();
+};
+
+// In-memory flash partition. Space is counted the way LittleFS allocates it:
+// whole blocks per file plus two for the root directory's metadata pair.
+class FS {
+protected:
+    std::shared_ptr<FSImpl> impl;
+
+public:
+    explicit FS(const std::shared_ptr<FSImpl>& impl) : impl(impl) {}
+
+    File open(const char* path, const char* mode = FILE_READ, bool create = false);
+    File open(const String& path, const char* mode = FILE_READ, bool create = false) { return open(path.c_str(), mode, create); }
+    bool exists(const char* path);
+    bool exists(const String& path) { return exists(path.c_str()); }
+    bool remove(const char* path);
+    bool remove(const String& path) { return remove(path.c_str()); }
+    bool rename(const char* from, const char* to);
+};
+
+}
+
+using fs::File;
+using fs::FS;
+
+#endif // HOST_FS_H
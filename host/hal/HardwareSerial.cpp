@@ -0,0 +1,118 @@
+#include "HardwareSerial.h"
+#include "HostRuntime.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
+HardwareSerial Serial2(2);
+
+static const size_t DEFAULT_RX_BUFFER_SIZE = 256;
+
+HardwareSerial::HardwareSerial(int uart_number)
+    : uart_number(uart_number), baud(0), started(false), rx_buffer_size(DEFAULT_RX_BUFFER_SIZE),
+      callback_queued(false), rx_overflows(0), echo(uart_number == 0 && getenv("ALEPH_HOST_ECHO") != NULL) {}
+
+void HardwareSerial::begin(unsigned long new_baud, uint32_t config, int8_t rx_pin, int8_t tx_pin) {
+    baud = new_baud;
+    started = true;
+}
+
+void HardwareSerial::end() {
+    started = false;
+    rx.clear();
+}
+
+// Like the driver, the size only takes effect on the next begin()
+size_t HardwareSerial::setRxBufferSize(size_t size) {
+    if (started) {
+        return 0;
+    }
+    rx_buffer_size = size;
+    return size;
+}
+
+void HardwareSerial::onReceive(OnReceiveCb function, bool only_on_timeout) {
+    on_receive = function;
+}
+
+int HardwareSerial::read() {
+    if (rx.empty()) {
+        return -1;
+    }
+    uint8_t c = rx.front();
+    rx.pop_front();
+    return c;
+}
+
+size_t HardwareSerial::readBytes(char* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length && !rx.empty()) {
+        buffer[count++] = (char)rx.front();
+        rx.pop_front();
+    }
+    return count;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    tx.append((const char*)buffer, size);
+    if (echo) {
+        fwrite(buffer, 1, size, stdout);
+        fflush(stdout);
+    }
+    return size;
+}
+
+void HardwareSerial::deliver(const uint8_t* data, size_t length) {
+    if (!started) {
+        return;     // Nobody is listening on the pin
+    }
+    for (size_t i = 0; i < length; i++) {
+        if (rx.size() >= rx_buffer_size) {
+            rx_overflows++;
+            continue;
+        }
+        rx.push_back(data[i]);
+    }
+    // One event per delivery, as the driver raises one per RX FIFO threshold or timeout
+    if (on_receive && !callback_queued) {
+        callback_queued = true;
+        host::schedule(0, [this]() { runCallback(); });
+    }
+}
+
+void HardwareSerial::runCallback() {
+    callback_queued = false;
+    if (on_receive && !rx.empty()) {
+        on_receive();
+    }
+}
+
+std::string HardwareSerial::takeTransmitted() {
+    std::string out;
+    out.swap(tx);
+    return out;
+}
+
+void HardwareSerial::reset() {
+    baud = 0;
+    started = false;
+    rx_buffer_size = DEFAULT_RX_BUFFER_SIZE;
+    rx.clear();
+    tx.clear();
+    on_receive = OnReceiveCb();
+    callback_queued = false;
+    rx_overflows = 0;
+}
+
+namespace host {
+
+std::string takeSerialOutput() {
+    return Serial.takeTransmitted();
+}
+
+void setSerialEcho(bool enabled) {
+    Serial.setEcho(enabled);
+}
+
+}
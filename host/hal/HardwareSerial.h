@@ -0,0 +1,68 @@
+#ifndef HOST_HARDWARE_SERIAL_H
+#define HOST_HARDWARE_SERIAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <deque>
+#include <functional>
+#include <string>
+#include "Stream.h"
+
+// UART stand-in. The device side is the arduino-esp32 API; the host side
+// (deliver(), takeTransmitted()) is what a device model or test plays as the
+// other end of the wire. Delivered bytes land in the RX buffer (dropped when
+// it is full, as the driver would) and the onReceive() callback runs from the
+// scheduler, as it would from the UART event task.
+class HardwareSerial : public Stream {
+public:
+    typedef std::function<void(void)> OnReceiveCb;
+
+private:
+    const int uart_number;
+    uint32_t baud;
+    bool started;
+    size_t rx_buffer_size;
+    std::deque<uint8_t> rx;
+    std::string tx;
+    OnReceiveCb on_receive;
+    bool callback_queued;
+    uint32_t rx_overflows;
+    bool echo;                  // Serial: copy output to stdout
+
+    void runCallback();
+
+public:
+    explicit HardwareSerial(int uart_number);
+
+    void begin(unsigned long baud, uint32_t config = 0, int8_t rx_pin = -1, int8_t tx_pin = -1);
+    void end();
+    void updateBaudRate(unsigned long new_baud) { baud = new_baud; }
+    uint32_t baudRate() const { return baud; }
+    size_t setRxBufferSize(size_t size);
+    void onReceive(OnReceiveCb function, bool only_on_timeout = false);
+    operator bool() const { return true; }
+
+    int available() override { return (int)rx.size(); }
+    int read() override;
+    int peek() override { return rx.empty() ? -1 : rx.front(); }
+    size_t readBytes(char* buffer, size_t length) override;
+    using Stream::readBytes;
+    int availableForWrite() override { return 128; }
+
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+
+    // Host side
+    void deliver(const uint8_t* data, size_t length);       // Bytes arriving on RX
+    std::string takeTransmitted();                           // Bytes written to TX since the last call
+    uint32_t getRxOverflows() const { return rx_overflows; }
+    bool isStarted() const { return started; }
+    void setEcho(bool enabled) { echo = enabled; }
+    void reset();                                            // Back to the power-on state
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
+
+#endif // HOST_HARDWARE_SERIAL_H
@@ -0,0 +1,91 @@
+#ifndef HOST_NETWORK_H
+#define HOST_NETWORK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "IPAddress.h"
+
+// Host side of the WiFi, UDP, TCP and HTTP stand-ins: the access point and
+// the other end of every socket. Everything is loopback on the virtual clock;
+// nothing touches the host's network.
+namespace host {
+
+// ==================== ACCESS POINT ====================
+
+const IPAddress LOCAL_IP(192, 168, 4, 20);
+const IPAddress BROADCAST_IP(192, 168, 4, 255);
+const IPAddress PEER_IP(192, 168, 4, 2);
+
+// WiFi.begin() joins `join_ms` after it is called while the access point is up
+void setAccessPoint(bool available, uint32_t join_ms = 1200);
+void dropWiFi();                                // Connection lost; rejoins if auto-reconnect is on
+
+// ==================== UDP ====================
+
+struct Datagram {
+    IPAddress address;              // Destination for sent datagrams
+    uint16_t port;
+    uint16_t local_port;            // The firmware socket's port
+    std::string payload;
+};
+
+// To the firmware socket bound to `port`; false if nothing is bound there
+bool sendDatagram(uint16_t port, const void* data, size_t length, IPAddress from = PEER_IP, uint16_t from_port = 40000);
+std::vector<Datagram> takeDatagrams();          // Sent by the firmware since the last call
+
+// ==================== TCP ====================
+
+struct TcpConnection;
+
+// The remote end of a connection to a WiFiServer. The firmware's send buffer
+// (lwIP TCP_SND_BUF) only empties while the peer reads: a stalled peer lets it
+// fill, after which WiFiClient::write() blocks the calling task.
+class TcpPeer {
+private:
+    std::shared_ptr<TcpConnection> connection;
+
+public:
+    explicit TcpPeer(const std::shared_ptr<TcpConnection>& connection) : connection(connection) {}
+
+    bool isAccepted() const;                    // Taken by WiFiServer::available()
+    bool isOpen() const;                        // Neither end has closed it
+    void send(const std::string& data);
+    std::string receive();                      // What the firmware sent; drains its send buffer unless stalled
+    void setStalled(bool stalled);
+    void close();
+};
+
+// Queued on the WiFiServer listening on `port`; NULL if none is
+std::shared_ptr<TcpPeer> connectTcp(uint16_t port);
+void setTcpSendBuffer(size_t bytes);            // For connections opened from now on (default 5744)
+
+// ==================== HTTP ====================
+
+struct HttpResponse {
+    int code;
+    std::string content_type;
+    std::map<std::string, std::string> headers;
+    std::string body;
+};
+
+// Queues a request on the WebServer on `port` and runs the scheduler until it
+// has answered. `target` is the path with an optional query string.
+bool httpRequest(uint16_t port, const std::string& method, const std::string& target, HttpResponse& response,
+                 const std::string& body = "", const std::map<std::string, std::string>& headers = {},
+                 uint32_t timeout_ms = 5000);
+
+// The same without waiting: queues the request and returns its id (0 if no
+// server listens on `port`); the WebServer takes one request per handleClient()
+uint32_t queueHttpRequest(uint16_t port, const std::string& method, const std::string& target,
+                          const std::string& body = "", const std::map<std::string, std::string>& headers = {});
+bool takeHttpResponse(uint32_t id, HttpResponse& response);    // False until the request has been answered
+
+void resetNetwork();
+
+}
+
+#endif // HOST_NETWORK_H
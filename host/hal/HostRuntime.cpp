@@ -0,0 +1,607 @@
+#include "HostRuntime.h"
+#include "Arduino.h"
+#include "HostNetwork.h"
+#include "LittleFS.h"
+#include "Wire.h"
+#include <ucontext.h>
+#include <time.h>
+#include <map>
+#include <memory>
+#include <vector>
+
+// Cooperative scheduler: every task is a ucontext coroutine with its own
+// stack, switched to from the scheduler loop and back when it blocks. Blocking
+// calls made with the task marked for deletion throw TaskKilled, which unwinds
+// the task's stack back to its trampoline.
+
+struct HostTask {
+    enum State { READY, DONE };
+
+    std::string name;
+    TaskFunction_t code;
+    void* param;
+    UBaseType_t priority;
+    BaseType_t core;
+    uint32_t stack_depth;
+    std::vector<uint8_t> stack;
+    ucontext_t context;
+
+    State state;
+    uint64_t wake_us;           // Runnable once the clock reaches this
+    uint64_t order;             // FIFO among equal priority and wake time
+    bool waiting_notify;
+    uint32_t notify_count;
+    bool kill;
+};
+
+namespace {
+
+struct TaskKilled {};
+
+struct Event {
+    uint64_t time_us;
+    host::EventId id;
+    std::function<void()> callback;
+};
+
+const size_t TASK_STACK_BYTES = 1 << 20;        // Host frames are larger than on the ESP32
+const uint64_t NEVER = UINT64_MAX;
+
+uint64_t now_us = 0;
+bool charge_cpu = false;
+bool slice_open = false;
+uint64_t slice_start_ns = 0;
+
+std::vector<std::unique_ptr<HostTask>> tasks;
+HostTask* current = NULL;
+bool in_callback = false;
+ucontext_t scheduler_context;
+uint64_t next_order = 0;
+uint32_t context_switches = 0;
+
+std::multimap<uint64_t, Event> events;          // By time, then insertion
+host::EventId next_event_id = 1;
+
+int critical_depth = 0;
+uint64_t critical_start_ns = 0;
+uint64_t critical_max_ns = 0;
+uint64_t critical_count = 0;
+
+const int PIN_COUNT = 64;
+const int LEDC_CHANNELS = 16;
+int pin_levels[PIN_COUNT];
+int pin_modes[PIN_COUNT];
+void (*pin_handlers[PIN_COUNT])(void*);
+void* pin_handler_args[PIN_COUNT];
+int pin_channels[PIN_COUNT];
+uint32_t ledc_duty[LEDC_CHANNELS];
+uint32_t ledc_writes[LEDC_CHANNELS];
+
+uint64_t monotonicNanos() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void fatal(const char* message) {
+    fprintf(stderr, "host runtime: %s\n", message);
+    abort();
+}
+
+void resetPins() {
+    for (int i = 0; i < PIN_COUNT; i++) {
+        pin_levels[i] = -1;
+        pin_modes[i] = -1;
+        pin_handlers[i] = NULL;
+        pin_handler_args[i] = NULL;
+        pin_channels[i] = -1;
+    }
+    for (int i = 0; i < LEDC_CHANNELS; i++) {
+        ledc_duty[i] = 0;
+        ledc_writes[i] = 0;
+    }
+}
+
+struct PinInit {
+    PinInit() { resetPins(); }
+} pin_init;
+
+// Work done inside a task or callback moves the clock when CPU time is charged
+void openSlice() {
+    slice_open = true;
+    if (charge_cpu) {
+        slice_start_ns = monotonicNanos();
+    }
+}
+
+void closeSlice() {
+    if (slice_open && charge_cpu) {
+        now_us += (monotonicNanos() - slice_start_ns) / 1000;
+    }
+    slice_open = false;
+}
+
+void taskEntry() {
+    HostTask* task = current;
+    try {
+        task->code(task->param);
+    } catch (const TaskKilled&) {
+    }
+    // Returning from a FreeRTOS task is a bug on the target; here it ends the task
+    task->state = HostTask::DONE;
+    swapcontext(&task->context, &scheduler_context);
+}
+
+void switchTo(HostTask* task) {
+    current = task;
+    context_switches++;
+    openSlice();
+    swapcontext(&scheduler_context, &task->context);
+    closeSlice();
+    current = NULL;
+    if (task->state == HostTask::DONE) {
+        task->stack.clear();
+        task->stack.shrink_to_fit();
+    }
+}
+
+// Gives the CPU back to the scheduler until the task is due again
+void block(uint64_t wake_us) {
+    HostTask* task = current;
+    if (task == NULL) {
+        fatal(in_callback ? "blocking call from a timer or UART callback" : "blocking call outside a task");
+    }
+    if (critical_depth > 0) {
+        fatal("task blocked inside a critical section");
+    }
+    if (task->kill) {
+        throw TaskKilled();
+    }
+    task->wake_us = wake_us;
+    task->order = next_order++;
+    swapcontext(&task->context, &scheduler_context);
+    if (task->kill) {
+        throw TaskKilled();
+    }
+}
+
+HostTask* nextReadyTask() {
+    HostTask* best = NULL;
+    for (auto& task : tasks) {
+        if (task->state != HostTask::READY || task->wake_us > now_us) {
+            continue;
+        }
+        if (best == NULL || task->priority > best->priority ||
+            (task->priority == best->priority && task->order < best->order)) {
+            best = task.get();
+        }
+    }
+    return best;
+}
+
+uint64_t nextWake() {
+    uint64_t wake = events.empty() ? NEVER : events.begin()->first;
+    for (auto& task : tasks) {
+        if (task->state == HostTask::READY && task->wake_us < wake) {
+            wake = task->wake_us;
+        }
+    }
+    return wake;
+}
+
+// One event or task slice if something is due by `end_us`; false when idle until then
+bool step(uint64_t end_us) {
+    if (!events.empty() && events.begin()->first <= now_us) {
+        Event event = std::move(events.begin()->second);
+        events.erase(events.begin());
+        in_callback = true;
+        openSlice();
+        event.callback();
+        closeSlice();
+        in_callback = false;
+        return true;
+    }
+
+    HostTask* task = nextReadyTask();
+    if (task != NULL) {
+        switchTo(task);
+        return true;
+    }
+
+    uint64_t wake = nextWake();
+    if (wake > end_us) {
+        return false;
+    }
+    now_us = wake;
+    return true;
+}
+
+void killTask(HostTask* task) {
+    if (task->state == HostTask::DONE) {
+        return;
+    }
+    task->kill = true;
+    switchTo(task);
+}
+
+}
+
+// ==================== HOST API ====================
+
+namespace host {
+
+uint64_t nowMicros() {
+    if (slice_open && charge_cpu) {
+        return now_us + (monotonicNanos() - slice_start_ns) / 1000;
+    }
+    return now_us;
+}
+
+void setChargeCpuTime(bool enabled) {
+    charge_cpu = enabled;
+}
+
+bool isChargingCpuTime() {
+    return charge_cpu;
+}
+
+void runForMicros(uint64_t duration_us) {
+    if (current != NULL || in_callback) {
+        fatal("the scheduler cannot be run from firmware code");
+    }
+    uint64_t end_us = now_us + duration_us;
+    while (step(end_us)) {
+    }
+    if (now_us < end_us) {
+        now_us = end_us;
+    }
+}
+
+void runFor(uint32_t duration_ms) {
+    runForMicros((uint64_t)duration_ms * 1000);
+}
+
+bool runUntil(const std::function<bool()>& done, uint32_t timeout_ms) {
+    if (current != NULL || in_callback) {
+        fatal("the scheduler cannot be run from firmware code");
+    }
+    uint64_t end_us = now_us + (uint64_t)timeout_ms * 1000;
+    while (!done()) {
+        if (!step(end_us)) {
+            now_us = end_us;
+            return done();
+        }
+    }
+    return true;
+}
+
+EventId schedule(uint64_t delay_us, const std::function<void()>& callback) {
+    Event event;
+    event.time_us = nowMicros() + delay_us;
+    event.id = next_event_id++;
+    event.callback = callback;
+    events.emplace(event.time_us, std::move(event));
+    return next_event_id - 1;
+}
+
+void cancel(EventId id) {
+    for (auto it = events.begin(); it != events.end(); ++it) {
+        if (it->second.id == id) {
+            events.erase(it);
+            return;
+        }
+    }
+}
+
+bool inTask() {
+    return current != NULL;
+}
+
+uint32_t getTaskCount() {
+    uint32_t count = 0;
+    for (auto& task : tasks) {
+        if (task->state != HostTask::DONE) {
+            count++;
+        }
+    }
+    return count;
+}
+
+uint32_t getContextSwitches() {
+    return context_switches;
+}
+
+void reset() {
+    if (current != NULL || in_callback) {
+        fatal("reset() from firmware code");
+    }
+    for (auto& task : tasks) {
+        killTask(task.get());
+    }
+    tasks.clear();
+    events.clear();
+    now_us = 0;
+    critical_depth = 0;
+    resetCriticalSectionStats();
+    resetPins();
+    Serial.reset();
+    Serial1.reset();
+    Serial2.reset();
+    Wire.reset();
+    LittleFS.end();
+    resetNetwork();
+}
+
+uint64_t getCriticalSectionMaxNanos() {
+    return critical_max_ns;
+}
+
+uint64_t getCriticalSectionCount() {
+    return critical_count;
+}
+
+void resetCriticalSectionStats() {
+    critical_max_ns = 0;
+    critical_count = 0;
+}
+
+int pinLevel(uint8_t pin) {
+    return pin < PIN_COUNT ? pin_levels[pin] : -1;
+}
+
+int pinModeOf(uint8_t pin) {
+    return pin < PIN_COUNT ? pin_modes[pin] : -1;
+}
+
+void raiseInterrupt(uint8_t pin) {
+    if (pin < PIN_COUNT && pin_handlers[pin] != NULL) {
+        pin_handlers[pin](pin_handler_args[pin]);
+    }
+}
+
+uint32_t ledcDuty(uint8_t channel) {
+    return channel < LEDC_CHANNELS ? ledc_duty[channel] : 0;
+}
+
+uint32_t ledcWriteCount(uint8_t channel) {
+    return channel < LEDC_CHANNELS ? ledc_writes[channel] : 0;
+}
+
+int ledcChannelForPin(uint8_t pin) {
+    return pin < PIN_COUNT ? pin_channels[pin] : -1;
+}
+
+}
+
+// ==================== ARDUINO TIME ====================
+
+unsigned long millis() {
+    return (unsigned long)(uint32_t)(host::nowMicros() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)(uint32_t)host::nowMicros();
+}
+
+void delay(uint32_t ms) {
+    if (current != NULL) {
+        vTaskDelay(pdMS_TO_TICKS(ms));
+    } else if (!in_callback) {
+        host::runFor(ms);
+    } else {
+        fatal("delay() from a timer or UART callback");
+    }
+}
+
+// Busy-waits on the target; the clock simply moves on here
+void delayMicroseconds(uint32_t us) {
+    now_us += us;
+}
+
+void yield() {
+    if (current != NULL) {
+        block(now_us);
+    }
+}
+
+// ==================== GPIO AND LEDC ====================
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (pin < PIN_COUNT) {
+        pin_modes[pin] = mode;
+    }
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin < PIN_COUNT) {
+        pin_levels[pin] = value ? HIGH : LOW;
+    }
+}
+
+int digitalRead(uint8_t pin) {
+    return pin < PIN_COUNT && pin_levels[pin] > 0 ? HIGH : LOW;
+}
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg, int mode) {
+    if (pin < PIN_COUNT) {
+        pin_handlers[pin] = handler;
+        pin_handler_args[pin] = arg;
+    }
+}
+
+void detachInterrupt(uint8_t pin) {
+    if (pin < PIN_COUNT) {
+        pin_handlers[pin] = NULL;
+    }
+}
+
+uint32_t ledcSetup(uint8_t channel, uint32_t freq, uint8_t resolution_bits) {
+    return channel < LEDC_CHANNELS ? freq : 0;
+}
+
+void ledcAttachPin(uint8_t pin, uint8_t channel) {
+    if (pin < PIN_COUNT && channel < LEDC_CHANNELS) {
+        pin_channels[pin] = channel;
+    }
+}
+
+void ledcDetachPin(uint8_t pin) {
+    if (pin < PIN_COUNT) {
+        pin_channels[pin] = -1;
+    }
+}
+
+void ledcWrite(uint8_t channel, uint32_t duty) {
+    if (channel < LEDC_CHANNELS) {
+        ledc_duty[channel] = duty;
+        ledc_writes[channel]++;
+    }
+}
+
+uint32_t ledcRead(uint8_t channel) {
+    return host::ledcDuty(channel);
+}
+
+// ==================== FREERTOS ====================
+
+void hostEnterCritical(portMUX_TYPE* mux) {
+    if (critical_depth++ == 0) {
+        critical_start_ns = monotonicNanos();
+    }
+    mux->count++;
+}
+
+void hostExitCritical(portMUX_TYPE* mux) {
+    if (critical_depth <= 0 || mux->count == 0) {
+        fatal("portEXIT_CRITICAL without a matching portENTER_CRITICAL");
+    }
+    mux->count--;
+    if (--critical_depth == 0) {
+        uint64_t held_ns = monotonicNanos() - critical_start_ns;
+        critical_count++;
+        if (held_ns > critical_max_ns) {
+            critical_max_ns = held_ns;
+        }
+    }
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char* name, uint32_t stack_depth, void* param,
+                                   UBaseType_t priority, TaskHandle_t* created, BaseType_t core) {
+    std::unique_ptr<HostTask> task(new HostTask());
+    task->name = name != NULL ? name : "";
+    task->code = code;
+    task->param = param;
+    task->priority = priority;
+    task->core = core;
+    task->stack_depth = stack_depth;
+    task->stack.resize(TASK_STACK_BYTES);
+    task->state = HostTask::READY;
+    task->wake_us = now_us;
+    task->order = next_order++;
+    task->waiting_notify = false;
+    task->notify_count = 0;
+    task->kill = false;
+
+    getcontext(&task->context);
+    task->context.uc_stack.ss_sp = task->stack.data();
+    task->context.uc_stack.ss_size = task->stack.size();
+    task->context.uc_link = NULL;
+    makecontext(&task->context, taskEntry, 0);
+
+    if (created != NULL) {
+        *created = task.get();
+    }
+    tasks.push_back(std::move(task));
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char* name, uint32_t stack_depth, void* param,
+                       UBaseType_t priority, TaskHandle_t* created) {
+    return xTaskCreatePinnedToCore(code, name, stack_depth, param, priority, created, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    if (task == NULL || task == current) {
+        if (current == NULL) {
+            fatal("vTaskDelete(NULL) outside a task");
+        }
+        throw TaskKilled();
+    }
+    task->kill = true;      // Ends at its next blocking call, or when it is next switched to
+    if (task->state == HostTask::READY) {
+        task->wake_us = now_us;
+    }
+}
+
+void vTaskDelay(TickType_t ticks) {
+    block(host::nowMicros() + (uint64_t)ticks * 1000);
+}
+
+// Wakes at *previous_wake + increment; a deadline already passed does not delay
+void vTaskDelayUntil(TickType_t* previous_wake, TickType_t increment) {
+    TickType_t next = *previous_wake + increment;
+    *previous_wake = next;
+    TickType_t now = xTaskGetTickCount();
+    if ((int32_t)(next - now) > 0) {
+        block(now_us - now_us % 1000 + (uint64_t)(next - now) * 1000);
+    } else {
+        block(now_us);
+    }
+}
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)(host::nowMicros() / 1000);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return current;
+}
+
+// The host cannot see stack use; reports the configured depth as untouched
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    if (task == NULL) {
+        task = current;
+    }
+    return task != NULL ? task->stack_depth : 0;
+}
+
+BaseType_t xPortGetCoreID() {
+    return current != NULL && current->core != tskNO_AFFINITY ? current->core : 0;
+}
+
+void taskYIELD() {
+    yield();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait) {
+    HostTask* task = current;
+    if (task == NULL) {
+        fatal("ulTaskNotifyTake() outside a task");
+    }
+    if (task->notify_count == 0 && ticks_to_wait > 0) {
+        task->waiting_notify = true;
+        block(ticks_to_wait == portMAX_DELAY ? NEVER : host::nowMicros() + (uint64_t)ticks_to_wait * 1000);
+        task->waiting_notify = false;
+    }
+    uint32_t count = task->notify_count;
+    task->notify_count = clear_on_exit ? 0 : (count > 0 ? count - 1 : 0);
+    return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    if (task == NULL) {
+        return pdFAIL;
+    }
+    task->notify_count++;
+    if (task->waiting_notify && task->wake_us > now_us) {
+        task->wake_us = now_us;
+    }
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higher_priority_task_woken) {
+    xTaskNotifyGive(task);
+    if (higher_priority_task_woken != NULL) {
+        *higher_priority_task_woken = pdTRUE;
+    }
+}
@@ -0,0 +1,70 @@
+#ifndef HOST_RUNTIME_H
+#define HOST_RUNTIME_H
+
+#include <stdint.h>
+#include <functional>
+#include <string>
+
+// Host side of the HAL stand-ins: the virtual clock, the scheduler that runs
+// the firmware's FreeRTOS tasks on it, and read-back of what the firmware
+// drove (pins, LEDC duty, Serial output).
+//
+// Time only moves while the scheduler runs (runFor(), runUntil()). It jumps
+// straight to the next task wake-up, timer or scheduled event, so idle time
+// costs nothing and an hour of firmware time replays in seconds. Tasks are
+// coroutines: one runs at a time, until it blocks (vTaskDelay,
+// vTaskDelayUntil, ulTaskNotifyTake, delay). With setChargeCpuTime(true) the
+// host CPU time a task or callback spends is added to the clock as it runs,
+// so micros() deltas inside the firmware measure real work (benchmarks);
+// otherwise work is free and a run is fully deterministic (tests).
+namespace host {
+
+// ==================== CLOCK AND SCHEDULER ====================
+
+uint64_t nowMicros();                           // Virtual time since reset()
+void setChargeCpuTime(bool enabled);
+bool isChargingCpuTime();
+
+void runForMicros(uint64_t duration_us);
+void runFor(uint32_t duration_ms);
+bool runUntil(const std::function<bool()>& done, uint32_t timeout_ms);  // Checked after every task slice and event
+
+// One-shot callback on the scheduler, `delay_us` from now; runs before any
+// task due at the same time, like the esp_timer and UART event tasks
+typedef uint32_t EventId;
+EventId schedule(uint64_t delay_us, const std::function<void()>& callback);
+void cancel(EventId id);
+
+bool inTask();                                  // Called from a firmware task rather than the harness or a callback
+uint32_t getTaskCount();                        // Created and not yet deleted
+uint32_t getContextSwitches();
+
+// Kills every task, drops events, timers, pin, bus, UART and network state,
+// unmounts LittleFS (its contents stay, like flash) and winds the clock back
+// to 0. Firmware objects keep their own state.
+void reset();
+
+// ==================== CRITICAL SECTIONS ====================
+
+// portENTER_CRITICAL to portEXIT_CRITICAL, in host CPU time
+uint64_t getCriticalSectionMaxNanos();
+uint64_t getCriticalSectionCount();
+void resetCriticalSectionStats();
+
+// ==================== PINS ====================
+
+int pinLevel(uint8_t pin);                      // Last digitalWrite(), -1 if never written
+int pinModeOf(uint8_t pin);                     // -1 if never set
+void raiseInterrupt(uint8_t pin);               // Runs the handler attached with attachInterruptArg()
+uint32_t ledcDuty(uint8_t channel);
+uint32_t ledcWriteCount(uint8_t channel);
+int ledcChannelForPin(uint8_t pin);             // -1 when no channel drives the pin
+
+// ==================== SERIAL ====================
+
+std::string takeSerialOutput();                 // Everything printed to Serial since the last call
+void setSerialEcho(bool enabled);               // Copy Serial to stdout (default: $ALEPH_HOST_ECHO set)
+
+}
+
+#endif // HOST_RUNTIME_H
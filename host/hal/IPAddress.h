@@ -0,0 +1,35 @@
+#ifndef HOST_IP_ADDRESS_H
+#define HOST_IP_ADDRESS_H
+
+#include <stdint.h>
+#include "WString.h"
+
+class IPAddress {
+private:
+    uint8_t bytes[4];
+
+public:
+    IPAddress() : bytes{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : bytes{a, b, c, d} {}
+    IPAddress(uint32_t address) {       // Network order, as lwIP stores it
+        bytes[0] = address & 0xFF;
+        bytes[1] = (address >> 8) & 0xFF;
+        bytes[2] = (address >> 16) & 0xFF;
+        bytes[3] = (address >> 24) & 0xFF;
+    }
+
+    operator uint32_t() const {
+        return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+    }
+    bool operator==(const IPAddress& other) const { return (uint32_t)*this == (uint32_t)other; }
+    bool operator!=(const IPAddress& other) const { return !(*this == other); }
+    uint8_t operator[](int index) const { return bytes[index]; }
+    uint8_t& operator[](int index) { return bytes[index]; }
+
+    String toString() const {
+        return String((unsigned)bytes[0]) + "." + String((unsigned)bytes[1]) + "." +
+               String((unsigned)bytes[2]) + "." + String((unsigned)bytes[3]);
+    }
+};
+
+#endif // HOST_IP_ADDRESS_H
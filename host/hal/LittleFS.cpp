@@ -0,0 +1,308 @@
+#include "LittleFS.h"
+#include <Arduino.h>
+#include "HostRuntime.h"
+#include <algorithm>
+#include <map>
+#include <string.h>
+
+namespace fs {
+
+static const size_t BLOCK_SIZE = 4096;
+static const size_t METADATA_BLOCKS = 2;
+
+class FSImpl {
+public:
+    std::map<std::string, std::shared_ptr<std::string>> files;     // Path to contents
+    size_t capacity;
+    uint32_t format_ms;
+    bool formatted;
+    bool mounted;
+    bool fail_mount;
+
+    FSImpl() : capacity(0x160000), format_ms(0), formatted(false), mounted(false), fail_mount(false) {}
+
+    size_t usedBlocks() const {
+        size_t blocks = METADATA_BLOCKS;
+        for (auto& file : files) {
+            blocks += std::max((size_t)1, (file.second->size() + BLOCK_SIZE - 1) / BLOCK_SIZE);
+        }
+        return blocks;
+    }
+
+    // Bytes a file of `current` bytes can still grow by before the partition is full
+    size_t room(size_t current) const {
+        size_t total_blocks = capacity / BLOCK_SIZE;
+        size_t used = usedBlocks();
+        size_t slack = current == 0 ? BLOCK_SIZE : (BLOCK_SIZE - current % BLOCK_SIZE) % BLOCK_SIZE;
+        size_t free_blocks = total_blocks > used ? total_blocks - used : 0;
+        return slack + free_blocks * BLOCK_SIZE;
+    }
+};
+
+struct FileImpl {
+    std::shared_ptr<FSImpl> fs;
+    std::string path;
+    std::string name;
+    std::shared_ptr<std::string> data;      // NULL for the directory
+    size_t position;
+    bool writable;
+    bool open;
+    std::vector<std::string> listing;       // Directory entries, for openNextFile()
+    size_t listing_index;
+};
+
+static std::string normalize(const char* path) {
+    std::string normalized = path != NULL ? path : "";
+    if (normalized.empty() || normalized[0] != '/') {
+        normalized = "/" + normalized;
+    }
+    return normalized;
+}
+
+// ==================== FILE ====================
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+    if (!impl || !impl->open || !impl->writable || !impl->data) {
+        return 0;
+    }
+    std::string& data = *impl->data;
+    size_t growth = impl->position + size > data.size() ? impl->position + size - data.size() : 0;
+    size_t room = impl->fs->room(data.size());
+    if (growth > room) {
+        size = size - (growth - room);      // Partial write up to the last free block
+    }
+    if (impl->position + size > data.size()) {
+        data.resize(impl->position + size);
+    }
+    memcpy(&data[impl->position], buffer, size);
+    impl->position += size;
+    return size;
+}
+
+int File::available() {
+    if (!impl || !impl->open || !impl->data) {
+        return 0;
+    }
+    return (int)(impl->data->size() - std::min(impl->position, impl->data->size()));
+}
+
+int File::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+    size_t count = std::min(size, (size_t)available());
+    if (count > 0) {
+        memcpy(buffer, impl->data->data() + impl->position, count);
+        impl->position += count;
+    }
+    return count;
+}
+
+int File::peek() {
+    return available() > 0 ? (uint8_t)(*impl->data)[impl->position] : -1;
+}
+
+bool File::seek(uint32_t position, SeekMode mode) {
+    if (!impl || !impl->data) {
+        return false;
+    }
+    size_t base = mode == SeekSet ? 0 : mode == SeekCur ? impl->position : impl->data->size();
+    impl->position = base + position;
+    return impl->position <= impl->data->size();
+}
+
+size_t File::position() const {
+    return impl ? impl->position : 0;
+}
+
+size_t File::size() const {
+    return impl && impl->data ? impl->data->size() : 0;
+}
+
+void File::close() {
+    if (impl) {
+        impl->open = false;
+    }
+    impl.reset();
+}
+
+File::operator bool() const {
+    return impl && impl->open;
+}
+
+const char* File::name() const {
+    return impl ? impl->name.c_str() : "";
+}
+
+const char* File::path() const {
+    return impl ? impl->path.c_str() : "";
+}
+
+bool File::isDirectory() const {
+    return impl && !impl->data;
+}
+
+File File::openNextFile(const char* mode) {
+    if (!isDirectory()) {
+        return File();
+    }
+    while (impl->listing_index < impl->listing.size()) {
+        const std::string& path = impl->listing[impl->listing_index++];
+        if (impl->fs->files.count(path)) {
+            return FS(impl->fs).open(path.c_str(), mode);
+        }
+    }
+    return File();
+}
+
+void File::rewindDirectory() {
+    if (isDirectory()) {
+        impl->listing_index = 0;
+    }
+}
+
+// ==================== FS ====================
+
+File FS::open(const char* path, const char* mode, bool create) {
+    if (!impl->mounted) {
+        return File();
+    }
+    std::string normalized = normalize(path);
+    std::shared_ptr<FileImpl> file(new FileImpl());
+    file->fs = impl;
+    file->path = normalized;
+    file->name = normalized.substr(normalized.rfind('/') + 1);
+    file->position = 0;
+    file->open = true;
+    file->listing_index = 0;
+
+    if (normalized == "/") {
+        file->writable = false;
+        for (auto& entry : impl->files) {
+            file->listing.push_back(entry.first);
+        }
+        return File(file);
+    }
+
+    auto it = impl->files.find(normalized);
+    std::string how = mode != NULL ? mode : FILE_READ;
+    if (how[0] == 'r') {
+        if (it == impl->files.end()) {
+            return File();
+        }
+        file->data = it->second;
+        file->writable = how.find('+') != std::string::npos;
+        return File(file);
+    }
+
+    // "w" truncates, "a" appends; both create the file, which takes a block
+    if (it == impl->files.end()) {
+        if (impl->room(0) < BLOCK_SIZE) {
+            return File();
+        }
+        it = impl->files.emplace(normalized, std::make_shared<std::string>()).first;
+    } else if (how[0] == 'w') {
+        it->second->clear();
+    }
+    file->data = it->second;
+    file->writable = true;
+    file->position = how[0] == 'a' ? file->data->size() : 0;
+    return File(file);
+}
+
+bool FS::exists(const char* path) {
+    std::string normalized = normalize(path);
+    return impl->mounted && (normalized == "/" || impl->files.count(normalized) > 0);
+}
+
+// Open handles keep their contents, as on LittleFS
+bool FS::remove(const char* path) {
+    return impl->mounted && impl->files.erase(normalize(path)) > 0;
+}
+
+bool FS::rename(const char* from, const char* to) {
+    if (!impl->mounted) {
+        return false;
+    }
+    auto it = impl->files.find(normalize(from));
+    if (it == impl->files.end()) {
+        return false;
+    }
+    std::shared_ptr<std::string> data = it->second;
+    impl->files.erase(it);
+    impl->files[normalize(to)] = data;
+    return true;
+}
+
+// ==================== LITTLEFS ====================
+
+LittleFSFS::LittleFSFS() : FS(std::make_shared<FSImpl>()) {}
+
+bool LittleFSFS::begin(bool format_on_fail, const char* base_path, uint8_t max_open_files, const char* partition_label) {
+    if (impl->mounted) {
+        return true;
+    }
+    if (impl->fail_mount) {
+        return false;
+    }
+    if (!impl->formatted) {
+        if (!format_on_fail || !format()) {
+            return false;
+        }
+    }
+    impl->mounted = true;
+    return true;
+}
+
+void LittleFSFS::end() {
+    impl->mounted = false;
+}
+
+// Erasing the partition takes seconds; the calling task waits while the others run
+bool LittleFSFS::format() {
+    if (impl->fail_mount) {
+        return false;
+    }
+    if (impl->format_ms > 0 && host::inTask()) {
+        delay(impl->format_ms);
+    }
+    impl->files.clear();
+    impl->formatted = true;
+    return true;
+}
+
+size_t LittleFSFS::totalBytes() {
+    return impl->mounted ? impl->capacity / BLOCK_SIZE * BLOCK_SIZE : 0;
+}
+
+size_t LittleFSFS::usedBytes() {
+    return impl->mounted ? impl->usedBlocks() * BLOCK_SIZE : 0;
+}
+
+void LittleFSFS::setCapacity(size_t bytes) {
+    impl->capacity = bytes;
+}
+
+void LittleFSFS::setFormatDurationMs(uint32_t ms) {
+    impl->format_ms = ms;
+}
+
+void LittleFSFS::setMountFailure(bool fail) {
+    impl->fail_mount = fail;
+}
+
+void LittleFSFS::wipe() {
+    impl->files.clear();
+    impl->formatted = false;
+    impl->mounted = false;
+}
+
+bool LittleFSFS::isMounted() const {
+    return impl->mounted;
+}
+
+}
+
+fs::LittleFSFS LittleFS;
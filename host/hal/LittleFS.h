@@ -0,0 +1,31 @@
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+#include "FS.h"
+
+namespace fs {
+
+class LittleFSFS : public FS {
+public:
+    LittleFSFS();
+
+    bool begin(bool format_on_fail = false, const char* base_path = "/littlefs", uint8_t max_open_files = 10,
+               const char* partition_label = "spiffs");
+    void end();
+    bool format();
+    size_t totalBytes();
+    size_t usedBytes();
+
+    // Host side. The contents survive host::reset(), as flash survives a reboot.
+    void setCapacity(size_t bytes);     // Default 0x160000, the default partition table's spiffs partition
+    void setFormatDurationMs(uint32_t ms);
+    void setMountFailure(bool fail);    // Every begin() fails, as with a missing partition
+    void wipe();                        // Unformatted, as from the factory
+    bool isMounted() const;
+};
+
+}
+
+extern fs::LittleFSFS LittleFS;
+
+#endif // HOST_LITTLEFS_H
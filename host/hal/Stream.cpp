@@ -0,0 +1,56 @@
+#include "Stream.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+size_t Print::print(long number, int base) {
+    return print(String(number, (unsigned char)base));
+}
+
+size_t Print::print(unsigned long number, int base) {
+    return print(String(number, (unsigned char)base));
+}
+
+size_t Print::print(double number, int digits) {
+    return print(String(number, (unsigned int)digits));
+}
+
+size_t Print::printf(const char* format, ...) {
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < 0) {
+        return 0;
+    }
+    if ((size_t)length < sizeof(buffer)) {
+        return write((const uint8_t*)buffer, length);
+    }
+    std::string large(length + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&large[0], large.size(), format, args);
+    va_end(args);
+    return write((const uint8_t*)large.data(), length);
+}
+
+// Returns what is already buffered; nothing more can arrive while the caller runs
+size_t Stream::readBytes(char* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+        int c = read();
+        if (c < 0) {
+            break;
+        }
+        buffer[count++] = (char)c;
+    }
+    return count;
+}
+
+String Stream::readString() {
+    std::string text;
+    int c;
+    while ((c = read()) >= 0) {
+        text += (char)c;
+    }
+    return String(text);
+}
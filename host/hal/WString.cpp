@@ -0,0 +1,152 @@
+#include "WString.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <algorithm>
+
+static uint32_t allocations = 0;
+
+void String::countAllocation() {
+    allocations++;
+}
+
+uint32_t String::getAllocations() {
+    return allocations;
+}
+
+void String::resetAllocations() {
+    allocations = 0;
+}
+
+static std::string formatInteger(unsigned long magnitude, bool negative, unsigned char base) {
+    if (base < 2 || base > 36) {
+        base = 10;
+    }
+    std::string digits;
+    do {
+        unsigned digit = magnitude % base;
+        digits += (char)(digit < 10 ? '0' + digit : 'a' + digit - 10);
+        magnitude /= base;
+    } while (magnitude > 0);
+    if (negative) {
+        digits += '-';
+    }
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
+
+String::String(int number, unsigned char base) : String((long)number, base) {}
+
+String::String(unsigned int number, unsigned char base) : String((unsigned long)number, base) {}
+
+// Like the Arduino core, only base 10 prints a sign
+String::String(long number, unsigned char base)
+    : value(base == 10 && number < 0 ? formatInteger(0UL - (unsigned long)number, true, base)
+                                     : formatInteger((unsigned long)number, false, base)) {
+    countAllocation();
+}
+
+String::String(unsigned long number, unsigned char base) : value(formatInteger(number, false, base)) {
+    countAllocation();
+}
+
+String::String(float number, unsigned int decimals) : String((double)number, decimals) {}
+
+String::String(double number, unsigned int decimals) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, number);
+    value = buffer;
+    countAllocation();
+}
+
+long String::toInt() const {
+    return strtol(value.c_str(), NULL, 10);
+}
+
+float String::toFloat() const {
+    return (float)toDouble();
+}
+
+double String::toDouble() const {
+    return strtod(value.c_str(), NULL);
+}
+
+bool String::endsWith(const String& suffix) const {
+    return value.size() >= suffix.value.size() &&
+           value.compare(value.size() - suffix.value.size(), suffix.value.size(), suffix.value) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    size_t index = value.find(c, from);
+    return index == std::string::npos ? -1 : (int)index;
+}
+
+int String::indexOf(const String& text, unsigned int from) const {
+    size_t index = value.find(text.value, from);
+    return index == std::string::npos ? -1 : (int)index;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) {
+        std::swap(from, to);
+    }
+    if (from >= value.size()) {
+        return String();
+    }
+    return String(value.substr(from, std::min((size_t)to, value.size()) - from));
+}
+
+void String::trim() {
+    size_t begin = 0;
+    while (begin < value.size() && isspace((unsigned char)value[begin])) {
+        begin++;
+    }
+    size_t end = value.size();
+    while (end > begin && isspace((unsigned char)value[end - 1])) {
+        end--;
+    }
+    value = value.substr(begin, end - begin);
+}
+
+void String::toLowerCase() {
+    for (char& c : value) {
+        c = (char)tolower((unsigned char)c);
+    }
+}
+
+void String::toUpperCase() {
+    for (char& c : value) {
+        c = (char)toupper((unsigned char)c);
+    }
+}
+
+String operator+(const String& left, const String& right) {
+    String result(left);
+    result += right;
+    return result;
+}
+
+String operator+(const String& left, const char* right) {
+    String result(left);
+    result += right;
+    return result;
+}
+
+String operator+(const char* left, const String& right) {
+    String result(left);
+    result += right;
+    return result;
+}
+
+String operator+(const String& left, char right) {
+    String result(left);
+    result += right;
+    return result;
+}
+
+String operator+(const String& left, int right) { return left + String(right); }
+String operator+(const String& left, unsigned int right) { return left + String(right); }
+String operator+(const String& left, long right) { return left + String(right); }
+String operator+(const String& left, unsigned long right) { return left + String(right); }
+String operator+(const String& left, float right) { return left + String(right); }
+String operator+(const String& left, double right) { return left + String(right); }
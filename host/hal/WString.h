@@ -0,0 +1,89 @@
+#ifndef HOST_WSTRING_H
+#define HOST_WSTRING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+// Arduino String over std::string. Every construction and concatenation is
+// counted, so host benchmarks can report the heap traffic a code path causes.
+class String {
+private:
+    std::string value;
+
+public:
+    String() { countAllocation(); }
+    String(const char* text) : value(text != NULL ? text : "") { countAllocation(); }
+    String(const char* text, size_t length) : value(text, length) { countAllocation(); }
+    String(const std::string& text) : value(text) { countAllocation(); }
+    String(const String& other) : value(other.value) { countAllocation(); }
+    String(String&& other) noexcept : value(std::move(other.value)) {}
+    explicit String(char c) : value(1, c) { countAllocation(); }
+    explicit String(int number, unsigned char base = 10);
+    explicit String(unsigned int number, unsigned char base = 10);
+    explicit String(long number, unsigned char base = 10);
+    explicit String(unsigned long number, unsigned char base = 10);
+    explicit String(float number, unsigned int decimals = 2);
+    explicit String(double number, unsigned int decimals = 2);
+
+    String& operator=(const String& other) { value = other.value; countAllocation(); return *this; }
+    String& operator=(String&& other) noexcept { value = std::move(other.value); return *this; }
+    String& operator=(const char* text) { value = text != NULL ? text : ""; countAllocation(); return *this; }
+
+    String& operator+=(const String& other) { value += other.value; countAllocation(); return *this; }
+    String& operator+=(const char* text) { value += text; countAllocation(); return *this; }
+    String& operator+=(char c) { value += c; countAllocation(); return *this; }
+    String& operator+=(int number) { return *this += String(number); }
+    String& operator+=(unsigned int number) { return *this += String(number); }
+    String& operator+=(long number) { return *this += String(number); }
+    String& operator+=(unsigned long number) { return *this += String(number); }
+    String& operator+=(float number) { return *this += String(number); }
+    String& operator+=(double number) { return *this += String(number); }
+
+    bool operator==(const String& other) const { return value == other.value; }
+    bool operator==(const char* text) const { return value == (text != NULL ? text : ""); }
+    bool operator!=(const String& other) const { return !(*this == other); }
+    bool operator!=(const char* text) const { return !(*this == text); }
+    bool equals(const String& other) const { return *this == other; }
+    char operator[](size_t index) const { return index < value.size() ? value[index] : '\0'; }
+    char charAt(size_t index) const { return (*this)[index]; }
+
+    const char* c_str() const { return value.c_str(); }
+    size_t length() const { return value.size(); }
+    bool isEmpty() const { return value.empty(); }
+    long toInt() const;
+    float toFloat() const;
+    double toDouble() const;
+    bool startsWith(const String& prefix) const { return value.compare(0, prefix.value.size(), prefix.value) == 0; }
+    bool endsWith(const String& suffix) const;
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String& text, unsigned int from = 0) const;
+    String substring(unsigned int from) const { return from < value.size() ? String(value.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const;
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+    bool reserve(size_t size) { value.reserve(size); return true; }
+
+    const std::string& str() const { return value; }
+
+    // Constructions, assignments and appends since the last reset (host only)
+    static uint32_t getAllocations();
+    static void resetAllocations();
+
+private:
+    static void countAllocation();
+};
+
+String operator+(const String& left, const String& right);
+String operator+(const String& left, const char* right);
+String operator+(const char* left, const String& right);
+String operator+(const String& left, char right);
+String operator+(const String& left, int right);
+String operator+(const String& left, unsigned int right);
+String operator+(const String& left, long right);
+String operator+(const String& left, unsigned long right);
+String operator+(const String& left, float right);
+String operator+(const String& left, double right);
+
+#endif // HOST_WSTRING_H
@@ -0,0 +1,283 @@
+#include "WebServer.h"
+#include "HostRuntime.h"
+#include "LittleFS.h"
+
+namespace {
+
+// Firmware servers are globals; the registry must exist before their constructors run
+std::vector<WebServer*>& servers() {
+    static std::vector<WebServer*> registry;
+    return registry;
+}
+
+std::map<uint32_t, host::HttpResponse> completed;
+uint32_t next_request_id = 1;
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+std::string urlDecode(const std::string& text) {
+    std::string out;
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '+') {
+            out += ' ';
+        } else if (text[i] == '%' && i + 2 < text.size() && hexValue(text[i + 1]) >= 0 && hexValue(text[i + 2]) >= 0) {
+            out += (char)(hexValue(text[i + 1]) * 16 + hexValue(text[i + 2]));
+            i += 2;
+        } else {
+            out += text[i];
+        }
+    }
+    return out;
+}
+
+HTTPMethod parseMethod(const std::string& method) {
+    if (method == "POST") return HTTP_POST;
+    if (method == "PUT") return HTTP_PUT;
+    if (method == "PATCH") return HTTP_PATCH;
+    if (method == "DELETE") return HTTP_DELETE;
+    if (method == "HEAD") return HTTP_HEAD;
+    if (method == "OPTIONS") return HTTP_OPTIONS;
+    return HTTP_GET;
+}
+
+bool equalsIgnoreCase(const std::string& a, const std::string& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++) {
+        if (tolower((unsigned char)a[i]) != tolower((unsigned char)b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
+
+WebServer::WebServer(int port) : port((uint16_t)port), started(false), responded(false) {
+    servers().push_back(this);
+}
+
+WebServer::~WebServer() {
+    servers().erase(std::remove(servers().begin(), servers().end(), this), servers().end());
+}
+
+void WebServer::begin() {
+    started = true;
+}
+
+void WebServer::close() {
+    started = false;
+}
+
+void WebServer::on(const String& uri, HTTPMethod method, THandlerFunction handler) {
+    Route route;
+    route.uri = uri.str();
+    route.method = method;
+    route.handler = handler;
+    routes.push_back(route);
+}
+
+void WebServer::collectHeaders(const char* header_keys[], size_t count) {
+    collected.assign(header_keys, header_keys + count);
+}
+
+void WebServer::handleClient() {
+    if (!started || pending.empty()) {
+        return;
+    }
+    current = std::move(pending.front());
+    pending.pop_front();
+    response = host::HttpResponse();
+    response.code = 0;
+    response_headers.clear();
+    responded = false;
+
+    // Like the real server, only the headers asked for survive parsing
+    std::map<std::string, std::string> kept;
+    for (auto& header : current.headers) {
+        for (const std::string& key : collected) {
+            if (equalsIgnoreCase(header.first, key)) {
+                kept[key] = header.second;
+            }
+        }
+    }
+    current.headers.swap(kept);
+
+    const Route* match = NULL;
+    for (const Route& route : routes) {
+        if (route.uri == current.uri && (route.method == HTTP_ANY || route.method == current.method)) {
+            match = &route;
+            break;
+        }
+    }
+    if (match != NULL) {
+        match->handler();
+    } else if (not_found) {
+        not_found();
+    } else {
+        send(404, "text/plain", String("Not found: ") + current.uri.c_str());
+    }
+    if (!responded) {
+        send(500, "text/plain", "No response");
+    }
+    finish();
+}
+
+void WebServer::finish() {
+    for (auto& header : response_headers) {
+        response.headers[header.first] = header.second;
+    }
+    completed[current.id] = response;
+}
+
+bool WebServer::hasArg(const String& name) const {
+    for (auto& arg : current.args) {
+        if (arg.first == name.str()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+String WebServer::arg(const String& name) const {
+    for (auto& arg : current.args) {
+        if (arg.first == name.str()) {
+            return String(arg.second);
+        }
+    }
+    return String();
+}
+
+String WebServer::header(const String& name) const {
+    for (auto& header : current.headers) {
+        if (equalsIgnoreCase(header.first, name.str())) {
+            return String(header.second);
+        }
+    }
+    return String();
+}
+
+bool WebServer::hasHeader(const String& name) const {
+    for (auto& header : current.headers) {
+        if (equalsIgnoreCase(header.first, name.str())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void WebServer::sendHeader(const String& name, const String& value, bool first) {
+    response_headers.push_back(std::make_pair(name.str(), value.str()));
+}
+
+void WebServer::send(int code, const char* content_type, const String& content) {
+    send_P(code, content_type, content.c_str(), content.length());
+}
+
+void WebServer::send_P(int code, PGM_P content_type, PGM_P content, size_t length) {
+    if (responded) {
+        return;
+    }
+    responded = true;
+    response.code = code;
+    response.content_type = content_type != NULL ? content_type : "";
+    response.body.assign(content, length);
+}
+
+void WebServer::sendContent(const char* content, size_t length) {
+    response.body.append(content, length);
+}
+
+size_t WebServer::streamFile(File& file, const String& content_type) {
+    std::string body;
+    uint8_t buffer[512];
+    int count;
+    while ((count = file.read(buffer, sizeof(buffer))) > 0) {
+        body.append((const char*)buffer, count);
+    }
+    send_P(200, content_type.c_str(), body.data(), body.size());
+    return body.size();
+}
+
+bool WebServer::takeResponse(uint32_t id, host::HttpResponse& out) {
+    auto it = completed.find(id);
+    if (it == completed.end()) {
+        return false;
+    }
+    out = std::move(it->second);
+    completed.erase(it);
+    return true;
+}
+
+namespace host {
+
+uint32_t queueHttpRequest(uint16_t port, const std::string& method, const std::string& target,
+                          const std::string& body, const std::map<std::string, std::string>& headers) {
+    WebServer* server = NULL;
+    for (WebServer* candidate : servers()) {
+        if (candidate->getPort() == port) {
+            server = candidate;
+        }
+    }
+    if (server == NULL) {
+        return 0;
+    }
+
+    WebServer::Request request;
+    request.id = next_request_id++;
+    request.method = parseMethod(method);
+    request.headers = headers;
+    size_t query = target.find('?');
+    request.uri = target.substr(0, query);
+    if (query != std::string::npos) {
+        std::string args = target.substr(query + 1);
+        size_t start = 0;
+        while (start <= args.size()) {
+            size_t end = args.find('&', start);
+            if (end == std::string::npos) {
+                end = args.size();
+            }
+            std::string pair = args.substr(start, end - start);
+            if (!pair.empty()) {
+                size_t equals = pair.find('=');
+                request.args.push_back(std::make_pair(urlDecode(pair.substr(0, equals)),
+                                                      equals == std::string::npos ? "" : urlDecode(pair.substr(equals + 1))));
+            }
+            start = end + 1;
+        }
+    }
+    if (!body.empty()) {
+        request.args.push_back(std::make_pair(std::string("plain"), body));
+    }
+
+    server->enqueue(request);
+    return request.id;
+}
+
+bool takeHttpResponse(uint32_t id, HttpResponse& response) {
+    return WebServer::takeResponse(id, response);
+}
+
+bool httpRequest(uint16_t port, const std::string& method, const std::string& target, HttpResponse& response,
+                 const std::string& body, const std::map<std::string, std::string>& headers, uint32_t timeout_ms) {
+    uint32_t id = queueHttpRequest(port, method, target, body, headers);
+    if (id == 0) {
+        return false;
+    }
+    return runUntil([id, &response]() { return takeHttpResponse(id, response); }, timeout_ms);
+}
+
+void resetHttp() {
+    for (WebServer* server : servers()) {
+        server->clearPending();
+    }
+    completed.clear();
+}
+
+}
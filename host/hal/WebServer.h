@@ -0,0 +1,103 @@
+#ifndef HOST_WEB_SERVER_H
+#define HOST_WEB_SERVER_H
+
+// Synchronous WebServer stand-in. Requests come from host::httpRequest()
+// (HostNetwork.h) rather than sockets; handleClient() serves at most one per
+// call, as the real server does, and the response is captured whole.
+
+#include <stdint.h>
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Arduino.h"
+#include "FS.h"
+#include "HostNetwork.h"
+
+typedef enum {
+    HTTP_ANY,
+    HTTP_GET,
+    HTTP_HEAD,
+    HTTP_POST,
+    HTTP_PUT,
+    HTTP_PATCH,
+    HTTP_DELETE,
+    HTTP_OPTIONS,
+} HTTPMethod;
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+class WebServer {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    struct Request {
+        uint32_t id;
+        HTTPMethod method;
+        std::string uri;
+        std::vector<std::pair<std::string, std::string>> args;
+        std::map<std::string, std::string> headers;
+    };
+
+private:
+    struct Route {
+        std::string uri;
+        HTTPMethod method;
+        THandlerFunction handler;
+    };
+
+    uint16_t port;
+    bool started;
+    std::vector<Route> routes;
+    THandlerFunction not_found;
+    std::vector<std::string> collected;
+    std::deque<Request> pending;
+
+    // The request being served and its response
+    Request current;
+    host::HttpResponse response;
+    std::vector<std::pair<std::string, std::string>> response_headers;
+    bool responded;
+
+    void finish();
+
+public:
+    explicit WebServer(int port = 80);
+    ~WebServer();
+
+    void begin();
+    void close();
+    void handleClient();
+
+    void on(const String& uri, THandlerFunction handler) { on(uri, HTTP_ANY, handler); }
+    void on(const String& uri, HTTPMethod method, THandlerFunction handler);
+    void onNotFound(THandlerFunction handler) { not_found = handler; }
+    void collectHeaders(const char* header_keys[], size_t count);
+
+    HTTPMethod method() const { return current.method; }
+    String uri() const { return String(current.uri); }
+    bool hasArg(const String& name) const;
+    String arg(const String& name) const;
+    int args() const { return (int)current.args.size(); }
+    String header(const String& name) const;
+    bool hasHeader(const String& name) const;
+
+    void sendHeader(const String& name, const String& value, bool first = false);
+    void setContentLength(size_t length) {}
+    void send(int code, const char* content_type = NULL, const String& content = String());
+    void send(int code, const String& content_type, const String& content) { send(code, content_type.c_str(), content); }
+    void send_P(int code, PGM_P content_type, PGM_P content, size_t length);
+    void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+    void sendContent(const char* content, size_t length);
+    size_t streamFile(File& file, const String& content_type);
+
+    // Host side
+    uint16_t getPort() const { return port; }
+    void enqueue(const Request& request) { pending.push_back(request); }
+    void clearPending() { pending.clear(); }
+    static bool takeResponse(uint32_t id, host::HttpResponse& out);
+};
+
+#endif // HOST_WEB_SERVER_H
@@ -0,0 +1,469 @@
+#include "WiFi.h"
+#include "HostNetwork.h"
+#include "HostRuntime.h"
+#include "lwip/sockets.h"
+#include <algorithm>
+
+WiFiClass WiFi;
+
+namespace host {
+
+void resetHttp();       // WebServer.cpp
+
+struct TcpConnection {
+    int fd;
+    size_t send_capacity;
+    std::string to_device;          // Sent by the peer, not yet read by the firmware
+    std::string send_buffer;        // Written by the firmware, not yet read by the peer
+    std::string to_peer;            // Read by the peer, not yet taken by receive()
+    bool stalled;
+    bool accepted;
+    bool device_closed;
+    bool peer_closed;
+};
+
+}
+
+namespace {
+
+// ==================== STATION ====================
+
+bool ap_available = true;
+uint32_t ap_join_ms = 1200;
+wl_status_t wifi_status = WL_IDLE_STATUS;
+bool auto_reconnect = false;
+bool joining = false;
+host::EventId join_event = 0;
+
+void join() {
+    if (joining) {
+        return;
+    }
+    joining = true;
+    join_event = host::schedule((uint64_t)ap_join_ms * 1000, []() {
+        joining = false;
+        if (ap_available) {
+            wifi_status = WL_CONNECTED;
+        } else if (auto_reconnect) {
+            join();         // Keeps scanning for the access point
+        } else {
+            wifi_status = WL_NO_SSID_AVAIL;
+        }
+    });
+}
+
+// ==================== UDP ====================
+
+// Sockets are firmware globals, destroyed in no particular order at exit; these outlive them
+std::vector<WiFiUDP*>& udp_sockets = *new std::vector<WiFiUDP*>();
+std::vector<host::Datagram> sent_datagrams;
+
+// ==================== TCP ====================
+
+size_t tcp_send_capacity = 5744;    // TCP_SND_BUF: 4 segments of 1436 bytes
+int next_fd = 50;
+std::map<int, std::weak_ptr<host::TcpConnection>> sockets;
+std::map<uint16_t, std::deque<std::shared_ptr<host::TcpConnection>>>& listeners =
+    *new std::map<uint16_t, std::deque<std::shared_ptr<host::TcpConnection>>>();
+
+std::shared_ptr<host::TcpConnection> findSocket(int fd) {
+    auto it = sockets.find(fd);
+    return it != sockets.end() ? it->second.lock() : std::shared_ptr<host::TcpConnection>();
+}
+
+// Takes what fits in the send buffer; an unstalled peer reads it at once
+size_t enqueue(host::TcpConnection& connection, const uint8_t* data, size_t length) {
+    size_t space = connection.send_capacity - connection.send_buffer.size();
+    size_t accepted = std::min(space, length);
+    connection.send_buffer.append((const char*)data, accepted);
+    if (!connection.stalled) {
+        connection.to_peer += connection.send_buffer;
+        connection.send_buffer.clear();
+    }
+    return accepted;
+}
+
+const int WRITE_RETRIES = 10;               // WIFI_CLIENT_MAX_WRITE_RETRY
+const uint32_t WRITE_SELECT_TIMEOUT_MS = 1000;
+
+}
+
+// ==================== WIFI ====================
+
+bool WiFiClass::mode(wifi_mode_t mode) {
+    return true;
+}
+
+bool WiFiClass::setAutoReconnect(bool enabled) {
+    auto_reconnect = enabled;
+    return true;
+}
+
+wl_status_t WiFiClass::begin(const char* ssid, const char* password) {
+    if (ssid == NULL || ssid[0] == '\0' || (password != NULL && strlen(password) > 0 && strlen(password) < 8)) {
+        return WL_CONNECT_FAILED;
+    }
+    wifi_status = WL_DISCONNECTED;
+    join();
+    return wifi_status;
+}
+
+bool WiFiClass::disconnect() {
+    if (joining) {
+        host::cancel(join_event);
+        joining = false;
+    }
+    wifi_status = WL_DISCONNECTED;
+    return true;
+}
+
+wl_status_t WiFiClass::status() {
+    return wifi_status;
+}
+
+IPAddress WiFiClass::localIP() {
+    return wifi_status == WL_CONNECTED ? host::LOCAL_IP : IPAddress();
+}
+
+IPAddress WiFiClass::broadcastIP() {
+    return wifi_status == WL_CONNECTED ? host::BROADCAST_IP : IPAddress();
+}
+
+// ==================== TCP CLIENT AND SERVER ====================
+
+uint8_t WiFiClient::connected() {
+    if (!connection || connection->device_closed) {
+        return 0;
+    }
+    return !connection->peer_closed || !connection->to_device.empty();
+}
+
+int WiFiClient::fd() const {
+    return connection ? connection->fd : -1;
+}
+
+void WiFiClient::stop() {
+    if (connection) {
+        connection->device_closed = true;
+        connection.reset();
+    }
+}
+
+size_t WiFiClient::write(const uint8_t* data, size_t length) {
+    if (!connection || connection->device_closed || connection->peer_closed) {
+        return 0;
+    }
+    size_t sent = enqueue(*connection, data, length);
+    int retries = WRITE_RETRIES;
+    while (sent < length && retries > 0 && host::inTask()) {
+        // One select() round: wait for the peer to read, up to the timeout
+        uint32_t waited_ms = 0;
+        while (waited_ms < WRITE_SELECT_TIMEOUT_MS && connection->send_buffer.size() >= connection->send_capacity &&
+               !connection->peer_closed) {
+            vTaskDelay(1);
+            waited_ms++;
+        }
+        if (connection->peer_closed) {
+            break;
+        }
+        size_t accepted = enqueue(*connection, data + sent, length - sent);
+        sent += accepted;
+        retries = accepted > 0 ? WRITE_RETRIES : retries - 1;
+    }
+    return sent;
+}
+
+int WiFiClient::available() {
+    return connection ? (int)connection->to_device.size() : 0;
+}
+
+int WiFiClient::read() {
+    if (!connection || connection->to_device.empty()) {
+        return -1;
+    }
+    uint8_t c = (uint8_t)connection->to_device[0];
+    connection->to_device.erase(0, 1);
+    return c;
+}
+
+int WiFiClient::peek() {
+    return connection && !connection->to_device.empty() ? (uint8_t)connection->to_device[0] : -1;
+}
+
+size_t WiFiClient::readBytes(char* buffer, size_t length) {
+    if (!connection) {
+        return 0;
+    }
+    size_t count = std::min(length, connection->to_device.size());
+    memcpy(buffer, connection->to_device.data(), count);
+    connection->to_device.erase(0, count);
+    return count;
+}
+
+ssize_t lwip_send(int socket, const void* data, size_t length, int flags) {
+    std::shared_ptr<host::TcpConnection> connection = findSocket(socket);
+    if (!connection || connection->device_closed || connection->peer_closed) {
+        errno = ENOTCONN;
+        return -1;
+    }
+    if (!(flags & MSG_DONTWAIT)) {
+        return (ssize_t)WiFiClient(connection).write((const uint8_t*)data, length);
+    }
+    size_t accepted = enqueue(*connection, (const uint8_t*)data, length);
+    if (accepted == 0 && length > 0) {
+        errno = EAGAIN;
+        return -1;
+    }
+    return (ssize_t)accepted;
+}
+
+WiFiServer::~WiFiServer() {
+    end();
+}
+
+void WiFiServer::begin(uint16_t new_port) {
+    if (new_port != 0) {
+        port = new_port;
+    }
+    listening = true;
+    listeners[port];
+}
+
+void WiFiServer::end() {
+    if (listening) {
+        listeners.erase(port);
+        listening = false;
+    }
+}
+
+bool WiFiServer::hasClient() {
+    auto it = listeners.find(port);
+    return listening && it != listeners.end() && !it->second.empty();
+}
+
+WiFiClient WiFiServer::available() {
+    if (!hasClient()) {
+        return WiFiClient();
+    }
+    std::deque<std::shared_ptr<host::TcpConnection>>& pending = listeners[port];
+    std::shared_ptr<host::TcpConnection> connection = pending.front();
+    pending.pop_front();
+    connection->accepted = true;
+    return WiFiClient(connection);
+}
+
+// ==================== UDP ====================
+
+WiFiUDP::WiFiUDP() : local_port(0), current_index(0), sending(false), send_port(0) {}
+
+WiFiUDP::~WiFiUDP() {
+    stop();
+}
+
+uint8_t WiFiUDP::begin(uint16_t port) {
+    if (wifi_status != WL_CONNECTED) {
+        return 0;
+    }
+    stop();
+    local_port = port;
+    udp_sockets.push_back(this);
+    return 1;
+}
+
+void WiFiUDP::stop() {
+    udp_sockets.erase(std::remove(udp_sockets.begin(), udp_sockets.end(), this), udp_sockets.end());
+    local_port = 0;
+    queue.clear();
+}
+
+int WiFiUDP::beginPacket(IPAddress address, uint16_t port) {
+    if (wifi_status != WL_CONNECTED) {
+        return 0;
+    }
+    sending = true;
+    send_address = address;
+    send_port = port;
+    send_buffer.clear();
+    return 1;
+}
+
+int WiFiUDP::endPacket() {
+    if (!sending) {
+        return 0;
+    }
+    sending = false;
+    if (wifi_status != WL_CONNECTED) {
+        return 0;
+    }
+    host::Datagram datagram;
+    datagram.address = send_address;
+    datagram.port = send_port;
+    datagram.local_port = local_port;
+    datagram.payload.swap(send_buffer);
+    sent_datagrams.push_back(std::move(datagram));
+    return 1;
+}
+
+size_t WiFiUDP::write(const uint8_t* data, size_t length) {
+    if (!sending) {
+        return 0;
+    }
+    send_buffer.append((const char*)data, length);
+    return length;
+}
+
+int WiFiUDP::parsePacket() {
+    current = Packet();
+    current_index = 0;
+    if (queue.empty()) {
+        return 0;
+    }
+    current = std::move(queue.front());
+    queue.pop_front();
+    return (int)current.payload.size();
+}
+
+int WiFiUDP::read() {
+    return current_index < current.payload.size() ? (uint8_t)current.payload[current_index++] : -1;
+}
+
+int WiFiUDP::read(uint8_t* buffer, size_t length) {
+    size_t count = std::min(length, current.payload.size() - current_index);
+    memcpy(buffer, current.payload.data() + current_index, count);
+    current_index += count;
+    return (int)count;
+}
+
+int WiFiUDP::peek() {
+    return current_index < current.payload.size() ? (uint8_t)current.payload[current_index] : -1;
+}
+
+void WiFiUDP::deliver(const Packet& packet) {
+    queue.push_back(packet);
+}
+
+// ==================== HOST SIDE ====================
+
+namespace host {
+
+void setAccessPoint(bool available, uint32_t join_ms) {
+    ap_available = available;
+    ap_join_ms = join_ms;
+}
+
+void dropWiFi() {
+    if (wifi_status != WL_CONNECTED) {
+        return;
+    }
+    wifi_status = WL_CONNECTION_LOST;
+    if (auto_reconnect) {
+        join();
+    }
+}
+
+bool sendDatagram(uint16_t port, const void* data, size_t length, IPAddress from, uint16_t from_port) {
+    if (wifi_status != WL_CONNECTED) {
+        return false;
+    }
+    for (WiFiUDP* socket : udp_sockets) {
+        if (socket->getLocalPort() == port) {
+            WiFiUDP::Packet packet;
+            packet.address = from;
+            packet.port = from_port;
+            packet.payload.assign((const char*)data, length);
+            socket->deliver(packet);
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<Datagram> takeDatagrams() {
+    std::vector<Datagram> out;
+    out.swap(sent_datagrams);
+    return out;
+}
+
+bool TcpPeer::isAccepted() const {
+    return connection->accepted;
+}
+
+bool TcpPeer::isOpen() const {
+    return !connection->device_closed && !connection->peer_closed;
+}
+
+void TcpPeer::send(const std::string& data) {
+    if (isOpen()) {
+        connection->to_device += data;
+    }
+}
+
+std::string TcpPeer::receive() {
+    if (!connection->stalled) {
+        connection->to_peer += connection->send_buffer;
+        connection->send_buffer.clear();
+    }
+    std::string out;
+    out.swap(connection->to_peer);
+    return out;
+}
+
+void TcpPeer::setStalled(bool stalled) {
+    connection->stalled = stalled;
+    if (!stalled) {
+        connection->to_peer += connection->send_buffer;
+        connection->send_buffer.clear();
+    }
+}
+
+void TcpPeer::close() {
+    connection->peer_closed = true;
+}
+
+std::shared_ptr<TcpPeer> connectTcp(uint16_t port) {
+    auto it = listeners.find(port);
+    if (wifi_status != WL_CONNECTED || it == listeners.end()) {
+        return std::shared_ptr<TcpPeer>();
+    }
+    std::shared_ptr<TcpConnection> connection(new TcpConnection());
+    connection->fd = next_fd++;
+    connection->send_capacity = tcp_send_capacity;
+    connection->stalled = false;
+    connection->accepted = false;
+    connection->device_closed = false;
+    connection->peer_closed = false;
+    sockets[connection->fd] = connection;
+    it->second.push_back(connection);
+    return std::make_shared<TcpPeer>(connection);
+}
+
+void setTcpSendBuffer(size_t bytes) {
+    tcp_send_capacity = bytes;
+}
+
+void resetNetwork() {
+    ap_available = true;
+    ap_join_ms = 1200;
+    wifi_status = WL_IDLE_STATUS;
+    auto_reconnect = false;
+    joining = false;
+    for (WiFiUDP* socket : std::vector<WiFiUDP*>(udp_sockets)) {
+        socket->stop();
+    }
+    sent_datagrams.clear();
+    tcp_send_capacity = 5744;
+    for (auto& listener : listeners) {
+        listener.second.clear();
+    }
+    for (auto& socket : sockets) {
+        std::shared_ptr<TcpConnection> connection = socket.second.lock();
+        if (connection) {
+            connection->device_closed = true;
+            connection->peer_closed = true;
+        }
+    }
+    sockets.clear();
+    resetHttp();
+}
+
+}
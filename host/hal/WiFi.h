@@ -0,0 +1,88 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+// WiFi station, TCP client and server stand-ins; the access point and the
+// remote ends are driven from HostNetwork.h.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <memory>
+#include "Arduino.h"
+#include "IPAddress.h"
+#include "WiFiUdp.h"
+
+typedef enum {
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+    WIFI_AP = 2,
+    WIFI_AP_STA = 3,
+} wifi_mode_t;
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_SCAN_COMPLETED = 2,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6,
+} wl_status_t;
+
+class WiFiClass {
+public:
+    bool mode(wifi_mode_t mode);
+    bool setAutoReconnect(bool enabled);
+    wl_status_t begin(const char* ssid, const char* password = NULL);
+    bool disconnect();
+    wl_status_t status();
+    IPAddress localIP();
+    IPAddress broadcastIP();
+};
+
+extern WiFiClass WiFi;
+
+namespace host { struct TcpConnection; }
+
+class WiFiClient : public Stream {
+private:
+    std::shared_ptr<host::TcpConnection> connection;
+
+public:
+    WiFiClient() {}
+    explicit WiFiClient(const std::shared_ptr<host::TcpConnection>& connection) : connection(connection) {}
+
+    uint8_t connected();
+    operator bool() { return connected() != 0; }
+    bool operator==(const WiFiClient& other) const { return connection == other.connection; }
+    int fd() const;
+    void stop();
+    int setNoDelay(bool enabled) { return 0; }
+
+    // Blocks while the send buffer is full, as lwIP does, for up to ten 1 s retries without progress
+    size_t write(const uint8_t* data, size_t length) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t readBytes(char* buffer, size_t length) override;
+    using Stream::readBytes;
+};
+
+class WiFiServer {
+private:
+    uint16_t port;
+    bool listening;
+
+public:
+    explicit WiFiServer(uint16_t port = 80) : port(port), listening(false) {}
+    ~WiFiServer();
+
+    void begin(uint16_t new_port = 0);
+    void end();
+    void setNoDelay(bool enabled) {}
+    bool hasClient();
+    WiFiClient available();             // The next pending connection, or an invalid client
+    WiFiClient accept() { return available(); }
+};
+
+#endif // HOST_WIFI_H
@@ -0,0 +1,57 @@
+#ifndef HOST_WIFI_UDP_H
+#define HOST_WIFI_UDP_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <deque>
+#include <string>
+#include "Stream.h"
+#include "IPAddress.h"
+
+class WiFiUDP : public Stream {
+public:
+    struct Packet {
+        IPAddress address;
+        uint16_t port;
+        std::string payload;
+    };
+
+private:
+    uint16_t local_port;
+    std::deque<Packet> queue;
+    Packet current;                     // Returned by parsePacket(), read from here
+    size_t current_index;
+    bool sending;
+    IPAddress send_address;
+    uint16_t send_port;
+    std::string send_buffer;
+
+public:
+    WiFiUDP();
+    ~WiFiUDP();
+
+    uint8_t begin(uint16_t port);
+    void stop();
+
+    int beginPacket(IPAddress address, uint16_t port);
+    int endPacket();
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t length) override;
+    using Print::write;
+
+    int parsePacket();
+    int available() override { return (int)(current.payload.size() - current_index); }
+    int read() override;
+    int read(uint8_t* buffer, size_t length);
+    int read(char* buffer, size_t length) { return read((uint8_t*)buffer, length); }
+    int peek() override;
+    void flush() override { current_index = current.payload.size(); }
+    IPAddress remoteIP() const { return current.address; }
+    uint16_t remotePort() const { return current.port; }
+
+    // Host side
+    void deliver(const Packet& packet);
+    uint16_t getLocalPort() const { return local_port; }
+};
+
+#endif // HOST_WIFI_UDP_H
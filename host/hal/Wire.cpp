@@ -0,0 +1,140 @@
+#include "Wire.h"
+#include <Arduino.h>
+#include "HostRuntime.h"
+#include <string.h>
+
+TwoWire Wire;
+
+TwoWire::TwoWire() {
+    for (int i = 0; i < 128; i++) {
+        devices[i] = NULL;
+    }
+    reset();
+}
+
+bool TwoWire::begin(int sda, int scl, uint32_t frequency) {
+    started = true;
+    if (frequency > 0) {
+        clock_hz = frequency;
+    }
+    return true;
+}
+
+bool TwoWire::end() {
+    started = false;
+    return true;
+}
+
+bool TwoWire::setClock(uint32_t frequency) {
+    clock_hz = frequency;
+    return true;
+}
+
+// A transaction holds the calling task for its bus time: 9 clocks a byte plus
+// the address byte, start and stop
+void TwoWire::chargeBusTime(size_t bytes) {
+    if (clock_hz == 0 || !host::inTask()) {
+        return;
+    }
+    uint64_t bus_us = ((uint64_t)(bytes + 1) * 9 + 2) * 1000000ULL / clock_hz;
+    delayMicroseconds((uint32_t)bus_us);
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+    tx_address = address;
+    tx_length = 0;
+    tx_overflow = false;
+}
+
+// Error codes follow the Arduino core: 1 data too long, 2 address NACK, 4 other
+uint8_t TwoWire::endTransmission(bool send_stop) {
+    if (!started) {
+        return 4;
+    }
+    if (tx_overflow) {
+        return 1;
+    }
+    transactions++;
+    bytes_transferred += tx_length;
+    chargeBusTime(tx_length);
+    I2CDevice* device = tx_address < 128 ? devices[tx_address] : NULL;
+    if (device == NULL || !device->write(tx_buffer, tx_length)) {
+        return 2;
+    }
+    return 0;
+}
+
+size_t TwoWire::requestFrom(uint8_t address, size_t length, bool send_stop) {
+    rx_length = 0;
+    rx_index = 0;
+    if (!started || length > BUFFER_LENGTH) {
+        return 0;
+    }
+    transactions++;
+    chargeBusTime(length);
+    I2CDevice* device = address < 128 ? devices[address] : NULL;
+    if (device == NULL || !device->read(rx_buffer, length)) {
+        return 0;
+    }
+    bytes_transferred += length;
+    rx_length = length;
+    return length;
+}
+
+size_t TwoWire::write(uint8_t data) {
+    if (tx_length >= BUFFER_LENGTH) {
+        tx_overflow = true;
+        return 0;
+    }
+    tx_buffer[tx_length++] = data;
+    return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t length) {
+    size_t written = 0;
+    while (written < length && write(data[written]) == 1) {
+        written++;
+    }
+    return written;
+}
+
+int TwoWire::read() {
+    return rx_index < rx_length ? rx_buffer[rx_index++] : -1;
+}
+
+int TwoWire::peek() {
+    return rx_index < rx_length ? rx_buffer[rx_index] : -1;
+}
+
+size_t TwoWire::readBytes(char* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length && rx_index < rx_length) {
+        buffer[count++] = (char)rx_buffer[rx_index++];
+    }
+    return count;
+}
+
+void TwoWire::attach(uint8_t address, I2CDevice* device) {
+    if (address < 128) {
+        devices[address] = device;
+    }
+}
+
+void TwoWire::detach(uint8_t address) {
+    if (address < 128) {
+        devices[address] = NULL;
+    }
+}
+
+// Devices stay attached; they belong to whoever attached them
+void TwoWire::reset() {
+    started = false;
+    clock_hz = 100000;
+    tx_address = 0;
+    tx_length = 0;
+    tx_overflow = false;
+    rx_length = 0;
+    rx_index = 0;
+    transactions = 0;
+    bytes_transferred = 0;
+}
@@ -0,0 +1,74 @@
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Stream.h"
+
+// A device on the host I2C bus. The bus calls write() with the bytes of each
+// write transaction (register pointer first) and read() to fill a read
+// transaction; returning false NACKs it.
+class I2CDevice {
+public:
+    virtual ~I2CDevice() {}
+    virtual bool write(const uint8_t* data, size_t length) = 0;
+    virtual bool read(uint8_t* data, size_t length) = 0;
+};
+
+// TwoWire stand-in with the arduino-esp32 128-byte transaction buffer.
+// Devices are attached by address from the host side; an address with no
+// device NACKs, as an unpopulated bus would.
+class TwoWire : public Stream {
+public:
+    static const size_t BUFFER_LENGTH = 128;
+
+private:
+    I2CDevice* devices[128];
+    bool started;
+    uint32_t clock_hz;
+    uint8_t tx_address;
+    uint8_t tx_buffer[BUFFER_LENGTH];
+    size_t tx_length;
+    bool tx_overflow;
+    uint8_t rx_buffer[BUFFER_LENGTH];
+    size_t rx_length;
+    size_t rx_index;
+    uint32_t transactions;
+    uint64_t bytes_transferred;
+
+    void chargeBusTime(size_t bytes);
+
+public:
+    TwoWire();
+
+    bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0);
+    bool end();
+    bool setClock(uint32_t frequency);
+    uint32_t getClock() const { return clock_hz; }
+
+    void beginTransmission(uint8_t address);
+    void beginTransmission(int address) { beginTransmission((uint8_t)address); }
+    uint8_t endTransmission(bool send_stop = true);
+    size_t requestFrom(uint8_t address, size_t length, bool send_stop = true);
+    uint8_t requestFrom(int address, int length) { return (uint8_t)requestFrom((uint8_t)address, (size_t)length, true); }
+
+    size_t write(uint8_t data) override;
+    size_t write(const uint8_t* data, size_t length) override;
+    using Print::write;
+    int available() override { return (int)(rx_length - rx_index); }
+    int read() override;
+    int peek() override;
+    size_t readBytes(char* buffer, size_t length) override;
+    using Stream::readBytes;
+
+    // Host side
+    void attach(uint8_t address, I2CDevice* device);
+    void detach(uint8_t address);
+    uint32_t getTransactions() const { return transactions; }
+    uint64_t getBytesTransferred() const { return bytes_transferred; }
+    void reset();
+};
+
+extern TwoWire Wire;
+
+#endif // HOST_WIRE_H
@@ -0,0 +1,85 @@
+#include "esp_timer.h"
+#include "HostRuntime.h"
+#include <stddef.h>
+
+struct HostTimer {
+    esp_timer_cb_t callback;
+    void* arg;
+    uint64_t period_us;         // 0 for one-shot
+    host::EventId event;
+    bool armed;
+};
+
+static void arm(HostTimer* timer, uint64_t delay_us) {
+    timer->armed = true;
+    timer->event = host::schedule(delay_us, [timer]() {
+        timer->armed = false;
+        if (timer->period_us > 0) {
+            arm(timer, timer->period_us);
+        }
+        timer->callback(timer->arg);
+    });
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* out_handle) {
+    if (args == NULL || args->callback == NULL || out_handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    HostTimer* timer = new HostTimer();
+    timer->callback = args->callback;
+    timer->arg = args->arg;
+    timer->period_us = 0;
+    timer->event = 0;
+    timer->armed = false;
+    *out_handle = timer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us) {
+    if (timer == NULL || period_us == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (timer->armed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->period_us = period_us;
+    arm(timer, period_us);
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (timer->armed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->period_us = 0;
+    arm(timer, timeout_us);
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if (timer == NULL || !timer->armed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    host::cancel(timer->event);
+    timer->armed = false;
+    timer->period_us = 0;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (timer->armed) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    delete timer;
+    return ESP_OK;
+}
+
+int64_t esp_timer_get_time() {
+    return (int64_t)host::nowMicros();
+}
@@ -0,0 +1,15 @@
+#ifndef HOST_LWIP_SOCKETS_H
+#define HOST_LWIP_SOCKETS_H
+
+// The lwIP socket calls the firmware makes on WiFiClient::fd(), against the
+// host's loopback connections (HostNetwork.h)
+
+#include <stddef.h>
+#include <sys/types.h>
+#include <errno.h>
+
+#define MSG_DONTWAIT 0x08
+
+ssize_t lwip_send(int socket, const void* data, size_t length, int flags);
+
+#endif // HOST_LWIP_SOCKETS_H
@@ -0,0 +1,108 @@
+#include "Adafruit_BMP280.h"
+
+static const uint8_t REG_CALIB = 0x88;
+static const uint8_t REG_CHIP_ID = 0xD0;
+static const uint8_t REG_CTRL_MEAS = 0xF4;
+static const uint8_t REG_CONFIG = 0xF5;
+static const uint8_t REG_PRESSURE = 0xF7;
+static const uint8_t REG_TEMPERATURE = 0xFA;
+
+Adafruit_BMP280::Adafruit_BMP280(TwoWire* wire) : wire(wire), address(BMP280_ADDRESS), t_fine(0) {}
+
+bool Adafruit_BMP280::writeRegister(uint8_t reg, uint8_t value) {
+    wire->beginTransmission(address);
+    wire->write(reg);
+    wire->write(value);
+    return wire->endTransmission() == 0;
+}
+
+bool Adafruit_BMP280::readRegisters(uint8_t reg, uint8_t* buffer, size_t length) {
+    wire->beginTransmission(address);
+    wire->write(reg);
+    if (wire->endTransmission(false) != 0 || wire->requestFrom(address, length, true) != length) {
+        return false;
+    }
+    wire->readBytes(buffer, length);
+    return true;
+}
+
+// The library reads the trimming parameters too; the firmware reads them again itself
+bool Adafruit_BMP280::begin(uint8_t i2c_address, uint8_t chip_id) {
+    address = i2c_address;
+    uint8_t id;
+    if (!readRegisters(REG_CHIP_ID, &id, 1) || id != chip_id) {
+        return false;
+    }
+    uint8_t calibration[24];
+    if (!readRegisters(REG_CALIB, calibration, sizeof(calibration))) {
+        return false;
+    }
+    uint16_t words[12];
+    for (int i = 0; i < 12; i++) {
+        words[i] = (uint16_t)(calibration[2 * i + 1] << 8 | calibration[2 * i]);
+    }
+    dig_T1 = words[0];
+    dig_T2 = (int16_t)words[1];
+    dig_T3 = (int16_t)words[2];
+    dig_P1 = words[3];
+    dig_P2 = (int16_t)words[4];
+    dig_P3 = (int16_t)words[5];
+    dig_P4 = (int16_t)words[6];
+    dig_P5 = (int16_t)words[7];
+    dig_P6 = (int16_t)words[8];
+    dig_P7 = (int16_t)words[9];
+    dig_P8 = (int16_t)words[10];
+    dig_P9 = (int16_t)words[11];
+    setSampling();
+    delay(100);
+    return true;
+}
+
+void Adafruit_BMP280::setSampling(sensor_mode mode, sensor_sampling temperature_sampling, sensor_sampling pressure_sampling,
+                                  sensor_filter filter, standby_duration duration) {
+    writeRegister(REG_CONFIG, (uint8_t)((duration << 5) | (filter << 2)));
+    writeRegister(REG_CTRL_MEAS, (uint8_t)((temperature_sampling << 5) | (pressure_sampling << 2) | mode));
+}
+
+int32_t Adafruit_BMP280::read24(uint8_t reg) {
+    uint8_t raw[3] = { 0, 0, 0 };
+    readRegisters(reg, raw, sizeof(raw));
+    return (int32_t)raw[0] << 16 | (int32_t)raw[1] << 8 | raw[2];
+}
+
+// Below as in the library: one three-byte read per quantity and Bosch's integer compensation
+float Adafruit_BMP280::readTemperature() {
+    int32_t adc_T = read24(REG_TEMPERATURE) >> 4;
+    int32_t var1 = ((((adc_T >> 3) - ((int32_t)dig_T1 << 1))) * ((int32_t)dig_T2)) >> 11;
+    int32_t var2 = (((((adc_T >> 4) - ((int32_t)dig_T1)) * ((adc_T >> 4) - ((int32_t)dig_T1))) >> 12) *
+                    ((int32_t)dig_T3)) >> 14;
+    t_fine = var1 + var2;
+    float T = (t_fine * 5 + 128) >> 8;
+    return T / 100;
+}
+
+float Adafruit_BMP280::readPressure() {
+    readTemperature();
+    int32_t adc_P = read24(REG_PRESSURE) >> 4;
+
+    int64_t var1 = ((int64_t)t_fine) - 128000;
+    int64_t var2 = var1 * var1 * (int64_t)dig_P6;
+    var2 = var2 + ((var1 * (int64_t)dig_P5) << 17);
+    var2 = var2 + (((int64_t)dig_P4) << 35);
+    var1 = ((var1 * var1 * (int64_t)dig_P3) >> 8) + ((var1 * (int64_t)dig_P2) << 12);
+    var1 = (((((int64_t)1) << 47) + var1)) * ((int64_t)dig_P1) >> 33;
+    if (var1 == 0) {
+        return 0;
+    }
+    int64_t p = 1048576 - adc_P;
+    p = (((p << 31) - var2) * 3125) / var1;
+    var1 = (((int64_t)dig_P9) * (p >> 13) * (p >> 13)) >> 25;
+    var2 = (((int64_t)dig_P8) * p) >> 19;
+    p = ((p + var1 + var2) >> 8) + (((int64_t)dig_P7) << 4);
+    return (float)p / 256;
+}
+
+float Adafruit_BMP280::readAltitude(float sea_level_hpa) {
+    float pressure = readPressure() / 100;
+    return 44330 * (1.0 - pow(pressure / sea_level_hpa, 0.1903));
+}
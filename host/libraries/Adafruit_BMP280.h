@@ -0,0 +1,59 @@
+#ifndef HOST_ADAFRUIT_BMP280_H
+#define HOST_ADAFRUIT_BMP280_H
+
+// Adafruit_BMP280 over the host Wire bus. The firmware only probes and
+// configures through it and does its own burst reads and compensation; the
+// library's read path (three-byte reads, the same integer compensation and
+// pow() for altitude) is kept as the reference the tests and benchmarks
+// compare that against.
+
+#include <Arduino.h>
+#include <Wire.h>
+#include "Adafruit_Sensor.h"
+
+#define BMP280_ADDRESS 0x77
+#define BMP280_CHIPID 0x58
+
+class Adafruit_BMP280 {
+public:
+    enum sensor_mode { MODE_SLEEP = 0x00, MODE_FORCED = 0x01, MODE_NORMAL = 0x03, MODE_SOFT_RESET_CODE = 0xB6 };
+    enum sensor_sampling { SAMPLING_NONE = 0x00, SAMPLING_X1, SAMPLING_X2, SAMPLING_X4, SAMPLING_X8, SAMPLING_X16 };
+    enum sensor_filter { FILTER_OFF = 0x00, FILTER_X2, FILTER_X4, FILTER_X8, FILTER_X16 };
+    enum standby_duration {
+        STANDBY_MS_1 = 0x00,
+        STANDBY_MS_63 = 0x01,
+        STANDBY_MS_125 = 0x02,
+        STANDBY_MS_250 = 0x03,
+        STANDBY_MS_500 = 0x04,
+        STANDBY_MS_1000 = 0x05,
+        STANDBY_MS_2000 = 0x06,
+        STANDBY_MS_4000 = 0x07,
+    };
+
+private:
+    TwoWire* wire;
+    uint8_t address;
+    uint16_t dig_T1;
+    int16_t dig_T2, dig_T3;
+    uint16_t dig_P1;
+    int16_t dig_P2, dig_P3, dig_P4, dig_P5, dig_P6, dig_P7, dig_P8, dig_P9;
+    int32_t t_fine;
+
+    bool writeRegister(uint8_t reg, uint8_t value);
+    bool readRegisters(uint8_t reg, uint8_t* buffer, size_t length);
+    int32_t read24(uint8_t reg);
+
+public:
+    explicit Adafruit_BMP280(TwoWire* wire = &Wire);
+
+    bool begin(uint8_t address = BMP280_ADDRESS, uint8_t chip_id = BMP280_CHIPID);
+    void setSampling(sensor_mode mode = MODE_NORMAL, sensor_sampling temperature_sampling = SAMPLING_X16,
+                     sensor_sampling pressure_sampling = SAMPLING_X16, sensor_filter filter = FILTER_OFF,
+                     standby_duration duration = STANDBY_MS_1);
+
+    float readTemperature();                        // °C
+    float readPressure();                           // Pa; reads the temperature first for t_fine
+    float readAltitude(float sea_level_hpa = 1013.25);
+};
+
+#endif // HOST_ADAFRUIT_BMP280_H
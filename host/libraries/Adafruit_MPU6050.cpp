@@ -0,0 +1,101 @@
+#include "Adafruit_MPU6050.h"
+
+static const uint8_t REG_SMPLRT_DIV = 0x19;
+static const uint8_t REG_CONFIG = 0x1A;
+static const uint8_t REG_GYRO_CONFIG = 0x1B;
+static const uint8_t REG_ACCEL_CONFIG = 0x1C;
+static const uint8_t REG_ACCEL_OUT = 0x3B;
+static const uint8_t REG_SIGNAL_PATH_RESET = 0x68;
+static const uint8_t REG_PWR_MGMT_1 = 0x6B;
+static const uint8_t REG_WHO_AM_I = 0x75;
+static const uint8_t DEVICE_ID = 0x68;
+
+Adafruit_MPU6050::Adafruit_MPU6050()
+    : wire(&Wire), address(MPU6050_I2CADDR_DEFAULT), accel_range(MPU6050_RANGE_2_G), gyro_range(MPU6050_RANGE_500_DEG) {}
+
+bool Adafruit_MPU6050::writeRegister(uint8_t reg, uint8_t value) {
+    wire->beginTransmission(address);
+    wire->write(reg);
+    wire->write(value);
+    return wire->endTransmission() == 0;
+}
+
+bool Adafruit_MPU6050::readRegisters(uint8_t reg, uint8_t* buffer, size_t length) {
+    wire->beginTransmission(address);
+    wire->write(reg);
+    if (wire->endTransmission(false) != 0 || wire->requestFrom(address, length, true) != length) {
+        return false;
+    }
+    wire->readBytes(buffer, length);
+    return true;
+}
+
+bool Adafruit_MPU6050::updateBits(uint8_t reg, uint8_t mask, uint8_t shift, uint8_t value) {
+    uint8_t current;
+    if (!readRegisters(reg, &current, 1)) {
+        return false;
+    }
+    current = (current & ~(mask << shift)) | ((value & mask) << shift);
+    return writeRegister(reg, current);
+}
+
+bool Adafruit_MPU6050::begin(uint8_t i2c_address, TwoWire* bus, int32_t sensor_id) {
+    wire = bus;
+    address = i2c_address;
+    uint8_t id;
+    if (!readRegisters(REG_WHO_AM_I, &id, 1) || id != DEVICE_ID) {
+        return false;
+    }
+    reset();
+    writeRegister(REG_SMPLRT_DIV, 0);
+    setFilterBandwidth(MPU6050_BAND_260_HZ);
+    setGyroRange(MPU6050_RANGE_500_DEG);
+    setAccelerometerRange(MPU6050_RANGE_2_G);
+    writeRegister(REG_PWR_MGMT_1, 0x01);   // PLL with the X gyro as clock
+    delay(100);
+    return true;
+}
+
+void Adafruit_MPU6050::reset() {
+    writeRegister(REG_PWR_MGMT_1, 0x80);
+    uint8_t value = 0x80;
+    while (readRegisters(REG_PWR_MGMT_1, &value, 1) && (value & 0x80)) {
+        delay(1);
+    }
+    delay(100);
+    writeRegister(REG_SIGNAL_PATH_RESET, 0x07);
+    delay(100);
+}
+
+void Adafruit_MPU6050::setAccelerometerRange(mpu6050_accel_range_t range) {
+    if (updateBits(REG_ACCEL_CONFIG, 0x03, 3, range)) {
+        accel_range = range;
+    }
+}
+
+void Adafruit_MPU6050::setGyroRange(mpu6050_gyro_range_t range) {
+    if (updateBits(REG_GYRO_CONFIG, 0x03, 3, range)) {
+        gyro_range = range;
+    }
+}
+
+void Adafruit_MPU6050::setFilterBandwidth(mpu6050_bandwidth_t bandwidth) {
+    updateBits(REG_CONFIG, 0x07, 0, bandwidth);
+}
+
+bool Adafruit_MPU6050::getEvent(sensors_event_t* accel, sensors_event_t* gyro, sensors_event_t* temp) {
+    uint8_t raw[14];
+    if (!readRegisters(REG_ACCEL_OUT, raw, sizeof(raw))) {
+        return false;
+    }
+    float accel_scale = 16384.0f / (float)(1 << accel_range);
+    float gyro_scale = 131.0f / (float)(1 << gyro_range);
+    for (int i = 0; i < 3; i++) {
+        accel->acceleration.v[i] = (int16_t)((raw[2 * i] << 8) | raw[2 * i + 1]) / accel_scale * SENSORS_GRAVITY_STANDARD;
+        gyro->gyro.v[i] = (int16_t)((raw[8 + 2 * i] << 8) | raw[9 + 2 * i]) / gyro_scale * (float)DEG_TO_RAD;
+    }
+    temp->temperature = (int16_t)((raw[6] << 8) | raw[7]) / 340.0f + 36.53f;
+    uint32_t now = millis();
+    accel->timestamp = gyro->timestamp = temp->timestamp = now;
+    return true;
+}
@@ -0,0 +1,59 @@
+#ifndef HOST_ADAFRUIT_MPU6050_H
+#define HOST_ADAFRUIT_MPU6050_H
+
+// Adafruit_MPU6050 over the host Wire bus, with the library's register
+// traffic and reset delays, for the MPU6050 model or any device on the bus
+
+#include <Arduino.h>
+#include <Wire.h>
+#include "Adafruit_Sensor.h"
+
+#define MPU6050_I2CADDR_DEFAULT 0x68
+
+typedef enum {
+    MPU6050_RANGE_2_G = 0,
+    MPU6050_RANGE_4_G = 1,
+    MPU6050_RANGE_8_G = 2,
+    MPU6050_RANGE_16_G = 3,
+} mpu6050_accel_range_t;
+
+typedef enum {
+    MPU6050_RANGE_250_DEG = 0,
+    MPU6050_RANGE_500_DEG = 1,
+    MPU6050_RANGE_1000_DEG = 2,
+    MPU6050_RANGE_2000_DEG = 3,
+} mpu6050_gyro_range_t;
+
+typedef enum {
+    MPU6050_BAND_260_HZ = 0,
+    MPU6050_BAND_184_HZ = 1,
+    MPU6050_BAND_94_HZ = 2,
+    MPU6050_BAND_44_HZ = 3,
+    MPU6050_BAND_21_HZ = 4,
+    MPU6050_BAND_10_HZ = 5,
+    MPU6050_BAND_5_HZ = 6,
+} mpu6050_bandwidth_t;
+
+class Adafruit_MPU6050 {
+private:
+    TwoWire* wire;
+    uint8_t address;
+    mpu6050_accel_range_t accel_range;
+    mpu6050_gyro_range_t gyro_range;
+
+    bool writeRegister(uint8_t reg, uint8_t value);
+    bool readRegisters(uint8_t reg, uint8_t* buffer, size_t length);
+    bool updateBits(uint8_t reg, uint8_t mask, uint8_t shift, uint8_t value);
+
+public:
+    Adafruit_MPU6050();
+
+    bool begin(uint8_t i2c_address = MPU6050_I2CADDR_DEFAULT, TwoWire* wire = &Wire, int32_t sensor_id = 0);
+    void reset();
+    void setAccelerometerRange(mpu6050_accel_range_t range);
+    void setGyroRange(mpu6050_gyro_range_t range);
+    void setFilterBandwidth(mpu6050_bandwidth_t bandwidth);
+    bool getEvent(sensors_event_t* accel, sensors_event_t* gyro, sensors_event_t* temp);
+};
+
+#endif // HOST_ADAFRUIT_MPU6050_H
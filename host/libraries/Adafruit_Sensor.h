@@ -0,0 +1,38 @@
+#ifndef HOST_ADAFRUIT_SENSOR_H
+#define HOST_ADAFRUIT_SENSOR_H
+
+// The parts of the Adafruit Unified Sensor types the firmware reads
+
+#include <stdint.h>
+
+typedef struct {
+    union {
+        float v[3];
+        struct {
+            float x;
+            float y;
+            float z;
+        };
+    };
+    int8_t status;
+    uint8_t reserved[3];
+} sensors_vec_t;
+
+typedef struct {
+    int32_t version;
+    int32_t sensor_id;
+    int32_t type;
+    int32_t reserved0;
+    int32_t timestamp;
+    union {
+        float data[4];
+        sensors_vec_t acceleration;     // m/s²
+        sensors_vec_t gyro;             // rad/s
+        float temperature;              // °C
+        float pressure;                 // hPa
+    };
+} sensors_event_t;
+
+#define SENSORS_GRAVITY_STANDARD 9.80665F
+
+#endif // HOST_ADAFRUIT_SENSOR_H
@@ -0,0 +1,315 @@
+#include "TinyGPS++.h"
+#include <string.h>
+#include <ctype.h>
+#include <stdlib.h>
+
+#define _GPRMCterm "GPRMC"
+#define _GPGGAterm "GPGGA"
+#define _GNRMCterm "GNRMC"
+#define _GNGGAterm "GNGGA"
+
+TinyGPSPlus::TinyGPSPlus()
+    : parity(0), isChecksumTerm(false), curSentenceType(GPS_SENTENCE_OTHER), curTermNumber(0), curTermOffset(0),
+      sentenceHasFix(false), encodedCharCount(0), sentencesWithFixCount(0), failedChecksumCount(0),
+      passedChecksumCount(0) {
+    term[0] = '\0';
+}
+
+bool TinyGPSPlus::encode(char c) {
+    ++encodedCharCount;
+
+    switch (c) {
+    case ',':   // Term terminators
+        parity ^= (uint8_t)c;
+        // Fall through
+    case '\r':
+    case '\n':
+    case '*': {
+        bool isValidSentence = false;
+        if (curTermOffset < sizeof(term)) {
+            term[curTermOffset] = 0;
+            isValidSentence = endOfTermHandler();
+        }
+        ++curTermNumber;
+        curTermOffset = 0;
+        isChecksumTerm = c == '*';
+        return isValidSentence;
+    }
+
+    case '$':   // Sentence begin
+        curTermNumber = curTermOffset = 0;
+        parity = 0;
+        curSentenceType = GPS_SENTENCE_OTHER;
+        isChecksumTerm = false;
+        sentenceHasFix = false;
+        return false;
+
+    default:    // Ordinary characters
+        if (curTermOffset < sizeof(term) - 1) {
+            term[curTermOffset++] = c;
+        }
+        if (!isChecksumTerm) {
+            parity ^= c;
+        }
+        return false;
+    }
+}
+
+int TinyGPSPlus::fromHex(char a) {
+    if (a >= 'A' && a <= 'F') {
+        return a - 'A' + 10;
+    } else if (a >= 'a' && a <= 'f') {
+        return a - 'a' + 10;
+    } else {
+        return a - '0';
+    }
+}
+
+int32_t TinyGPSPlus::parseDecimal(const char* term) {
+    bool negative = *term == '-';
+    if (negative) {
+        ++term;
+    }
+    int32_t ret = 100 * (int32_t)atol(term);
+    while (isdigit(*term)) {
+        ++term;
+    }
+    if (*term == '.' && isdigit(term[1])) {
+        ret += 10 * (term[1] - '0');
+        if (isdigit(term[2])) {
+            ret += term[2] - '0';
+        }
+    }
+    return negative ? -ret : ret;
+}
+
+// Parse degrees in that funny NMEA format DDMM.MMMM
+void TinyGPSPlus::parseDegrees(const char* term, RawDegrees& deg) {
+    uint32_t leftOfDecimal = (uint32_t)atol(term);
+    uint16_t minutes = (uint16_t)(leftOfDecimal % 100);
+    uint32_t multiplier = 10000000UL;
+    uint32_t tenMillionthsOfMinutes = minutes * multiplier;
+
+    deg.deg = (int16_t)(leftOfDecimal / 100);
+
+    while (isdigit(*term)) {
+        ++term;
+    }
+
+    if (*term == '.') {
+        while (isdigit(*++term)) {
+            multiplier /= 10;
+            tenMillionthsOfMinutes += (*term - '0') * multiplier;
+        }
+    }
+
+    deg.billionths = (5 * tenMillionthsOfMinutes + 1) / 3;
+    deg.negative = false;
+}
+
+#define COMBINE(sentence_type, term_number) (((unsigned)(sentence_type) << 5) | term_number)
+
+// Processes a just-completed term; returns true if a new sentence has just passed checksum
+bool TinyGPSPlus::endOfTermHandler() {
+    // If it's the checksum term, and the checksum checks out, commit
+    if (isChecksumTerm) {
+        byte checksum = 16 * fromHex(term[0]) + fromHex(term[1]);
+        if (checksum == parity) {
+            passedChecksumCount++;
+            if (sentenceHasFix) {
+                ++sentencesWithFixCount;
+            }
+
+            switch (curSentenceType) {
+            case GPS_SENTENCE_GPRMC:
+                date.commit();
+                time.commit();
+                if (sentenceHasFix) {
+                    location.commit();
+                    speed.commit();
+                    course.commit();
+                }
+                break;
+            case GPS_SENTENCE_GPGGA:
+                time.commit();
+                if (sentenceHasFix) {
+                    location.commit();
+                    altitude.commit();
+                }
+                satellites.commit();
+                hdop.commit();
+                break;
+            }
+            return true;
+        } else {
+            ++failedChecksumCount;
+        }
+        return false;
+    }
+
+    // The first term determines the sentence type
+    if (curTermNumber == 0) {
+        if (!strcmp(term, _GPRMCterm) || !strcmp(term, _GNRMCterm)) {
+            curSentenceType = GPS_SENTENCE_GPRMC;
+        } else if (!strcmp(term, _GPGGAterm) || !strcmp(term, _GNGGAterm)) {
+            curSentenceType = GPS_SENTENCE_GPGGA;
+        } else {
+            curSentenceType = GPS_SENTENCE_OTHER;
+        }
+        return false;
+    }
+
+    if (curSentenceType != GPS_SENTENCE_OTHER && term[0]) {
+        switch (COMBINE(curSentenceType, curTermNumber)) {
+        case COMBINE(GPS_SENTENCE_GPRMC, 1):    // Time in both sentences
+        case COMBINE(GPS_SENTENCE_GPGGA, 1):
+            time.setTime(term);
+            break;
+        case COMBINE(GPS_SENTENCE_GPRMC, 2):    // GPRMC validity
+            sentenceHasFix = term[0] == 'A';
+            break;
+        case COMBINE(GPS_SENTENCE_GPRMC, 3):    // Latitude
+        case COMBINE(GPS_SENTENCE_GPGGA, 2):
+            location.setLatitude(term);
+            break;
+        case COMBINE(GPS_SENTENCE_GPRMC, 4):    // N/S
+        case COMBINE(GPS_SENTENCE_GPGGA, 3):
+            location.rawNewLatData.negative = term[0] == 'S';
+            break;
+        case COMBINE(GPS_SENTENCE_GPRMC, 5):    // Longitude
+        case COMBINE(GPS_SENTENCE_GPGGA, 4):
+            location.setLongitude(term);
+            break;
+        case COMBINE(GPS_SENTENCE_GPRMC, 6):    // E/W
+        case COMBINE(GPS_SENTENCE_GPGGA, 5):
+            location.rawNewLngData.negative = term[0] == 'W';
+            break;
+        case COMBINE(GPS_SENTENCE_GPRMC, 7):    // Speed (GPRMC)
+            speed.set(term);
+            break;
+        case COMBINE(GPS_SENTENCE_GPRMC, 8):    // Course (GPRMC)
+            course.set(term);
+            break;
+        case COMBINE(GPS_SENTENCE_GPRMC, 9):    // Date (GPRMC)
+            date.setDate(term);
+            break;
+        case COMBINE(GPS_SENTENCE_GPGGA, 6):    // Fix data (GPGGA)
+            sentenceHasFix = term[0] > '0';
+            break;
+        case COMBINE(GPS_SENTENCE_GPGGA, 7):    // Satellites used (GPGGA)
+            satellites.set(term);
+            break;
+        case COMBINE(GPS_SENTENCE_GPGGA, 8):    // HDOP
+            hdop.set(term);
+            break;
+        case COMBINE(GPS_SENTENCE_GPGGA, 9):    // Altitude (GPGGA)
+            altitude.set(term);
+            break;
+        }
+    }
+
+    return false;
+}
+
+void TinyGPSLocation::commit() {
+    rawLatData = rawNewLatData;
+    rawLngData = rawNewLngData;
+    lastCommitTime = millis();
+    valid = updated = true;
+}
+
+void TinyGPSLocation::setLatitude(const char* term) {
+    TinyGPSPlus::parseDegrees(term, rawNewLatData);
+}
+
+void TinyGPSLocation::setLongitude(const char* term) {
+    TinyGPSPlus::parseDegrees(term, rawNewLngData);
+}
+
+double TinyGPSLocation::lat() {
+    updated = false;
+    double ret = rawLatData.deg + rawLatData.billionths / 1000000000.0;
+    return rawLatData.negative ? -ret : ret;
+}
+
+double TinyGPSLocation::lng() {
+    updated = false;
+    double ret = rawLngData.deg + rawLngData.billionths / 1000000000.0;
+    return rawLngData.negative ? -ret : ret;
+}
+
+void TinyGPSDate::commit() {
+    date = newDate;
+    lastCommitTime = millis();
+    valid = updated = true;
+}
+
+void TinyGPSTime::commit() {
+    time = newTime;
+    lastCommitTime = millis();
+    valid = updated = true;
+}
+
+void TinyGPSTime::setTime(const char* term) {
+    newTime = (uint32_t)TinyGPSPlus::parseDecimal(term);
+}
+
+void TinyGPSDate::setDate(const char* term) {
+    newDate = atol(term);
+}
+
+uint16_t TinyGPSDate::year() {
+    updated = false;
+    uint16_t year = date % 100;
+    return year + 2000;
+}
+
+uint8_t TinyGPSDate::month() {
+    updated = false;
+    return (date / 100) % 100;
+}
+
+uint8_t TinyGPSDate::day() {
+    updated = false;
+    return date / 10000;
+}
+
+uint8_t TinyGPSTime::hour() {
+    updated = false;
+    return time / 1000000;
+}
+
+uint8_t TinyGPSTime::minute() {
+    updated = false;
+    return (time / 10000) % 100;
+}
+
+uint8_t TinyGPSTime::second() {
+    updated = false;
+    return (time / 100) % 100;
+}
+
+uint8_t TinyGPSTime::centisecond() {
+    updated = false;
+    return time % 100;
+}
+
+void TinyGPSDecimal::commit() {
+    val = newval;
+    lastCommitTime = millis();
+    valid = updated = true;
+}
+
+void TinyGPSDecimal::set(const char* term) {
+    newval = TinyGPSPlus::parseDecimal(term);
+}
+
+void TinyGPSInteger::commit() {
+    val = newval;
+    lastCommitTime = millis();
+    valid = updated = true;
+}
+
+void TinyGPSInteger::set(const char* term) {
+    newval = atol(term);
+}
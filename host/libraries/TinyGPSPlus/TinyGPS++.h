@@ -0,0 +1,204 @@
+#ifndef HOST_TINYGPS_PLUS_H
+#define HOST_TINYGPS_PLUS_H
+
+// Stand-in for Mikal Hart's TinyGPS++ 1.0.3, used when the real library is
+// not available to the host build (see host/CMakeLists.txt). The parsing and
+// commit rules are the library's: terms are committed only on a good
+// checksum, RMC commits date and time and, with a fix, location, speed and
+// course; GGA commits time, satellites and HDOP and, with a fix, location and
+// altitude. Custom fields and the distance helpers are left out.
+
+#include <Arduino.h>
+#include <limits.h>
+
+#define _GPS_VERSION "1.0.3"
+#define _GPS_MPH_PER_KNOT 1.15077945
+#define _GPS_MPS_PER_KNOT 0.51444444
+#define _GPS_KMPH_PER_KNOT 1.852
+#define _GPS_MAX_FIELD_SIZE 15
+
+struct RawDegrees {
+    uint16_t deg;
+    uint32_t billionths;
+    bool negative;
+
+public:
+    RawDegrees() : deg(0), billionths(0), negative(false) {}
+};
+
+struct TinyGPSLocation {
+    friend class TinyGPSPlus;
+
+public:
+    bool isValid() const { return valid; }
+    bool isUpdated() const { return updated; }
+    uint32_t age() const { return valid ? millis() - lastCommitTime : (uint32_t)ULONG_MAX; }
+    const RawDegrees& rawLat() { updated = false; return rawLatData; }
+    const RawDegrees& rawLng() { updated = false; return rawLngData; }
+    double lat();
+    double lng();
+
+    TinyGPSLocation() : valid(false), updated(false), lastCommitTime(0) {}
+
+private:
+    bool valid, updated;
+    RawDegrees rawLatData, rawLngData, rawNewLatData, rawNewLngData;
+    uint32_t lastCommitTime;
+    void commit();
+    void setLatitude(const char* term);
+    void setLongitude(const char* term);
+};
+
+struct TinyGPSDate {
+    friend class TinyGPSPlus;
+
+public:
+    bool isValid() const { return valid; }
+    bool isUpdated() const { return updated; }
+    uint32_t age() const { return valid ? millis() - lastCommitTime : (uint32_t)ULONG_MAX; }
+
+    uint32_t value() { updated = false; return date; }
+    uint16_t year();
+    uint8_t month();
+    uint8_t day();
+
+    TinyGPSDate() : valid(false), updated(false), date(0), newDate(0), lastCommitTime(0) {}
+
+private:
+    bool valid, updated;
+    uint32_t date, newDate;
+    uint32_t lastCommitTime;
+    void commit();
+    void setDate(const char* term);
+};
+
+struct TinyGPSTime {
+    friend class TinyGPSPlus;
+
+public:
+    bool isValid() const { return valid; }
+    bool isUpdated() const { return updated; }
+    uint32_t age() const { return valid ? millis() - lastCommitTime : (uint32_t)ULONG_MAX; }
+
+    uint32_t value() { updated = false; return time; }
+    uint8_t hour();
+    uint8_t minute();
+    uint8_t second();
+    uint8_t centisecond();
+
+    TinyGPSTime() : valid(false), updated(false), time(0), newTime(0), lastCommitTime(0) {}
+
+private:
+    bool valid, updated;
+    uint32_t time, newTime;
+    uint32_t lastCommitTime;
+    void commit();
+    void setTime(const char* term);
+};
+
+struct TinyGPSDecimal {
+    friend class TinyGPSPlus;
+
+public:
+    bool isValid() const { return valid; }
+    bool isUpdated() const { return updated; }
+    uint32_t age() const { return valid ? millis() - lastCommitTime : (uint32_t)ULONG_MAX; }
+    int32_t value() { updated = false; return val; }
+
+    TinyGPSDecimal() : valid(false), updated(false), lastCommitTime(0), val(0), newval(0) {}
+
+private:
+    bool valid, updated;
+    uint32_t lastCommitTime;
+    int32_t val, newval;
+    void commit();
+    void set(const char* term);
+};
+
+struct TinyGPSInteger {
+    friend class TinyGPSPlus;
+
+public:
+    bool isValid() const { return valid; }
+    bool isUpdated() const { return updated; }
+    uint32_t age() const { return valid ? millis() - lastCommitTime : (uint32_t)ULONG_MAX; }
+    uint32_t value() { updated = false; return val; }
+
+    TinyGPSInteger() : valid(false), updated(false), lastCommitTime(0), val(0), newval(0) {}
+
+private:
+    bool valid, updated;
+    uint32_t lastCommitTime;
+    uint32_t val, newval;
+    void commit();
+    void set(const char* term);
+};
+
+struct TinyGPSSpeed : TinyGPSDecimal {
+    double knots() { return value() / 100.0; }
+    double mph() { return _GPS_MPH_PER_KNOT * value() / 100.0; }
+    double mps() { return _GPS_MPS_PER_KNOT * value() / 100.0; }
+    double kmph() { return _GPS_KMPH_PER_KNOT * value() / 100.0; }
+};
+
+struct TinyGPSCourse : public TinyGPSDecimal {
+    double deg() { return value() / 100.0; }
+};
+
+struct TinyGPSAltitude : TinyGPSDecimal {
+    double meters() { return value() / 100.0; }
+};
+
+struct TinyGPSHDOP : TinyGPSDecimal {
+    double hdop() { return value() / 100.0; }
+};
+
+class TinyGPSPlus {
+public:
+    TinyGPSPlus();
+    bool encode(char c);        // Process one character received from GPS
+    TinyGPSPlus& operator<<(char c) { encode(c); return *this; }
+
+    TinyGPSLocation location;
+    TinyGPSDate date;
+    TinyGPSTime time;
+    TinyGPSSpeed speed;
+    TinyGPSCourse course;
+    TinyGPSAltitude altitude;
+    TinyGPSInteger satellites;
+    TinyGPSHDOP hdop;
+
+    static const char* libraryVersion() { return _GPS_VERSION; }
+
+    static int32_t parseDecimal(const char* term);
+    static void parseDegrees(const char* term, RawDegrees& deg);
+
+    uint32_t charsProcessed() const { return encodedCharCount; }
+    uint32_t sentencesWithFix() const { return sentencesWithFixCount; }
+    uint32_t failedChecksum() const { return failedChecksumCount; }
+    uint32_t passedChecksum() const { return passedChecksumCount; }
+
+private:
+    enum { GPS_SENTENCE_GPGGA, GPS_SENTENCE_GPRMC, GPS_SENTENCE_OTHER };
+
+    // Parsing state variables
+    uint8_t parity;
+    bool isChecksumTerm;
+    char term[_GPS_MAX_FIELD_SIZE];
+    uint8_t curSentenceType;
+    uint8_t curTermNumber;
+    uint8_t curTermOffset;
+    bool sentenceHasFix;
+
+    // Statistics
+    uint32_t encodedCharCount;
+    uint32_t sentencesWithFixCount;
+    uint32_t failedChecksumCount;
+    uint32_t passedChecksumCount;
+
+    // Internal utilities
+    int fromHex(char a);
+    bool endOfTermHandler();
+};
+
+#endif // HOST_TINYGPS_PLUS_H
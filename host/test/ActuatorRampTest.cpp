@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "HostRuntime.h"
+#include "ActuatorModule.h"
+
+// The actuator ramp generator on the esp_timer stand-in, read back from the
+// LEDC duty and direction pins once per 5 ms tick.
+namespace {
+
+const uint8_t SERVO_CHANNEL = 0;
+const uint8_t MOTOR_CHANNEL = 8;
+const uint8_t MOTOR_STBY = 33;
+const uint8_t MOTOR_IN1 = 27;
+const uint8_t MOTOR_IN2 = 26;
+
+class ActuatorRampTest : public ::testing::Test {
+protected:
+    ActuatorModule actuators;
+
+    void SetUp() override {
+        host::reset();
+        ASSERT_TRUE(actuators.begin());
+        ASSERT_TRUE(actuators.beginMotor());
+    }
+
+    // Signed motor drive as the TB6612 sees it: duty with the sign from IN1/IN2
+    int motorDrive() {
+        int in1 = host::pinLevel(MOTOR_IN1);
+        int in2 = host::pinLevel(MOTOR_IN2);
+        EXPECT_FALSE(in1 == HIGH && in2 == HIGH) << "both bridge inputs high at " << millis() << " ms";
+        int duty = (int)host::ledcDuty(MOTOR_CHANNEL);
+        return in2 == HIGH ? -duty : duty;
+    }
+
+    std::vector<int> recordMotor(uint32_t duration_ms) {
+        std::vector<int> drive;
+        for (uint32_t t = 0; t < duration_ms; t += 5) {
+            host::runFor(5);
+            drive.push_back(motorDrive());
+            EXPECT_EQ(drive.back(), actuators.getMotorSpeed());
+        }
+        return drive;
+    }
+};
+
+TEST_F(ActuatorRampTest, ServoSlewsAtTheConfiguredRate) {
+    host::runFor(20);
+    uint32_t centre = host::ledcDuty(SERVO_CHANNEL);
+    actuators.setPosition(180);
+
+    int previous = actuators.getPosition();
+    uint32_t arrived_ms = 0;
+    for (uint32_t t = 5; t <= 1000 && arrived_ms == 0; t += 5) {
+        host::runFor(5);
+        int position = actuators.getPosition();
+        EXPECT_LE(abs(position - previous), 1);         // 180°/s is 0.9° per tick
+        previous = position;
+        if (position == 180) {
+            arrived_ms = t;
+        }
+    }
+    EXPECT_NEAR(arrived_ms, 500, 10);
+    // 1.5 ms to 2 ms pulse in a 20 ms period at 16 bits
+    EXPECT_NEAR(host::ledcDuty(SERVO_CHANNEL) - centre, (2000 - 1500) * 65535 / 20000, 2);
+
+    actuators.setServoSlewRate(360.0f);
+    actuators.setPosition(0);
+    host::runFor(505);
+    EXPECT_EQ(actuators.getPosition(), 0);
+}
+
+TEST_F(ActuatorRampTest, MotorRampIsAccelerationAndJerkLimited) {
+    actuators.setMotorSpeed(255);
+    std::vector<int> drive = recordMotor(1000);
+
+    int previous_step = 0;
+    size_t arrived = 0;
+    for (size_t i = 1; i < drive.size(); i++) {
+        int step = drive[i] - drive[i - 1];
+        EXPECT_GE(step, 0) << "tick " << i;
+        EXPECT_LE(step, 3) << "tick " << i;         // 510 counts/s is 2.55 per tick
+        EXPECT_LE(abs(step - previous_step), 1) << "tick " << i;
+        previous_step = step;
+        if (drive[i] == 255 && arrived == 0) {
+            arrived = i;
+        }
+    }
+    // 0.2 s to reach the slope limit, 0.3 s at it and 0.2 s easing off: about 0.7 s
+    EXPECT_GT(arrived * 5, 650u);
+    EXPECT_LT(arrived * 5, 800u);
+    EXPECT_EQ(host::pinLevel(MOTOR_STBY), HIGH);
+}
+
+TEST_F(ActuatorRampTest, ReversalPassesSmoothlyThroughZero) {
+    actuators.setMotorSpeed(255);
+    host::runFor(1000);
+    actuators.setMotorSpeed(-255);
+    std::vector<int> drive = recordMotor(2000);
+
+    bool crossed = false;
+    for (size_t i = 1; i < drive.size(); i++) {
+        EXPECT_LE(drive[i], drive[i - 1]) << "tick " << i;
+        EXPECT_LE(drive[i - 1] - drive[i], 3) << "tick " << i;
+        crossed = crossed || (drive[i - 1] > 0 && drive[i] <= 0);
+    }
+    EXPECT_TRUE(crossed);
+    EXPECT_EQ(drive.back(), -255);
+    EXPECT_EQ(host::pinLevel(MOTOR_IN1), LOW);
+    EXPECT_EQ(host::pinLevel(MOTOR_IN2), HIGH);
+}
+
+TEST_F(ActuatorRampTest, StopRampsDownAndDisableCutsAtOnce) {
+    actuators.setMotorSpeed(200);
+    host::runFor(1000);
+    ASSERT_EQ(actuators.getMotorSpeed(), 200);
+
+    actuators.stopMotor();
+    host::runFor(5);
+    EXPECT_GT(actuators.getMotorSpeed(), 190);
+    host::runFor(1000);
+    EXPECT_EQ(actuators.getMotorSpeed(), 0);
+
+    actuators.setMotorSpeed(200);
+    host::runFor(1000);
+    actuators.disableMotor();
+    EXPECT_EQ(host::pinLevel(MOTOR_STBY), LOW);
+    host::runFor(5);
+    EXPECT_EQ(host::ledcDuty(MOTOR_CHANNEL), 0u);
+    EXPECT_EQ(actuators.getMotorSpeed(), 0);
+
+    // Re-enabling ramps up from zero again
+    actuators.enableMotor();
+    actuators.setMotorSpeed(200);
+    host::runFor(5);
+    EXPECT_LE(actuators.getMotorSpeed(), 1);
+}
+
+TEST_F(ActuatorRampTest, TickCostAndRate) {
+    // Host time per tick, including the scheduler dispatching the timer callback; the
+    // callback's own micros() figures are below the stand-in clock's resolution
+    uint32_t ticks = actuators.getRampTicks();
+    auto started = std::chrono::steady_clock::now();
+    for (int i = 0; i < 10; i++) {
+        actuators.setMotorSpeed(i % 2 ? -255 : 255);
+        actuators.setPosition(i % 2 ? 0 : 180);
+        host::runFor(1000);
+    }
+    double elapsed_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - started).count();
+    uint32_t run = actuators.getRampTicks() - ticks;
+
+    EXPECT_NEAR(run, 2000, 2);      // 200 Hz
+    RecordProperty("ramp_tick_ns", std::to_string(elapsed_ns / run));
+    printf("Ramp tick: %.0f ns on the host over %lu ticks\n", elapsed_ns / run, (unsigned long)run);
+    EXPECT_LT(elapsed_ns / run, 50000.0);
+}
+
+}
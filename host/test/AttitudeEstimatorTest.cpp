@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <math.h>
+#include <functional>
+#include "AttitudeEstimator.h"
+
+// AttitudeEstimator against synthetic rotation traces: the true roll, pitch
+// and yaw are functions of time, and the IMU samples are what a perfect
+// MPU6050 strapped to that attitude would read at 1 kHz.
+namespace {
+
+const double G = 9.80665;
+const uint32_t PERIOD_US = 1000;
+
+struct Angles {
+    double roll, pitch, yaw;        // rad, ZYX
+};
+
+typedef std::function<Angles(double t)> Trace;
+
+ImuSample sampleAt(const Trace& trace, double t, uint32_t timestamp_us) {
+    const double h = 1e-5;
+    Angles a = trace(t);
+    Angles before = trace(t - h), after = trace(t + h);
+    double droll = (after.roll - before.roll) / (2 * h);
+    double dpitch = (after.pitch - before.pitch) / (2 * h);
+    double dyaw = (after.yaw - before.yaw) / (2 * h);
+
+    ImuSample sample;
+    sample.timestamp_us = timestamp_us;
+    // Body rates from Euler rates
+    sample.gyro_x = (float)(droll - dyaw * sin(a.pitch));
+    sample.gyro_y = (float)(dpitch * cos(a.roll) + dyaw * sin(a.roll) * cos(a.pitch));
+    sample.gyro_z = (float)(-dpitch * sin(a.roll) + dyaw * cos(a.roll) * cos(a.pitch));
+    // Specific force at rest: gravity's reaction, rotated into the body frame
+    sample.accel_x = (float)(-G * sin(a.pitch));
+    sample.accel_y = (float)(G * sin(a.roll) * cos(a.pitch));
+    sample.accel_z = (float)(G * cos(a.roll) * cos(a.pitch));
+    return sample;
+}
+
+double wrapDegrees(double angle) {
+    while (angle > 180) angle -= 360;
+    while (angle < -180) angle += 360;
+    return angle;
+}
+
+struct Errors {
+    double roll, pitch, yaw;        // Worst absolute error, degrees
+};
+
+// Runs the trace for `seconds`, measuring errors after the first `settle` seconds
+Errors track(AttitudeEstimator& filter, const Trace& trace, double seconds, double settle,
+             const float gyro_bias[3] = NULL) {
+    Errors worst = { 0, 0, 0 };
+    uint32_t steps = (uint32_t)(seconds * 1e6 / PERIOD_US);
+    for (uint32_t i = 0; i <= steps; i++) {
+        double t = i * PERIOD_US * 1e-6;
+        ImuSample sample = sampleAt(trace, t, 5000 + i * PERIOD_US);
+        if (gyro_bias != NULL) {
+            sample.gyro_x += gyro_bias[0];
+            sample.gyro_y += gyro_bias[1];
+            sample.gyro_z += gyro_bias[2];
+        }
+        filter.update(sample);
+        if (t < settle) {
+            continue;
+        }
+        Angles truth = trace(t);
+        float roll, pitch, yaw;
+        filter.getEuler(roll, pitch, yaw);
+        worst.roll = fmax(worst.roll, fabs(wrapDegrees(roll - truth.roll * RAD_TO_DEG)));
+        worst.pitch = fmax(worst.pitch, fabs(wrapDegrees(pitch - truth.pitch * RAD_TO_DEG)));
+        worst.yaw = fmax(worst.yaw, fabs(wrapDegrees(yaw - truth.yaw * RAD_TO_DEG)));
+    }
+    return worst;
+}
+
+TEST(AttitudeEstimatorTest, StaticTiltIsSeededFromGravity) {
+    AttitudeEstimator filter;
+    Trace tilted = [](double) { return Angles{ 15 * DEG_TO_RAD, -8 * DEG_TO_RAD, 0 }; };
+    Errors errors = track(filter, tilted, 0.01, 0);
+    EXPECT_LT(errors.roll, 0.1);
+    EXPECT_LT(errors.pitch, 0.1);
+    EXPECT_LT(errors.yaw, 0.1);
+}
+
+TEST(AttitudeEstimatorTest, TracksRollingAndPitchingWhileTurning) {
+    AttitudeEstimator filter;
+    // Swell: ±20° roll at 0.2 Hz and ±10° pitch at 0.13 Hz, while turning at 10°/s
+    Trace swell = [](double t) {
+        return Angles{ 20 * DEG_TO_RAD * sin(2 * PI * 0.2 * t),
+                       10 * DEG_TO_RAD * sin(2 * PI * 0.13 * t),
+                       10 * DEG_TO_RAD * t };
+    };
+    Errors errors = track(filter, swell, 60, 1);
+    EXPECT_LT(errors.roll, 2.0);
+    EXPECT_LT(errors.pitch, 2.0);
+    EXPECT_LT(errors.yaw, 2.0);
+    EXPECT_EQ(filter.getUpdateCount(), 60000u);
+}
+
+TEST(AttitudeEstimatorTest, AccelerometerHoldsRollAndPitchAgainstGyroBias) {
+    AttitudeEstimator filter;
+    Trace level = [](double) { return Angles{ 0, 0, 0 }; };
+    const float bias[3] = { 0.01f, -0.01f, 0.01f };     // 0.57°/s, a poorly calibrated MPU6050
+    Errors errors = track(filter, level, 120, 0, bias);
+    EXPECT_LT(errors.roll, 3.0);
+    EXPECT_LT(errors.pitch, 3.0);
+    float roll, pitch, yaw;
+    filter.getEuler(roll, pitch, yaw);
+    EXPECT_NEAR(yaw, 120 * 0.01 * RAD_TO_DEG, 5.0);     // Without a magnetometer, yaw integrates the bias
+}
+
+TEST(AttitudeEstimatorTest, GapInSamplesRestartsIntegration) {
+    AttitudeEstimator filter;
+    Trace level = [](double) { return Angles{ 0, 0, 0 }; };
+    track(filter, level, 0.1, 0);
+    uint32_t updates = filter.getUpdateCount();
+
+    ImuSample late = sampleAt(level, 0, 5000 + 100 * PERIOD_US + 200000);
+    late.gyro_z = 10.0f;
+    filter.update(late);
+    EXPECT_EQ(filter.getUpdateCount(), updates);        // Not integrated over the 200 ms gap
+    float roll, pitch, yaw;
+    filter.getEuler(roll, pitch, yaw);
+    EXPECT_NEAR(yaw, 0.0f, 0.1f);
+}
+
+}
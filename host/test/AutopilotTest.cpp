@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <math.h>
+#include <string>
+#include <vector>
+#include "HostRuntime.h"
+#include "HostNetwork.h"
+#include "Firmware.h"
+
+// Heading hold on the simulated hull (SIMULATION_ENABLED build): a 90° step
+// through /autopilot, judged on the simulator's true heading rather than the
+// controller's own estimate. Each test boots the firmware once; ctest runs
+// every test in its own process.
+namespace {
+
+// Reads one numeric field from a flat JSON object
+double jsonNumber(const std::string& body, const char* name) {
+    std::string key = std::string("\"") + name + "\":";
+    size_t at = body.find(key);
+    return at == std::string::npos ? NAN : atof(body.c_str() + at + key.size());
+}
+
+class AutopilotTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        host::reset();
+        host::bootFirmware();
+        ASSERT_TRUE(host::runUntil([]() { return boot.isComplete(); }, 20000));
+        request("/motor?speed=255");
+        // Up to speed, so GPS course has aligned the heading estimate
+        ASSERT_TRUE(host::runUntil([]() { return autopilot.isHeadingValid(); }, 30000));
+        host::runFor(10000);
+    }
+
+    std::string request(const char* uri) {
+        host::HttpResponse response;
+        EXPECT_TRUE(host::httpRequest(80, "GET", uri, response));
+        EXPECT_EQ(response.code, 200) << uri << ": " << response.body;
+        return response.body;
+    }
+};
+
+TEST_F(AutopilotTest, NinetyDegreeStepResponse) {
+    const float start = simulator.getHeading();
+    const float step = 90.0f;
+    char uri[48];
+    snprintf(uri, sizeof(uri), "/autopilot?heading=%.1f", HeadingController::wrapHeading(start + step));
+    request(uri);
+
+    // True heading progress toward the target, every 100 ms for 60 s
+    std::vector<float> progress;
+    float integral_max = 0, rudder_max = 0;
+    uint32_t ticks_before = autopilot.getTicks();
+    for (int i = 0; i < 600; i++) {
+        host::runFor(100);
+        progress.push_back(-HeadingController::headingError(start, simulator.getHeading()));
+        integral_max = fmaxf(integral_max, fabsf(autopilot.getIntegral()));
+        rudder_max = fmaxf(rudder_max, fabsf(autopilot.getRudder()));
+    }
+
+    int rise_start = -1, rise_end = -1, settled = -1;
+    float peak = 0;
+    for (size_t i = 0; i < progress.size(); i++) {
+        if (rise_start < 0 && progress[i] >= 0.1f * step) {
+            rise_start = i;
+        }
+        if (rise_end < 0 && progress[i] >= 0.9f * step) {
+            rise_end = i;
+        }
+        peak = fmaxf(peak, progress[i]);
+        if (fabsf(progress[i] - step) > 5.0f) {
+            settled = -1;
+        } else if (settled < 0) {
+            settled = i;
+        }
+    }
+    float rise_s = (rise_end - rise_start) / 10.0f;
+    float settle_s = (settled + 1) / 10.0f;
+    float overshoot = peak - step;
+    printf("Rise (10-90%%) %.1f s, overshoot %.1f°, within 5° from %.1f s, final error %.2f°, "
+           "|integral| max %.2f°, |rudder| max %.1f°\n",
+           rise_s, overshoot, settle_s, progress.back() - step, integral_max, rudder_max);
+
+    ASSERT_GE(rise_start, 0);
+    ASSERT_GE(rise_end, 0);
+    ASSERT_GE(settled, 0) << "never settled within 5°";
+    EXPECT_LT(rise_s, 10.0f);
+    EXPECT_LT(overshoot, 10.0f);
+    EXPECT_LT(settle_s, 15.0f);
+    EXPECT_NEAR(progress.back(), step, 1.0f);
+    EXPECT_LT(integral_max, 10.0f);         // Conditional integration: no windup during the turn
+    EXPECT_LE(rudder_max, 35.0f);
+
+    // Tick timing as /autopilot reports it: one tick per 20 ms, none late on the virtual clock
+    std::string stats = request("/autopilot");
+    printf("%s\n", stats.c_str());
+    EXPECT_NEAR(autopilot.getTicks() - ticks_before, 60000 / autopilot.getPeriodMs(), 5);
+    EXPECT_EQ(jsonNumber(stats, "period_ms"), 20);
+    EXPECT_LT(jsonNumber(stats, "jitter_us_max"), 1000);
+    EXPECT_LE(jsonNumber(stats, "compute_us_avg"), jsonNumber(stats, "compute_us_max"));
+    EXPECT_NEAR(jsonNumber(stats, "error"), 0.0, 1.0);
+}
+
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include <math.h>
+#include "HostRuntime.h"
+#include "Firmware.h"
+#include "SensorRig.h"
+#include <Adafruit_BMP280.h>
+
+// The firmware's BMP280 burst read, integer compensation and pow()-free
+// altitude over a temperature/pressure grid, against the datasheet's
+// floating-point compensation and the Adafruit library's read path.
+namespace {
+
+// Bmp280Model's trimming parameters (datasheet section 3.12)
+const double T1 = 27504, T2 = 26435, T3 = -1000;
+const double P1 = 36477, P2 = -10685, P3 = 3024, P4 = 2855, P5 = 140, P6 = -7, P7 = 15500, P8 = -14600, P9 = 6000;
+
+// Datasheet section 8.1, double precision
+double referenceTFine(int32_t adc_T) {
+    double var1 = (adc_T / 16384.0 - T1 / 1024.0) * T2;
+    double var2 = (adc_T / 131072.0 - T1 / 8192.0) * (adc_T / 131072.0 - T1 / 8192.0) * T3;
+    return var1 + var2;
+}
+
+double referencePressure(int32_t adc_P, double t_fine) {
+    double var1 = t_fine / 2.0 - 64000.0;
+    double var2 = var1 * var1 * P6 / 32768.0;
+    var2 = var2 + var1 * P5 * 2.0;
+    var2 = var2 / 4.0 + P4 * 65536.0;
+    var1 = (P3 * var1 * var1 / 524288.0 + P2 * var1) / 524288.0;
+    var1 = (1.0 + var1 / 32768.0) * P1;
+    double p = 1048576.0 - adc_P;
+    p = (p - var2 / 4096.0) * 6250.0 / var1;
+    var1 = P9 * p * p / 2147483648.0;
+    var2 = p * P8 / 32768.0;
+    return p + (var1 + var2 + P7) / 16.0;   // Pa
+}
+
+// Raw readings for a temperature and pressure; both are monotonic in the ADC value
+int32_t rawTemperature(double celsius) {
+    int32_t low = 0, high = (1 << 20) - 1;
+    while (low < high) {
+        int32_t mid = (low + high) / 2;
+        if (referenceTFine(mid) / 5120.0 < celsius) low = mid + 1; else high = mid;
+    }
+    return low;
+}
+
+int32_t rawPressure(double pascals, double t_fine) {
+    int32_t low = 0, high = (1 << 20) - 1;
+    while (low < high) {
+        int32_t mid = (low + high) / 2;
+        if (referencePressure(mid, t_fine) > pascals) low = mid + 1; else high = mid;
+    }
+    return low;
+}
+
+class BarometerTest : public ::testing::Test {
+protected:
+    SensorRig rig;
+    SensorModule module;
+    Adafruit_BMP280 library;
+
+    void SetUp() override {
+        host::reset();
+        module.beginBus();
+        ASSERT_TRUE(module.beginBMP());
+        ASSERT_TRUE(library.begin(0x76));
+        module.setBMPInterval(0);
+    }
+};
+
+TEST_F(BarometerTest, CompensationMatchesTheReferenceOverTheGrid) {
+    const float sea_level = 1023;   // SensorModule default
+    double worst_temperature = 0, worst_pressure = 0, worst_altitude = 0;
+
+    for (double celsius = -20; celsius <= 60; celsius += 10) {
+        for (double hpa = 800; hpa <= 1080; hpa += 20) {
+            int32_t adc_T = rawTemperature(celsius);
+            double t_fine = referenceTFine(adc_T);
+            int32_t adc_P = rawPressure(hpa * 100, t_fine);
+            rig.bmp.setRaw(adc_P, adc_T);
+            host::runFor(1);
+            module.update();
+
+            double temperature = module.readBMPTemperature();
+            double pressure = module.readBMPPressure();
+            double altitude = module.readBMPAltitude();
+            double reference_pressure = referencePressure(adc_P, t_fine) / 100;
+
+            // The integer path rounds to 0.01 °C and 1/256 Pa
+            EXPECT_NEAR(temperature, t_fine / 5120.0, 0.01) << celsius << " °C";
+            EXPECT_NEAR(pressure, reference_pressure, 0.01) << hpa << " hPa at " << celsius << " °C";
+            // Same compensation as the library, so the same reading, and altitude within 1 cm of pow()
+            EXPECT_NEAR(temperature, library.readTemperature(), 1e-4);
+            EXPECT_NEAR(pressure, library.readPressure() / 100, 1e-4);
+            EXPECT_NEAR(altitude, library.readAltitude(sea_level), 0.01) << hpa << " hPa";
+
+            worst_temperature = fmax(worst_temperature, fabs(temperature - t_fine / 5120.0));
+            worst_pressure = fmax(worst_pressure, fabs(pressure - reference_pressure));
+            worst_altitude = fmax(worst_altitude, fabs(altitude - 44330.0 * (1.0 - pow(pressure / sea_level, 0.1903))));
+        }
+    }
+    printf("Worst error: temperature %.4f °C, pressure %.2f Pa, altitude %.2f mm\n",
+           worst_temperature, worst_pressure * 100, worst_altitude * 1000);
+}
+
+TEST_F(BarometerTest, OneBurstPerSample) {
+    uint32_t before = Wire.getTransactions();
+    module.update();
+    uint32_t burst = Wire.getTransactions() - before;
+
+    before = Wire.getTransactions();
+    library.readTemperature();
+    library.readPressure();
+    library.readAltitude();
+    uint32_t adafruit = Wire.getTransactions() - before;
+
+    EXPECT_EQ(burst, 2u);       // Register pointer, then six bytes
+    EXPECT_EQ(adafruit, 10u);   // Five three-byte reads, each with its pointer write
+}
+
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include "HostRuntime.h"
+#include "Firmware.h"
+#include "SensorRig.h"
+
+// The hardware build on the sensor models. Each test boots the firmware once;
+// ctest runs every test in its own process, so the sketch's globals start clean.
+namespace {
+
+bool waitForBoot(uint32_t timeout_ms) {
+    return host::runUntil([]() { return boot.isComplete(); }, timeout_ms);
+}
+
+TEST(BootTest, EverySubsystemComesUpOnTheBoard) {
+    SensorRig rig;
+    host::reset();
+    rig.start();
+    host::bootFirmware();
+
+    ASSERT_TRUE(waitForBoot(20000));
+    for (int i = 0; i < BOOT_SUBSYSTEM_COUNT; i++) {
+        EXPECT_EQ(boot.getState((BootSubsystem)i), BOOT_READY) << BootSequence::getName((BootSubsystem)i);
+    }
+    EXPECT_TRUE(sensor_module.isGPSUbx());
+    EXPECT_EQ(rig.gps.getBaud(), 115200u);
+    EXPECT_EQ(rig.gps.getMeasurementMs(), 200u);
+}
+
+TEST(BootTest, MissingBarometerFailsOnlyItself) {
+    SensorRig rig;
+    Wire.detach(0x76);
+    host::reset();
+    rig.start();
+    host::bootFirmware();
+
+    ASSERT_TRUE(waitForBoot(20000));
+    EXPECT_EQ(boot.getState(BOOT_BAROMETER), BOOT_FAILED);
+    EXPECT_GE(boot.getSettledMillis(BOOT_BAROMETER), 3000u);
+    EXPECT_EQ(boot.getState(BOOT_IMU), BOOT_READY);
+    EXPECT_EQ(boot.getState(BOOT_GPS), BOOT_READY);
+}
+
+TEST(BootTest, FailedBarometerIsProbedAgain) {
+    SensorRig rig;
+    Wire.detach(0x76);
+    host::reset();
+    rig.start();
+    host::bootFirmware();
+
+    ASSERT_TRUE(waitForBoot(20000));
+    ASSERT_EQ(boot.getState(BOOT_BAROMETER), BOOT_FAILED);
+
+    // Reseated after boot: up within one slow probe interval
+    Wire.attach(0x76, &rig.bmp);
+    uint32_t attached_ms = millis();
+    ASSERT_TRUE(host::runUntil([]() { return boot.isUp(BOOT_BAROMETER); }, 6000));
+    EXPECT_EQ(boot.getState(BOOT_BAROMETER), BOOT_READY);
+    EXPECT_GE(boot.getSettledMillis(BOOT_BAROMETER), attached_ms);
+    EXPECT_TRUE(sensor_module.isBMPInitialized());
+}
+
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "HostRuntime.h"
+#include "HostNetwork.h"
+#include "Firmware.h"
+#include "SensorRig.h"
+
+// A burst of /servo and /control requests, all queued within one control
+// tick, against the hardware build with host CPU time charged. The WebServer
+// answers one request per web task pass, as the real one does, so the burst
+// drains over several 20 ms ticks; each tick must apply at most one command,
+// the latest of each field. Each test boots the firmware once; ctest runs
+// every test in its own process.
+namespace {
+
+double jsonNumber(const std::string& body, const char* name) {
+    std::string key = std::string("\"") + name + "\":";
+    size_t at = body.find(key);
+    return at == std::string::npos ? -1 : atof(body.c_str() + at + key.size());
+}
+
+struct Posted {
+    uint32_t id;
+    int servo;                  // -1 when the request does not set it
+    int motor;
+};
+
+TEST(ControlStormTest, BurstCoalescesToOneUpdatePerTick) {
+    SensorRig rig;
+    host::reset();
+    rig.start();
+    host::setChargeCpuTime(true);
+    host::bootFirmware();
+    ASSERT_TRUE(host::runUntil([]() { return WiFi.status() == WL_CONNECTED; }, 20000));
+    host::runFor(1000);
+
+    host::HttpResponse response;
+    ASSERT_TRUE(host::httpRequest(80, "GET", "/control", response));
+    std::string before = response.body;
+    web_profiler.reset();
+
+    // 400 requests at one instant: slider drags on /servo interleaved with combined /control
+    const int REQUESTS = 400;
+    std::vector<Posted> posted;
+    char target[64];
+    for (int i = 0; i < REQUESTS; i++) {
+        Posted request = { 0, 30 + (i * 7) % 120, -1 };
+        if (i % 2) {
+            request.motor = -200 + (i * 13) % 400;
+            snprintf(target, sizeof(target), "/control?servo=%d&motor=%d", request.servo, request.motor);
+        } else {
+            snprintf(target, sizeof(target), "/servo?angle=%d", request.servo);
+        }
+        request.id = host::queueHttpRequest(80, "GET", target);
+        ASSERT_NE(request.id, 0u);
+        posted.push_back(request);
+    }
+    uint64_t start_us = host::nowMicros();
+
+    // Answers come back in order; whenever a target moves it must be the latest answered value
+    size_t answered = 0;
+    int latest_servo = -1, latest_motor = 0;
+    int servo_target = actuator_module.getTargetPosition();
+    int motor_target = actuator_module.getTargetMotorSpeed();
+    uint32_t target_changes = 0, stale_targets = 0;
+    ASSERT_TRUE(host::runUntil([&]() {
+        while (answered < posted.size() && host::takeHttpResponse(posted[answered].id, response)) {
+            EXPECT_EQ(response.code, 200);
+            latest_servo = posted[answered].servo;
+            if (posted[answered].motor != -1) {
+                latest_motor = posted[answered].motor;
+            }
+            answered++;
+        }
+        int servo = actuator_module.getTargetPosition();
+        int motor = actuator_module.getTargetMotorSpeed();
+        if (servo != servo_target || motor != motor_target) {
+            target_changes++;
+            if (servo != latest_servo || motor != latest_motor) {
+                stale_targets++;
+            }
+            servo_target = servo;
+            motor_target = motor;
+        }
+        return answered == posted.size();
+    }, 5000));
+    host::runFor(40);   // The tick after the last answer
+    double elapsed_ms = (host::nowMicros() - start_us) / 1000.0;
+
+    ASSERT_TRUE(host::httpRequest(80, "GET", "/control", response));
+    std::string after = response.body;
+    double posts = jsonNumber(after, "posted") - jsonNumber(before, "posted");
+    double coalesced = jsonNumber(after, "coalesced") - jsonNumber(before, "coalesced");
+    double ticks = jsonNumber(after, "ticks") - jsonNumber(before, "ticks");
+    double updates = jsonNumber(after, "updates") - jsonNumber(before, "updates");
+    printf("%d requests drained in %.1f ms: %.0f ticks took a command, %.0f updates, %.0f coalesced, "
+           "%u target changes; web iteration p99 %lu us, max %lu us\n",
+           REQUESTS, elapsed_ms, ticks, updates, coalesced, target_changes,
+           (unsigned long)web_profiler.getPercentile(99), (unsigned long)web_profiler.getMaxLatency());
+
+    // Every post either started a command or merged into the pending one
+    EXPECT_EQ(posts, REQUESTS);
+    EXPECT_EQ(coalesced, posts - ticks);
+    EXPECT_GT(coalesced, REQUESTS / 2);
+    // At most one actuator update per 20 ms tick, each carrying the latest values
+    EXPECT_LE(ticks, elapsed_ms / 20 + 1);
+    EXPECT_LE(updates, ticks);
+    EXPECT_LE(target_changes, updates);
+    EXPECT_EQ(stale_targets, 0u);
+    EXPECT_EQ(actuator_module.getTargetPosition(), posted.back().servo);
+    EXPECT_EQ(actuator_module.getTargetMotorSpeed(), posted.back().motor);
+    // The burst never holds the web task up
+    EXPECT_LT(web_profiler.getMaxLatency(), 2000u);
+}
+
+}
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include <LittleFS.h>
+#include <vector>
+#include "HostRuntime.h"
+#include "HostNetwork.h"
+#include "Firmware.h"
+#include "SensorRig.h"
+
+// The booted firmware's flight recorder on the LittleFS stand-in: sustained
+// record rate and size, and a log that decodes block by block the way
+// tools/decode_flight_log.py reads it, and the oldest logs making room on a
+// full partition. Each test boots the firmware once, so run them through
+// ctest, which gives every test its own process.
+namespace {
+
+struct DecodedLog {
+    uint32_t blocks;
+    uint32_t dropped;
+    std::vector<std::vector<int32_t>> records;
+};
+
+uint32_t readUint32(const uint8_t* in) {
+    return in[0] | (in[1] << 8) | (in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+bool decode(const char* path, DecodedLog& log) {
+    File file = LittleFS.open(path, FILE_READ);
+    if (!file) {
+        return false;
+    }
+    log = DecodedLog{ 0, 0, {} };
+    uint8_t block[FlightRecorder::BLOCK_SIZE];
+    while (file.read(block, sizeof(block)) == sizeof(block)) {
+        if (memcmp(block, "ALOG", 4) != 0 || block[4] != FlightRecorder::FORMAT_VERSION
+            || block[5] != FlightRecorder::FIELD_COUNT || readUint32(block + 8) != log.blocks) {
+            return false;
+        }
+        size_t end = FlightRecorder::HEADER_SIZE + (block[6] | (block[7] << 8));
+        log.dropped += readUint32(block + 12);
+
+        std::vector<int32_t> previous(FlightRecorder::FIELD_COUNT, 0);
+        size_t offset = FlightRecorder::HEADER_SIZE;
+        while (offset < end) {
+            std::vector<int32_t> record(FlightRecorder::FIELD_COUNT);
+            for (int i = 0; i < FlightRecorder::FIELD_COUNT; i++) {
+                uint32_t zigzag = 0;
+                for (int shift = 0; ; shift += 7) {
+                    uint8_t byte = block[offset++];
+                    zigzag |= (uint32_t)(byte & 0x7F) << shift;
+                    if (!(byte & 0x80)) {
+                        break;
+                    }
+                }
+                uint32_t delta = (zigzag >> 1) ^ (0u - (zigzag & 1));
+                record[i] = (int32_t)((uint32_t)previous[i] + delta);
+            }
+            previous = record;
+            log.records.push_back(record);
+        }
+        log.blocks++;
+    }
+    return true;
+}
+
+class FlightRecorderTest : public ::testing::Test {
+protected:
+    SensorRig rig;
+
+    void SetUp() override {
+        host::reset();
+        LittleFS.wipe();
+        rig.start();
+        host::bootFirmware();
+        ASSERT_TRUE(host::runUntil([]() { return boot.isComplete(); }, 20000));
+        ASSERT_EQ(boot.getState(BOOT_RECORDER), BOOT_READY);
+    }
+};
+
+TEST_F(FlightRecorderTest, SustainsFiftyRecordsPerSecondWithoutDrops) {
+    uint32_t records = flight_recorder.getRecordsRecorded();
+    host::runFor(300000);
+    double rate = (flight_recorder.getRecordsRecorded() - records) / 300.0;
+
+    RecordProperty("records_per_second", std::to_string(rate));
+    printf("Recorded %.1f records/s, %lu KiB flashed\n", rate, (unsigned long)(flight_recorder.getBytesFlashed() / 1024));
+    EXPECT_NEAR(rate, 50.0, 0.5);
+    EXPECT_EQ(flight_recorder.getRecordsDropped(), 0u);
+    EXPECT_TRUE(flight_recorder.isActive());
+}
+
+TEST_F(FlightRecorderTest, LogDecodesToEveryFlashedRecord) {
+    host::runFor(60000);
+    flight_recorder.stop();
+    host::runFor(500);                  // The writer flushes the last block and closes the file
+    ASSERT_FALSE(flight_recorder.isActive());
+
+    DecodedLog log;
+    ASSERT_TRUE(decode(flight_recorder.getFilePath(), log));
+    ASSERT_GT(log.records.size(), 0u);
+    EXPECT_EQ(log.records.size(), flight_recorder.getRecordsRecorded());
+    EXPECT_EQ(log.dropped, 0u);
+    EXPECT_EQ(log.blocks * FlightRecorder::BLOCK_SIZE, flight_recorder.getBytesFlashed());
+
+    // Records follow the sensor task's snapshots, on a 20 ms grid on average
+    for (size_t i = 1; i < log.records.size(); i++) {
+        int32_t interval = log.records[i][FlightRecorder::TIMESTAMP_MS] - log.records[i - 1][FlightRecorder::TIMESTAMP_MS];
+        EXPECT_GT(interval, 10) << "record " << i;
+        EXPECT_LT(interval, 30) << "record " << i;
+    }
+    double span_ms = log.records.back()[FlightRecorder::TIMESTAMP_MS] - log.records.front()[FlightRecorder::TIMESTAMP_MS];
+    EXPECT_NEAR(span_ms / (log.records.size() - 1), 20.0, 0.2);
+
+    double bytes_per_record = (double)flight_recorder.getBytesFlashed() / log.records.size();
+    RecordProperty("flash_bytes_per_record", std::to_string(bytes_per_record));
+    printf("%zu records in %lu blocks, %.1f flash bytes/record\n", log.records.size(), (unsigned long)log.blocks,
+           bytes_per_record);
+    EXPECT_LT(bytes_per_record, 60.0);  // Against 27 fields * 4 bytes raw
+
+    // At rest and level on the bench
+    const std::vector<int32_t>& last = log.records.back();
+    EXPECT_NEAR(last[FlightRecorder::ACCEL_Z], 9807, 50);
+    EXPECT_EQ(last[FlightRecorder::MOTOR_SPEED], 0);
+    EXPECT_EQ(last[FlightRecorder::SERVO_POSITION], 90);
+}
+
+// Flash as earlier boots left it: a log of `bytes` for each number
+void writeOldLogs(std::initializer_list<int> numbers, size_t bytes) {
+    ASSERT_TRUE(LittleFS.begin(true));
+    std::vector<uint8_t> data(bytes, 0x5A);
+    for (int number : numbers) {
+        char path[24];
+        snprintf(path, sizeof(path), "/flight_%03d.bin", number);
+        File file = LittleFS.open(path, FILE_WRITE);
+        ASSERT_EQ(file.write(data.data(), data.size()), data.size());
+        file.close();
+    }
+    LittleFS.end();
+}
+
+class FlightLogRetentionTest : public ::testing::Test {
+protected:
+    SensorRig rig;
+
+    void SetUp() override {
+        host::reset();
+        LittleFS.wipe();
+    }
+
+    void startFirmware() {
+        rig.start();
+        host::bootFirmware();
+        ASSERT_TRUE(host::runUntil([]() { return boot.isComplete(); }, 20000));
+        ASSERT_EQ(boot.getState(BOOT_RECORDER), BOOT_READY);
+    }
+};
+
+TEST_F(FlightLogRetentionTest, FullPartitionDeletesTheOldestLogsAndKeepsRecording) {
+    LittleFS.setCapacity(512 * 1024);
+    writeOldLogs({ 0, 1, 2 }, 150 * 1024);          // 450 KiB of a 512 KiB partition
+    startFirmware();
+
+    // Room made at boot, and the numbering continues from the newest
+    EXPECT_STREQ(flight_recorder.getFilePath(), "/flight_003.bin");
+    EXPECT_FALSE(LittleFS.exists("/flight_000.bin"));
+    EXPECT_TRUE(LittleFS.exists("/flight_002.bin"));
+
+    // Five minutes is ~400 KiB: the other old logs go as space runs out
+    host::runFor(300000);
+    EXPECT_TRUE(flight_recorder.isActive());
+    EXPECT_EQ(flight_recorder.getRecordsDropped(), 0u);
+    EXPECT_EQ(flight_recorder.getLogsDeleted(), 3u);
+    EXPECT_FALSE(LittleFS.exists("/flight_002.bin"));
+    EXPECT_GT(flight_recorder.getBytesFlashed(), 300u * 1024);
+}
+
+TEST_F(FlightLogRetentionTest, NumberingWrapsAfter999) {
+    writeOldLogs({ 998, 999, 0 }, 4096);
+    startFirmware();
+    EXPECT_STREQ(flight_recorder.getFilePath(), "/flight_001.bin");
+}
+
+TEST_F(FlightLogRetentionTest, LogsCanBeDeletedOverHttpExceptTheCurrentOne) {
+    writeOldLogs({ 0 }, 4096);
+    startFirmware();
+    ASSERT_STREQ(flight_recorder.getFilePath(), "/flight_001.bin");
+    ASSERT_TRUE(host::runUntil([]() { return WiFi.status() == WL_CONNECTED; }, 20000));
+
+    host::HttpResponse response;
+    ASSERT_TRUE(host::httpRequest(80, "DELETE", "/logs?file=flight_001.bin", response));
+    EXPECT_EQ(response.code, 409);
+    EXPECT_TRUE(LittleFS.exists("/flight_001.bin"));
+
+    ASSERT_TRUE(host::httpRequest(80, "DELETE", "/logs?file=flight_000.bin", response));
+    EXPECT_EQ(response.code, 200) << response.body;
+    EXPECT_FALSE(LittleFS.exists("/flight_000.bin"));
+
+    ASSERT_TRUE(host::httpRequest(80, "GET", "/logs", response));
+    EXPECT_EQ(response.body.find("flight_000.bin"), std::string::npos);
+    EXPECT_NE(response.body.find("flight_001.bin"), std::string::npos);
+}
+
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <random>
+#include "HostRuntime.h"
+#include "Geofence.h"
+#include "FenceShapes.h"
+
+// Geofence against a reference full-scan point-in-polygon test, and its
+// motor cut through ActuatorModule on the esp_timer and LEDC stand-ins.
+namespace {
+
+class GeofenceTest : public ::testing::Test {
+protected:
+    ActuatorModule actuators;
+    Geofence fence{ actuators };
+
+    void SetUp() override {
+        host::reset();
+        ASSERT_TRUE(actuators.beginMotor());
+    }
+
+    void checkAt(double north, double east) {
+        fence.check(FenceShapes::latitude(north), FenceShapes::longitude(east));
+    }
+};
+
+TEST_F(GeofenceTest, AgreesWithAFullScanOnLargePolygons) {
+    FenceShapes shapes(912, 7, 16);     // 8 polygons and 1024 vertices, the most a fence may have
+    ASSERT_TRUE(fence.load(shapes.text().c_str()));
+    EXPECT_EQ(fence.getPolygonCount(), 8);
+    EXPECT_EQ(fence.getVertexCount(), 1024);
+
+    std::mt19937 random(3);
+    std::uniform_real_distribution<double> coordinate(-2200.0, 2200.0);
+    int compared = 0, allowed = 0;
+    for (int i = 0; i < 20000; i++) {
+        double x = coordinate(random), y = coordinate(random);
+        double margin;
+        bool expected = shapes.allowed(x, y, margin);
+        if (margin < 0.05) {
+            continue;       // Float projection may round either way this close to an edge
+        }
+        checkAt(y, x);
+        ASSERT_EQ(fence.isBreached(), !expected) << "at " << x << " m E, " << y << " m N";
+        compared++;
+        allowed += expected;
+    }
+    EXPECT_GT(compared, 19000);
+    EXPECT_GT(allowed, 5000);
+    EXPECT_GT(compared - allowed, 5000);
+
+    // The band index bounds the work per check well below the vertex count
+    EXPECT_LE(fence.getEdgesTestedMax(), (uint32_t)fence.getWorstCaseEdges() * 8);
+    EXPECT_LT(fence.getWorstCaseEdges(), 1024 / 8);
+}
+
+TEST_F(GeofenceTest, BreachLatchesTheMotorInhibit) {
+    ASSERT_TRUE(fence.load(FenceShapes(64, 0, 0, 500.0).text().c_str()));
+    actuators.setMotorSpeed(200);
+    checkAt(0, 0);
+    EXPECT_FALSE(fence.isBreached());
+    EXPECT_EQ(actuators.getTargetMotorSpeed(), 200);
+
+    checkAt(600, 0);
+    EXPECT_TRUE(fence.isBreached());
+    EXPECT_TRUE(actuators.isMotorInhibited());
+    EXPECT_EQ(fence.getBreaches(), 1u);
+    EXPECT_EQ(actuators.getTargetMotorSpeed(), 0);
+
+    // Nothing restarts it between fixes, and the ramp brings the output down
+    actuators.setMotorSpeed(150);
+    EXPECT_EQ(actuators.getTargetMotorSpeed(), 0);
+    host::runFor(1000);
+    EXPECT_EQ(actuators.getMotorSpeed(), 0);
+    checkAt(601, 0);
+    EXPECT_EQ(fence.getMotorCuts(), 1u);
+    EXPECT_EQ(fence.getBreaches(), 1u);
+
+    // Back inside, or a fix that jumps back in: still latched until rearmed
+    checkAt(0, 0);
+    EXPECT_FALSE(fence.isBreached());
+    EXPECT_TRUE(actuators.isMotorInhibited());
+    actuators.setMotorSpeed(150);
+    EXPECT_EQ(actuators.getTargetMotorSpeed(), 0);
+    fence.rearmMotor();
+    EXPECT_FALSE(actuators.isMotorInhibited());
+    actuators.setMotorSpeed(150);
+    EXPECT_EQ(actuators.getTargetMotorSpeed(), 150);
+}
+
+TEST_F(GeofenceTest, RearmReleasesUntilTheNextBreach) {
+    ASSERT_TRUE(fence.load(FenceShapes(64, 0, 0, 500.0).text().c_str()));
+    checkAt(600, 0);
+    fence.rearmMotor();
+    EXPECT_FALSE(actuators.isMotorInhibited());
+    actuators.setMotorSpeed(-120);      // Back toward the fence
+    checkAt(580, 0);
+    EXPECT_EQ(actuators.getTargetMotorSpeed(), -120);
+
+    checkAt(0, 0);
+    checkAt(0, 600);
+    EXPECT_TRUE(actuators.isMotorInhibited());
+    EXPECT_EQ(fence.getMotorCuts(), 2u);
+}
+
+TEST_F(GeofenceTest, ClearResetsTheBreach) {
+    ASSERT_TRUE(fence.load(FenceShapes(64, 0, 0, 500.0).text().c_str()));
+    checkAt(600, 0);
+    fence.clear();
+    EXPECT_FALSE(fence.isBreached());
+    EXPECT_FALSE(actuators.isMotorInhibited());
+
+    // A new fence breached at the same spot counts as a new breach
+    ASSERT_TRUE(fence.load(FenceShapes(64, 0, 0, 500.0).text().c_str()));
+    checkAt(600, 0);
+    EXPECT_EQ(fence.getBreaches(), 2u);
+    EXPECT_TRUE(actuators.isMotorInhibited());
+}
+
+TEST_F(GeofenceTest, DisarmedFenceOnlyReports) {
+    ASSERT_TRUE(fence.load(FenceShapes(64, 0, 0, 500.0).text().c_str()));
+    fence.setArmed(false);
+    actuators.setMotorSpeed(200);
+    checkAt(600, 0);
+    EXPECT_TRUE(fence.isBreached());
+    EXPECT_FALSE(actuators.isMotorInhibited());
+    EXPECT_EQ(actuators.getTargetMotorSpeed(), 200);
+
+    fence.setArmed(true);               // Arming while outside cuts at once
+    EXPECT_TRUE(actuators.isMotorInhibited());
+}
+
+TEST_F(GeofenceTest, InvalidUploadKeepsTheCurrentFence) {
+    ASSERT_TRUE(fence.load(FenceShapes(64, 0, 0, 500.0).text().c_str()));
+    EXPECT_FALSE(fence.load("in\n-34.5,-58.4\n-34.6,-58.4\n"));         // Two vertices
+    EXPECT_FALSE(fence.load("out\n-34.5,-58.4\n-34.6,garbage\n-34.6,-58.5\n"));
+    EXPECT_FALSE(fence.load("-34.5,-58.4\n"));                          // No polygon header
+    EXPECT_EQ(fence.getPolygonCount(), 1);
+    EXPECT_EQ(fence.getVertexCount(), 64);
+
+    fence.clear();
+    EXPECT_EQ(fence.getPolygonCount(), 0);
+    checkAt(10000, 0);
+    EXPECT_EQ(fence.getChecks(), 0u);   // No fence, nothing to check
+}
+
+}
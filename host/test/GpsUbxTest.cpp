@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <math.h>
+#include "HostRuntime.h"
+#include "Firmware.h"
+#include "SensorRig.h"
+
+// GPS_USE_UBX on the NEO-6M model: the receiver is switched to UBX at boot and
+// every epoch becomes one fix; a receiver that never acknowledges is put back
+// on NMEA. Each test boots the firmware once; ctest runs every test in its own
+// process.
+namespace {
+
+const double START_LATITUDE = 41.3851;
+const double START_LONGITUDE = 2.1734;
+const double KNOTS = 4.0;
+const double METERS_PER_DEG_LAT = 111320.0;
+
+// Due north at 4 knots
+Neo6mModel::Fix sailing(uint64_t t_us) {
+    Neo6mModel::Fix fix;
+    fix.valid = true;
+    fix.latitude = START_LATITUDE + KNOTS * 0.514444 * (t_us / 1e6) / METERS_PER_DEG_LAT;
+    fix.longitude = START_LONGITUDE;
+    fix.altitude = 12.0;
+    fix.speed_knots = KNOTS;
+    fix.course = 0.0;
+    fix.satellites = 9;
+    fix.hdop = 0.9;
+    return fix;
+}
+
+class GpsUbxTest : public ::testing::Test {
+protected:
+    SensorRig rig;
+
+    void bootWith(bool ubx_supported) {
+        host::reset();
+        rig.gps.setSource(sailing);
+        rig.gps.setUbxSupported(ubx_supported);
+        rig.start();
+        host::bootFirmware();
+        ASSERT_TRUE(host::runUntil([]() { return boot.isComplete(); }, 20000));
+    }
+
+    // New fixes over `seconds` of firmware time
+    uint32_t countFixes(uint32_t seconds) {
+        GPSData fix;
+        sensor_module.getGPSData(fix);
+        uint32_t before = fix.fix_count;
+        host::runFor(seconds * 1000);
+        sensor_module.getGPSData(fix);
+        return fix.fix_count - before;
+    }
+};
+
+TEST_F(GpsUbxTest, EachEpochIsOneFixAtFiveHz) {
+    bootWith(true);
+    ASSERT_EQ(boot.getState(BOOT_GPS), BOOT_READY);
+    ASSERT_TRUE(sensor_module.isGPSUbx());
+    EXPECT_EQ(rig.gps.getAcks(), 5u);       // Four CFG-MSG and CFG-RATE
+
+    uint32_t epochs = rig.gps.getEpochs();
+    uint32_t fixes = countFixes(10);
+    EXPECT_EQ(fixes, rig.gps.getEpochs() - epochs);
+    EXPECT_NEAR(fixes, 50u, 1u);
+
+    GPSData fix;
+    sensor_module.getGPSData(fix);
+    Neo6mModel::Fix truth = sailing(host::nowMicros());
+    EXPECT_TRUE(fix.valid);
+    EXPECT_NEAR(fix.latitude, truth.latitude, 3.0 / METERS_PER_DEG_LAT);     // Up to one epoch behind
+    EXPECT_NEAR(fix.longitude, START_LONGITUDE, 1e-6);
+    EXPECT_NEAR(fix.speed, KNOTS, 0.05);
+    EXPECT_EQ(fix.satellites, 9);
+
+    // The single-field getters read the same fix, each under gps_mux
+    host::resetCriticalSectionStats();
+    EXPECT_EQ(sensor_module.getLatitude(), fix.latitude);
+    EXPECT_EQ(sensor_module.getLongitude(), fix.longitude);
+    EXPECT_EQ(sensor_module.getSpeed(), fix.speed);
+    EXPECT_EQ(sensor_module.getSatellites(), fix.satellites);
+    char time[12], date[12], clipped[4];
+    sensor_module.getGPSTime(time, sizeof(time));
+    sensor_module.getGPSDate(date, sizeof(date));
+    sensor_module.getGPSTime(clipped, sizeof(clipped));
+    EXPECT_STREQ(time, fix.time);
+    EXPECT_STREQ(date, fix.date);
+    EXPECT_EQ(std::string(clipped), std::string(fix.time, 3));
+    EXPECT_EQ(host::getCriticalSectionCount(), 7u);
+}
+
+TEST_F(GpsUbxTest, UnacknowledgedConfigurationFallsBackToNmea) {
+    bootWith(false);
+    EXPECT_EQ(boot.getState(BOOT_GPS), BOOT_DEGRADED);
+    EXPECT_FALSE(sensor_module.isGPSUbx());
+    EXPECT_FALSE(rig.gps.isUbxOutput());
+    EXPECT_EQ(rig.gps.getBaud(), 9600u);
+
+    EXPECT_NEAR(countFixes(10), 10u, 1u);   // RMC and GGA each epoch, counted once
+    GPSData fix;
+    sensor_module.getGPSData(fix);
+    EXPECT_TRUE(fix.valid);
+    EXPECT_NEAR(fix.latitude, sailing(host::nowMicros()).latitude, 3.0 / METERS_PER_DEG_LAT);
+}
+
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <Arduino.h>
+#include <Wire.h>
+#include <LittleFS.h>
+#include <esp_timer.h>
+#include "HostRuntime.h"
+
+namespace {
+
+class HostRuntimeTest : public ::testing::Test {
+protected:
+    void SetUp() override { host::reset(); }
+};
+
+std::vector<std::string> trace;
+
+void delayTask(void* param) {
+    for (int i = 0; i < 3; i++) {
+        trace.push_back(std::string((const char*)param) + "@" + std::to_string(millis()));
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    vTaskDelete(NULL);
+}
+
+TEST_F(HostRuntimeTest, DelaysAdvanceTheVirtualClock) {
+    trace.clear();
+    xTaskCreatePinnedToCore(delayTask, "a", 4096, (void*)"a", 1, NULL, 0);
+    host::runFor(100);
+    EXPECT_EQ(trace, (std::vector<std::string>{ "a@0", "a@10", "a@20" }));
+    EXPECT_EQ(host::nowMicros(), 100000u);
+    EXPECT_EQ(host::getTaskCount(), 0u);
+}
+
+TEST_F(HostRuntimeTest, HigherPriorityRunsFirst) {
+    trace.clear();
+    xTaskCreatePinnedToCore(delayTask, "low", 4096, (void*)"low", 1, NULL, 0);
+    xTaskCreatePinnedToCore(delayTask, "high", 4096, (void*)"high", 5, NULL, 0);
+    host::runFor(5);
+    ASSERT_EQ(trace.size(), 2u);
+    EXPECT_EQ(trace[0], "high@0");
+    EXPECT_EQ(trace[1], "low@0");
+}
+
+TaskHandle_t waiter = NULL;
+uint32_t notified_at = 0;
+
+void notifyTask(void* param) {
+    waiter = xTaskGetCurrentTaskHandle();
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    notified_at = millis();
+    vTaskDelete(NULL);
+}
+
+TEST_F(HostRuntimeTest, NotificationWakesABlockedTask) {
+    notified_at = 0;
+    xTaskCreatePinnedToCore(notifyTask, "wait", 4096, NULL, 1, NULL, 0);
+    host::schedule(42000, []() { xTaskNotifyGive(waiter); });
+    host::runFor(100);
+    EXPECT_EQ(notified_at, 42u);
+}
+
+int timer_calls = 0;
+
+TEST_F(HostRuntimeTest, PeriodicTimerFiresOnThePeriod) {
+    timer_calls = 0;
+    esp_timer_create_args_t args = {};
+    args.callback = [](void*) { timer_calls++; };
+    esp_timer_handle_t timer;
+    ASSERT_EQ(esp_timer_create(&args, &timer), ESP_OK);
+    ASSERT_EQ(esp_timer_start_periodic(timer, 5000), ESP_OK);
+    host::runFor(52);
+    EXPECT_EQ(timer_calls, 10);
+    EXPECT_EQ(esp_timer_stop(timer), ESP_OK);
+    host::runFor(50);
+    EXPECT_EQ(timer_calls, 10);
+    esp_timer_delete(timer);
+}
+
+TEST_F(HostRuntimeTest, UartCallbackRunsOnDelivery) {
+    std::string received;
+    Serial2.begin(9600);
+    Serial2.onReceive([&received]() {
+        while (Serial2.available()) {
+            received += (char)Serial2.read();
+        }
+    });
+    Serial2.deliver((const uint8_t*)"$GPGGA", 6);
+    EXPECT_TRUE(received.empty());     // From the scheduler, not from deliver()
+    host::runFor(1);
+    EXPECT_EQ(received, "$GPGGA");
+}
+
+TEST_F(HostRuntimeTest, UartDropsWhatDoesNotFitTheRxBuffer) {
+    Serial2.setRxBufferSize(16);
+    Serial2.begin(9600);
+    std::string line(40, 'x');
+    Serial2.deliver((const uint8_t*)line.data(), line.size());
+    EXPECT_EQ(Serial2.available(), 16);
+    EXPECT_EQ(Serial2.getRxOverflows(), 24u);
+}
+
+TEST_F(HostRuntimeTest, AbsentI2CDeviceNacks) {
+    Wire.begin(21, 22);
+    Wire.beginTransmission(0x68);
+    Wire.write(0x75);
+    EXPECT_EQ(Wire.endTransmission(), 2);
+    EXPECT_EQ(Wire.requestFrom((uint8_t)0x68, (size_t)1, true), 0u);
+}
+
+TEST_F(HostRuntimeTest, LittleFSFillsUpAtItsCapacity) {
+    LittleFS.wipe();
+    LittleFS.setCapacity(16 * 4096);
+    ASSERT_FALSE(LittleFS.begin(false));
+    ASSERT_TRUE(LittleFS.begin(true));
+    File file = LittleFS.open("/log", FILE_WRITE);
+    ASSERT_TRUE(file);
+    uint8_t block[4096] = {};
+    size_t written = 0;
+    for (int i = 0; i < 20; i++) {
+        written += file.write(block, sizeof(block));
+    }
+    EXPECT_EQ(written, 14u * 4096);     // Two blocks hold the root directory
+    EXPECT_EQ(LittleFS.usedBytes(), LittleFS.totalBytes());
+    file.close();
+    EXPECT_TRUE(LittleFS.remove("/log"));
+    EXPECT_EQ(LittleFS.usedBytes(), 2u * 4096);
+    LittleFS.setCapacity(0x160000);
+    LittleFS.wipe();
+}
+
+}
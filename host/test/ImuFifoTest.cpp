@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include "HostRuntime.h"
+#include "Firmware.h"
+#include "SensorRig.h"
+
+// MPU6050 FIFO acquisition against the register model: at 1 kHz every sample
+// the chip takes must reach the ring buffer, by interrupt or by polling.
+namespace {
+
+const uint8_t INT_PIN = 4;
+
+struct Acquisition {
+    SensorModule* module;
+    bool stalled;
+};
+
+void acquisitionTask(void* param) {
+    Acquisition* acquisition = static_cast<Acquisition*>(param);
+    for (;;) {
+        if (acquisition->stalled) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+            continue;
+        }
+        acquisition->module->waitForData(20);
+        acquisition->module->update();
+    }
+}
+
+class ImuFifoTest : public ::testing::Test {
+protected:
+    SensorRig rig;
+    SensorModule module;
+    Acquisition acquisition;
+
+    void SetUp() override {
+        host::reset();
+        acquisition = { &module, false };
+    }
+
+    void startAcquisition(int int_pin) {
+        rig.mpu.setInterruptPin(int_pin);
+        module.beginBus();
+        ASSERT_TRUE(module.beginMPU());
+        ASSERT_TRUE(module.beginMPUFifo(1000, int_pin));
+        xTaskCreatePinnedToCore(acquisitionTask, "acquire", 4096, &acquisition, 5, NULL, 1);
+    }
+
+    // Samples the chip took in the window that never reached the ring buffer
+    int64_t lostSamples(uint32_t window_ms) {
+        host::runFor(500);
+        size_t queued = rig.mpu.getFifoLevel() / 12;   // Catches the model up first
+        uint32_t taken = rig.mpu.getSamples();
+        uint32_t pushed = module.getIMUBuffer().getTotalSamples();
+        uint64_t start_us = host::nowMicros();
+
+        host::runFor(window_ms);     // Ends after the task slice in progress, which may hold the bus
+        int64_t queued_delta = (int64_t)(rig.mpu.getFifoLevel() / 12) - (int64_t)queued;
+        int64_t taken_delta = rig.mpu.getSamples() - taken;
+        int64_t pushed_delta = module.getIMUBuffer().getTotalSamples() - pushed;
+        EXPECT_NEAR(taken_delta, (host::nowMicros() - start_us) / 1000, 1);
+        return taken_delta - queued_delta - pushed_delta;
+    }
+};
+
+TEST_F(ImuFifoTest, InterruptDrivenDrainKeepsUpAtOneKilohertz) {
+    startAcquisition(INT_PIN);
+    EXPECT_EQ(lostSamples(10000), 0);
+    EXPECT_EQ(module.getMPUFifoOverflows(), 0u);
+    EXPECT_EQ(rig.mpu.getFifoOverflows(), 0u);
+}
+
+TEST_F(ImuFifoTest, PolledDrainKeepsUpAtOneKilohertz) {
+    startAcquisition(-1);
+    EXPECT_EQ(lostSamples(10000), 0);
+    EXPECT_EQ(module.getMPUFifoOverflows(), 0u);
+}
+
+TEST_F(ImuFifoTest, TimestampsFollowTheSampleRate) {
+    startAcquisition(INT_PIN);
+    host::runFor(100);
+    ImuRingBuffer::Reader reader = module.getIMUBuffer().createReader();
+    host::runFor(300);
+
+    ImuSample previous, sample;
+    ASSERT_TRUE(module.getIMUBuffer().pop(reader, previous));
+    uint32_t first_us = previous.timestamp_us;
+    uint32_t count = 1;
+    while (module.getIMUBuffer().pop(reader, sample)) {
+        EXPECT_GT(sample.timestamp_us, previous.timestamp_us);
+        EXPECT_NEAR(sample.accel_z, 9.81f, 0.05f);      // Level and at rest
+        previous = sample;
+        count++;
+    }
+    EXPECT_EQ(reader.dropped, 0u);
+    EXPECT_GT(count, 250u);
+    EXPECT_NEAR((double)(previous.timestamp_us - first_us) / (count - 1), 1000.0, 50.0);
+}
+
+TEST_F(ImuFifoTest, StalledDrainOverflowsAndRecovers) {
+    startAcquisition(INT_PIN);
+    host::runFor(500);
+    acquisition.stalled = true;
+    host::runFor(200);                  // The 1024-byte FIFO holds 85 ms at 1 kHz
+    EXPECT_GT(rig.mpu.getFifoOverflows(), 0u);
+    acquisition.stalled = false;
+    host::runFor(50);
+    EXPECT_GE(module.getMPUFifoOverflows(), 1u);  // Once more if it refills during the reset
+    EXPECT_EQ(lostSamples(2000), 0);
+}
+
+TEST(ImuRingBufferTest, LaggingReaderSkipsAheadAndCountsDrops) {
+    static ImuRingBuffer buffer;
+    ImuRingBuffer::Reader reader = buffer.createReader();
+    ImuSample sample = {};
+    for (uint32_t i = 0; i < ImuRingBuffer::CAPACITY + 100; i++) {
+        sample.timestamp_us = i;
+        buffer.push(sample);
+    }
+    ImuSample out;
+    ASSERT_TRUE(buffer.pop(reader, out));
+    EXPECT_EQ(reader.dropped, 101u);                // The slot being written next is not safe to copy
+    EXPECT_EQ(out.timestamp_us, 101u);
+    uint32_t remaining = 0;
+    while (buffer.pop(reader, out)) {
+        remaining++;
+    }
+    EXPECT_EQ(remaining, ImuRingBuffer::CAPACITY - 2);
+}
+
+TEST(FirmwareImuTest, BootedFirmwareDrainsEverySample) {
+    SensorRig rig;
+    host::reset();
+    rig.start();
+    host::bootFirmware();
+    ASSERT_TRUE(host::runUntil([]() { return boot.isComplete(); }, 20000));
+    ASSERT_TRUE(sensor_module.isMPUFifoEnabled());
+
+    host::runFor(500);
+    size_t queued = rig.mpu.getFifoLevel() / 12;
+    uint32_t taken = rig.mpu.getSamples();
+    uint32_t pushed = sensor_module.getIMUBuffer().getTotalSamples();
+    host::runFor(10000);
+    int64_t queued_delta = (int64_t)(rig.mpu.getFifoLevel() / 12) - (int64_t)queued;
+    int64_t lost = (int64_t)(rig.mpu.getSamples() - taken) - queued_delta
+                 - (int64_t)(sensor_module.getIMUBuffer().getTotalSamples() - pushed);
+    EXPECT_EQ(lost, 0);
+    EXPECT_EQ(sensor_module.getMPUFifoOverflows(), 0u);
+}
+
+}
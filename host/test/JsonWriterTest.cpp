@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <math.h>
+#include <string>
+#include "JsonWriter.h"
+
+// JsonWriter output against what the String builder produced, and what it
+// leaves in the buffer when the document does not fit (WebModule answers 500).
+namespace {
+
+TEST(JsonWriterTest, NestsObjectsWithCommasBetweenFields) {
+    char buffer[128];
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginObject();
+    json.field("a", 1);
+    json.beginObject("b");
+    json.field("c", true);
+    json.field("d", "x");
+    json.endObject();
+    json.beginObject("e");
+    json.endObject();
+    json.field("f", 2UL);
+    json.endObject();
+    EXPECT_FALSE(json.overflowed());
+    EXPECT_STREQ(json.c_str(), "{\"a\":1,\"b\":{\"c\":true,\"d\":\"x\"},\"e\":{},\"f\":2}");
+    EXPECT_EQ(json.size(), strlen(buffer));
+}
+
+TEST(JsonWriterTest, NumbersMatchTheStringBuilder) {
+    const double values[] = { 0.0, 1.005, -0.006, 21.375, 1013.25, -58.4398715, 9.81, 123456.789 };
+    const int decimals[] = { 0, 2, 6 };
+    for (double value : values) {
+        for (int places : decimals) {
+            char buffer[64];
+            JsonWriter json(buffer, sizeof(buffer));
+            json.beginObject();
+            json.field("v", value, places);
+            json.endObject();
+            std::string expected = "{\"v\":" + std::string(String(value, places).c_str()) + "}";
+            if (expected.find("-0}") != std::string::npos || expected.find("-0.00}") != std::string::npos) {
+                continue;  // See below
+            }
+            EXPECT_EQ(json.c_str(), expected) << value << " with " << places << " decimals";
+        }
+    }
+}
+
+// The one deliberate difference: String prints "-0.00" for a small negative,
+// JsonWriter drops the sign once the value rounds to zero
+TEST(JsonWriterTest, NegativeValuesThatRoundToZeroHaveNoSign) {
+    char buffer[64];
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginObject();
+    json.field("a", -0.004, 2);
+    json.field("b", -0.4f, 0);
+    json.field("c", -0.006, 2);
+    json.endObject();
+    EXPECT_STREQ(json.c_str(), "{\"a\":0.00,\"b\":0,\"c\":-0.01}");
+}
+
+TEST(JsonWriterTest, NegativeIntegersAndNonFiniteValues) {
+    char buffer[128];
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginObject();
+    json.field("i", -255);
+    json.field("l", -2147483647L - 1);
+    json.field("nan", (float)NAN);
+    json.field("inf", (double)INFINITY);
+    json.endObject();
+    EXPECT_STREQ(json.c_str(), "{\"i\":-255,\"l\":-2147483648,\"nan\":null,\"inf\":null}");
+}
+
+TEST(JsonWriterTest, OverflowIsReportedAndTheBufferStaysTerminated) {
+    char buffer[16];
+    memset(buffer, 'x', sizeof(buffer));
+    JsonWriter json(buffer, sizeof(buffer));
+    json.beginObject();
+    json.field("temperature", 21.37f);
+    json.endObject();
+    EXPECT_TRUE(json.overflowed());
+    EXPECT_EQ(json.size(), sizeof(buffer) - 1);
+    EXPECT_EQ(buffer[sizeof(buffer) - 1], '\0');
+
+    json.reset();
+    json.beginObject();
+    json.endObject();
+    EXPECT_FALSE(json.overflowed());
+    EXPECT_STREQ(json.c_str(), "{}");
+}
+
+}
@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "HostRuntime.h"
+#include "Log.h"
+
+// The deferred logger's formatting at the drain and its full-ring behaviour.
+namespace {
+
+class LogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        host::reset();
+        host::setSerialEcho(false);
+        Log::begin();
+        Log::setLevel(LOG_LEVEL_INFO);
+    }
+
+    std::string drained() {
+        host::takeSerialOutput();
+        Log::drain();
+        return host::takeSerialOutput();
+    }
+};
+
+TEST_F(LogTest, CoordinatesKeepTheirPrecision) {
+    double latitude = 38.6913357, longitude = -9.2159871;
+    LOG_WARN("Geofence breached at %.6f, %.6f", latitude, longitude);
+    EXPECT_NE(drained().find("W Geofence breached at 38.691336, -9.215987"), std::string::npos);
+}
+
+TEST_F(LogTest, FormatsEachArgumentType) {
+    LOG_INFO("%d %u %03d %lu %.2f %s", -5, 7u, 9, 123456ul, 2.5f, "text");
+    EXPECT_NE(drained().find("I -5 7 009 123456 2.50 text"), std::string::npos);
+}
+
+TEST_F(LogTest, FullRingDropsAndCounts) {
+    uint32_t dropped = Log::getDropped();
+    for (int i = 0; i < 200; i++) {
+        LOG_INFO("record %d", i);
+    }
+    EXPECT_EQ(Log::getDropped() - dropped, 200u - 128u);
+    std::string text = drained();
+    EXPECT_NE(text.find("record 127"), std::string::npos);
+    EXPECT_EQ(text.find("record 128"), std::string::npos);
+    EXPECT_NE(text.find("72 log records dropped"), std::string::npos);
+}
+
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <string>
+#include "HostRuntime.h"
+#include "Metrics.h"
+
+// Stage histograms and their Prometheus rendering. The cycle counter stand-in
+// runs at 240 cycles per virtual microsecond, so delayMicroseconds() inside a
+// scope lands in a known bucket.
+namespace {
+
+std::string render() {
+    std::string text;
+    char buffer[2048];
+    for (int piece = 0; piece < Metrics::getPieceCount(); piece++) {
+        text.append(buffer, Metrics::writePiece(piece, buffer, sizeof(buffer)));
+    }
+    return text;
+}
+
+bool hasLine(const std::string& text, const std::string& line) {
+    return text.find(line + "\n") != std::string::npos;
+}
+
+class MetricsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        host::reset();
+        Metrics::begin();
+    }
+};
+
+TEST_F(MetricsTest, ScopeTimesItsLifetime) {
+    for (int i = 0; i < 3; i++) {
+        METRICS_SCOPE(STAGE_AUTOPILOT);
+        delayMicroseconds(150);
+    }
+    std::string text = render();
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_bucket{stage=\"autopilot\",le=\"0.0001\"} 0")) << text;
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_bucket{stage=\"autopilot\",le=\"0.0002\"} 3"));
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_bucket{stage=\"autopilot\",le=\"+Inf\"} 3"));
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_sum{stage=\"autopilot\"} 0.000450"));
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_count{stage=\"autopilot\"} 3"));
+    EXPECT_TRUE(hasLine(text, "aleph_stage_max_seconds{stage=\"autopilot\"} 0.0001500"));
+}
+
+TEST_F(MetricsTest, MicrosScopeRecordsInTheSameUnits) {
+    for (int i = 0; i < 2; i++) {
+        METRICS_SCOPE_US(STAGE_GPS_PARSE);
+        delayMicroseconds(40);
+    }
+    std::string text = render();
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_bucket{stage=\"gps_parse\",le=\"2e-05\"} 0")) << text;
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_bucket{stage=\"gps_parse\",le=\"5e-05\"} 2"));
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_sum{stage=\"gps_parse\"} 0.000080"));
+    EXPECT_TRUE(hasLine(text, "aleph_stage_max_seconds{stage=\"gps_parse\"} 0.0000400"));
+}
+
+TEST_F(MetricsTest, BucketsAreInclusiveUpperBoundsAndCumulative) {
+    const uint32_t cycles_per_us = Metrics::getCyclesPerMicro();
+    Metrics::record(STAGE_MISSION, 1 * cycles_per_us);          // le=1e-06
+    Metrics::record(STAGE_MISSION, 1 * cycles_per_us + 1);      // le=2e-06
+    Metrics::record(STAGE_MISSION, 50 * cycles_per_us);         // le=5e-05
+    Metrics::record(STAGE_MISSION, 60000 * cycles_per_us);      // +Inf only
+
+    std::string text = render();
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_bucket{stage=\"mission\",le=\"1e-06\"} 1")) << text;
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_bucket{stage=\"mission\",le=\"2e-06\"} 2"));
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_bucket{stage=\"mission\",le=\"2e-05\"} 2"));
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_bucket{stage=\"mission\",le=\"5e-05\"} 3"));
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_bucket{stage=\"mission\",le=\"0.05\"} 3"));
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_bucket{stage=\"mission\",le=\"+Inf\"} 4"));
+    EXPECT_TRUE(hasLine(text, "aleph_stage_max_seconds{stage=\"mission\"} 0.0600000"));
+    // Untouched stages still render, empty
+    EXPECT_TRUE(hasLine(text, "aleph_stage_seconds_count{stage=\"gps_parse\"} 0"));
+}
+
+TEST_F(MetricsTest, SmallBufferTruncatesCleanly) {
+    Metrics::record(STAGE_MISSION, 100);
+    char buffer[64];
+    memset(buffer, 'x', sizeof(buffer));
+    size_t length = Metrics::writePiece(2 + STAGE_MISSION, buffer, sizeof(buffer));
+    EXPECT_EQ(length, sizeof(buffer) - 1);
+    EXPECT_EQ(buffer[length], '\0');
+}
+
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include <math.h>
+#include "HostRuntime.h"
+#include "HostNetwork.h"
+#include "Firmware.h"
+
+// Missions flown end to end on the SIMULATION_ENABLED build: uploaded and
+// started over HTTP, steered by the autopilot task against the simulated
+// hull. Each test boots the firmware once; ctest runs every test in its own
+// process.
+namespace {
+
+const double START_LATITUDE = -34.5443;        // Simulator's default start
+const double START_LONGITUDE = -58.4399;
+const double METERS_PER_DEG_LAT = 111320.0;
+
+std::string offset(double north, double east, int motor) {
+    double meters_per_deg_lon = METERS_PER_DEG_LAT * cos(START_LATITUDE * DEG_TO_RAD);
+    char line[64];
+    snprintf(line, sizeof(line), "%.7f,%.7f,%d\n", START_LATITUDE + north / METERS_PER_DEG_LAT,
+             START_LONGITUDE + east / meters_per_deg_lon, motor);
+    return line;
+}
+
+double distanceTo(double north, double east) {
+    double meters_per_deg_lon = METERS_PER_DEG_LAT * cos(START_LATITUDE * DEG_TO_RAD);
+    double dn = (simulator.getLatitude() - START_LATITUDE) * METERS_PER_DEG_LAT - north;
+    double de = (simulator.getLongitude() - START_LONGITUDE) * meters_per_deg_lon - east;
+    return sqrt(dn * dn + de * de);
+}
+
+class MissionTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        host::reset();
+        host::bootFirmware();
+        ASSERT_TRUE(host::runUntil([]() { return boot.isComplete(); }, 20000));
+        ASSERT_EQ(boot.getState(BOOT_WIFI), BOOT_READY);
+        host::runFor(3000);             // A few fixes, so navigation has an origin
+    }
+
+    void startMission(const std::string& waypoints) {
+        host::HttpResponse response;
+        ASSERT_TRUE(host::httpRequest(80, "POST", "/mission", response, waypoints));
+        ASSERT_EQ(response.code, 200) << response.body;
+        ASSERT_TRUE(host::httpRequest(80, "POST", "/mission?action=start", response));
+        ASSERT_EQ(response.code, 200) << response.body;
+    }
+};
+
+TEST_F(MissionTest, FliesABoxAndTracksEachLeg) {
+    // 120 m legs north, east, south and west, back to the start
+    startMission(offset(120, 0, 200) + offset(120, 120, 200) + offset(0, 120, 200) + offset(0, 0, 200));
+
+    float worst_cross_track = 0;
+    int legs_seen = 0;
+    uint32_t elapsed_ms = 0;
+    while (mission.getState() != MissionEngine::COMPLETE && elapsed_ms < 900000) {
+        host::runFor(100);
+        elapsed_ms += 100;
+        if (mission.getLeg() + 1 > legs_seen) {
+            legs_seen = mission.getLeg() + 1;
+        }
+        // Once settled on the line; the turn onto each leg starts up to 90° off it
+        if (mission.getState() == MissionEngine::RUNNING && mission.getAlongTrack() > 40) {
+            worst_cross_track = fmaxf(worst_cross_track, fabsf(mission.getCrossTrack()));
+        }
+    }
+    printf("Mission complete in %.0f s, worst cross-track %.1f m, %lu nav updates\n", elapsed_ms / 1000.0,
+           worst_cross_track, (unsigned long)mission.getNavUpdates());
+
+    ASSERT_EQ(mission.getState(), MissionEngine::COMPLETE);
+    EXPECT_EQ(legs_seen, 4);
+    EXPECT_LT(worst_cross_track, 8.0f);
+    EXPECT_LT(distanceTo(0, 0), 12.0);              // 5 m acceptance plus GPS noise and the run-out
+    EXPECT_FALSE(autopilot.isEngaged());
+    EXPECT_EQ(mission.getGPSTimeouts(), 0u);
+
+    // Throttle ramps down once the mission is over
+    host::runFor(3000);
+    EXPECT_EQ(actuator_module.getMotorSpeed(), 0);
+}
+
+TEST_F(MissionTest, SteeringByHandAbortsTheMission) {
+    startMission(offset(300, 0, 200));
+    host::runFor(10000);
+    ASSERT_EQ(mission.getState(), MissionEngine::RUNNING);
+    ASSERT_TRUE(autopilot.isEngaged());
+
+    host::HttpResponse response;
+    ASSERT_TRUE(host::httpRequest(80, "GET", "/servo?angle=120", response));
+    host::runFor(200);
+    EXPECT_EQ(mission.getState(), MissionEngine::ABORTED);
+    EXPECT_FALSE(autopilot.isEngaged());
+}
+
+TEST_F(MissionTest, GeofenceBreachAbortsTheMission) {
+    // Keep-in square 40 m around the start; the waypoint is well outside it
+    double meters_per_deg_lon = METERS_PER_DEG_LAT * cos(START_LATITUDE * DEG_TO_RAD);
+    std::string fence = "in\n";
+    const double corners[4][2] = { { -40, -40 }, { 40, -40 }, { 40, 40 }, { -40, 40 } };
+    for (const auto& corner : corners) {
+        char line[64];
+        snprintf(line, sizeof(line), "%.7f,%.7f\n", START_LATITUDE + corner[0] / METERS_PER_DEG_LAT,
+                 START_LONGITUDE + corner[1] / meters_per_deg_lon);
+        fence += line;
+    }
+    host::HttpResponse response;
+    ASSERT_TRUE(host::httpRequest(80, "POST", "/geofence", response, fence));
+    ASSERT_EQ(response.code, 200) << response.body;
+
+    startMission(offset(300, 0, 200));
+    ASSERT_TRUE(host::runUntil([]() { return geofence.isBreached(); }, 120000));
+    host::runFor(200);
+    EXPECT_EQ(mission.getState(), MissionEngine::ABORTED);
+    EXPECT_TRUE(actuator_module.isMotorInhibited());
+    EXPECT_EQ(actuator_module.getTargetMotorSpeed(), 0);
+
+    // Drifting back in does not restart anything
+    host::runFor(30000);
+    EXPECT_EQ(mission.getState(), MissionEngine::ABORTED);
+    EXPECT_TRUE(actuator_module.isMotorInhibited());
+}
+
+TEST_F(MissionTest, RejectsUploadsWhileRunning) {
+    startMission(offset(300, 0, 200));
+    host::runFor(2000);
+    host::HttpResponse response;
+    ASSERT_TRUE(host::httpRequest(80, "POST", "/mission", response, offset(10, 10, 100)));
+    EXPECT_EQ(response.code, 400);
+    EXPECT_EQ(mission.getWaypointCount(), 1);
+}
+
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include <math.h>
+#include "NavigationFilter.h"
+#include "BoatTrack.h"
+
+// NavigationFilter replayed over BoatTrack: 1 kHz IMU, 1 Hz fixes with 2 m
+// noise and 10 Hz barometric altitude, fused in the order the sensor task
+// uses (attitude, predict, then any new fix).
+namespace {
+
+struct Replay {
+    double filter_rms;      // Horizontal error of the fused position, m
+    double filter_max;
+    double held_rms;        // Horizontal error of the last fix, held until the next one
+    double altitude_max;    // Worst |altitude error|, m
+};
+
+Replay replay(NavigationFilter& filter, BoatTrack& track, double seconds, double settle_seconds) {
+    AttitudeEstimator attitude;
+    GPSData held = {};
+    double filter_sum = 0, held_sum = 0;
+    Replay result = { 0, 0, 0, 0 };
+    uint32_t measured = 0;
+
+    uint32_t steps = (uint32_t)(seconds * 1000);
+    for (uint32_t i = 1; i <= steps; i++) {
+        ImuSample sample = track.step();
+        attitude.update(sample);
+        filter.predict(sample, attitude);
+        if (i % 100 == 0) {
+            filter.updateBaro(track.baroAltitude());
+        }
+        if (i % 1000 == 0) {
+            held = track.fix();
+            filter.updateGPS(held, attitude);
+        }
+        if (i < settle_seconds * 1000) {
+            continue;
+        }
+        NavigationState state;
+        filter.getState(state);
+        double error = track.errorOf(state.latitude, state.longitude);
+        double held_error = track.errorOf(held.latitude, held.longitude);
+        filter_sum += error * error;
+        held_sum += held_error * held_error;
+        result.filter_max = fmax(result.filter_max, error);
+        result.altitude_max = fmax(result.altitude_max, fabs(state.altitude - BoatTrack::ALTITUDE));
+        measured++;
+    }
+    result.filter_rms = sqrt(filter_sum / measured);
+    result.held_rms = sqrt(held_sum / measured);
+    return result;
+}
+
+TEST(NavigationFilterTest, NothingIsPublishedBeforeTheFirstFix) {
+    NavigationFilter filter;
+    BoatTrack track;
+    AttitudeEstimator attitude;
+    for (int i = 0; i < 500; i++) {
+        ImuSample sample = track.step();
+        attitude.update(sample);
+        filter.predict(sample, attitude);
+    }
+    NavigationState state;
+    filter.getState(state);
+    EXPECT_FALSE(state.valid);
+    EXPECT_EQ(filter.getPredictCount(), 0u);
+}
+
+TEST(NavigationFilterTest, FirstFixSetsTheOrigin) {
+    NavigationFilter filter;
+    AttitudeEstimator attitude;
+    GPSData fix = {};
+    fix.valid = true;
+    fix.latitude = BoatTrack::ORIGIN_LATITUDE;
+    fix.longitude = BoatTrack::ORIGIN_LONGITUDE;
+    fix.fix_count = 1;
+    filter.updateGPS(fix, attitude);
+
+    NavigationState state;
+    filter.getState(state);
+    EXPECT_TRUE(state.valid);
+    EXPECT_DOUBLE_EQ(state.latitude, BoatTrack::ORIGIN_LATITUDE);
+    EXPECT_DOUBLE_EQ(state.longitude, BoatTrack::ORIGIN_LONGITUDE);
+    EXPECT_FLOAT_EQ(state.north, 0.0f);
+}
+
+TEST(NavigationFilterTest, EachFixIsFusedOnce) {
+    NavigationFilter filter;
+    AttitudeEstimator attitude;
+    BoatTrack track;
+    GPSData fix = track.fix();
+    filter.updateGPS(fix, attitude);
+    fix = track.fix();
+    filter.updateGPS(fix, attitude);
+    filter.updateGPS(fix, attitude);
+    EXPECT_EQ(filter.getGPSUpdateCount(), 2u);
+}
+
+TEST(NavigationFilterTest, PlaceholderSpeedIsNotFused) {
+    NavigationFilter filter;
+    AttitudeEstimator attitude;
+    GPSData fix = {};
+    fix.valid = true;
+    fix.latitude = BoatTrack::ORIGIN_LATITUDE;
+    fix.longitude = BoatTrack::ORIGIN_LONGITUDE;
+    fix.speed = 13.37f;                 // SensorModule's placeholder before the first RMC
+    for (uint32_t i = 1; i <= 10; i++) {
+        fix.fix_count = i;
+        filter.updateGPS(fix, attitude);
+    }
+
+    NavigationState state;
+    filter.getState(state);
+    EXPECT_EQ(filter.getGPSUpdateCount(), 10u);
+    EXPECT_FLOAT_EQ(state.vel_north, 0.0f);
+    EXPECT_FLOAT_EQ(state.vel_east, 0.0f);
+    EXPECT_FALSE(state.heading_aligned);
+}
+
+TEST(NavigationFilterTest, FusedPositionBeatsTheLastFixBetweenFixes) {
+    NavigationFilter filter;
+    BoatTrack track;
+    Replay result = replay(filter, track, 240, 30);
+
+    NavigationState state;
+    filter.getState(state);
+    EXPECT_TRUE(state.heading_aligned);
+    EXPECT_LT(result.filter_rms, result.held_rms);
+    EXPECT_LT(result.filter_rms, 2.0);
+    EXPECT_LT(result.filter_max, 6.0);
+    EXPECT_LT(result.altitude_max, 1.0);
+    EXPECT_EQ(filter.getGPSUpdateCount(), 240u);
+    EXPECT_EQ(filter.getBaroUpdateCount(), 2399u);     // The first reading seeds the axis
+}
+
+TEST(NavigationFilterTest, VelocityFollowsTheTrack) {
+    NavigationFilter filter;
+    BoatTrack track;
+    replay(filter, track, 120, 0);      // Mid-way through the starboard turn's exit, cruising at 3 m/s
+
+    NavigationState state;
+    filter.getState(state);
+    EXPECT_NEAR(hypot(state.vel_north, state.vel_east), track.getSpeed(), 0.3);
+    EXPECT_NEAR(state.vel_up, 0.0, 0.2);
+}
+
+}
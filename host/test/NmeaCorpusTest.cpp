@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "HostRuntime.h"
+#include "SensorModule.h"
+#include "NmeaCorpus.h"
+
+// Every corpus in NmeaCorpus.h through SensorModule's NMEA and UBX paths, as
+// NmeaBenchmark replays them at boot: the parser's sentence, checksum-failure
+// and fix counts must match the corpus generator's reference model
+// (tools/embed_nmea_corpus.py), however the stream is cut into UART reads.
+namespace {
+
+struct Counts {
+    uint32_t passed;
+    uint32_t failed;
+    uint32_t fixes;
+};
+
+Counts replay(SensorModule& sensors, const NmeaCorpus& corpus, size_t chunk_bytes, int passes) {
+    sensors.resetGPS();
+    for (int pass = 0; pass < passes; pass++) {
+        for (size_t offset = 0; offset < corpus.length; offset += chunk_bytes) {
+            size_t length = corpus.length - offset < chunk_bytes ? corpus.length - offset : chunk_bytes;
+            if (corpus.protocol == CORPUS_UBX) {
+                sensors.injectUBX((const uint8_t*)corpus.text + offset, length);
+            } else {
+                sensors.injectNMEA(corpus.text + offset, length);
+            }
+        }
+    }
+    Counts counts;
+    uint32_t chars;
+    sensors.getGPSParserStats(chars, counts.passed, counts.failed);
+    GPSData fix;
+    sensors.getGPSData(fix);
+    counts.fixes = fix.fix_count;
+    return counts;
+}
+
+class NmeaCorpusTest : public ::testing::TestWithParam<int> {
+protected:
+    SensorModule sensors;
+
+    void SetUp() override {
+        host::reset();
+    }
+};
+
+TEST_P(NmeaCorpusTest, CountsMatchTheGenerator) {
+    const NmeaCorpus& corpus = NMEA_CORPORA[GetParam()];
+    for (size_t chunk_bytes : { (size_t)1, (size_t)7, (size_t)120, corpus.length }) {
+        Counts counts = replay(sensors, corpus, chunk_bytes, 2);
+        EXPECT_EQ(counts.passed, 2 * corpus.sentences_passed) << corpus.name << ", " << chunk_bytes << "-byte chunks";
+        EXPECT_EQ(counts.failed, 2 * corpus.sentences_failed) << corpus.name << ", " << chunk_bytes << "-byte chunks";
+        EXPECT_EQ(counts.fixes, 2 * corpus.fixes) << corpus.name << ", " << chunk_bytes << "-byte chunks";
+    }
+}
+
+TEST_P(NmeaCorpusTest, EndsOnAValidFix) {
+    const NmeaCorpus& corpus = NMEA_CORPORA[GetParam()];
+    replay(sensors, corpus, 120, 1);
+    GPSData fix;
+    sensors.getGPSData(fix);
+    EXPECT_TRUE(fix.valid) << corpus.name;
+    EXPECT_NE(fix.latitude, 0.0) << corpus.name;
+    EXPECT_NE(fix.longitude, 0.0) << corpus.name;
+}
+
+INSTANTIATE_TEST_SUITE_P(Corpora, NmeaCorpusTest, ::testing::Range(0, NMEA_CORPUS_COUNT),
+                         [](const ::testing::TestParamInfo<int>& info) { return std::string(NMEA_CORPORA[info.param].name); });
+
+}
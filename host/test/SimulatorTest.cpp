@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <math.h>
+#include <chrono>
+#include "HostRuntime.h"
+#include "HostNetwork.h"
+#include "Firmware.h"
+
+// The SIMULATION_ENABLED build on the virtual clock: the simulator steps the
+// hull at 1 kHz of firmware time however long the host takes, so these runs
+// are deterministic and an hour of sailing replays in seconds. Each test boots
+// the firmware once; ctest runs every test in its own process.
+namespace {
+
+const double START_LATITUDE = -34.5443;        // Simulator's default start
+const double START_LONGITUDE = -58.4399;
+const double METERS_PER_DEG_LAT = 111320.0;
+const double METERS_PER_DEG_LON = METERS_PER_DEG_LAT * cos(START_LATITUDE * DEG_TO_RAD);
+
+std::string offset(double north, double east, int motor) {
+    char line[64];
+    snprintf(line, sizeof(line), "%.7f,%.7f,%d\n", START_LATITUDE + north / METERS_PER_DEG_LAT,
+             START_LONGITUDE + east / METERS_PER_DEG_LON, motor);
+    return line;
+}
+
+// Horizontal distance between the navigation estimate and the simulator's truth
+double navigationError() {
+    NavigationState state;
+    sensor_module.getNavigation().getState(state);
+    double dn = (state.latitude - simulator.getLatitude()) * METERS_PER_DEG_LAT;
+    double de = (state.longitude - simulator.getLongitude()) * METERS_PER_DEG_LON;
+    return sqrt(dn * dn + de * de);
+}
+
+class SimulatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        host::reset();
+        host::bootFirmware();
+        ASSERT_TRUE(host::runUntil([]() { return boot.isComplete(); }, 20000));
+        ASSERT_EQ(boot.getState(BOOT_WIFI), BOOT_READY);
+        host::runFor(3000);
+    }
+
+    void request(const char* method, const char* uri, const std::string& body = "") {
+        host::HttpResponse response;
+        ASSERT_TRUE(host::httpRequest(80, method, uri, response, body));
+        ASSERT_EQ(response.code, 200) << uri << ": " << response.body;
+    }
+};
+
+TEST_F(SimulatorTest, FullAheadSettlesAtMaxSpeedAndNavigationFollows) {
+    request("GET", "/motor?speed=255");
+    float worst_error = 0;
+    for (int second = 0; second < 60; second++) {
+        host::runFor(1000);
+        if (second >= 10) {
+            worst_error = fmaxf(worst_error, (float)navigationError());
+        }
+    }
+    printf("Speed %.2f m/s, heading %.1f°, worst navigation error %.1f m\n",
+           simulator.getSpeed(), simulator.getHeading(), worst_error);
+
+    EXPECT_NEAR(simulator.getSpeed(), 2.0f, 0.05f);
+    EXPECT_NEAR(simulator.getLatitude(), START_LATITUDE + 100 / METERS_PER_DEG_LAT, 20 / METERS_PER_DEG_LAT);
+    EXPECT_LT(worst_error, 6.0f);
+    EXPECT_EQ(simulator.getSkippedMicros(), 0u);
+    // GGA and RMC once a second since the simulator started during boot
+    EXPECT_NEAR(simulator.getGPSSentences(), 2.0 * host::nowMicros() / 1e6, 10.0);
+}
+
+// The hull follows the PWM and direction pins, not ActuatorModule's own state
+TEST_F(SimulatorTest, HullFollowsTheDrivenOutputs) {
+    ASSERT_EQ(actuator_module.getMotorSpeed(), 0);
+    digitalWrite(actuator_module.getMotorIn1Pin(), HIGH);
+    digitalWrite(actuator_module.getMotorIn2Pin(), LOW);
+    ledcWrite(actuator_module.getMotorChannel(), 255);
+    host::runFor(20000);
+    EXPECT_EQ(actuator_module.getMotorSpeed(), 0);
+    EXPECT_GT(simulator.getSpeed(), 1.8f);
+
+    // Reverse the pins alone: the same duty now pushes astern
+    digitalWrite(actuator_module.getMotorIn1Pin(), LOW);
+    digitalWrite(actuator_module.getMotorIn2Pin(), HIGH);
+    host::runFor(30000);
+    EXPECT_LT(simulator.getSpeed(), -1.0f);
+}
+
+TEST_F(SimulatorTest, AnHourLongMissionReplaysInSeconds) {
+    // 3.5 km out and back, 200 m apart, at full ahead: about an hour at 2 m/s
+    request("POST", "/mission", offset(3500, 0, 255) + offset(3500, 200, 255) + offset(0, 200, 255) + offset(0, 0, 255));
+    request("POST", "/mission?action=start");
+
+    uint64_t started_us = host::nowMicros();
+    uint32_t start_steps = simulator.getSteps();
+    auto wall_start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(host::runUntil([]() { return mission.getState() == MissionEngine::COMPLETE; }, 7200000));
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+    double simulated = (host::nowMicros() - started_us) / 1e6;
+    printf("Simulated %.0f s of mission in %.2f s of wall time (%.0fx)\n", simulated, wall, simulated / wall);
+
+    EXPECT_GT(simulated, 3000.0);
+    EXPECT_LT(wall, 60.0);
+    // One hull step per IMU period, none dropped
+    EXPECT_NEAR(simulator.getSteps() - start_steps, simulated * 1000, 100);
+    EXPECT_EQ(simulator.getSkippedMicros(), 0u);
+    EXPECT_EQ(mission.getGPSTimeouts(), 0u);
+}
+
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "SensorSnapshot.h"
+
+// SnapshotBuffer under real concurrency: one writer thread and two reader
+// threads on host threads rather than the virtual scheduler, so the OS
+// preempts them mid-copy. Every field of a published snapshot carries the
+// same stamp; a reader that sees two different stamps got a torn copy.
+namespace {
+
+const uint32_t PUBLISHES = 200000;
+
+void stamp(SensorSnapshot& snapshot, uint32_t k) {
+    snapshot.timestamp_ms = k;
+    snapshot.bmp_timestamp_ms = k;
+    snapshot.bmp_pressure = (float)k;
+    snapshot.mpu_timestamp_ms = k;
+    snapshot.accel_x = (float)k;
+    snapshot.gyro_z = (float)k;
+    snapshot.mpu_sample_count = k;
+    snapshot.attitude_updates = k;
+    snapshot.navigation_predicts = k;
+    snapshot.gps_timestamp_ms = k;
+    snapshot.gps.satellites = (int)k;
+}
+
+bool isConsistent(const SensorSnapshot& snapshot) {
+    uint32_t k = snapshot.timestamp_ms;
+    return snapshot.bmp_timestamp_ms == k
+        && snapshot.bmp_pressure == (float)k
+        && snapshot.mpu_timestamp_ms == k
+        && snapshot.accel_x == (float)k
+        && snapshot.gyro_z == (float)k
+        && snapshot.mpu_sample_count == k
+        && snapshot.attitude_updates == k
+        && snapshot.navigation_predicts == k
+        && snapshot.gps_timestamp_ms == k
+        && snapshot.gps.satellites == (int)k;
+}
+
+TEST(SnapshotBufferTest, ReadersNeverSeeTornSnapshots) {
+    static SnapshotBuffer buffer;
+    std::atomic<bool> done(false);
+    std::atomic<uint32_t> torn(0), backwards(0), reads(0);
+
+    auto reader = [&]() {
+        SensorSnapshot snapshot;
+        uint32_t last_sequence = 0;
+        while (!done.load(std::memory_order_relaxed)) {
+            buffer.read(snapshot);
+            if (!isConsistent(snapshot)) {
+                torn++;
+            }
+            if (snapshot.sequence < last_sequence) {
+                backwards++;
+            }
+            last_sequence = snapshot.sequence;
+            reads++;
+        }
+    };
+    std::thread reader_a(reader), reader_b(reader);
+
+    // On a single core the writer could otherwise finish before either reader is scheduled
+    while (reads.load() < 2) {
+        std::this_thread::yield();
+    }
+
+    SensorSnapshot snapshot;
+    memset(&snapshot, 0, sizeof(snapshot));
+    for (uint32_t k = 1; k <= PUBLISHES; k++) {
+        stamp(snapshot, k);
+        buffer.publish(snapshot);
+        if (k % 1024 == 0) {
+            std::this_thread::yield();      // Keeps the readers interleaved there too
+        }
+    }
+    done = true;
+    reader_a.join();
+    reader_b.join();
+
+    EXPECT_EQ(torn.load(), 0u);
+    EXPECT_EQ(backwards.load(), 0u);
+    EXPECT_GT(reads.load(), 0u);
+    EXPECT_EQ(buffer.getPublishCount(), PUBLISHES);
+
+    SensorSnapshot last;
+    buffer.read(last);
+    EXPECT_EQ(last.sequence, PUBLISHES);
+    EXPECT_EQ(last.timestamp_ms, PUBLISHES);
+}
+
+TEST(SnapshotBufferTest, ReadBeforeFirstPublishIsZeroed) {
+    SnapshotBuffer buffer;
+    SensorSnapshot snapshot;
+    memset(&snapshot, 0xff, sizeof(snapshot));
+    buffer.read(snapshot);
+    EXPECT_EQ(snapshot.sequence, 0u);
+    EXPECT_EQ(snapshot.timestamp_ms, 0u);
+    EXPECT_EQ(snapshot.gps_timestamp_ms, 0u);
+}
+
+}
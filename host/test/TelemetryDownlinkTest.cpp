@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "HostRuntime.h"
+#include "HostNetwork.h"
+#include "Firmware.h"
+#include "SensorRig.h"
+
+// The UDP downlink as the firmware sends it, on the sensor models: frames go
+// out through the WiFiUDP stand-in, some are dropped here on purpose, and the
+// rest are decoded by tools/telemetry_receiver.py --replay, which must count
+// exactly the dropped sequence numbers as lost. Host CPU time is charged to
+// the clock, so encode_us is the host's cost of TelemetryDownlink's encoder.
+// Each test boots the firmware once; ctest runs every test in its own process.
+namespace {
+
+std::vector<TelemetryFrame> decodeAll(const std::vector<std::string>& payloads) {
+    std::vector<TelemetryFrame> frames;
+    for (const std::string& payload : payloads) {
+        TelemetryFrame frame;
+        EXPECT_EQ(payload.size(), sizeof(frame));
+        memcpy(&frame, payload.data(), std::min(payload.size(), sizeof(frame)));
+        EXPECT_EQ(memcmp(frame.magic, "AU", 2), 0);
+        EXPECT_EQ(frame.version, TelemetryDownlink::FRAME_VERSION);
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+// The receiver's summary line for a capture, empty if it could not be run
+std::string replay(const std::vector<std::string>& payloads) {
+    char path[] = "/tmp/aleph_downlink_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        return "";
+    }
+    FILE* capture = fdopen(fd, "wb");
+    for (const std::string& payload : payloads) {
+        uint8_t length[2] = { (uint8_t)(payload.size() & 0xFF), (uint8_t)(payload.size() >> 8) };
+        fwrite(length, 1, 2, capture);
+        fwrite(payload.data(), 1, payload.size(), capture);
+    }
+    fclose(capture);
+
+    std::string command = std::string("python3 " ALEPH_TOOLS_DIR "/telemetry_receiver.py --replay ") + path + " 2>&1";
+    std::string output;
+    FILE* pipe = popen(command.c_str(), "r");
+    if (pipe != NULL) {
+        char line[256];
+        while (fgets(line, sizeof(line), pipe) != NULL) {
+            output += line;
+        }
+        if (pclose(pipe) != 0) {
+            output.clear();
+        }
+    }
+    remove(path);
+    return output;
+}
+
+TEST(TelemetryDownlinkTest, ReceiverCountsDroppedFramesAsLost) {
+    SensorRig rig;
+    host::reset();
+    rig.start();
+    host::setChargeCpuTime(true);
+    host::bootFirmware();
+    ASSERT_TRUE(host::runUntil([]() { return telemetry_downlink.isActive(); }, 20000));
+    host::runFor(2000);
+    host::takeDatagrams();
+
+    uint32_t sent_before = telemetry_downlink.getFramesSent();
+    uint64_t start_us = host::nowMicros();
+    host::runFor(10000);
+    double seconds = (host::nowMicros() - start_us) / 1e6;
+
+    std::vector<std::string> payloads;
+    for (const host::Datagram& datagram : host::takeDatagrams()) {
+        if (datagram.port == telemetry_downlink.getPort()) {
+            EXPECT_EQ(datagram.address, host::BROADCAST_IP);
+            payloads.push_back(datagram.payload);
+        }
+    }
+    std::vector<TelemetryFrame> frames = decodeAll(payloads);
+    ASSERT_FALSE(frames.empty());
+
+    double rate = frames.size() / seconds;
+    printf("%zu frames in %.2f s: %.1f frames/s; encode %lu us/frame average, %lu us max\n",
+           frames.size(), seconds, rate, (unsigned long)telemetry_downlink.getEncodeMicrosAverage(),
+           (unsigned long)telemetry_downlink.getEncodeMicrosMax());
+    EXPECT_EQ(frames.size(), telemetry_downlink.getFramesSent() - sent_before);
+    EXPECT_NEAR(rate, telemetry_downlink.getRate(), 1.0);
+    EXPECT_EQ(telemetry_downlink.getSendFailures(), 0u);
+    EXPECT_LT(telemetry_downlink.getEncodeMicrosAverage(), 50u);
+    for (size_t i = 1; i < frames.size(); i++) {
+        ASSERT_EQ(frames[i].sequence, frames[i - 1].sequence + 1) << "frame " << i;
+    }
+    // Built from the live snapshot: the rig's GPS fix and the IMU's 1 g
+    EXPECT_TRUE(frames.back().flags & 0x01);
+    EXPECT_NEAR(frames.back().accel[2], 9.81f, 0.5f);
+
+    // Lose every 20th frame and a burst of 7, as a lossy link would
+    std::vector<std::string> received;
+    uint32_t dropped = 0;
+    for (size_t i = 0; i < payloads.size(); i++) {
+        if (i % 20 == 10 || (i >= 200 && i < 207)) {
+            dropped++;
+        } else {
+            received.push_back(payloads[i]);
+        }
+    }
+
+    std::string summary = replay(received);
+    if (summary.empty()) {
+        GTEST_SKIP() << "python3 could not run tools/telemetry_receiver.py";
+    }
+    printf("%s", summary.c_str());
+    unsigned long packets, count, lost, reordered, invalid;
+    ASSERT_EQ(sscanf(summary.c_str(), "replayed %lu packets: received %lu lost %lu (%*f%%) reordered %lu invalid %lu",
+                     &packets, &count, &lost, &reordered, &invalid), 5) << summary;
+    EXPECT_EQ(count, received.size());
+    EXPECT_EQ(lost, dropped);
+    EXPECT_EQ(reordered, 0u);
+    EXPECT_EQ(invalid, 0u);
+}
+
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "HostRuntime.h"
+#include "Firmware.h"
+#include "SensorRig.h"
+
+// The SSE stream on port 81: its rate and per-frame cost with every slot
+// taken, and a subscriber that has stopped reading. Boots the hardware build;
+// ctest runs each test in its own process.
+namespace {
+
+class TelemetryStreamTest : public ::testing::Test {
+protected:
+    SensorRig rig;
+
+    void SetUp() override {
+        host::reset();
+        rig.start();
+        host::bootFirmware();
+        ASSERT_TRUE(host::runUntil([]() { return WiFi.status() == WL_CONNECTED; }, 20000));
+    }
+
+    std::string streamStats(const char* target = "/stream") {
+        host::HttpResponse response;
+        EXPECT_TRUE(host::httpRequest(80, "GET", target, response));
+        return response.body;
+    }
+
+    static unsigned long statField(const std::string& stats, const char* key) {
+        std::string pattern = std::string("\"") + key + "\":";
+        size_t at = stats.find(pattern);
+        EXPECT_NE(at, std::string::npos) << key << " in " << stats;
+        return at == std::string::npos ? 0 : strtoul(stats.c_str() + at + pattern.size(), NULL, 10);
+    }
+
+    static size_t countEvents(const std::string& received) {
+        size_t count = 0;
+        for (size_t at = received.find("data: "); at != std::string::npos; at = received.find("data: ", at + 6)) {
+            count++;
+        }
+        return count;
+    }
+};
+
+TEST_F(TelemetryStreamTest, HoldsTheConfiguredRateWithEverySlotTaken) {
+    std::string stats = streamStats("/stream?rate=50");
+    ASSERT_EQ(statField(stats, "rate"), 50u);
+
+    std::vector<std::shared_ptr<host::TcpPeer>> subscribers;
+    for (int i = 0; i < 4; i++) {
+        subscribers.push_back(host::connectTcp(81));
+        ASSERT_TRUE(subscribers.back());
+    }
+
+    // Per-frame cost first, with host CPU time on the clock: wall-clock charging
+    // would let host preemption stretch the rate figures below
+    host::setChargeCpuTime(true);
+    for (int tick = 0; tick < 20; tick++) {
+        host::runFor(100);
+        for (auto& subscriber : subscribers) {
+            subscriber->receive();
+        }
+    }
+    host::setChargeCpuTime(false);
+    stats = streamStats();
+    unsigned long encode_avg = statField(stats, "encode_us_avg"), send_avg = statField(stats, "send_us_avg");
+    printf("Per frame to 4 subscribers: encode %lu us (max %lu), send to all %lu us (max %lu)\n", encode_avg,
+           statField(stats, "encode_us_max"), send_avg, statField(stats, "send_us_max"));
+    EXPECT_LT(encode_avg, 500u);        // Host time; a blocking send would show up as the frame interval
+    EXPECT_LT(send_avg, 500u);
+
+    // 10 s of events, read every 100 ms as a browser would
+    std::vector<size_t> events(subscribers.size(), 0);
+    uint64_t start_us = host::nowMicros();
+    unsigned long frames_before = statField(streamStats(), "frames");
+    for (int tick = 0; tick < 100; tick++) {
+        host::runFor(100);
+        for (size_t i = 0; i < subscribers.size(); i++) {
+            events[i] += countEvents(subscribers[i]->receive());
+        }
+    }
+    double expected = 50 * (host::nowMicros() - start_us) / 1e6;
+    stats = streamStats();
+
+    EXPECT_EQ(statField(stats, "subscribers"), 4u);
+    EXPECT_EQ(statField(stats, "dropped_subscribers"), 0u);
+    for (size_t i = 0; i < subscribers.size(); i++) {
+        EXPECT_NEAR((double)events[i], expected, 1.0) << "subscriber " << i;
+    }
+    EXPECT_NEAR((double)(statField(stats, "frames") - frames_before), expected, 1.0);
+}
+
+TEST_F(TelemetryStreamTest, StalledSubscriberIsDroppedWithoutBlocking) {
+    std::shared_ptr<host::TcpPeer> reader = host::connectTcp(81);
+    std::shared_ptr<host::TcpPeer> stalled = host::connectTcp(81);
+    ASSERT_TRUE(reader && stalled);
+    stalled->setStalled(true);
+
+    // Well past the point where the stalled peer's send buffer is full
+    for (int i = 0; i < 50; i++) {
+        host::runFor(100);
+        reader->receive();
+    }
+
+    // The web task still answers, and only the stalled subscriber is gone
+    std::string stats = streamStats();
+    EXPECT_NE(stats.find("\"subscribers\":1"), std::string::npos) << stats;
+    EXPECT_NE(stats.find("\"dropped_subscribers\":1"), std::string::npos) << stats;
+    EXPECT_FALSE(stalled->isOpen());
+    EXPECT_TRUE(reader->isOpen());
+
+    // Every event the reader gets is whole
+    host::runFor(1000);
+    std::string events = reader->receive();
+    ASSERT_FALSE(events.empty());
+    size_t count = 0;
+    for (size_t start = 0; start < events.size(); count++) {
+        ASSERT_EQ(events.compare(start, 6, "data: "), 0) << "event " << count;
+        size_t end = events.find("\n\n", start);
+        ASSERT_NE(end, std::string::npos) << "event " << count;
+        start = end + 2;
+    }
+    EXPECT_NEAR((double)count, (double)statField(stats, "rate"), 1.0);    // 1 s of events
+}
+
+}
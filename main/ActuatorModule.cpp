@@ -2,46 +2,50 @@
 
 ActuatorModule::ActuatorModule(int servo_pin, int servo_channel, 
                                int motor_pwm, int motor_stby, int motor_in1, int motor_in2, int motor_channel) 
-    : servo_pin(servo_pin), ledc_channel(servo_channel), current_position(90), servo_initialized(false),
+    : servo_pin(servo_pin), ledc_channel(servo_channel), current_position(90), target_position(90),
+      servo_initialized(false), servo_attached(false),
       motor_pwm_pin(motor_pwm), motor_standby_pin(motor_stby), 
       motor_in1_pin(motor_in1), motor_in2_pin(motor_in2), 
-      motor_ledc_channel(motor_channel), current_motor_speed(0), motor_initialized(false) {
+      motor_ledc_channel(motor_channel), current_motor_speed(0), target_motor_speed(0),
+      motor_inhibited(false), inhibited_targets(0), motor_initialized(false),
+      ramp_timer(NULL), motor_ramp_reset(false), servo_output(90.0f), servo_slew_rate(DEFAULT_SERVO_SLEW_RATE),
+      motor_output(0.0f), motor_rate(0.0f),
+      motor_accel_limit(DEFAULT_MOTOR_ACCEL_LIMIT), motor_jerk_limit(DEFAULT_MOTOR_JERK_LIMIT),
+      ramp_ticks(0), ramp_us_total(0), ramp_us_max(0) {
 }
 
+// Nothing here waits on the servo: the first pulse already commands center, and
+// the servo gets there on its own while the rest of the system comes up
 bool ActuatorModule::begin() {
 
     ledcSetup(ledc_channel, LEDC_HZ, LEDC_RES);
     ledcAttachPin(servo_pin, ledc_channel);
-    delay(50);
     
-    setPosition(90);
-    delay(500);
+    // Start at center directly; the ramp only slews from here on
+    ledcWrite(ledc_channel, microsecondsToDutyCycle(angleToUs(90)));
+    current_position = target_position = 90;
+    servo_output = 90.0f;
     
+    servo_attached = true;
     servo_initialized = true;
-    Serial.println("Servo initialized on pin " + String(servo_pin) + " (LEDC channel " + String(ledc_channel) + ") at center position (90°)");
-    return true;
+    LOG_INFO("Servo initialized on pin %d (LEDC channel %d) at center position (90°)", servo_pin, ledc_channel);
+    return startRampTimer();
 }
 
 void ActuatorModule::setPosition(int angle) {
     if (!servo_initialized) {
-        Serial.println("ERROR: Servo not initialized");
+        LOG_ERROR("Servo not initialized");
         return;
     }
 
     if (angle < MIN_POSITION || angle > MAX_POSITION) {
-      Serial.println("WARNING: Servo angle " + String(angle) + "° out of range (" + 
-                    String(MIN_POSITION) + "-" + String(MAX_POSITION) + "°). Constraining.");
+      LOG_WARN("Servo angle %d° out of range (%d-%d°). Constraining.", angle, MIN_POSITION, MAX_POSITION);
     }
     
     angle = constrain(angle, MIN_POSITION, MAX_POSITION);
+    target_position = angle;
     
-    int pulseWidth = angleToUs(angle);
-    uint32_t duty = microsecondsToDutyCycle(pulseWidth);
-    ledcWrite(ledc_channel, duty);
-    
-    current_position = angle;
-    
-    Serial.println("Servo moved to " + String(angle) + "° (pulse: " + String(pulseWidth) + "µs, duty: " + String(duty) + ")");
+    LOG_DEBUG("Servo target set to %d°", angle);  // The autopilot retargets at its tick rate
 }
 
 int ActuatorModule::getPosition() const {
@@ -54,15 +58,17 @@ void ActuatorModule::center() {
 
 void ActuatorModule::detach() {
     if (servo_initialized) {
+        servo_attached = false;
         ledcDetachPin(servo_pin);
-        Serial.println("Servo detached from pin " + String(servo_pin));
+        LOG_INFO("Servo detached from pin %d", servo_pin);
     }
 }
 
 void ActuatorModule::attach() {
     if (servo_initialized) {
         ledcAttachPin(servo_pin, ledc_channel);
-        Serial.println("Servo re-attached to pin " + String(servo_pin) + " (LEDC channel " + String(ledc_channel) + ")");
+        servo_attached = true;
+        LOG_INFO("Servo re-attached to pin %d (LEDC channel %d)", servo_pin, ledc_channel);
     }
 }
 
@@ -72,6 +78,14 @@ uint32_t ActuatorModule::microsecondsToDutyCycle(int us) const {
     return (uint32_t)((uint64_t)us * max_duty / period_us);
 }
 
+float ActuatorModule::dutyToAngle(uint32_t duty) const {
+    const uint32_t period_us = 1000000UL / LEDC_HZ;
+    const uint32_t max_duty = (1UL << LEDC_RES) - 1;
+    float us = (float)duty * period_us / max_duty;
+    return MIN_POSITION + (us - SERVO_MIN_MICROSECONDS) * (MAX_POSITION - MIN_POSITION) /
+           (float)(SERVO_MAX_MICROSECONDS - SERVO_MIN_MICROSECONDS);
+}
+
 // Helper function: Convert an angle (0–180°) → pulse width (µs)
 int ActuatorModule::angleToUs(int angle) const {
     return map(angle, MIN_POSITION, MAX_POSITION, SERVO_MIN_MICROSECONDS, SERVO_MAX_MICROSECONDS);
@@ -95,42 +109,38 @@ bool ActuatorModule::beginMotor() {
     ledcAttachPin(motor_pwm_pin, motor_ledc_channel);
     ledcWrite(motor_ledc_channel, 0);  // Start with 0 speed
     
+    current_motor_speed = target_motor_speed = 0;
+    motor_output = 0.0f;
+    motor_rate = 0.0f;
     motor_initialized = true;
-    current_motor_speed = 0;
     
-    Serial.println("DC Motor initialized:");
-    Serial.println("  PWM pin: " + String(motor_pwm_pin) + " (LEDC channel " + String(motor_ledc_channel) + ")");
-    Serial.println("  STBY pin: " + String(motor_standby_pin));
-    Serial.println("  IN1 pin: " + String(motor_in1_pin));
-    Serial.println("  IN2 pin: " + String(motor_in2_pin));
+    LOG_INFO("DC Motor initialized: PWM pin %d (LEDC channel %d), STBY pin %d, IN1 pin %d, IN2 pin %d",
+             motor_pwm_pin, motor_ledc_channel, motor_standby_pin, motor_in1_pin, motor_in2_pin);
     
-    return true;
+    return startRampTimer();
 }
 
 void ActuatorModule::setMotorSpeed(int speed) {
     if (!motor_initialized) {
-        Serial.println("ERROR: Motor not initialized");
+        LOG_ERROR("Motor not initialized");
         return;
     }
     
     // Constrain speed to valid range
     if (speed < -MAX_MOTOR_SPEED || speed > MAX_MOTOR_SPEED) {
-        Serial.println("WARNING: Motor speed " + String(speed) + " out of range (-" + 
-                      String(MAX_MOTOR_SPEED) + " to " + String(MAX_MOTOR_SPEED) + "). Constraining.");
+        LOG_WARN("Motor speed %d out of range (-%d to %d). Constraining.", speed, MAX_MOTOR_SPEED, MAX_MOTOR_SPEED);
     }
     speed = constrain(speed, -MAX_MOTOR_SPEED, MAX_MOTOR_SPEED);
+    if (motor_inhibited && speed != 0) {
+        if (inhibited_targets++ == 0) {
+            LOG_WARN("Motor inhibited, target %d ignored", speed);    // Uplink and mission retry at their own rate
+        }
+        speed = 0;
+    }
+    target_motor_speed = speed;
     
-    // Set direction based on speed sign
-    setMotorDirection(speed);
-    
-    // Set PWM duty cycle based on absolute speed value
-    int pwm_value = abs(speed);
-    ledcWrite(motor_ledc_channel, pwm_value);
-    
-    current_motor_speed = speed;
-    
-    String direction = (speed > 0) ? "FORWARD" : (speed < 0) ? "REVERSE" : "STOPPED";
-    Serial.println("Motor speed set to " + String(speed) + " (" + direction + ", PWM: " + String(pwm_value) + ")");
+    const char* direction = (speed > 0) ? "FORWARD" : (speed < 0) ? "REVERSE" : "STOPPED";
+    LOG_INFO("Motor target set to %d (%s)", speed, direction);
 }
 
 void ActuatorModule::setMotorDirection(int speed) {
@@ -155,36 +165,173 @@ int ActuatorModule::getMotorSpeed() const {
 
 void ActuatorModule::stopMotor() {
     if (!motor_initialized) {
-        Serial.println("ERROR: Motor not initialized");
+        LOG_ERROR("Motor not initialized");
         return;
     }
     
-    // Stop motor by setting speed to 0
-    digitalWrite(motor_in1_pin, LOW);
-    digitalWrite(motor_in2_pin, LOW);
-    ledcWrite(motor_ledc_channel, 0);
-    current_motor_speed = 0;
+    // Ramp down rather than cut the PWM, so the deceleration current stays bounded too
+    target_motor_speed = 0;
     
-    Serial.println("Motor stopped");
+    LOG_INFO("Motor stopping");
+}
+
+// The ramp tick reads the flag too, so a target written just before the inhibit cannot slip through
+void ActuatorModule::setMotorInhibit(bool inhibited) {
+    if (inhibited == motor_inhibited) {
+        return;
+    }
+    motor_inhibited = inhibited;
+    if (inhibited) {
+        inhibited_targets = 0;
+        target_motor_speed = 0;
+        LOG_WARN("Motor inhibited");
+    } else {
+        LOG_INFO("Motor inhibit released, %lu targets ignored", (unsigned long)inhibited_targets);
+    }
 }
 
 void ActuatorModule::enableMotor() {
     if (!motor_initialized) {
-        Serial.println("ERROR: Motor not initialized");
+        LOG_ERROR("Motor not initialized");
         return;
     }
     
     digitalWrite(motor_standby_pin, HIGH);
-    Serial.println("Motor driver enabled");
+    LOG_INFO("Motor driver enabled");
 }
 
 void ActuatorModule::disableMotor() {
     if (!motor_initialized) {
-        Serial.println("ERROR: Motor not initialized");
+        LOG_ERROR("Motor not initialized");
         return;
     }
     
     digitalWrite(motor_standby_pin, LOW);
-    current_motor_speed = 0;
-    Serial.println("Motor driver disabled (standby mode)");
+    
+    // The bridge is already off; the ramp restarts from zero so re-enabling does not jump
+    target_motor_speed = 0;
+    motor_ramp_reset = true;
+    LOG_INFO("Motor driver disabled (standby mode)");
+}
+
+// ==================== RAMP GENERATOR ====================
+
+bool ActuatorModule::startRampTimer() {
+    if (ramp_timer != NULL) {
+        return true;
+    }
+    
+    esp_timer_create_args_t args = {};
+    args.callback = &ActuatorModule::onRampTimer;
+    args.arg = this;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "actuator_ramp";
+    
+    if (esp_timer_create(&args, &ramp_timer) != ESP_OK ||
+        esp_timer_start_periodic(ramp_timer, RAMP_PERIOD_US) != ESP_OK) {
+        LOG_ERROR("Could not start the actuator ramp timer");
+        return false;
+    }
+    return true;
+}
+
+void ActuatorModule::onRampTimer(void* arg) {
+    static_cast<ActuatorModule*>(arg)->updateRamp();
+}
+
+void ActuatorModule::updateRamp() {
+    uint32_t start = micros();
+    const float dt = RAMP_PERIOD_US * 1e-6f;
+    
+    if (servo_initialized && servo_attached) {
+        updateServoRamp(dt);
+    }
+    if (motor_initialized) {
+        updateMotorRamp(dt);
+    }
+    
+    uint32_t elapsed = micros() - start;
+    ramp_ticks = ramp_ticks + 1;
+    ramp_us_total = ramp_us_total + elapsed;
+    if (elapsed > ramp_us_max) {
+        ramp_us_max = elapsed;
+    }
+}
+
+// Constant slew rate; the duty register is only written when the whole-degree output changes
+void ActuatorModule::updateServoRamp(float dt) {
+    float error = target_position - servo_output;
+    if (error == 0.0f) {
+        return;
+    }
+    
+    float step = servo_slew_rate * dt;
+    servo_output += constrain(error, -step, step);
+    
+    int position = lroundf(servo_output);
+    if (position != current_position) {
+        ledcWrite(ledc_channel, microsecondsToDutyCycle(angleToUs(position)));
+        current_position = position;
+    }
+}
+
+// Jerk-limited (S-curve) ramp. The slope is capped at the acceleration limit
+// and at the fastest value that can still be brought back to zero at the
+// target under the jerk limit (the discrete-time form of sqrt(2 * j * |error|),
+// so the landing step is within j * dt too); the slope itself changes by at
+// most j * dt per tick. Sign changes pass smoothly through 0.
+void ActuatorModule::updateMotorRamp(float dt) {
+    if (motor_ramp_reset) {
+        motor_ramp_reset = false;
+        motor_output = 0.0f;
+        motor_rate = 0.0f;
+        current_motor_speed = 0;
+        setMotorDirection(0);
+        ledcWrite(motor_ledc_channel, 0);
+    }
+    
+    float target = motor_inhibited ? 0.0f : target_motor_speed;
+    float error = target - motor_output;
+    if (error == 0.0f && motor_rate == 0.0f) {
+        return;
+    }
+    
+    float jerk_step = motor_jerk_limit * dt;
+    float braking_rate = jerk_step * (sqrtf(2.0f * fabsf(error) / (jerk_step * dt) + 0.25f) - 0.5f);
+    float desired_rate = copysignf(fminf(motor_accel_limit, braking_rate), error);
+    motor_rate += constrain(desired_rate - motor_rate, -jerk_step, jerk_step);
+    
+    float next = motor_output + motor_rate * dt;
+    if ((error >= 0.0f && next >= target) || (error <= 0.0f && next <= target)) {
+        // Arrived (or would overshoot within this tick): land exactly on the target
+        next = target;
+        motor_rate = 0.0f;
+    }
+    motor_output = next;
+    
+    int speed = lroundf(motor_output);
+    if (speed != current_motor_speed) {
+        if ((speed > 0) != (current_motor_speed > 0) || (speed < 0) != (current_motor_speed < 0)) {
+            setMotorDirection(speed);
+        }
+        ledcWrite(motor_ledc_channel, abs(speed));
+        current_motor_speed = speed;
+    }
+}
+
+void ActuatorModule::setServoSlewRate(float degrees_per_second) {
+    if (degrees_per_second <= 0.0f) {
+        LOG_WARN("Servo slew rate must be positive, ignored");
+        return;
+    }
+    servo_slew_rate = degrees_per_second;
+}
+
+void ActuatorModule::setMotorRamp(float accel_limit, float jerk_limit) {
+    if (accel_limit <= 0.0f || jerk_limit <= 0.0f) {
+        LOG_WARN("Motor ramp limits must be positive, ignored");
+        return;
+    }
+    motor_accel_limit = accel_limit;
+    motor_jerk_limit = jerk_limit;
 }
@@ -2,14 +2,21 @@
 #define ACTUATOR_MODULE_H
 
 #include <Arduino.h>
+#include <esp_timer.h>
+#include "Log.h"
 
+// Servo and TB6612FNG motor driver. Setters only change targets; a periodic
+// esp_timer callback moves the outputs toward them under the slew, acceleration
+// and jerk limits and is the only code that writes the PWM registers.
 class ActuatorModule {
 private:
     // Servo control
     const int servo_pin;
     const int ledc_channel;
-    int current_position;
+    volatile int current_position;      // Output actually driven, updated by the ramp
+    volatile int target_position;
     bool servo_initialized;
+    volatile bool servo_attached;
     
     static const int MIN_POSITION = 0;
     static const int MAX_POSITION = 180;
@@ -30,7 +37,10 @@ private:
     const int motor_in1_pin;
     const int motor_in2_pin;
     const int motor_ledc_channel;
-    int current_motor_speed;
+    volatile int current_motor_speed;   // Output actually driven, updated by the ramp
+    volatile int target_motor_speed;
+    volatile bool motor_inhibited;      // Latched by setMotorInhibit(); holds the target at 0
+    uint32_t inhibited_targets;         // Non-zero targets ignored since the inhibit was set
     bool motor_initialized;
     
     static const int MOTOR_LEDC_HZ = 1000;
@@ -38,6 +48,30 @@ private:
     static const int MAX_MOTOR_SPEED = 255;
     
     void setMotorDirection(int speed);
+    
+    // Ramp generator (esp_timer task context)
+    static const uint32_t RAMP_PERIOD_US = 5000;     // 200 Hz
+    static constexpr float DEFAULT_SERVO_SLEW_RATE = 180.0f;    // Full travel in 1 s
+    static constexpr float DEFAULT_MOTOR_ACCEL_LIMIT = 510.0f;  // 0 to full in 0.5 s at the slope limit
+    static constexpr float DEFAULT_MOTOR_JERK_LIMIT = 2550.0f;  // Slope limit reached in 0.2 s
+    esp_timer_handle_t ramp_timer;
+    volatile bool motor_ramp_reset;     // Set by disableMotor(), consumed by the next tick
+    float servo_output;                 // degrees
+    float servo_slew_rate;              // degrees/s
+    float motor_output;                 // PWM counts, signed
+    float motor_rate;                   // PWM counts/s, the current ramp slope
+    float motor_accel_limit;            // Max |d(speed)/dt|, counts/s
+    float motor_jerk_limit;             // Max |d²(speed)/dt²|, counts/s²
+    // The outputs and slope above are only touched by the ramp tick
+    volatile uint32_t ramp_ticks;
+    volatile uint32_t ramp_us_total;
+    volatile uint32_t ramp_us_max;
+    
+    bool startRampTimer();
+    void updateRamp();
+    void updateServoRamp(float dt);
+    void updateMotorRamp(float dt);
+    static void onRampTimer(void* arg);
 
 public:
     ActuatorModule(int servo_pin = 25, int servo_channel = 0, 
@@ -47,8 +81,10 @@ public:
     bool begin();
     bool isServoInitialized() const { return servo_initialized; }
     
-    void setPosition(int angle);
-    int getPosition() const;
+    void setPosition(int angle);        // Target; the servo slews there at the configured rate
+    int getPosition() const;            // Current output
+    int getTargetPosition() const { return target_position; }
+    void setServoSlewRate(float degrees_per_second);
     
     void center();
     
@@ -59,11 +95,27 @@ public:
     bool beginMotor();
     bool isMotorInitialized() const { return motor_initialized; }
     
-    void setMotorSpeed(int speed);  // Range: -255 to 255 (negative = reverse)
-    int getMotorSpeed() const;
-    void stopMotor();
+    void setMotorSpeed(int speed);  // Range: -255 to 255 (negative = reverse); ramped target, 0 while inhibited
+    int getMotorSpeed() const;      // Current output
+    int getTargetMotorSpeed() const { return target_motor_speed; }
+    void stopMotor();               // Ramps down to 0
     void enableMotor();
-    void disableMotor();
+    void disableMotor();            // Immediate: driver to standby, ramp reset
+    void setMotorRamp(float accel_limit, float jerk_limit);  // counts/s and counts/s²
+    void setMotorInhibit(bool inhibited);   // While set, every target is clamped to 0 and the ramp brings the motor down
+    bool isMotorInhibited() const { return motor_inhibited; }
+    
+    // Where the outputs are driven, for code that reads them back from the hardware (Simulator)
+    int getServoChannel() const { return ledc_channel; }
+    int getMotorChannel() const { return motor_ledc_channel; }
+    int getMotorIn1Pin() const { return motor_in1_pin; }
+    int getMotorIn2Pin() const { return motor_in2_pin; }
+    float dutyToAngle(uint32_t duty) const;     // Inverse of the servo's angle -> pulse -> duty mapping
+    
+    // Ramp timer cost, measured inside the callback
+    uint32_t getRampTicks() const { return ramp_ticks; }
+    uint32_t getRampMicrosAverage() const { return ramp_ticks > 0 ? ramp_us_total / ramp_ticks : 0; }
+    uint32_t getRampMicrosMax() const { return ramp_us_max; }
 };
 
 #endif // ACTUATOR_MODULE_H
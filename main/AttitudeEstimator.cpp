@@ -0,0 +1,126 @@
+#include "AttitudeEstimator.h"
+
+AttitudeEstimator::AttitudeEstimator(float gain)
+    : beta(gain) {
+    reset();
+}
+
+void AttitudeEstimator::reset() {
+    q0 = 1.0f;
+    q1 = 0.0f;
+    q2 = 0.0f;
+    q3 = 0.0f;
+    last_timestamp_us = 0;
+    initialized = false;
+    update_count = 0;
+}
+
+// Seed roll and pitch from gravity so the filter does not spend seconds converging
+void AttitudeEstimator::initializeFromAccel(float ax, float ay, float az) {
+    float roll = atan2f(ay, az);
+    float pitch = atan2f(-ax, sqrtf(ay * ay + az * az));
+
+    float cr = cosf(roll * 0.5f);
+    float sr = sinf(roll * 0.5f);
+    float cp = cosf(pitch * 0.5f);
+    float sp = sinf(pitch * 0.5f);
+
+    q0 = cr * cp;
+    q1 = sr * cp;
+    q2 = cr * sp;
+    q3 = -sr * sp;
+    initialized = true;
+}
+
+void AttitudeEstimator::update(const ImuSample& sample) {
+    if (!initialized) {
+        initializeFromAccel(sample.accel_x, sample.accel_y, sample.accel_z);
+        last_timestamp_us = sample.timestamp_us;
+        return;
+    }
+
+    uint32_t dt_us = sample.timestamp_us - last_timestamp_us;
+    last_timestamp_us = sample.timestamp_us;
+    if (dt_us == 0 || dt_us > MAX_DT_US) {
+        return;
+    }
+
+    updateIMU(sample.gyro_x, sample.gyro_y, sample.gyro_z,
+              sample.accel_x, sample.accel_y, sample.accel_z,
+              dt_us * 1e-6f);
+}
+
+void AttitudeEstimator::updateIMU(float gx, float gy, float gz, float ax, float ay, float az, float dt) {
+    // Rate of change of quaternion from gyroscope
+    float qDot1 = 0.5f * (-q1 * gx - q2 * gy - q3 * gz);
+    float qDot2 = 0.5f * (q0 * gx + q2 * gz - q3 * gy);
+    float qDot3 = 0.5f * (q0 * gy - q1 * gz + q3 * gx);
+    float qDot4 = 0.5f * (q0 * gz + q1 * gy - q2 * gx);
+
+    // Accelerometer correction, skipped in free fall
+    float norm = ax * ax + ay * ay + az * az;
+    if (norm > 0.0f) {
+        float recip = 1.0f / sqrtf(norm);
+        ax *= recip;
+        ay *= recip;
+        az *= recip;
+
+        float _2q0 = 2.0f * q0;
+        float _2q1 = 2.0f * q1;
+        float _2q2 = 2.0f * q2;
+        float _2q3 = 2.0f * q3;
+        float _4q0 = 4.0f * q0;
+        float _4q1 = 4.0f * q1;
+        float _4q2 = 4.0f * q2;
+        float _8q1 = 8.0f * q1;
+        float _8q2 = 8.0f * q2;
+        float q0q0 = q0 * q0;
+        float q1q1 = q1 * q1;
+        float q2q2 = q2 * q2;
+        float q3q3 = q3 * q3;
+
+        // Gradient of the objective function (predicted minus measured gravity)
+        float s0 = _4q0 * q2q2 + _2q2 * ax + _4q0 * q1q1 - _2q1 * ay;
+        float s1 = _4q1 * q3q3 - _2q3 * ax + 4.0f * q0q0 * q1 - _2q0 * ay - _4q1 + _8q1 * q1q1 + _8q1 * q2q2 + _4q1 * az;
+        float s2 = 4.0f * q0q0 * q2 + _2q0 * ax + _4q2 * q3q3 - _2q3 * ay - _4q2 + _8q2 * q1q1 + _8q2 * q2q2 + _4q2 * az;
+        float s3 = 4.0f * q1q1 * q3 - _2q1 * ax + 4.0f * q2q2 * q3 - _2q2 * ay;
+
+        norm = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+        if (norm > 0.0f) {
+            recip = 1.0f / sqrtf(norm);
+            qDot1 -= beta * s0 * recip;
+            qDot2 -= beta * s1 * recip;
+            qDot3 -= beta * s2 * recip;
+            qDot4 -= beta * s3 * recip;
+        }
+    }
+
+    q0 += qDot1 * dt;
+    q1 += qDot2 * dt;
+    q2 += qDot3 * dt;
+    q3 += qDot4 * dt;
+
+    float recip = 1.0f / sqrtf(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+    q0 *= recip;
+    q1 *= recip;
+    q2 *= recip;
+    q3 *= recip;
+
+    update_count++;
+}
+
+void AttitudeEstimator::getQuaternion(float& w, float& x, float& y, float& z) const {
+    w = q0;
+    x = q1;
+    y = q2;
+    z = q3;
+}
+
+void AttitudeEstimator::getEuler(float& roll, float& pitch, float& yaw) const {
+    float sin_pitch = 2.0f * (q0 * q2 - q3 * q1);
+    sin_pitch = constrain(sin_pitch, -1.0f, 1.0f);
+
+    roll = atan2f(2.0f * (q0 * q1 + q2 * q3), 1.0f - 2.0f * (q1 * q1 + q2 * q2)) * (float)RAD_TO_DEG;
+    pitch = asinf(sin_pitch) * (float)RAD_TO_DEG;
+    yaw = atan2f(2.0f * (q0 * q3 + q1 * q2), 1.0f - 2.0f * (q2 * q2 + q3 * q3)) * (float)RAD_TO_DEG;
+}
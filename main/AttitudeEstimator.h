@@ -0,0 +1,37 @@
+#ifndef ATTITUDE_ESTIMATOR_H
+#define ATTITUDE_ESTIMATOR_H
+
+#include <Arduino.h>
+#include "ImuRingBuffer.h"
+
+// Madgwick gradient-descent AHRS, IMU-only (no magnetometer, so yaw drifts with gyro bias).
+// The per-sample update is single-precision and trig-free; Euler angles are
+// only computed on request.
+class AttitudeEstimator {
+private:
+    float q0, q1, q2, q3;           // Orientation quaternion, sensor frame relative to earth
+    float beta;                     // Filter gain (gyro drift vs accelerometer correction)
+    uint32_t last_timestamp_us;
+    bool initialized;
+    uint32_t update_count;
+
+    static const uint32_t MAX_DT_US = 100000;  // Larger gaps restart integration
+
+    void initializeFromAccel(float ax, float ay, float az);
+
+public:
+    AttitudeEstimator(float gain = 0.1f);
+
+    void reset();
+    void update(const ImuSample& sample);      // Integrates one IMU sample using its timestamp
+    void updateIMU(float gx, float gy, float gz, float ax, float ay, float az, float dt);
+
+    void getQuaternion(float& w, float& x, float& y, float& z) const;
+    void getEuler(float& roll, float& pitch, float& yaw) const;  // Degrees, yaw in [-180, 180]
+
+    bool isInitialized() const { return initialized; }
+    uint32_t getUpdateCount() const { return update_count; }
+    void setGain(float gain) { beta = gain; }
+};
+
+#endif // ATTITUDE_ESTIMATOR_H
@@ -0,0 +1,180 @@
+#include "BootSequence.h"
+#include <stdarg.h>
+
+const char* const BootSequence::NAMES[BOOT_SUBSYSTEM_COUNT] = {
+    "actuators", "imu", "barometer", "gps", "wifi", "recorder"
+};
+
+BootSequence::BootSequence() : complete_reported(false) {
+    for (int i = 0; i < BOOT_SUBSYSTEM_COUNT; i++) {
+        entries[i].state = BOOT_PENDING;
+        entries[i].settled_ms = 0;
+        entries[i].deadline_ms = 0;
+        entries[i].detail = NULL;
+    }
+}
+
+void BootSequence::setDeadline(BootSubsystem subsystem, uint32_t deadline_ms, const char* failure_detail) {
+    portENTER_CRITICAL(&mux);
+    entries[subsystem].deadline_ms = deadline_ms;
+    entries[subsystem].detail = failure_detail;
+    portEXIT_CRITICAL(&mux);
+}
+
+void BootSequence::setReady(BootSubsystem subsystem) {
+    settle(subsystem, BOOT_READY, NULL);
+}
+
+void BootSequence::setDegraded(BootSubsystem subsystem, const char* detail) {
+    settle(subsystem, BOOT_DEGRADED, detail);
+}
+
+void BootSequence::setFailed(BootSubsystem subsystem, const char* detail) {
+    settle(subsystem, BOOT_FAILED, detail);
+}
+
+// A subsystem settles once; the only later change is a failed one coming up late
+void BootSequence::settle(BootSubsystem subsystem, BootState state, const char* detail) {
+    uint32_t now = millis();
+    bool late = false;
+
+    portENTER_CRITICAL(&mux);
+    Entry& entry = entries[subsystem];
+    bool allowed = entry.state == BOOT_PENDING || (entry.state == BOOT_FAILED && state != BOOT_FAILED);
+    if (allowed) {
+        late = entry.state == BOOT_FAILED;
+        entry.state = state;
+        entry.settled_ms = now;
+        entry.detail = detail;
+    }
+    portEXIT_CRITICAL(&mux);
+
+    if (!allowed) {
+        return;
+    }
+    const char* name = NAMES[subsystem];
+    if (state == BOOT_READY) {
+        if (late) {
+            LOG_INFO("Boot: %s ready at %lu ms, after its deadline", name, (unsigned long)now);
+        } else {
+            LOG_INFO("Boot: %s ready at %lu ms", name, (unsigned long)now);
+        }
+    } else if (state == BOOT_DEGRADED) {
+        LOG_WARN("Boot: %s degraded at %lu ms: %s", name, (unsigned long)now, detail != NULL ? detail : "");
+    } else {
+        LOG_ERROR("Boot: %s failed at %lu ms: %s", name, (unsigned long)now, detail != NULL ? detail : "");
+    }
+}
+
+BootState BootSequence::getState(BootSubsystem subsystem) const {
+    portENTER_CRITICAL(&mux);
+    BootState state = entries[subsystem].state;
+    portEXIT_CRITICAL(&mux);
+    return state;
+}
+
+bool BootSequence::isUp(BootSubsystem subsystem) const {
+    BootState state = getState(subsystem);
+    return state == BOOT_READY || state == BOOT_DEGRADED;
+}
+
+bool BootSequence::isComplete() const {
+    for (int i = 0; i < BOOT_SUBSYSTEM_COUNT; i++) {
+        if (isPending((BootSubsystem)i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t BootSequence::getSettledMillis(BootSubsystem subsystem) const {
+    portENTER_CRITICAL(&mux);
+    uint32_t settled_ms = entries[subsystem].settled_ms;
+    portEXIT_CRITICAL(&mux);
+    return settled_ms;
+}
+
+void BootSequence::update() {
+    uint32_t now = millis();
+    for (int i = 0; i < BOOT_SUBSYSTEM_COUNT; i++) {
+        portENTER_CRITICAL(&mux);
+        const Entry& entry = entries[i];
+        bool overdue = entry.state == BOOT_PENDING && entry.deadline_ms > 0 && now >= entry.deadline_ms;
+        const char* detail = entry.detail;
+        portEXIT_CRITICAL(&mux);
+        if (overdue) {
+            setFailed((BootSubsystem)i, detail != NULL ? detail : "timed out");
+        }
+    }
+
+    if (complete_reported || !isComplete()) {
+        return;
+    }
+    complete_reported = true;
+
+    int ready = 0;
+    int degraded = 0;
+    int failed = 0;
+    uint32_t settled_ms = 0;
+    for (int i = 0; i < BOOT_SUBSYSTEM_COUNT; i++) {
+        portENTER_CRITICAL(&mux);
+        Entry entry = entries[i];
+        portEXIT_CRITICAL(&mux);
+        if (entry.state == BOOT_READY) {
+            ready++;
+        } else if (entry.state == BOOT_DEGRADED) {
+            degraded++;
+        } else {
+            failed++;
+        }
+        if (entry.settled_ms > settled_ms) {
+            settled_ms = entry.settled_ms;
+        }
+    }
+    if (degraded == 0 && failed == 0) {
+        LOG_INFO("Boot complete at %lu ms, all %d subsystems ready", (unsigned long)settled_ms, ready);
+    } else {
+        LOG_WARN("Boot complete at %lu ms in degraded mode: %d ready, %d degraded, %d failed",
+                 (unsigned long)settled_ms, ready, degraded, failed);
+    }
+}
+
+static void append(char* buffer, size_t capacity, size_t& used, const char* format, ...) {
+    if (used + 1 >= capacity) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer + used, capacity - used, format, args);
+    va_end(args);
+    if (length > 0) {
+        used += (size_t)length;
+    }
+    if (used >= capacity) {
+        used = capacity - 1;
+    }
+}
+
+size_t BootSequence::writeMetrics(char* buffer, size_t capacity) const {
+    Entry copy[BOOT_SUBSYSTEM_COUNT];
+    portENTER_CRITICAL(&mux);
+    memcpy(copy, entries, sizeof(copy));
+    portEXIT_CRITICAL(&mux);
+
+    size_t used = 0;
+    buffer[0] = '\0';
+    append(buffer, capacity, used, "# HELP aleph_boot_state Subsystem bring-up: 0 pending, 1 ready, 2 degraded, 3 failed\n"
+                                   "# TYPE aleph_boot_state gauge\n");
+    for (int i = 0; i < BOOT_SUBSYSTEM_COUNT; i++) {
+        append(buffer, capacity, used, "aleph_boot_state{subsystem=\"%s\"} %u\n", NAMES[i], (unsigned)copy[i].state);
+    }
+    append(buffer, capacity, used, "# HELP aleph_boot_ready_seconds Time from reset until the subsystem came up\n"
+                                   "# TYPE aleph_boot_ready_seconds gauge\n");
+    for (int i = 0; i < BOOT_SUBSYSTEM_COUNT; i++) {
+        if (copy[i].state == BOOT_READY || copy[i].state == BOOT_DEGRADED) {
+            append(buffer, capacity, used, "aleph_boot_ready_seconds{subsystem=\"%s\"} %.3f\n",
+                   NAMES[i], copy[i].settled_ms / 1000.0);
+        }
+    }
+    return used;
+}
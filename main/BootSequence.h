@@ -0,0 +1,72 @@
+#ifndef BOOT_SEQUENCE_H
+#define BOOT_SEQUENCE_H
+
+#include <Arduino.h>
+#include "Log.h"
+
+// Subsystems brought up at boot, in the order they are reported
+enum BootSubsystem : uint8_t {
+    BOOT_ACTUATORS,
+    BOOT_IMU,
+    BOOT_BAROMETER,
+    BOOT_GPS,
+    BOOT_WIFI,
+    BOOT_RECORDER,
+    BOOT_SUBSYSTEM_COUNT
+};
+
+enum BootState : uint8_t {
+    BOOT_PENDING,       // Still coming up
+    BOOT_READY,
+    BOOT_DEGRADED,      // Up with reduced function
+    BOOT_FAILED         // Missed its deadline; everything else runs without it
+};
+
+// Bring-up bookkeeping. Each subsystem is started by the task that owns it and
+// reported here when it settles, so nothing waits on anything else: a missing
+// sensor or an absent access point costs only its own function. A subsystem
+// still pending at its deadline is marked failed; one that comes up after that
+// is still reported ready, with its late time. Times are millis() since reset.
+//
+// Setters are safe from any task. update() must be called periodically from one task.
+class BootSequence {
+private:
+    struct Entry {
+        BootState state;
+        uint32_t settled_ms;        // When it came up (or failed)
+        uint32_t deadline_ms;       // 0 for none
+        const char* detail;         // String literal: why it is degraded or failed
+    };
+
+    static const char* const NAMES[BOOT_SUBSYSTEM_COUNT];
+
+    Entry entries[BOOT_SUBSYSTEM_COUNT];
+    bool complete_reported;         // update() only
+    mutable portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+
+    void settle(BootSubsystem subsystem, BootState state, const char* detail);
+
+public:
+    BootSequence();
+
+    // Fails the subsystem with this detail if it is still pending deadline_ms after reset
+    void setDeadline(BootSubsystem subsystem, uint32_t deadline_ms, const char* failure_detail);
+
+    void setReady(BootSubsystem subsystem);
+    void setDegraded(BootSubsystem subsystem, const char* detail);
+    void setFailed(BootSubsystem subsystem, const char* detail);
+
+    BootState getState(BootSubsystem subsystem) const;
+    bool isPending(BootSubsystem subsystem) const { return getState(subsystem) == BOOT_PENDING; }
+    bool isUp(BootSubsystem subsystem) const;       // Ready or degraded
+    bool isComplete() const;                        // Nothing pending
+    uint32_t getSettledMillis(BootSubsystem subsystem) const;
+
+    void update();      // Applies deadlines; logs a summary once everything has settled
+
+    size_t writeMetrics(char* buffer, size_t capacity) const;  // Prometheus text for /metrics
+
+    static const char* getName(BootSubsystem subsystem) { return NAMES[subsystem]; }
+};
+
+#endif // BOOT_SEQUENCE_H
@@ -0,0 +1,63 @@
+#include "CommandMailbox.h"
+
+CommandMailbox::CommandMailbox()
+    : has_pending(false), posted(0), taken(0), coalesced(0) {
+    memset(&pending, 0, sizeof(pending));
+}
+
+void CommandMailbox::post(const ActuatorCommand& command) {
+    portENTER_CRITICAL(&mux);
+    if (has_pending) {
+        coalesced++;
+    } else {
+        memset(&pending, 0, sizeof(pending));
+        has_pending = true;
+    }
+
+    if (command.has_servo) {
+        pending.has_servo = true;
+        pending.servo_angle = command.servo_angle;
+    }
+    if (command.stop_motor) {
+        pending.stop_motor = true;
+        pending.has_motor = false;
+    } else if (command.has_motor) {
+        pending.has_motor = true;
+        pending.motor_speed = command.motor_speed;
+        pending.stop_motor = false;
+    }
+    posted++;
+    portEXIT_CRITICAL(&mux);
+}
+
+void CommandMailbox::postServo(int angle) {
+    ActuatorCommand command = {};
+    command.has_servo = true;
+    command.servo_angle = angle;
+    post(command);
+}
+
+void CommandMailbox::postMotor(int speed) {
+    ActuatorCommand command = {};
+    command.has_motor = true;
+    command.motor_speed = speed;
+    post(command);
+}
+
+void CommandMailbox::postStop() {
+    ActuatorCommand command = {};
+    command.stop_motor = true;
+    post(command);
+}
+
+bool CommandMailbox::take(ActuatorCommand& out) {
+    portENTER_CRITICAL(&mux);
+    bool available = has_pending;
+    if (available) {
+        out = pending;
+        has_pending = false;
+        taken++;
+    }
+    portEXIT_CRITICAL(&mux);
+    return available;
+}
@@ -0,0 +1,43 @@
+#ifndef COMMAND_MAILBOX_H
+#define COMMAND_MAILBOX_H
+
+#include <Arduino.h>
+
+// Actuator setpoints requested since the last control tick; absent fields are left alone
+struct ActuatorCommand {
+    bool has_servo;
+    int servo_angle;            // degrees
+    bool has_motor;
+    int motor_speed;            // -255..255
+    bool stop_motor;            // Hard stop, overrides motor_speed
+};
+
+// Latest-wins mailbox between request handlers and the control tick.
+// Any number of posts between two ticks collapse into one command, field by
+// field, so a burst of slider requests costs one actuator update.
+class CommandMailbox {
+private:
+    ActuatorCommand pending;
+    bool has_pending;
+
+    uint32_t posted;
+    uint32_t taken;
+    uint32_t coalesced;         // Posts merged into a command that was still pending
+
+    mutable portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+
+public:
+    CommandMailbox();
+
+    void post(const ActuatorCommand& command);
+    void postServo(int angle);
+    void postMotor(int speed);
+    void postStop();
+    bool take(ActuatorCommand& out);    // False if nothing was posted since the last take
+
+    uint32_t getPosted() const { return posted; }
+    uint32_t getTaken() const { return taken; }
+    uint32_t getCoalesced() const { return coalesced; }
+};
+
+#endif // COMMAND_MAILBOX_H
@@ -0,0 +1,97 @@
+#include "ControlUplink.h"
+
+ControlUplink::ControlUplink(ActuatorModule& actuator_module, uint16_t udp_port)
+    : actuator_module(actuator_module), autopilot(NULL), port(udp_port), active(false),
+      session_active(false), last_sequence(0), last_command(0),
+      commands_applied(0), stale_dropped(0), invalid_packets(0), failsafe_stops(0),
+      apply_us_total(0), apply_us_max(0) {
+}
+
+bool ControlUplink::begin() {
+    if (WiFi.status() != WL_CONNECTED) {
+        LOG_ERROR("Control uplink needs WiFi");
+        return false;
+    }
+    if (!udp.begin(port)) {
+        LOG_ERROR("Control uplink could not bind its UDP port");
+        return false;
+    }
+
+    active = true;
+    LOG_INFO("Control uplink listening on UDP %u", (unsigned)port);
+    return true;
+}
+
+void ControlUplink::update() {
+    if (!active) {
+        return;
+    }
+    METRICS_SCOPE(STAGE_CONTROL_UPLINK);
+
+    int size;
+    while ((size = udp.parsePacket()) > 0) {
+        uint32_t received_us = micros();
+        ControlPacket packet;
+        if (size != sizeof(packet) || udp.read((uint8_t*)&packet, sizeof(packet)) != sizeof(packet)) {
+            invalid_packets++;
+            continue;
+        }
+        handlePacket(packet, received_us);
+    }
+
+    // Failsafe: the sender went quiet mid-session
+    if (session_active && millis() - last_command > COMMAND_TIMEOUT_MS) {
+        session_active = false;
+        if (actuator_module.getTargetMotorSpeed() != 0) {
+            actuator_module.stopMotor();
+            failsafe_stops++;
+            LOG_WARN("Control uplink timed out, motor stopped");
+        }
+    }
+}
+
+void ControlUplink::handlePacket(const ControlPacket& packet, uint32_t received_us) {
+    if (packet.magic[0] != 'A' || packet.magic[1] != 'C' || packet.version != PACKET_VERSION) {
+        invalid_packets++;
+        return;
+    }
+
+    // Serial-number comparison so the sequence may wrap
+    bool new_session = (packet.flags & 0x01) || millis() - last_command > SESSION_TIMEOUT_MS;
+    if (!new_session && (int32_t)(packet.sequence - last_sequence) <= 0) {
+        stale_dropped++;
+        return;
+    }
+    last_sequence = packet.sequence;
+    last_command = millis();
+    session_active = true;
+
+    // Only retarget on change; senders repeat the same command at 20-50 Hz
+    bool autopilot_steering = autopilot != NULL && autopilot->isEngaged();
+    if (!autopilot_steering && packet.servo_angle != actuator_module.getTargetPosition()) {
+        actuator_module.setPosition(packet.servo_angle);
+    }
+    if (packet.motor_speed != actuator_module.getTargetMotorSpeed()) {
+        actuator_module.setMotorSpeed(packet.motor_speed);
+    }
+
+    uint32_t elapsed = micros() - received_us;
+    commands_applied++;
+    apply_us_total += elapsed;
+    if (elapsed > apply_us_max) {
+        apply_us_max = elapsed;
+    }
+
+    ControlAck ack;
+    ack.magic[0] = 'A';
+    ack.magic[1] = 'K';
+    ack.version = PACKET_VERSION;
+    ack.reserved = 0;
+    ack.sequence = packet.sequence;
+    ack.sender_time_us = packet.sender_time_us;
+    ack.apply_us = elapsed;
+    if (udp.beginPacket(udp.remoteIP(), udp.remotePort())) {
+        udp.write((const uint8_t*)&ack, sizeof(ack));
+        udp.endPacket();
+    }
+}
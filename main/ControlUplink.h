@@ -0,0 +1,84 @@
+#ifndef CONTROL_UPLINK_H
+#define CONTROL_UPLINK_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include "ActuatorModule.h"
+#include "Metrics.h"
+#include "HeadingController.h"
+
+// Servo/motor command, little-endian and packed. Layout changes must bump
+// ControlUplink::PACKET_VERSION and tools/control_sender.py.
+struct __attribute__((packed)) ControlPacket {
+    uint8_t magic[2];           // "AC"
+    uint8_t version;
+    uint8_t flags;              // bit 0: new session, accept any sequence number
+    uint32_t sequence;          // Increasing per command; older packets are dropped
+    uint32_t sender_time_us;    // Sender clock, echoed back in the ack
+    int16_t servo_angle;        // degrees
+    int16_t motor_speed;        // -255..255
+};
+
+// Sent back to the command's source port for every applied command
+struct __attribute__((packed)) ControlAck {
+    uint8_t magic[2];           // "AK"
+    uint8_t version;
+    uint8_t reserved;
+    uint32_t sequence;
+    uint32_t sender_time_us;    // Copied from the command, so the sender can compute RTT
+    uint32_t apply_us;          // Packet read to actuator target set; the ramp tick follows within 5 ms
+};
+
+static_assert(sizeof(ControlPacket) == 16, "ControlPacket layout is part of the wire format");
+static_assert(sizeof(ControlAck) == 16, "ControlAck layout is part of the wire format");
+
+// Lightweight UDP command channel for steering, applied straight to ActuatorModule.
+// Packets that arrive out of order are dropped by sequence number. If commands
+// stop for COMMAND_TIMEOUT_MS after a session started, the motor is stopped.
+// While the autopilot is engaged the servo field is ignored.
+class ControlUplink {
+private:
+    static const uint32_t COMMAND_TIMEOUT_MS = 1000;
+    static const uint32_t SESSION_TIMEOUT_MS = 3000;   // After this long any sequence starts a new session
+
+    ActuatorModule& actuator_module;
+    HeadingController* autopilot;       // Optional; while engaged it owns the rudder
+    WiFiUDP udp;
+    const uint16_t port;
+    bool active;
+
+    bool session_active;
+    uint32_t last_sequence;
+    uint32_t last_command;      // millis()
+
+    // Statistics
+    uint32_t commands_applied;
+    uint32_t stale_dropped;
+    uint32_t invalid_packets;
+    uint32_t failsafe_stops;
+    uint32_t apply_us_total;
+    uint32_t apply_us_max;
+
+    void handlePacket(const ControlPacket& packet, uint32_t received_us);
+
+public:
+    static const uint8_t PACKET_VERSION = 1;
+
+    ControlUplink(ActuatorModule& actuator_module, uint16_t udp_port = 5006);
+
+    bool begin();           // Call once WiFi is connected
+    void update();          // Drains every queued packet; call from the task that owns the actuators
+    void setHeadingController(HeadingController* heading_controller) { autopilot = heading_controller; }
+
+    bool isActive() const { return active; }
+    uint16_t getPort() const { return port; }
+    uint32_t getCommandsApplied() const { return commands_applied; }
+    uint32_t getStaleDropped() const { return stale_dropped; }
+    uint32_t getInvalidPackets() const { return invalid_packets; }
+    uint32_t getFailsafeStops() const { return failsafe_stops; }
+    uint32_t getApplyMicrosAverage() const { return commands_applied > 0 ? apply_us_total / commands_applied : 0; }
+    uint32_t getApplyMicrosMax() const { return apply_us_max; }
+};
+
+#endif // CONTROL_UPLINK_H
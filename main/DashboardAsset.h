@@ -0,0 +1,189 @@
+// Generated by tools/embed_dashboard.py from main/web/dashboard.html -- do not edit.
+// 10049 bytes of HTML compressed to 2809 bytes.
+#ifndef DASHBOARD_ASSET_H
+#define DASHBOARD_ASSET_H
+
+#include <Arduino.h>
+
+static const char DASHBOARD_ETAG[] = "\"ca2af6966ed7608b\"";
+static const size_t DASHBOARD_HTML_GZ_LEN = 2809;
+static const uint8_t DASHBOARD_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x5a, 0xeb, 0x6e, 0xdb, 0x38,
+    0x16, 0xfe, 0xef, 0xa7, 0x60, 0x3d, 0xd8, 0xb1, 0x8c, 0x89, 0x2f, 0x49, 0x9a, 0xa0, 0xf1, 0x6d,
+    0x90, 0x26, 0x4e, 0xd1, 0x45, 0x93, 0x18, 0x71, 0xda, 0xdd, 0xee, 0x9f, 0x82, 0x91, 0x68, 0x5b,
+    0x53, 0x59, 0xd2, 0x90, 0x74, 0x1c, 0xb5, 0x93, 0x77, 0x2a, 0xf6, 0x11, 0xfa, 0x64, 0x7b, 0x0e,
+    0x29, 0xca, 0x92, 0x2c, 0xdb, 0x72, 0xa7, 0x8b, 0x00, 0xb1, 0x45, 0xf2, 0x7c, 0xe7, 0xc2, 0xc3,
+    0x73, 0xa1, 0xdc, 0x7b, 0x71, 0x79, 0x7b, 0x71, 0xff, 0x71, 0x34, 0x24, 0x33, 0x39, 0xf7, 0x06,
+    0x95, 0x9e, 0xf9, 0x60, 0xd4, 0x81, 0x0f, 0xe9, 0x4a, 0x8f, 0x0d, 0x86, 0xe3, 0xd1, 0xf1, 0x11,
+    0x19, 0x33, 0x5f, 0x04, 0x9c, 0x5c, 0x52, 0x31, 0x7b, 0x08, 0x28, 0x77, 0x7a, 0x2d, 0x3d, 0x5b,
+    0xe9, 0xcd, 0x99, 0xa4, 0xc4, 0xa7, 0x73, 0xd6, 0xaf, 0x3e, 0xba, 0x6c, 0x19, 0x06, 0x5c, 0x56,
+    0x89, 0x1d, 0xf8, 0x92, 0xf9, 0xb2, 0x5f, 0x5d, 0xba, 0x8e, 0x9c, 0xf5, 0x1d, 0xf6, 0xe8, 0xda,
+    0xac, 0xa1, 0x1e, 0x0e, 0x88, 0xeb, 0xbb, 0xd2, 0xa5, 0x5e, 0x43, 0xd8, 0xd4, 0x63, 0xfd, 0xc3,
+    0x2a, 0x80, 0x08, 0x19, 0x21, 0xd8, 0x43, 0xe0, 0x44, 0xe4, 0x2b, 0x99, 0x00, 0x75, 0x63, 0x42,
+    0xe7, 0xae, 0x17, 0x75, 0xc8, 0x39, 0x87, 0xb5, 0x07, 0x44, 0x50, 0x5f, 0x34, 0x04, 0xe3, 0xee,
+    0xa4, 0x4b, 0xe6, 0x94, 0x4f, 0x5d, 0xbf, 0x43, 0x8e, 0xda, 0xe1, 0x53, 0x97, 0x3c, 0x57, 0x9a,
+    0xc8, 0x8e, 0xba, 0x3e, 0xe3, 0x40, 0x3c, 0xa7, 0x4f, 0x9a, 0x51, 0x87, 0xbc, 0x6a, 0xab, 0x05,
+    0x66, 0x79, 0x9b, 0xd0, 0x85, 0x0c, 0x14, 0x81, 0x50, 0xea, 0x34, 0x1e, 0x82, 0x27, 0xf2, 0x15,
+    0xb8, 0x72, 0x87, 0xf1, 0x0e, 0x39, 0x0c, 0x9f, 0x88, 0x08, 0x3c, 0xd7, 0x21, 0xbf, 0x38, 0x8e,
+    0xd3, 0xad, 0x84, 0xd4, 0x71, 0x5c, 0x7f, 0x0a, 0x13, 0x27, 0x00, 0x53, 0x31, 0x30, 0x87, 0x00,
+    0x4a, 0xda, 0xdd, 0x98, 0xac, 0xc1, 0xa9, 0xe3, 0x2e, 0x44, 0x87, 0xa8, 0x35, 0x00, 0xfd, 0x48,
+    0xbd, 0x05, 0x33, 0x4a, 0x2c, 0x99, 0x3b, 0x9d, 0xc9, 0x0e, 0x79, 0x08, 0x3c, 0x07, 0x19, 0xf7,
+    0x5a, 0xb1, 0xa6, 0xbd, 0x56, 0x6c, 0x64, 0x54, 0x19, 0x3e, 0x1c, 0xf7, 0x91, 0xd8, 0x1e, 0x15,
+    0xa2, 0x5f, 0x4d, 0x94, 0x41, 0xc3, 0xcc, 0x0e, 0x37, 0x6e, 0x00, 0x4c, 0x65, 0xe8, 0x56, 0x3a,
+    0x29, 0xc2, 0xa3, 0xc1, 0x9b, 0xd1, 0x98, 0x58, 0x6f, 0x3e, 0x36, 0xe0, 0xf3, 0xf4, 0xfa, 0xc3,
+    0x51, 0x1d, 0x48, 0x8e, 0x60, 0x26, 0x1c, 0x8c, 0x25, 0x95, 0x28, 0x72, 0x4f, 0x84, 0xd4, 0x27,
+    0xae, 0xd3, 0xaf, 0x4e, 0x43, 0x30, 0xae, 0x1a, 0xad, 0x1a, 0x38, 0xa5, 0x47, 0x75, 0xd0, 0x68,
+    0x80, 0xcc, 0xb0, 0x6c, 0xd0, 0x6b, 0x85, 0x9a, 0x98, 0x4a, 0xe6, 0x79, 0xae, 0x64, 0xeb, 0x00,
+    0xc9, 0xcc, 0x4e, 0x90, 0x77, 0x14, 0xdc, 0x67, 0xe1, 0xb0, 0x3c, 0x84, 0x47, 0xe5, 0x46, 0xda,
+    0xef, 0xdf, 0x12, 0xea, 0xc0, 0x9f, 0x16, 0x93, 0x07, 0x7e, 0x09, 0xf2, 0x73, 0xaf, 0x98, 0x39,
+    0x8d, 0xc7, 0x37, 0x42, 0x90, 0x79, 0x62, 0x84, 0x90, 0x31, 0x67, 0x4d, 0x7f, 0x1c, 0xdc, 0x4c,
+    0xfc, 0xd9, 0x0f, 0xa4, 0x30, 0x00, 0xf7, 0xee, 0x7c, 0x8d, 0xbf, 0x84, 0xb1, 0x9d, 0x96, 0xbb,
+    0x04, 0x23, 0xe7, 0x09, 0x1d, 0x18, 0xdb, 0x41, 0xd8, 0x02, 0x47, 0xd9, 0xe1, 0x2e, 0x63, 0xc6,
+    0x1f, 0x03, 0x72, 0x01, 0xde, 0xc7, 0x03, 0x2f, 0xf1, 0x95, 0x8b, 0x05, 0xe7, 0x70, 0x92, 0xc9,
+    0x28, 0x10, 0x70, 0x6a, 0x03, 0x3f, 0xcd, 0x5b, 0x20, 0x45, 0x23, 0x8c, 0x67, 0xf2, 0x12, 0x9c,
+    0xb5, 0xd7, 0x2c, 0x5f, 0xe9, 0x79, 0xf4, 0x81, 0x79, 0x70, 0x36, 0xb8, 0xa1, 0x16, 0x70, 0xde,
+    0xd0, 0xd5, 0x35, 0xf7, 0x73, 0x7f, 0xea, 0x31, 0x62, 0xb5, 0x1b, 0x87, 0xaf, 0xda, 0xdf, 0xbf,
+    0xd5, 0x3b, 0xbd, 0x96, 0x22, 0x18, 0xf4, 0x1e, 0x38, 0x10, 0xbb, 0x7e, 0xb8, 0x90, 0x44, 0x46,
+    0x21, 0xc4, 0x1a, 0x4e, 0xfd, 0x29, 0x28, 0xbd, 0x12, 0x23, 0x06, 0x22, 0x73, 0xd7, 0xef, 0x57,
+    0xdb, 0x55, 0x8c, 0x03, 0xfd, 0x2a, 0xc0, 0x54, 0x89, 0x92, 0xa7, 0x5f, 0x3d, 0x83, 0xaf, 0xea,
+    0xf4, 0xc5, 0x51, 0x09, 0x4f, 0x72, 0xfb, 0x1f, 0xab, 0xf0, 0x10, 0x9f, 0x6b, 0x15, 0x8e, 0x12,
+    0x0d, 0x15, 0x68, 0x43, 0x6b, 0xb4, 0x59, 0xbf, 0xca, 0x4a, 0xc1, 0x87, 0x85, 0x94, 0x81, 0x4f,
+    0x02, 0xdf, 0xf6, 0x5c, 0xfb, 0x33, 0x9c, 0x66, 0x30, 0x1e, 0xe3, 0x4a, 0x3b, 0xab, 0x9e, 0x08,
+    0xb0, 0x0a, 0x2d, 0xc8, 0xf4, 0x28, 0x13, 0xa6, 0x30, 0x90, 0x54, 0x07, 0x17, 0x8a, 0x8e, 0x58,
+    0x67, 0x68, 0x87, 0x5e, 0x4b, 0xc3, 0x0e, 0x2a, 0xa5, 0x77, 0xf3, 0xf2, 0x82, 0x5c, 0x07, 0x12,
+    0x22, 0x46, 0xbc, 0xa1, 0xc4, 0xba, 0x7f, 0x7d, 0x7a, 0x7a, 0x78, 0x74, 0x75, 0xf3, 0xa6, 0xbe,
+    0xb6, 0xb9, 0x6b, 0xee, 0x3c, 0x47, 0xd2, 0x62, 0x87, 0x36, 0x5a, 0x13, 0x2b, 0xbf, 0xdc, 0x71,
+    0x39, 0xb3, 0x8b, 0x3c, 0x61, 0x7c, 0x7f, 0x3b, 0x1a, 0x0d, 0x2f, 0x63, 0xc2, 0x7a, 0xa1, 0x37,
+    0xc4, 0x1c, 0x63, 0x6f, 0xd0, 0xa2, 0x2b, 0xb1, 0x88, 0xd5, 0x38, 0x3a, 0x39, 0x21, 0x32, 0x20,
+    0xf0, 0x51, 0xd2, 0x23, 0x32, 0x60, 0xda, 0x23, 0x10, 0x24, 0x76, 0x0a, 0xf5, 0x2d, 0x76, 0x8a,
+    0x1f, 0xf0, 0x89, 0x34, 0x78, 0xb1, 0x67, 0x18, 0x13, 0x6d, 0x71, 0x0b, 0xc1, 0xa4, 0xd2, 0x51,
+    0xa9, 0x38, 0xe2, 0x0c, 0x9e, 0xad, 0xc3, 0x93, 0x76, 0x79, 0x0f, 0x21, 0x0f, 0xd4, 0xfe, 0x3c,
+    0xe5, 0xc1, 0xc2, 0x87, 0x8d, 0xfb, 0xe5, 0xe5, 0xc5, 0xf9, 0xd5, 0x49, 0xbb, 0x0b, 0x79, 0xd7,
+    0x0b, 0x20, 0x93, 0x2d, 0x67, 0x10, 0x85, 0x61, 0x49, 0x9c, 0xd8, 0xfc, 0xc0, 0x4f, 0x9e, 0x92,
+    0x7c, 0x75, 0x8c, 0x20, 0xf6, 0x82, 0x0b, 0x24, 0x08, 0x03, 0x17, 0xdd, 0x0d, 0x14, 0xbd, 0x0a,
+    0xf8, 0x52, 0xa5, 0x97, 0xc4, 0xe3, 0xca, 0x88, 0xde, 0xf8, 0x1b, 0xb2, 0x1f, 0x1d, 0x9e, 0x9d,
+    0x5e, 0x1d, 0xff, 0x0c, 0xd9, 0xef, 0xd8, 0x23, 0xe3, 0x82, 0x6d, 0x93, 0x5d, 0x06, 0xa1, 0x12,
+    0xde, 0xfa, 0x51, 0x69, 0x27, 0x2f, 0x5f, 0x1e, 0x1f, 0x9f, 0xfe, 0x0c, 0x69, 0xc7, 0x20, 0xcb,
+    0x0f, 0x1c, 0xec, 0xd7, 0xd7, 0xa3, 0xa3, 0x57, 0xed, 0xe4, 0x08, 0xdf, 0xb3, 0x79, 0xc8, 0x38,
+    0x64, 0x6e, 0x9e, 0x49, 0x0b, 0x0f, 0xf3, 0xb0, 0x21, 0x61, 0x6a, 0x73, 0x3a, 0xfa, 0xfe, 0xed,
+    0xc2, 0xb8, 0x27, 0x6e, 0xa2, 0x28, 0x00, 0x08, 0xe3, 0xf1, 0xcd, 0x20, 0xb3, 0x11, 0xdd, 0x96,
+    0x55, 0x11, 0xa4, 0x74, 0x56, 0x2d, 0xa1, 0xfb, 0xb9, 0xd4, 0x58, 0x89, 0xf6, 0x77, 0x81, 0xe7,
+    0xa5, 0x19, 0x52, 0x29, 0x1b, 0x10, 0xec, 0xbc, 0x12, 0x55, 0xc0, 0xc8, 0x95, 0xf6, 0x2c, 0x4f,
+    0x1b, 0xe2, 0x60, 0x09, 0xe2, 0x8f, 0x74, 0x99, 0x27, 0x8d, 0xe8, 0x72, 0x27, 0x61, 0x09, 0x15,
+    0x6f, 0xe8, 0xa3, 0x3b, 0xa5, 0x18, 0x45, 0x13, 0x25, 0x6f, 0xa0, 0xa4, 0xce, 0x48, 0xea, 0xd3,
+    0xc7, 0x86, 0x8f, 0x83, 0x25, 0x2a, 0x95, 0x21, 0x15, 0x32, 0x4f, 0xcb, 0x60, 0xec, 0x47, 0x8a,
+    0x1c, 0xa4, 0xdd, 0x51, 0xe4, 0xcc, 0x5b, 0x49, 0x89, 0xf3, 0xde, 0xb7, 0x19, 0xc7, 0x4a, 0x56,
+    0x46, 0x6b, 0x20, 0xee, 0x74, 0x4e, 0x7f, 0x86, 0x43, 0x5c, 0x8f, 0xde, 0x9f, 0xb6, 0x4f, 0x76,
+    0x9e, 0x86, 0x79, 0xb8, 0x28, 0x7b, 0x1a, 0x66, 0xc7, 0x83, 0x73, 0xdb, 0x66, 0x1e, 0xa2, 0xc0,
+    0x26, 0x10, 0x0b, 0x34, 0xfa, 0xfe, 0x5f, 0x4c, 0x99, 0xc7, 0x8a, 0xc3, 0xbf, 0x33, 0xfb, 0x6e,
+    0xdb, 0x8d, 0xa7, 0x9d, 0x25, 0xdb, 0xc7, 0x3c, 0x49, 0xb4, 0x93, 0xe4, 0x3f, 0x79, 0x92, 0x2f,
+    0x3b, 0x48, 0x40, 0xba, 0x37, 0x11, 0x0f, 0x84, 0x1d, 0x84, 0x50, 0x3f, 0x41, 0xe4, 0x69, 0x89,
+    0x0d, 0x32, 0x4f, 0x61, 0xd9, 0xbe, 0x42, 0x2b, 0x9a, 0x3d, 0xa5, 0x56, 0x34, 0x5f, 0xca, 0x95,
+    0xa5, 0xf1, 0x87, 0xb0, 0xb9, 0x1b, 0xca, 0x41, 0xa5, 0xd5, 0x22, 0x57, 0x1c, 0x3a, 0x4a, 0x01,
+    0x71, 0x38, 0x22, 0x36, 0xe5, 0x3c, 0x82, 0x10, 0xee, 0x45, 0x44, 0xce, 0x18, 0x11, 0xba, 0xc6,
+    0x10, 0xf0, 0x40, 0x25, 0xb1, 0x67, 0x98, 0xf5, 0x9d, 0xca, 0x64, 0xe1, 0xab, 0x61, 0x42, 0xc3,
+    0xd0, 0x8b, 0xa0, 0x48, 0xa6, 0x16, 0x54, 0xc5, 0xb4, 0x0e, 0xed, 0x1d, 0xa0, 0xbd, 0x0f, 0xb1,
+    0x44, 0x26, 0xd8, 0x10, 0xe1, 0x68, 0xc5, 0x9d, 0x10, 0x35, 0xdd, 0x84, 0xea, 0x19, 0x97, 0x38,
+    0x81, 0xbd, 0x98, 0x43, 0x21, 0xd4, 0x9c, 0x32, 0x39, 0xf4, 0x18, 0x7e, 0x7d, 0x1d, 0xbd, 0x75,
+    0xac, 0xda, 0xaa, 0x2f, 0xaa, 0xd5, 0x9b, 0x92, 0x3d, 0xc9, 0x0b, 0xdd, 0xd8, 0x92, 0x3e, 0x31,
+    0xf4, 0xd8, 0xf0, 0x41, 0xcb, 0xf8, 0x3b, 0xa9, 0x7d, 0x50, 0x5f, 0xae, 0xdc, 0xa7, 0x1a, 0xe9,
+    0x90, 0xda, 0x4d, 0xa0, 0xbe, 0x76, 0x77, 0x80, 0x27, 0x3d, 0xd3, 0x66, 0x06, 0xab, 0x35, 0x3b,
+    0xc0, 0xa0, 0x7b, 0xda, 0x2d, 0x66, 0x32, 0xe0, 0xc5, 0x3d, 0x58, 0x53, 0x06, 0x20, 0x28, 0x73,
+    0xac, 0xd3, 0x3a, 0xca, 0xdd, 0x68, 0xec, 0x92, 0x19, 0xba, 0xac, 0x7d, 0xd8, 0x98, 0x66, 0x6d,
+    0x6f, 0x3e, 0x26, 0x73, 0xec, 0xc1, 0xcc, 0x90, 0x24, 0xbc, 0x0e, 0x4b, 0xf2, 0x52, 0x61, 0x6d,
+    0x0f, 0x46, 0x6a, 0xfd, 0xde, 0x5c, 0xb0, 0xc3, 0xdb, 0xcc, 0x04, 0x67, 0xc9, 0x5f, 0x7f, 0x95,
+    0x01, 0x42, 0x77, 0xde, 0x0c, 0xa4, 0x9c, 0x3d, 0x01, 0x7a, 0x4e, 0x9d, 0x00, 0x5d, 0x3c, 0xe4,
+    0x0e, 0x01, 0x64, 0xe9, 0xad, 0x87, 0xc0, 0xd4, 0x12, 0xc5, 0x0c, 0x61, 0xb6, 0x29, 0x57, 0x61,
+    0x37, 0xb1, 0xc9, 0x51, 0xbd, 0xbb, 0x1d, 0xd2, 0x54, 0x17, 0x9b, 0x61, 0xcd, 0x8a, 0xf2, 0x98,
+    0xdb, 0x5d, 0x06, 0x31, 0xd7, 0x3c, 0x04, 0x31, 0xd3, 0x26, 0x8a, 0x53, 0x4a, 0xce, 0x46, 0x90,
+    0x41, 0xb6, 0xda, 0xc8, 0x64, 0x98, 0x62, 0xc6, 0x30, 0xbb, 0xbf, 0x8d, 0x54, 0x72, 0xd9, 0x8c,
+    0x47, 0x53, 0x59, 0xaa, 0xf9, 0x94, 0x40, 0x1e, 0xef, 0x82, 0x8c, 0x4a, 0x42, 0x46, 0xe5, 0x21,
+    0xbf, 0x94, 0x84, 0xfc, 0x52, 0x0e, 0x52, 0x67, 0xa8, 0xcd, 0x98, 0x38, 0x5f, 0x56, 0x63, 0x9d,
+    0xb9, 0x76, 0x60, 0x45, 0x7b, 0x60, 0x7d, 0xd9, 0x81, 0x95, 0xd5, 0x31, 0xed, 0x58, 0x34, 0x2e,
+    0x5e, 0x57, 0x4e, 0x65, 0x46, 0xb6, 0x7a, 0x96, 0x29, 0x69, 0x8b, 0xf9, 0x1a, 0x88, 0x26, 0x2e,
+    0x49, 0xc5, 0xa3, 0xee, 0x76, 0x40, 0x55, 0xe7, 0xee, 0x40, 0x54, 0x6b, 0xca, 0x43, 0x42, 0xfd,
+    0xbb, 0x03, 0x10, 0x56, 0x64, 0xe0, 0xd2, 0xc6, 0x99, 0x2c, 0x04, 0xb4, 0xfa, 0x7e, 0x52, 0xfc,
+    0x12, 0x26, 0x20, 0x1c, 0xc2, 0xcc, 0xca, 0x5a, 0xa9, 0xc9, 0x5f, 0x7f, 0x25, 0xb9, 0x21, 0x1d,
+    0xa1, 0xd1, 0x90, 0x36, 0xd4, 0x06, 0x12, 0x91, 0x0c, 0xff, 0xd5, 0xa2, 0x2d, 0x1a, 0x24, 0x25,
+    0xf5, 0x9a, 0x0e, 0x30, 0xd3, 0x54, 0x33, 0xe5, 0x4e, 0xad, 0xa9, 0xaf, 0x0b, 0x71, 0x70, 0xa2,
+    0x3c, 0x4c, 0x71, 0x4e, 0xba, 0xa6, 0x20, 0xca, 0x2c, 0x0a, 0x03, 0x69, 0x21, 0xe4, 0x23, 0xf3,
+    0x3e, 0x29, 0xf1, 0x0e, 0x88, 0x79, 0x44, 0x2e, 0xf5, 0x3d, 0xd8, 0x60, 0x31, 0x5e, 0x28, 0xae,
+    0x9a, 0xd9, 0x18, 0x28, 0xa9, 0x2d, 0x17, 0x14, 0xaf, 0x69, 0xb2, 0x91, 0xd2, 0x0c, 0xab, 0xc2,
+    0x6a, 0x7d, 0xb4, 0xa9, 0x6e, 0xeb, 0xb6, 0x7a, 0x7c, 0xf6, 0x5a, 0x71, 0x83, 0x53, 0x65, 0xf1,
+    0x9a, 0x66, 0x35, 0x8a, 0x58, 0xc0, 0x54, 0xdd, 0xd9, 0x20, 0xd3, 0x85, 0x92, 0x5d, 0x5d, 0x01,
+    0x5c, 0xba, 0x22, 0xf4, 0x68, 0x54, 0xb8, 0x54, 0xe7, 0x77, 0xa5, 0x30, 0xfe, 0x25, 0xd5, 0xa5,
+    0x26, 0xff, 0x80, 0xb5, 0xac, 0xb0, 0x10, 0x6f, 0xc2, 0xe0, 0x90, 0x58, 0xb5, 0x16, 0x82, 0xd4,
+    0xea, 0x95, 0x26, 0x54, 0xa8, 0xbe, 0x05, 0x69, 0x2b, 0x04, 0x2f, 0x64, 0xa4, 0x3f, 0x20, 0xe6,
+    0x7b, 0xf3, 0x0f, 0x11, 0xf8, 0x56, 0xdd, 0x2c, 0x49, 0xca, 0x54, 0x18, 0xb0, 0x29, 0x62, 0x30,
+    0xce, 0xc1, 0x96, 0x40, 0x81, 0x0e, 0x1c, 0x78, 0xac, 0xa9, 0x06, 0xac, 0xda, 0x50, 0x8d, 0x2b,
+    0x3e, 0xae, 0x3f, 0x55, 0xda, 0x77, 0x6a, 0x07, 0x44, 0xcd, 0xd6, 0xcd, 0x96, 0xdc, 0x33, 0x34,
+    0xa0, 0x84, 0x3a, 0xd9, 0x15, 0x24, 0x5c, 0x88, 0x19, 0x1c, 0xa6, 0xe0, 0x91, 0x71, 0x82, 0x17,
+    0x8f, 0x8c, 0x37, 0xc6, 0x68, 0xba, 0xe1, 0x23, 0xfc, 0x17, 0x5d, 0x32, 0xa1, 0x9e, 0xa7, 0x2e,
+    0x35, 0xf0, 0x52, 0x2d, 0x84, 0xb8, 0x81, 0xb8, 0x4b, 0x57, 0xce, 0x82, 0x85, 0x24, 0xae, 0xac,
+    0x78, 0x4c, 0xaa, 0x61, 0xbc, 0xa3, 0xe6, 0xe8, 0x0a, 0x0b, 0xcf, 0xeb, 0xae, 0x6c, 0x00, 0xf5,
+    0x30, 0x97, 0x23, 0x4d, 0x66, 0x99, 0x4d, 0x4e, 0xad, 0xef, 0x6b, 0x0a, 0x9c, 0x49, 0xa3, 0x08,
+    0x26, 0xdf, 0xe2, 0xcd, 0x07, 0x1c, 0x54, 0x2b, 0x6d, 0xc6, 0x03, 0xbc, 0x72, 0x6b, 0xc7, 0xa6,
+    0x4e, 0x31, 0x09, 0xc2, 0xcd, 0x3c, 0x5e, 0xa4, 0x78, 0xd8, 0x1e, 0xa3, 0x3c, 0x41, 0x4e, 0xd6,
+    0x00, 0xe0, 0xba, 0x0e, 0x39, 0x16, 0xa0, 0xc7, 0x58, 0x72, 0x46, 0xe7, 0x09, 0x8b, 0x17, 0x4b,
+    0xd7, 0x77, 0x82, 0x65, 0x53, 0x99, 0x6a, 0x1c, 0x2c, 0xb8, 0xad, 0x82, 0x73, 0x56, 0xe5, 0x6e,
+    0x85, 0x33, 0x48, 0xe3, 0xca, 0xd7, 0x74, 0xb4, 0x61, 0xca, 0xb2, 0xc8, 0x86, 0x2d, 0x49, 0x8a,
+    0xd6, 0xaa, 0xcd, 0xa4, 0x0c, 0x3b, 0xad, 0x56, 0x8d, 0xfc, 0x46, 0xbc, 0xc0, 0xd6, 0xa1, 0x6a,
+    0x16, 0x08, 0x89, 0x2f, 0xcc, 0x60, 0xac, 0xd6, 0x79, 0x75, 0xd8, 0xd2, 0xd4, 0x35, 0xc0, 0xd5,
+    0xdf, 0x9a, 0x81, 0x0f, 0x5d, 0x9c, 0x8f, 0x36, 0x5b, 0x59, 0x21, 0x35, 0x09, 0x8d, 0x91, 0xa0,
+    0x53, 0xf0, 0x2e, 0xcd, 0x17, 0x7d, 0x66, 0xd5, 0xf5, 0xfc, 0x73, 0x7c, 0x7b, 0xd3, 0x0c, 0x29,
+    0x17, 0xcc, 0x52, 0xb3, 0x4d, 0xd5, 0x06, 0xa5, 0xb1, 0x63, 0x47, 0xcb, 0xec, 0x63, 0x97, 0x10,
+    0xf0, 0xa2, 0x94, 0xe4, 0xe0, 0xb7, 0xa0, 0x9a, 0x0f, 0xbd, 0x96, 0x80, 0xd6, 0x0b, 0xbc, 0x02,
+    0x3e, 0x96, 0xbe, 0x76, 0xb6, 0x73, 0x73, 0xf0, 0xed, 0x60, 0x3e, 0xa7, 0xbe, 0x23, 0x3a, 0x44,
+    0xdf, 0x86, 0x12, 0x87, 0xd3, 0xa9, 0x20, 0x94, 0x33, 0x68, 0xce, 0x78, 0x20, 0xa5, 0x07, 0x6e,
+    0x08, 0x3e, 0x06, 0x3c, 0x49, 0xcb, 0x8e, 0xef, 0xa1, 0x39, 0xfb, 0x13, 0x76, 0x1d, 0x1c, 0xcd,
+    0x27, 0x13, 0x0f, 0xdf, 0x8e, 0x1d, 0x20, 0x26, 0xb4, 0x72, 0xf3, 0x40, 0x5b, 0x12, 0x9c, 0xf8,
+    0xe2, 0xf6, 0xe6, 0xfe, 0xee, 0xf6, 0xdd, 0xa7, 0xb7, 0x37, 0xf7, 0xc3, 0xbb, 0x0f, 0xe7, 0xef,
+    0x3e, 0x5d, 0x8f, 0x0f, 0x08, 0xf5, 0x96, 0x34, 0x12, 0xba, 0x1d, 0x44, 0x8f, 0xc5, 0x66, 0x10,
+    0x7a, 0x18, 0xc4, 0x52, 0xcd, 0xa5, 0x88, 0x37, 0xa3, 0x80, 0x18, 0xb4, 0x3d, 0x69, 0x77, 0xb5,
+    0x63, 0x33, 0x1f, 0x6f, 0xfb, 0xcc, 0xad, 0x78, 0x9f, 0x7c, 0x7d, 0xd6, 0x13, 0xb1, 0x7c, 0x6f,
+    0xfd, 0x2b, 0x25, 0x15, 0xcc, 0xc0, 0x39, 0x11, 0x4c, 0x4f, 0x42, 0x0f, 0x2b, 0x63, 0x92, 0xb1,
+    0x8e, 0x42, 0xed, 0x0c, 0xd5, 0x86, 0xa3, 0x02, 0x9a, 0x2e, 0x58, 0x4c, 0x67, 0x69, 0x21, 0xd1,
+    0x9d, 0x6e, 0x1f, 0xfe, 0x00, 0xc3, 0x36, 0xa1, 0x2f, 0x76, 0xa7, 0xbe, 0x95, 0x95, 0xe8, 0x20,
+    0x56, 0x06, 0x76, 0x6c, 0xe2, 0xc1, 0x41, 0x36, 0xd4, 0xea, 0x80, 0x24, 0xc0, 0xd9, 0xa9, 0xd8,
+    0x79, 0xf3, 0x1a, 0x40, 0x07, 0x90, 0x11, 0x0f, 0x9e, 0x63, 0xce, 0x9f, 0x59, 0x24, 0x72, 0x7c,
+    0xeb, 0x4d, 0x8f, 0xf9, 0x53, 0x39, 0x53, 0xe7, 0xb7, 0x8d, 0x90, 0x79, 0x27, 0x5f, 0x52, 0x17,
+    0x15, 0xcf, 0x9b, 0xe2, 0xb7, 0x42, 0x83, 0x37, 0x08, 0xbe, 0xa8, 0x82, 0xc4, 0xb9, 0x44, 0xc9,
+    0x51, 0x3a, 0x45, 0x3e, 0xd0, 0xd0, 0x39, 0xab, 0x41, 0x68, 0xc0, 0xaf, 0x10, 0x7e, 0x2c, 0x50,
+    0x06, 0xdc, 0xf9, 0x6b, 0xa1, 0x5d, 0x73, 0x5a, 0x77, 0xc9, 0xf3, 0x81, 0x12, 0xaa, 0xe0, 0x40,
+    0xc2, 0x01, 0xa0, 0x73, 0x73, 0x20, 0xdf, 0xdf, 0xbd, 0x1b, 0x43, 0x8c, 0xb0, 0x67, 0x23, 0x35,
+    0x9a, 0x57, 0x1c, 0x02, 0x45, 0x91, 0x4f, 0xac, 0xfb, 0x83, 0xe4, 0x0b, 0x74, 0x87, 0x35, 0x57,
+    0x48, 0x6b, 0x6a, 0xf2, 0x41, 0x4c, 0xfd, 0x3b, 0x1e, 0x7c, 0x2d, 0x0c, 0xe4, 0x51, 0x08, 0x36,
+    0x2a, 0x80, 0x1c, 0xe0, 0x6b, 0x6a, 0x06, 0xf1, 0xd6, 0x81, 0xae, 0x71, 0x74, 0x3b, 0xbe, 0xaf,
+    0x91, 0xe7, 0x3d, 0x72, 0x07, 0x9e, 0x68, 0x65, 0xa5, 0x55, 0xa6, 0xd3, 0x77, 0x14, 0x2a, 0x2e,
+    0xd6, 0xc4, 0x02, 0x6a, 0x6e, 0x01, 0xf1, 0x24, 0x2e, 0x86, 0x52, 0xb9, 0xc4, 0x68, 0xa8, 0x1e,
+    0x31, 0x8b, 0xe8, 0xda, 0x55, 0xc7, 0x13, 0x1d, 0x82, 0x4b, 0xe6, 0x23, 0xa1, 0x4d, 0x66, 0xf6,
+    0x29, 0x95, 0x91, 0x2a, 0xcd, 0x89, 0xeb, 0x43, 0x86, 0x89, 0xcc, 0x5e, 0x56, 0x36, 0x9e, 0xac,
+    0x35, 0x07, 0x37, 0xe9, 0x4c, 0xbf, 0x0c, 0x34, 0x11, 0xc3, 0x78, 0xbd, 0x39, 0xe0, 0x71, 0xb0,
+    0x81, 0x4a, 0x60, 0x7b, 0x05, 0xa1, 0xd7, 0x61, 0x5c, 0x4d, 0xd3, 0xa9, 0xac, 0xb3, 0x95, 0x38,
+    0xf5, 0x66, 0x07, 0x89, 0xf5, 0x73, 0x93, 0x3a, 0x8e, 0x8a, 0x8f, 0xef, 0x5c, 0x01, 0x85, 0x08,
+    0x03, 0x4b, 0xa8, 0x97, 0x4f, 0xa0, 0xb8, 0x91, 0xcf, 0x5a, 0x95, 0x9f, 0x54, 0xbd, 0xc7, 0xec,
+    0xc7, 0x2c, 0xf5, 0x6f, 0x02, 0x0c, 0x92, 0x12, 0x20, 0x57, 0xd3, 0xa8, 0xf5, 0xb0, 0x80, 0x49,
+    0xa5, 0xba, 0x79, 0xd9, 0x6a, 0xa9, 0xf1, 0xd8, 0x32, 0xab, 0xc4, 0x55, 0xbc, 0x0a, 0x98, 0x67,
+    0xe2, 0xcd, 0x57, 0xa2, 0xcc, 0xd0, 0x89, 0x85, 0x79, 0xce, 0x46, 0x90, 0xcc, 0x7b, 0x49, 0x4c,
+    0x71, 0x29, 0x49, 0x41, 0xa0, 0xb3, 0xf6, 0x36, 0x71, 0xd5, 0x6c, 0x5e, 0x8a, 0xb3, 0xb6, 0xd9,
+    0x3e, 0xfd, 0xf6, 0x6e, 0xd3, 0xf6, 0xa9, 0x02, 0x6b, 0xbc, 0x73, 0x0f, 0xd3, 0xaf, 0xd9, 0x56,
+    0x7b, 0x98, 0x22, 0xde, 0xb9, 0x91, 0xeb, 0x2f, 0xea, 0x10, 0x27, 0x85, 0xb0, 0xdf, 0x9e, 0xaa,
+    0x92, 0x10, 0xf8, 0xa5, 0x01, 0xe2, 0x8d, 0xcd, 0x4b, 0x95, 0x33, 0x97, 0xa2, 0x54, 0x16, 0x5b,
+    0xbd, 0x38, 0xb3, 0x92, 0x0a, 0x33, 0xb7, 0xb5, 0x6b, 0x4b, 0xd6, 0xf7, 0x55, 0xb1, 0xeb, 0xc4,
+    0x02, 0xe5, 0xf6, 0xb5, 0xe8, 0xed, 0x5c, 0x82, 0xb3, 0x26, 0xfa, 0x4a, 0xb8, 0xbf, 0xa5, 0x82,
+    0x3a, 0xb3, 0x50, 0xab, 0x90, 0x87, 0x28, 0x84, 0xac, 0xc6, 0x84, 0x4a, 0xce, 0xa6, 0x06, 0x00,
+    0x07, 0x74, 0x88, 0xe3, 0x0a, 0xc8, 0xdc, 0x0e, 0x54, 0x07, 0x7e, 0xa4, 0xf3, 0xa2, 0xa3, 0xf5,
+    0x40, 0x89, 0xd5, 0x4b, 0xb1, 0x6c, 0xf1, 0x17, 0xbf, 0xa5, 0xdb, 0x20, 0x74, 0x7b, 0xa7, 0xc0,
+    0xb0, 0xc2, 0x81, 0xa2, 0x18, 0xfa, 0x94, 0x6c, 0x74, 0xd7, 0xf5, 0xfd, 0x2a, 0x50, 0xab, 0xc7,
+    0xdf, 0xa9, 0x62, 0xdc, 0x47, 0xc6, 0xb5, 0xff, 0x5b, 0x74, 0xee, 0xe7, 0xa3, 0x73, 0x41, 0x33,
+    0xa2, 0xce, 0x10, 0x61, 0x10, 0x1e, 0xd7, 0xa3, 0xb7, 0x3e, 0x56, 0x3f, 0x21, 0x76, 0x83, 0x96,
+    0x21, 0x06, 0x6f, 0xed, 0x47, 0xd9, 0x66, 0x22, 0xd7, 0xea, 0x64, 0x84, 0x4b, 0xfc, 0x68, 0xd7,
+    0x91, 0x2b, 0x6c, 0x5c, 0x63, 0x17, 0xd2, 0x87, 0x29, 0xf9, 0xad, 0x80, 0x99, 0xc0, 0xd2, 0x00,
+    0x2f, 0xd1, 0xaf, 0x6e, 0xef, 0xfe, 0x75, 0x7e, 0x77, 0x89, 0x57, 0xe8, 0x7a, 0xbc, 0xa7, 0xc7,
+    0xef, 0x86, 0x1f, 0x86, 0x77, 0xe3, 0xa1, 0xba, 0x5a, 0x8f, 0x7f, 0x4f, 0xb0, 0xed, 0x92, 0x34,
+    0xf7, 0x8b, 0x84, 0xf5, 0x26, 0xd2, 0xcc, 0xa0, 0xce, 0xd9, 0xae, 0xae, 0x5b, 0xc9, 0x74, 0x06,
+    0x5d, 0xfc, 0xd1, 0x56, 0xfc, 0x62, 0xa2, 0xd7, 0x8a, 0x7f, 0xae, 0xd5, 0xd2, 0xbf, 0x94, 0xfb,
+    0x1f, 0x40, 0x6f, 0x33, 0x04, 0x41, 0x27, 0x00, 0x00,
+};
+
+#endif // DASHBOARD_ASSET_H
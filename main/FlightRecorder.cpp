@@ -0,0 +1,331 @@
+#include "FlightRecorder.h"
+
+static const char LOG_MAGIC[4] = { 'A', 'L', 'O', 'G' };
+
+// Fixed-point conversion; non-finite values are logged as 0
+static int32_t toFixed(float value, float scale) {
+    if (!isfinite(value)) {
+        return 0;
+    }
+    return (int32_t)lroundf(value * scale);
+}
+
+static void writeUint16(uint8_t* out, uint16_t value) {
+    out[0] = value & 0xFF;
+    out[1] = value >> 8;
+}
+
+static void writeUint32(uint8_t* out, uint32_t value) {
+    out[0] = value & 0xFF;
+    out[1] = (value >> 8) & 0xFF;
+    out[2] = (value >> 16) & 0xFF;
+    out[3] = value >> 24;
+}
+
+FlightRecorder::FlightRecorder(SensorModule& sensor_module, ActuatorModule& actuator_module, uint32_t record_rate_hz)
+    : sensor_module(sensor_module), actuator_module(actuator_module),
+      blocks_sealed(0), blocks_written(0), block_used(0),
+      file_index(-1), active(false), storage_full(false),
+      record_interval_ms(1000 / constrain(record_rate_hz, 1UL, 200UL)), last_record(0),
+      records_recorded(0), records_dropped(0), dropped_since_block(0),
+      bytes_recorded(0), bytes_flashed(0), write_us_max(0), stats_start_ms(0), logs_deleted(0) {
+    file_path[0] = '\0';
+}
+
+bool FlightRecorder::begin() {
+    if (!LittleFS.begin(true)) {
+        LOG_ERROR("LittleFS mount failed, flight recorder disabled");
+        return false;
+    }
+
+    int oldest, newest;
+    int next = findLogRange(oldest, newest) ? (newest + 1) % MAX_LOG_FILES : 0;
+    formatLogPath(file_path, sizeof(file_path), next);
+    // Oldest logs go first, also when all numbers are taken and the next one is the oldest
+    while (freeBytes() < MIN_FREE_BYTES || LittleFS.exists(file_path)) {
+        if (!deleteOldestLog()) {
+            file_path[0] = '\0';
+            LOG_WARN("Flight log storage is full and there are no logs to delete");
+            return false;
+        }
+    }
+
+    if (!openLogFile(next)) {
+        LOG_ERROR("Could not create a flight log file");
+        return false;
+    }
+
+    LOG_INFO("Flight recorder writing to %s, %lu KiB free", file_path,     // file_path lives as long as the recorder
+             (unsigned long)(freeBytes() / 1024));
+
+    stats_start_ms = millis();
+    active = true;
+    return true;
+}
+
+bool FlightRecorder::openLogFile(int index) {
+    formatLogPath(file_path, sizeof(file_path), index);
+    file = LittleFS.open(file_path, FILE_WRITE);
+    if (!file) {
+        file_path[0] = '\0';
+        return false;
+    }
+    file_index = index;
+    return true;
+}
+
+void FlightRecorder::formatLogPath(char* path, size_t size, int index) {
+    snprintf(path, size, "/flight_%03d.bin", index);
+}
+
+// Numbers wrap after 999, so the newest log is the one before the longest run
+// of unused numbers and the oldest the one after it. False when there are no logs.
+bool FlightRecorder::findLogRange(int& oldest, int& newest) {
+    uint8_t present[(MAX_LOG_FILES + 7) / 8];
+    memset(present, 0, sizeof(present));
+    int any = -1;
+
+    File root = LittleFS.open("/");
+    if (root && root.isDirectory()) {
+        File entry = root.openNextFile();
+        while (entry) {
+            unsigned index;
+            char tail;
+            if (!entry.isDirectory() && sscanf(entry.name(), "flight_%3u.bi%c", &index, &tail) == 2 &&
+                tail == 'n' && index < MAX_LOG_FILES) {
+                present[index / 8] |= 1 << (index % 8);
+                any = index;
+            }
+            entry = root.openNextFile();
+        }
+    }
+    if (any < 0) {
+        return false;
+    }
+
+    int longest = -1;
+    int run = 0;
+    for (int step = 1; step <= MAX_LOG_FILES; step++) {
+        int index = (any + step) % MAX_LOG_FILES;
+        if (!(present[index / 8] & (1 << (index % 8)))) {
+            run++;
+            continue;
+        }
+        if (run > longest) {
+            longest = run;
+            oldest = index;
+            newest = (index - run - 1 + MAX_LOG_FILES) % MAX_LOG_FILES;
+        }
+        run = 0;
+    }
+    return true;
+}
+
+bool FlightRecorder::deleteOldestLog() {
+    int oldest, newest;
+    if (!findLogRange(oldest, newest) || oldest == file_index) {
+        return false;       // Nothing but the log being written
+    }
+    char path[24];
+    formatLogPath(path, sizeof(path), oldest);
+    if (!LittleFS.remove(path)) {
+        return false;
+    }
+    logs_deleted++;
+    LOG_INFO("Deleted flight_%03d.bin to free flight log space", oldest);
+    return true;
+}
+
+bool FlightRecorder::deleteLog(const char* name) {
+    unsigned index;
+    char tail;
+    if (sscanf(name, "flight_%3u.bi%c", &index, &tail) != 2 || tail != 'n' || index >= MAX_LOG_FILES) {
+        return false;
+    }
+    if ((int)index == file_index && file) {
+        return false;
+    }
+    char path[24];
+    formatLogPath(path, sizeof(path), index);
+    return LittleFS.remove(path);
+}
+
+size_t FlightRecorder::freeBytes() {
+    size_t total = LittleFS.totalBytes();
+    size_t used = LittleFS.usedBytes();
+    return total > used ? total - used : 0;
+}
+
+// ==================== RECORDING (SENSOR TASK) ====================
+
+void FlightRecorder::update() {
+    if (!active) {
+        return;
+    }
+
+    uint32_t now = millis();
+    if (now - last_record < record_interval_ms) {
+        return;
+    }
+    // Stay on the record grid so sensor-task jitter does not lower the rate; after a stall, restart it
+    last_record = now - last_record < 2 * record_interval_ms ? last_record + record_interval_ms : now;
+
+    if (block_used == 0) {
+        // The next slot is still queued for the writer: drop rather than wait on flash
+        if (blocks_sealed.load(std::memory_order_relaxed) - blocks_written.load(std::memory_order_acquire) >= BLOCK_COUNT) {
+            records_dropped++;
+            dropped_since_block++;
+            return;
+        }
+        startBlock();
+    }
+
+    int32_t fields[FIELD_COUNT];
+    sampleFields(fields);
+    appendRecord(fields);
+
+    if (block_used + MAX_RECORD_BYTES > BLOCK_SIZE) {
+        sealBlock();
+    }
+}
+
+void FlightRecorder::sampleFields(int32_t* fields) {
+    SensorSnapshot snapshot;
+    sensor_module.getSnapshot(snapshot);
+
+    fields[TIMESTAMP_MS] = (int32_t)snapshot.timestamp_ms;
+    fields[ACCEL_X] = toFixed(snapshot.accel_x, 1000.0f);
+    fields[ACCEL_Y] = toFixed(snapshot.accel_y, 1000.0f);
+    fields[ACCEL_Z] = toFixed(snapshot.accel_z, 1000.0f);
+    fields[GYRO_X] = toFixed(snapshot.gyro_x, 1000.0f);
+    fields[GYRO_Y] = toFixed(snapshot.gyro_y, 1000.0f);
+    fields[GYRO_Z] = toFixed(snapshot.gyro_z, 1000.0f);
+    fields[ROLL] = toFixed(snapshot.roll, 100.0f);
+    fields[PITCH] = toFixed(snapshot.pitch, 100.0f);
+    fields[YAW] = toFixed(snapshot.yaw, 100.0f);
+    fields[BMP_TEMPERATURE] = toFixed(snapshot.bmp_temperature, 100.0f);
+    fields[BMP_PRESSURE] = toFixed(snapshot.bmp_pressure, 100.0f);
+    fields[BMP_ALTITUDE] = toFixed(snapshot.bmp_altitude, 100.0f);
+
+    fields[GPS_FIX_COUNT] = (int32_t)snapshot.gps.fix_count;
+    fields[GPS_LATITUDE] = (int32_t)lround(snapshot.gps.latitude * 1e7);
+    fields[GPS_LONGITUDE] = (int32_t)lround(snapshot.gps.longitude * 1e7);
+    fields[GPS_SPEED] = toFixed(snapshot.gps.speed, 100.0f);
+    fields[GPS_COURSE] = toFixed(snapshot.gps.course, 100.0f);
+    fields[GPS_SATELLITES] = snapshot.gps.satellites;
+
+    const NavigationState& nav = snapshot.navigation;
+    fields[NAV_NORTH] = toFixed(nav.north, 100.0f);
+    fields[NAV_EAST] = toFixed(nav.east, 100.0f);
+    fields[NAV_UP] = toFixed(nav.up, 100.0f);
+    fields[NAV_VEL_NORTH] = toFixed(nav.vel_north, 100.0f);
+    fields[NAV_VEL_EAST] = toFixed(nav.vel_east, 100.0f);
+
+    fields[SERVO_POSITION] = actuator_module.getPosition();
+    fields[MOTOR_SPEED] = actuator_module.getMotorSpeed();
+
+    fields[FLAGS] = (snapshot.gps.valid ? 0x01 : 0)
+                  | (nav.valid ? 0x02 : 0)
+                  | (nav.heading_aligned ? 0x04 : 0);
+}
+
+// Zigzag varint of the wrapping 32-bit difference from the previous record
+void FlightRecorder::appendRecord(const int32_t* fields) {
+    uint8_t* out = blocks[blocks_sealed.load(std::memory_order_relaxed) % BLOCK_COUNT] + block_used;
+    uint8_t* start = out;
+
+    for (int i = 0; i < FIELD_COUNT; i++) {
+        uint32_t delta = (uint32_t)fields[i] - (uint32_t)previous[i];
+        uint32_t zigzag = (delta << 1) ^ (uint32_t)((int32_t)delta >> 31);
+        while (zigzag >= 0x80) {
+            *out++ = (uint8_t)(zigzag | 0x80);
+            zigzag >>= 7;
+        }
+        *out++ = (uint8_t)zigzag;
+        previous[i] = fields[i];
+    }
+
+    block_used += out - start;
+    bytes_recorded += out - start;
+    records_recorded++;
+}
+
+void FlightRecorder::startBlock() {
+    memset(previous, 0, sizeof(previous));  // First record of every block is absolute
+    block_used = HEADER_SIZE;
+}
+
+void FlightRecorder::sealBlock() {
+    uint32_t sequence = blocks_sealed.load(std::memory_order_relaxed);
+    uint8_t* block = blocks[sequence % BLOCK_COUNT];
+
+    memcpy(block, LOG_MAGIC, sizeof(LOG_MAGIC));
+    block[4] = FORMAT_VERSION;
+    block[5] = FIELD_COUNT;
+    writeUint16(block + 6, block_used - HEADER_SIZE);
+    writeUint32(block + 8, sequence);
+    writeUint32(block + 12, dropped_since_block);
+    memset(block + block_used, 0, BLOCK_SIZE - block_used);
+
+    dropped_since_block = 0;
+    block_used = 0;
+    blocks_sealed.store(sequence + 1, std::memory_order_release);
+}
+
+void FlightRecorder::stop() {
+    if (!active) {
+        return;
+    }
+    if (block_used > HEADER_SIZE) {
+        sealBlock();
+    }
+    active = false;
+}
+
+// ==================== FLASH WRITES (WRITER TASK) ====================
+
+void FlightRecorder::writeBlocks() {
+    METRICS_SCOPE(STAGE_RECORDER_WRITE);
+    uint32_t written = blocks_written.load(std::memory_order_relaxed);
+
+    while (written != blocks_sealed.load(std::memory_order_acquire)) {
+        if (!storage_full && file) {
+            while (freeBytes() < MIN_FREE_BYTES && deleteOldestLog()) {
+            }
+            uint32_t start = micros();
+            size_t result = file.write(blocks[written % BLOCK_COUNT], BLOCK_SIZE);
+            file.flush();
+            uint32_t elapsed = micros() - start;
+            if (elapsed > write_us_max) {
+                write_us_max = elapsed;
+            }
+
+            if (result == BLOCK_SIZE) {
+                bytes_flashed += BLOCK_SIZE;
+            } else {
+                LOG_WARN("Flight log storage full, recording stopped");
+                storage_full = true;
+                active = false;
+            }
+        }
+
+        written++;
+        blocks_written.store(written, std::memory_order_release);
+    }
+
+    // stop() seals before clearing active, so the last block is already counted here
+    if (!active && file && written == blocks_sealed.load(std::memory_order_acquire)) {
+        file.close();
+    }
+}
+
+void FlightRecorder::printReport() {
+    uint32_t records = records_recorded;
+    uint32_t elapsed_ms = millis() - stats_start_ms;
+
+    LOG_INFO("RECORDER %s n: %lu  rate: %.1f/s  size: %.1f B/rec  dropped: %lu", file_path, (unsigned long)records,
+             elapsed_ms > 0 ? records * 1000.0f / elapsed_ms : 0.0f, records > 0 ? (float)bytes_recorded / records : 0.0f,
+             (unsigned long)records_dropped);
+    LOG_INFO("RECORDER flash: %lu KiB  write max: %.1f ms  logs deleted: %lu", (unsigned long)(bytes_flashed / 1024),
+             write_us_max / 1000.0f, (unsigned long)logs_deleted);
+}
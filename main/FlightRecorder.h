@@ -0,0 +1,123 @@
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <atomic>
+#include "SensorModule.h"
+#include "ActuatorModule.h"
+#include "Metrics.h"
+
+// Flight-data recorder: sensor and actuator state to LittleFS at a fixed rate.
+//
+// Records are FIELD_COUNT fixed-point integers, each stored as a zigzag varint
+// delta from the previous record. Records are packed into BLOCK_SIZE RAM blocks
+// that are handed to a low-priority writer, so the sensor task never touches
+// flash. Every block starts with an absolute record and can be decoded on its
+// own; tools/decode_flight_log.py turns a log into CSV.
+//
+// Block layout (little-endian):
+//   char     magic[4]      "ALOG"
+//   uint8_t  version
+//   uint8_t  field_count
+//   uint16_t payload_bytes
+//   uint32_t sequence      Block number within the file
+//   uint32_t dropped       Records dropped before this block because all buffers were full
+//   payload, zero padded to BLOCK_SIZE
+//
+// Logs are numbered flight_000.bin to flight_999.bin, one per boot, counting
+// on from the newest and wrapping after 999. Whenever free space drops below
+// MIN_FREE_BYTES, at boot or while recording, the oldest log other than the
+// one being written is deleted, so the partition never fills for good.
+class FlightRecorder {
+public:
+    static const size_t BLOCK_SIZE = 4096;          // One flash sector
+    static const size_t HEADER_SIZE = 16;
+    static const uint8_t FORMAT_VERSION = 1;
+
+    // Field order is part of the file format; append only, and bump FORMAT_VERSION
+    enum Field {
+        TIMESTAMP_MS,
+        ACCEL_X, ACCEL_Y, ACCEL_Z,                  // mm/s²
+        GYRO_X, GYRO_Y, GYRO_Z,                     // mrad/s
+        ROLL, PITCH, YAW,                           // centidegrees
+        BMP_TEMPERATURE,                            // centidegrees C
+        BMP_PRESSURE,                               // Pa
+        BMP_ALTITUDE,                               // cm
+        GPS_FIX_COUNT,
+        GPS_LATITUDE, GPS_LONGITUDE,                // 1e-7 degrees
+        GPS_SPEED,                                  // centiknots
+        GPS_COURSE,                                 // centidegrees
+        GPS_SATELLITES,
+        NAV_NORTH, NAV_EAST, NAV_UP,                // cm
+        NAV_VEL_NORTH, NAV_VEL_EAST,                // cm/s
+        SERVO_POSITION,                             // degrees
+        MOTOR_SPEED,                                // -255..255
+        FLAGS,                                      // bit 0 GPS valid, 1 navigation valid, 2 heading aligned
+        FIELD_COUNT
+    };
+
+private:
+    static const uint32_t BLOCK_COUNT = 4;                  // 16 KiB of RAM, ~10 s of records at 50 Hz
+    static const size_t MAX_RECORD_BYTES = FIELD_COUNT * 5; // Worst case, every delta a 5-byte varint
+    static const uint16_t MAX_LOG_FILES = 1000;
+    static const size_t MIN_FREE_BYTES = 128 * 1024;       // ~90 s of records; the partition holds ~1.4 MB
+
+    SensorModule& sensor_module;
+    ActuatorModule& actuator_module;
+
+    uint8_t blocks[BLOCK_COUNT][BLOCK_SIZE];
+    std::atomic<uint32_t> blocks_sealed;    // Written by the recording task
+    std::atomic<uint32_t> blocks_written;   // Written by the writer task
+    size_t block_used;                      // Bytes used in the block being filled, 0 when none is open
+    int32_t previous[FIELD_COUNT];          // Delta base, zeroed at every block start
+
+    File file;
+    char file_path[24];
+    int file_index;                         // Number of the log being written, -1 before begin()
+    std::atomic<bool> active;               // Set by begin() in the writer task, read by the recording task
+    bool storage_full;
+
+    uint32_t record_interval_ms;
+    uint32_t last_record;
+
+    // Statistics
+    uint32_t records_recorded;
+    uint32_t records_dropped;
+    uint32_t dropped_since_block;
+    uint32_t bytes_recorded;                // Encoded record bytes, excluding headers and padding
+    uint32_t bytes_flashed;
+    uint32_t write_us_max;
+    uint32_t stats_start_ms;
+    uint32_t logs_deleted;                  // Oldest logs removed for space, this boot
+
+    void sampleFields(int32_t* fields);
+    void appendRecord(const int32_t* fields);
+    void startBlock();
+    void sealBlock();
+    bool openLogFile(int index);
+    bool findLogRange(int& oldest, int& newest);
+    bool deleteOldestLog();
+    size_t freeBytes();
+    static void formatLogPath(char* path, size_t size, int index);
+
+public:
+    FlightRecorder(SensorModule& sensor_module, ActuatorModule& actuator_module, uint32_t record_rate_hz = 50);
+
+    bool begin();           // Writer task: mounts LittleFS (formatting it on first use, seconds), makes room and opens the next log
+    void update();          // Sensor task: appends a record when one is due, never blocks
+    void writeBlocks();     // Writer task: moves sealed blocks to flash, deleting old logs when space runs low
+    void stop();            // Sensor task: seals the partial block, the writer then closes the file
+
+    bool deleteLog(const char* name);   // "flight_NNN.bin"; refuses the log being written
+
+    bool isActive() const { return active; }
+    const char* getFilePath() const { return file_path; }
+    uint32_t getRecordsRecorded() const { return records_recorded; }
+    uint32_t getRecordsDropped() const { return records_dropped; }
+    uint32_t getBytesFlashed() const { return bytes_flashed; }
+    uint32_t getLogsDeleted() const { return logs_deleted; }
+    void printReport();
+};
+
+#endif // FLIGHT_RECORDER_H
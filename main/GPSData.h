@@ -0,0 +1,27 @@
+#ifndef GPS_DATA_H
+#define GPS_DATA_H
+
+#include <Arduino.h>
+
+// Plain data, safe to memcpy and to embed in SensorSnapshot
+struct GPSData {
+    bool valid;
+    double latitude;
+    double longitude;
+    double altitude;
+    float speed;        // knots
+    float course;       // degrees true, course over ground
+    bool velocity_valid; // speed and course are the receiver's, not placeholders
+    int satellites;
+    uint8_t hour;       // UTC
+    uint8_t minute;
+    uint8_t second;
+    uint8_t day;
+    uint8_t month;
+    uint16_t year;
+    char time[12];      // "hhmmss"
+    char date[12];      // "ddmmyy"
+    uint32_t fix_count; // Incremented on every new position fix
+};
+
+#endif // GPS_DATA_H
@@ -0,0 +1,321 @@
+#include "Geofence.h"
+#include "MissionEngine.h"
+
+Geofence::Geofence(ActuatorModule& actuator_module)
+    : actuator_module(actuator_module), mission(NULL), active(-1), readers{ 0, 0 }, armed(true),
+      breached(false), checks(0), breaches(0), motor_cuts(0),
+      check_us_total(0), check_us_max(0), edges_tested_max(0) {
+}
+
+// The half that is not active, once no check() started before the last swap still reads it
+int Geofence::claimSpare() {
+    for (;;) {
+        portENTER_CRITICAL(&mux);
+        int spare = active == 0 ? 1 : 0;
+        bool idle = readers[spare] == 0;
+        portEXIT_CRITICAL(&mux);
+        if (idle) {
+            return spare;
+        }
+        vTaskDelay(1);      // A check takes microseconds
+    }
+}
+
+bool Geofence::load(const char* text) {
+    int spare = claimSpare();
+
+    // Only load() writes the spare set and check() only pins the active one
+    if (!build(sets[spare], text)) {
+        LOG_WARN("Geofence upload rejected");
+        return false;
+    }
+
+    portENTER_CRITICAL(&mux);
+    active = spare;
+    portEXIT_CRITICAL(&mux);
+
+    LOG_INFO("Geofence loaded: %d polygons, %d vertices, at most %d edges per test",
+             sets[spare].polygon_count, sets[spare].vertex_count, (int)sets[spare].max_slab_edges);
+    return true;
+}
+
+void Geofence::clear() {
+    portENTER_CRITICAL(&mux);
+    active = -1;
+    portEXIT_CRITICAL(&mux);
+    breached = false;
+    actuator_module.setMotorInhibit(false);
+    LOG_INFO("Geofence cleared");
+}
+
+void Geofence::setArmed(bool enabled) {
+    armed = enabled;
+    if (enabled && breached) {
+        cutMotor();
+    }
+}
+
+void Geofence::rearmMotor() {
+    if (breached) {
+        LOG_WARN("Motor re-armed outside the geofence");
+    }
+    actuator_module.setMotorInhibit(false);
+}
+
+// The mission would only steer the boat on with the motor off; stop() is a flag it takes on its own task
+void Geofence::cutMotor() {
+    if (mission != NULL) {
+        if (mission->getState() == MissionEngine::RUNNING) {
+            LOG_WARN("Mission aborted by the geofence");
+        }
+        mission->stop();        // Also drops a start not yet taken
+    }
+    if (!actuator_module.isMotorInhibited()) {
+        actuator_module.setMotorInhibit(true);
+        motor_cuts++;
+    }
+}
+
+// Parses and indexes the whole text into set; false on any error
+bool Geofence::build(FenceSet& set, const char* text) {
+    set.polygon_count = 0;
+    set.vertex_count = 0;
+    set.edge_ref_count = 0;
+    set.has_keep_in = false;
+    set.max_slab_edges = 0;
+
+    Polygon* polygon = NULL;
+    const char* p = text;
+
+    while (*p) {
+        while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') {
+            p++;
+        }
+        if (*p == '\0') {
+            break;
+        }
+        if (*p == '#') {
+            while (*p && *p != '\n') {
+                p++;
+            }
+            continue;
+        }
+
+        if (strncmp(p, "in", 2) == 0 || strncmp(p, "out", 3) == 0) {
+            if (polygon != NULL && !index(set, *polygon)) {
+                return false;
+            }
+            if (set.polygon_count >= MAX_POLYGONS) {
+                return false;
+            }
+            polygon = &set.polygons[set.polygon_count++];
+            polygon->keep_in = p[0] == 'i';
+            polygon->first_vertex = set.vertex_count;
+            polygon->vertex_count = 0;
+            set.has_keep_in |= polygon->keep_in;
+            p += polygon->keep_in ? 2 : 3;
+        } else {
+            char* end;
+            double latitude = strtod(p, &end);
+            if (end == p || *end != ',') {
+                return false;
+            }
+            p = end + 1;
+            double longitude = strtod(p, &end);
+            if (end == p || polygon == NULL || set.vertex_count >= MAX_VERTICES ||
+                latitude < -90.0 || latitude > 90.0 || longitude < -180.0 || longitude > 180.0) {
+                return false;
+            }
+            p = end;
+
+            // The first vertex fixes the plane for every polygon
+            if (set.vertex_count == 0) {
+                set.origin_latitude = latitude;
+                set.origin_longitude = longitude;
+                set.meters_per_deg_lat = METERS_PER_DEG_LAT;
+                set.meters_per_deg_lon = METERS_PER_DEG_LAT * cos(latitude * DEG_TO_RAD);
+            }
+            set.x[set.vertex_count] = (float)(longitude - set.origin_longitude) * set.meters_per_deg_lon;
+            set.y[set.vertex_count] = (float)(latitude - set.origin_latitude) * set.meters_per_deg_lat;
+            set.vertex_count++;
+            polygon->vertex_count++;
+        }
+
+        while (*p == ' ' || *p == '\t' || *p == '\r') {
+            p++;
+        }
+        if (*p == '#') {
+            continue;
+        }
+        if (*p && *p != '\n') {
+            return false;
+        }
+    }
+
+    return polygon != NULL && index(set, *polygon);
+}
+
+// Bounding box plus a counting sort of the polygon's edges into horizontal bands
+bool Geofence::index(FenceSet& set, Polygon& polygon) {
+    if (polygon.vertex_count < 3) {
+        return false;
+    }
+    int first = polygon.first_vertex;
+    int last = first + polygon.vertex_count - 1;
+
+    polygon.min_x = polygon.max_x = set.x[first];
+    polygon.min_y = polygon.max_y = set.y[first];
+    for (int i = first + 1; i <= last; i++) {
+        polygon.min_x = fminf(polygon.min_x, set.x[i]);
+        polygon.max_x = fmaxf(polygon.max_x, set.x[i]);
+        polygon.min_y = fminf(polygon.min_y, set.y[i]);
+        polygon.max_y = fmaxf(polygon.max_y, set.y[i]);
+    }
+    if (polygon.max_y - polygon.min_y < 0.01f || polygon.max_x - polygon.min_x < 0.01f) {
+        return false;       // Degenerate
+    }
+    polygon.slabs_per_meter = SLABS / (polygon.max_y - polygon.min_y);
+
+    uint16_t counts[SLABS];
+    memset(counts, 0, sizeof(counts));
+    for (int pass = 0; pass < 2; pass++) {
+        for (int i = first; i <= last; i++) {
+            int j = i == last ? first : i + 1;
+            int low = constrain((int)((fminf(set.y[i], set.y[j]) - polygon.min_y) * polygon.slabs_per_meter), 0, SLABS - 1);
+            int high = constrain((int)((fmaxf(set.y[i], set.y[j]) - polygon.min_y) * polygon.slabs_per_meter), 0, SLABS - 1);
+            for (int slab = low; slab <= high; slab++) {
+                if (pass == 0) {
+                    counts[slab]++;
+                } else {
+                    set.edge_refs[polygon.slab_start[slab] + counts[slab]++] = i;
+                }
+            }
+        }
+
+        if (pass == 0) {
+            polygon.slab_start[0] = set.edge_ref_count;
+            for (int slab = 0; slab < SLABS; slab++) {
+                if (polygon.slab_start[slab] + counts[slab] > MAX_EDGE_REFS) {
+                    return false;
+                }
+                polygon.slab_start[slab + 1] = polygon.slab_start[slab] + counts[slab];
+                if (counts[slab] > set.max_slab_edges) {
+                    set.max_slab_edges = counts[slab];
+                }
+                counts[slab] = 0;
+            }
+            set.edge_ref_count = polygon.slab_start[SLABS];
+        }
+    }
+    return true;
+}
+
+// Even-odd ray cast toward +x over the edges of the point's band
+bool Geofence::contains(const FenceSet& set, const Polygon& polygon, float x, float y, uint32_t& edges_tested) {
+    if (x < polygon.min_x || x > polygon.max_x || y < polygon.min_y || y > polygon.max_y) {
+        return false;
+    }
+    int slab = constrain((int)((y - polygon.min_y) * polygon.slabs_per_meter), 0, SLABS - 1);
+    int first = polygon.first_vertex;
+    int last = first + polygon.vertex_count - 1;
+
+    bool inside = false;
+    for (int k = polygon.slab_start[slab]; k < polygon.slab_start[slab + 1]; k++) {
+        int i = set.edge_refs[k];
+        int j = i == last ? first : i + 1;
+        float yi = set.y[i];
+        float yj = set.y[j];
+        if ((yi > y) != (yj > y)) {
+            float crossing = set.x[i] + (y - yi) * (set.x[j] - set.x[i]) / (yj - yi);
+            if (x < crossing) {
+                inside = !inside;
+            }
+        }
+    }
+    edges_tested += polygon.slab_start[slab + 1] - polygon.slab_start[slab];
+    return inside;
+}
+
+void Geofence::check(double latitude, double longitude) {
+    uint32_t start = micros();
+    uint32_t edges_tested = 0;
+    bool outside_rules = false;
+
+    portENTER_CRITICAL(&mux);
+    int pinned = active;
+    if (pinned >= 0) {
+        readers[pinned]++;
+    }
+    portEXIT_CRITICAL(&mux);
+    if (pinned < 0) {
+        return;
+    }
+
+    const FenceSet& set = sets[pinned];
+    float x = (float)(longitude - set.origin_longitude) * set.meters_per_deg_lon;
+    float y = (float)(latitude - set.origin_latitude) * set.meters_per_deg_lat;
+
+    bool inside_keep_in = false;
+    for (int i = 0; i < set.polygon_count; i++) {
+        const Polygon& polygon = set.polygons[i];
+        if (polygon.keep_in && inside_keep_in) {
+            continue;       // One keep-in is enough
+        }
+        if (contains(set, polygon, x, y, edges_tested)) {
+            if (polygon.keep_in) {
+                inside_keep_in = true;
+            } else {
+                outside_rules = true;
+            }
+        }
+    }
+    if (set.has_keep_in && !inside_keep_in) {
+        outside_rules = true;
+    }
+
+    portENTER_CRITICAL(&mux);
+    readers[pinned]--;
+    portEXIT_CRITICAL(&mux);
+
+    uint32_t elapsed = micros() - start;
+    checks++;
+    check_us_total += elapsed;
+    if (elapsed > check_us_max) {
+        check_us_max = elapsed;
+    }
+    if (edges_tested > edges_tested_max) {
+        edges_tested_max = edges_tested;
+    }
+
+    if (outside_rules && !breached) {
+        breaches++;
+        LOG_WARN("Geofence breached at %.6f, %.6f", latitude, longitude);
+        if (armed) {
+            cutMotor();
+        }
+    } else if (!outside_rules && breached) {
+        LOG_INFO("Back inside the geofence, motor stays inhibited until rearmed");
+    }
+    breached = outside_rules;
+}
+
+int Geofence::getPolygonCount() const {
+    portENTER_CRITICAL(&mux);
+    int count = active < 0 ? 0 : sets[active].polygon_count;
+    portEXIT_CRITICAL(&mux);
+    return count;
+}
+
+int Geofence::getVertexCount() const {
+    portENTER_CRITICAL(&mux);
+    int count = active < 0 ? 0 : sets[active].vertex_count;
+    portEXIT_CRITICAL(&mux);
+    return count;
+}
+
+int Geofence::getWorstCaseEdges() const {
+    portENTER_CRITICAL(&mux);
+    int count = active < 0 ? 0 : sets[active].max_slab_edges;
+    portEXIT_CRITICAL(&mux);
+    return count;
+}
@@ -0,0 +1,117 @@
+#ifndef GEOFENCE_H
+#define GEOFENCE_H
+
+#include <Arduino.h>
+#include "ActuatorModule.h"
+#include "Log.h"
+
+class MissionEngine;
+
+// Hard geofence: the boat must stay inside at least one keep-in polygon (if any
+// are defined) and outside every keep-out polygon. The first fix that breaks
+// either rule latches ActuatorModule's motor inhibit, so no later throttle
+// command (mission, uplink, HTTP) can restart the motor, and aborts the
+// mission if one is running. The inhibit stays latched when the boat drifts
+// back inside; only rearmMotor(), so an operator can drive the boat back in,
+// or clear() releases it. It latches again on the next breach.
+//
+// Polygons are projected once, at upload, into a flat plane around their
+// first vertex and indexed: each gets a bounding box and its edges are sorted
+// into SLABS horizontal bands. A query is one projection, a bbox test per
+// polygon and a ray-crossing test against only the edges in the query's band,
+// so the cost is bounded by the fullest band rather than the vertex count.
+//
+// check() runs in the GPS UART task; load() builds into the idle half of a
+// double buffer from the web task and swaps it in under a short lock. check()
+// holds the lock only to pin the active half (a reader count), and tests the
+// polygons outside it; load() waits for a half's readers to leave before
+// rebuilding it, so a set is never overwritten while a check reads it.
+class Geofence {
+public:
+    static const int MAX_POLYGONS = 8;
+    static const int MAX_VERTICES = 1024;       // Across all polygons
+    static const int MAX_EDGE_REFS = 3072;      // Edges spanning several bands count once per band
+    static const int SLABS = 32;
+
+private:
+    struct Polygon {
+        bool keep_in;
+        uint16_t first_vertex;
+        uint16_t vertex_count;
+        float min_x, max_x, min_y, max_y;       // m
+        float slabs_per_meter;
+        uint16_t slab_start[SLABS + 1];         // Band b's edges are edge_refs[slab_start[b] .. slab_start[b + 1])
+    };
+
+    struct FenceSet {
+        double origin_latitude;
+        double origin_longitude;
+        float meters_per_deg_lat;
+        float meters_per_deg_lon;
+        int polygon_count;
+        int vertex_count;
+        int edge_ref_count;
+        bool has_keep_in;
+        uint16_t max_slab_edges;                // Worst-case edges tested for one polygon
+        Polygon polygons[MAX_POLYGONS];
+        float x[MAX_VERTICES];                  // m east of the origin
+        float y[MAX_VERTICES];                  // m north of the origin
+        uint16_t edge_refs[MAX_EDGE_REFS];      // Edge from vertex i to the polygon's next vertex
+    };
+
+    ActuatorModule& actuator_module;
+    MissionEngine* mission;                     // Optional, aborted on a breach
+
+    FenceSet sets[2];
+    int active;                                 // Index into sets, -1 when no fence is loaded
+    uint8_t readers[2];                         // check() calls reading each set
+    mutable portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+
+    volatile bool armed;
+
+    // check() state (GPS UART task); clear() resets it from the web task
+    volatile bool breached;
+    uint32_t checks;
+    uint32_t breaches;
+    uint32_t motor_cuts;
+    uint32_t check_us_total;
+    uint32_t check_us_max;
+    uint32_t edges_tested_max;
+
+    static constexpr double METERS_PER_DEG_LAT = 111320.0;
+
+    static bool build(FenceSet& set, const char* text);
+    static bool index(FenceSet& set, Polygon& polygon);
+    static bool contains(const FenceSet& set, const Polygon& polygon, float x, float y, uint32_t& edges_tested);
+    int claimSpare();
+    void cutMotor();
+
+public:
+    Geofence(ActuatorModule& actuator_module);
+
+    // Polygons as text: a line "in" or "out" starts a keep-in or keep-out polygon,
+    // followed by one "lat,lon" line per vertex (at least 3; the ring closes itself).
+    // '#' starts a comment. Returns false, keeping the current fence, if the text is invalid.
+    bool load(const char* text);
+    void clear();
+
+    void check(double latitude, double longitude);     // Call for every new GPS fix
+    void setMissionEngine(MissionEngine* engine) { mission = engine; }
+
+    void setArmed(bool enabled);        // Arming while breached latches the inhibit at once
+    void rearmMotor();                  // Releases the inhibit until the next breach; clear() does too
+    bool isArmed() const { return armed; }
+    bool isBreached() const { return breached; }
+
+    int getPolygonCount() const;
+    int getVertexCount() const;
+    int getWorstCaseEdges() const;      // Bound on edges tested per polygon per check
+    uint32_t getChecks() const { return checks; }
+    uint32_t getBreaches() const { return breaches; }
+    uint32_t getMotorCuts() const { return motor_cuts; }
+    uint32_t getCheckMicrosAverage() const { return checks > 0 ? check_us_total / checks : 0; }
+    uint32_t getCheckMicrosMax() const { return check_us_max; }
+    uint32_t getEdgesTestedMax() const { return edges_tested_max; }
+};
+
+#endif // GEOFENCE_H
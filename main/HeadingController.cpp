@@ -0,0 +1,149 @@
+#include "HeadingController.h"
+
+HeadingController::HeadingController(SensorModule& sensor_module, ActuatorModule& actuator_module, uint32_t period_ms)
+    : sensor_module(sensor_module), actuator_module(actuator_module), period_ms(period_ms),
+      engaged(false), reset_pending(false), target_heading(0.0f),
+      kp(DEFAULT_KP), ki(DEFAULT_KI), kd(DEFAULT_KD), rudder_rate_limit(DEFAULT_RUDDER_RATE),
+      heading_valid(false), heading(0.0f), heading_rate(0.0f), last_fix_count(0), last_course_ms(0),
+      integral(0.0f), rudder(0.0f), last_error(0.0f),
+      last_tick_us(0), ticks(0), jitter_us_total(0), jitter_us_max(0), compute_us_total(0), compute_us_max(0) {
+}
+
+void HeadingController::engage(float heading_degrees) {
+    target_heading = wrapHeading(heading_degrees);
+    if (!engaged) {
+        reset_pending = true;
+        engaged = true;
+        LOG_INFO("Autopilot engaged, holding %.0f°", heading_degrees);
+    }
+}
+
+void HeadingController::disengage() {
+    if (engaged) {
+        engaged = false;
+        LOG_INFO("Autopilot disengaged");
+    }
+}
+
+void HeadingController::setGains(float kp, float ki, float kd) {
+    if (kp < 0.0f || ki < 0.0f || kd < 0.0f) {
+        LOG_WARN("Autopilot gains must not be negative, ignored");
+        return;
+    }
+    this->kp = kp;
+    this->ki = ki;
+    this->kd = kd;
+}
+
+void HeadingController::setRudderRateLimit(float degrees_per_second) {
+    if (degrees_per_second <= 0.0f) {
+        LOG_WARN("Autopilot rudder rate limit must be positive, ignored");
+        return;
+    }
+    rudder_rate_limit = degrees_per_second;
+}
+
+void HeadingController::update() {
+    METRICS_SCOPE(STAGE_AUTOPILOT);
+    uint32_t start = micros();
+    if (ticks > 0) {
+        int32_t jitter = (int32_t)(start - last_tick_us) - (int32_t)(period_ms * 1000);
+        uint32_t magnitude = jitter < 0 ? -jitter : jitter;
+        jitter_us_total += magnitude;
+        if (magnitude > jitter_us_max) {
+            jitter_us_max = magnitude;
+        }
+    }
+    last_tick_us = start;
+
+    // The gains assume the nominal period, so the loop behaves the same whatever the jitter
+    float dt = period_ms / 1000.0f;
+
+    SensorSnapshot snapshot;
+    sensor_module.getSnapshot(snapshot);
+    updateHeading(snapshot, dt);
+
+    if (engaged) {
+        steer(dt);
+    }
+
+    uint32_t elapsed = micros() - start;
+    ticks++;
+    compute_us_total += elapsed;
+    if (elapsed > compute_us_max) {
+        compute_us_max = elapsed;
+    }
+}
+
+// Gyro-propagated heading, corrected toward GPS course on each new fix. The IMU
+// yaw axis is counterclockwise-positive (see NavigationFilter), compass heading is not.
+void HeadingController::updateHeading(const SensorSnapshot& snapshot, float dt) {
+    heading_rate = -snapshot.gyro_z * RAD_TO_DEG;
+    heading = wrapHeading(heading + heading_rate * dt);
+
+    const GPSData& fix = snapshot.gps;
+    if (fix.fix_count == last_fix_count) {
+        return;
+    }
+    last_fix_count = fix.fix_count;
+    if (!fix.valid || !fix.velocity_valid || fix.speed < COURSE_MIN_SPEED_KNOTS) {
+        return;
+    }
+
+    // Scaled by the time since the last correction so the pull is the same at any fix rate
+    if (!heading_valid) {
+        heading = wrapHeading(fix.course);
+        heading_valid = true;
+    } else {
+        float gain = fminf((snapshot.gps_timestamp_ms - last_course_ms) / 1000.0f / COURSE_TIME_CONSTANT, COURSE_GAIN_MAX);
+        heading = wrapHeading(heading + gain * headingError(fix.course, heading));
+    }
+    last_course_ms = snapshot.gps_timestamp_ms;
+}
+
+void HeadingController::steer(float dt) {
+    if (reset_pending) {
+        // Pick up from wherever the rudder is so engaging does not jerk it
+        reset_pending = false;
+        integral = 0.0f;
+        rudder = (actuator_module.getTargetPosition() - RUDDER_CENTER) * RUDDER_DIRECTION;
+    }
+    if (!heading_valid) {
+        return;     // Hold the rudder until GPS course gives an absolute heading
+    }
+
+    float error = headingError(target_heading, heading);
+    last_error = error;
+
+    float candidate = constrain(integral + ki * error * dt, -MAX_RUDDER, MAX_RUDDER);
+    float unlimited = kp * error + candidate - kd * heading_rate;
+    float desired = constrain(unlimited, -MAX_RUDDER, MAX_RUDDER);
+    float step = rudder_rate_limit * dt;
+    float command = constrain(desired, rudder - step, rudder + step);
+
+    // Conditional integration: while either limit is active, only let the
+    // integrator move in the direction that releases it
+    bool limited = fabsf(command - unlimited) > 1e-3f;
+    if (!limited || (unlimited > command) != (error > 0.0f)) {
+        integral = candidate;
+    }
+    rudder = command;
+
+    int angle = RUDDER_CENTER + RUDDER_DIRECTION * (int)lroundf(rudder);
+    if (angle != actuator_module.getTargetPosition()) {
+        actuator_module.setPosition(angle);
+    }
+}
+
+float HeadingController::wrapHeading(float degrees) {
+    degrees = fmodf(degrees, 360.0f);
+    return degrees < 0.0f ? degrees + 360.0f : degrees;
+}
+
+float HeadingController::headingError(float target, float heading) {
+    float error = fmodf(target - heading + 180.0f, 360.0f);
+    if (error < 0.0f) {
+        error += 360.0f;
+    }
+    return error - 180.0f;
+}
@@ -0,0 +1,105 @@
+#ifndef HEADING_CONTROLLER_H
+#define HEADING_CONTROLLER_H
+
+#include <Arduino.h>
+#include "SensorModule.h"
+#include "ActuatorModule.h"
+#include "Log.h"
+#include "Metrics.h"
+
+// Heading-hold autopilot. Heading is tracked by integrating the gyro yaw rate
+// and pulling it toward GPS course over ground whenever the boat is moving fast
+// enough for the course to mean anything. A PID on the wrapped heading error
+// (derivative taken from the gyro rate, so target changes do not kick the
+// rudder) produces a rudder deflection that is magnitude- and rate-limited,
+// with conditional integration to stop windup against either limit.
+//
+// update() must be called from a fixed-rate task every getPeriodMs(); the
+// gains are tuned for that period and the tick jitter is measured.
+class HeadingController {
+private:
+    SensorModule& sensor_module;
+    ActuatorModule& actuator_module;
+    const uint32_t period_ms;
+
+    // Set from any task, read by the control tick
+    volatile bool engaged;
+    volatile bool reset_pending;        // Set by engage(), consumed by the next tick
+    volatile float target_heading;      // degrees, 0-360
+
+    // Gains (deflection degrees per degree, per degree·s, per degree/s)
+    float kp;
+    float ki;
+    float kd;
+    float rudder_rate_limit;            // degrees/s
+
+    // Heading estimate (control tick only)
+    bool heading_valid;
+    float heading;                      // degrees, 0-360
+    float heading_rate;                 // degrees/s, positive to starboard
+    uint32_t last_fix_count;
+    uint32_t last_course_ms;            // Publication time of the last fix used for a course correction
+
+    // PID state (control tick only)
+    float integral;                     // degrees of rudder
+    float rudder;                       // Last commanded deflection, degrees, positive to starboard
+    float last_error;
+
+    // Tick timing
+    uint32_t last_tick_us;
+    uint32_t ticks;
+    uint32_t jitter_us_total;
+    uint32_t jitter_us_max;
+    uint32_t compute_us_total;
+    uint32_t compute_us_max;
+
+    static const int RUDDER_CENTER = 90;                    // Servo angle for a straight rudder
+    static const int RUDDER_DIRECTION = 1;                  // Flip if a larger servo angle turns to port
+    static constexpr float MAX_RUDDER = 35.0f;              // degrees either side of centre
+    static constexpr float DEFAULT_KP = 1.2f;
+    static constexpr float DEFAULT_KI = 0.05f;
+    static constexpr float DEFAULT_KD = 1.0f;
+    static constexpr float DEFAULT_RUDDER_RATE = 60.0f;
+    static constexpr float COURSE_MIN_SPEED_KNOTS = 2.0f;   // Below this GPS course is noise
+    static constexpr float COURSE_TIME_CONSTANT = 5.0f;     // s; a 1 Hz fix takes a fifth of the course error
+    static constexpr float COURSE_GAIN_MAX = 0.2f;          // No single fix, even after a gap, pulls harder than one at 1 Hz
+
+    void updateHeading(const SensorSnapshot& snapshot, float dt);
+    void steer(float dt);
+
+public:
+    HeadingController(SensorModule& sensor_module, ActuatorModule& actuator_module, uint32_t period_ms = 20);
+
+    void update();          // One control tick; call every getPeriodMs() from a fixed-rate task
+
+    void engage(float heading_degrees);     // Hold this heading (also retargets while engaged)
+    void disengage();                       // Stop steering; the rudder stays where it is
+    bool isEngaged() const { return engaged; }
+    float getTargetHeading() const { return target_heading; }
+
+    void setGains(float kp, float ki, float kd);
+    void setRudderRateLimit(float degrees_per_second);
+    float getKp() const { return kp; }
+    float getKi() const { return ki; }
+    float getKd() const { return kd; }
+    float getRudderRateLimit() const { return rudder_rate_limit; }
+
+    bool isHeadingValid() const { return heading_valid; }
+    float getHeading() const { return heading; }
+    float getHeadingRate() const { return heading_rate; }
+    float getError() const { return last_error; }
+    float getRudder() const { return rudder; }
+    float getIntegral() const { return integral; }
+
+    uint32_t getPeriodMs() const { return period_ms; }
+    uint32_t getTicks() const { return ticks; }
+    uint32_t getJitterMicrosAverage() const { return ticks > 1 ? jitter_us_total / (ticks - 1) : 0; }
+    uint32_t getJitterMicrosMax() const { return jitter_us_max; }
+    uint32_t getComputeMicrosAverage() const { return ticks > 0 ? compute_us_total / ticks : 0; }
+    uint32_t getComputeMicrosMax() const { return compute_us_max; }
+
+    static float wrapHeading(float degrees);        // To [0, 360)
+    static float headingError(float target, float heading);  // Shortest turn, [-180, 180)
+};
+
+#endif // HEADING_CONTROLLER_H
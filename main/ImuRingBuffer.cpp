@@ -0,0 +1,48 @@
+#include "ImuRingBuffer.h"
+
+ImuRingBuffer::ImuRingBuffer() : head(0) {
+}
+
+void ImuRingBuffer::push(const ImuSample& sample) {
+    uint32_t index = head.load(std::memory_order_relaxed);
+    slots[index & MASK] = sample;
+    head.store(index + 1, std::memory_order_release);
+}
+
+ImuRingBuffer::Reader ImuRingBuffer::createReader() const {
+    Reader reader;
+    reader.tail = head.load(std::memory_order_acquire);
+    reader.dropped = 0;
+    return reader;
+}
+
+uint32_t ImuRingBuffer::available(const Reader& reader) const {
+    uint32_t pending = head.load(std::memory_order_acquire) - reader.tail;
+    return pending < CAPACITY ? pending : CAPACITY - 1;
+}
+
+bool ImuRingBuffer::pop(Reader& reader, ImuSample& out) const {
+    for (;;) {
+        uint32_t head_index = head.load(std::memory_order_acquire);
+        if (reader.tail == head_index) {
+            return false;
+        }
+
+        // While the producer writes index head_index it overwrites head_index - CAPACITY,
+        // so only the newest CAPACITY - 1 samples are safe to copy
+        if (head_index - reader.tail >= CAPACITY) {
+            uint32_t resume = head_index - (CAPACITY - 1);
+            reader.dropped += resume - reader.tail;
+            reader.tail = resume;
+        }
+
+        out = slots[reader.tail & MASK];
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // Re-check: if the producer lapped us during the copy, resync and try again
+        if (head.load(std::memory_order_relaxed) - reader.tail < CAPACITY) {
+            reader.tail++;
+            return true;
+        }
+    }
+}
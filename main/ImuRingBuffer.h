@@ -0,0 +1,47 @@
+#ifndef IMU_RING_BUFFER_H
+#define IMU_RING_BUFFER_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// One MPU6050 FIFO sample, converted to SI units
+struct ImuSample {
+    uint32_t timestamp_us;  // micros() at which the sample was taken
+    float accel_x;          // m/s²
+    float accel_y;
+    float accel_z;
+    float gyro_x;           // rad/s
+    float gyro_y;
+    float gyro_z;
+};
+
+// Single-producer broadcast ring buffer of IMU samples.
+// The producer never blocks; every consumer keeps its own Reader cursor, and a
+// reader that falls more than CAPACITY samples behind skips ahead and counts
+// the samples it missed.
+class ImuRingBuffer {
+public:
+    static const uint32_t CAPACITY = 512;  // Power of two, ~0.5 s at 1 kHz
+
+    struct Reader {
+        uint32_t tail;
+        uint32_t dropped;
+    };
+
+private:
+    static const uint32_t MASK = CAPACITY - 1;
+
+    ImuSample slots[CAPACITY];
+    std::atomic<uint32_t> head;  // Total samples ever pushed
+
+public:
+    ImuRingBuffer();
+
+    void push(const ImuSample& sample);               // Producer only
+    Reader createReader() const;                      // Starts at the newest sample
+    bool pop(Reader& reader, ImuSample& out) const;   // False when the reader is caught up
+    uint32_t available(const Reader& reader) const;
+    uint32_t getTotalSamples() const { return head.load(std::memory_order_relaxed); }
+};
+
+#endif // IMU_RING_BUFFER_H
@@ -0,0 +1,159 @@
+#include "JsonWriter.h"
+
+JsonWriter::JsonWriter(char* buf, size_t buf_capacity)
+    : buffer(buf), capacity(buf_capacity), length(0), overflow(false), need_comma(false) {
+    if (capacity > 0) {
+        buffer[0] = '\0';
+    }
+}
+
+void JsonWriter::reset() {
+    length = 0;
+    overflow = false;
+    need_comma = false;
+    if (capacity > 0) {
+        buffer[0] = '\0';
+    }
+}
+
+void JsonWriter::append(char c) {
+    if (length + 1 >= capacity) {
+        overflow = true;
+        return;
+    }
+    buffer[length++] = c;
+    buffer[length] = '\0';
+}
+
+void JsonWriter::append(const char* str) {
+    while (*str) {
+        append(*str++);
+    }
+}
+
+void JsonWriter::appendKey(const char* key) {
+    if (need_comma) {
+        append(',');
+    }
+    append('"');
+    append(key);
+    append("\":");
+}
+
+void JsonWriter::appendUnsigned(uint64_t value) {
+    char digits[21];
+    int n = 0;
+    do {
+        digits[n++] = '0' + (value % 10);
+        value /= 10;
+    } while (value > 0);
+
+    while (n > 0) {
+        append(digits[--n]);
+    }
+}
+
+// Fixed-point formatting, rounded half away from zero like String(float, decimals).
+// Avoids printf's float path, which allocates on newlib.
+void JsonWriter::appendFixed(double value, int decimals) {
+    if (isnan(value) || isinf(value)) {
+        append("null");
+        return;
+    }
+
+    if (decimals < 0) decimals = 0;
+    if (decimals > 9) decimals = 9;
+
+    uint64_t scale = 1;
+    for (int i = 0; i < decimals; i++) {
+        scale *= 10;
+    }
+
+    bool negative = value < 0;
+    if (negative) {
+        value = -value;
+    }
+
+    if (value * scale >= 1.8e19) {
+        append("null");  // Out of range for the fixed-point path
+        return;
+    }
+
+    uint64_t scaled = (uint64_t)(value * scale + 0.5);
+    if (negative && scaled > 0) {
+        append('-');
+    }
+    appendUnsigned(scaled / scale);
+
+    if (decimals > 0) {
+        append('.');
+        uint64_t fraction = scaled % scale;
+        for (uint64_t digit = scale / 10; digit > 0; digit /= 10) {
+            append('0' + (fraction / digit) % 10);
+        }
+    }
+}
+
+void JsonWriter::beginObject() {
+    if (need_comma) {
+        append(',');
+    }
+    append('{');
+    need_comma = false;
+}
+
+void JsonWriter::beginObject(const char* key) {
+    appendKey(key);
+    append('{');
+    need_comma = false;
+}
+
+void JsonWriter::endObject() {
+    append('}');
+    need_comma = true;
+}
+
+void JsonWriter::field(const char* key, int value) {
+    field(key, (long)value);
+}
+
+void JsonWriter::field(const char* key, long value) {
+    appendKey(key);
+    if (value < 0) {
+        append('-');
+        appendUnsigned((uint64_t)(-(int64_t)value));
+    } else {
+        appendUnsigned((uint64_t)value);
+    }
+    need_comma = true;
+}
+
+void JsonWriter::field(const char* key, unsigned long value) {
+    appendKey(key);
+    appendUnsigned(value);
+    need_comma = true;
+}
+
+void JsonWriter::field(const char* key, bool value) {
+    appendKey(key);
+    append(value ? "true" : "false");
+    need_comma = true;
+}
+
+void JsonWriter::field(const char* key, float value, int decimals) {
+    field(key, (double)value, decimals);
+}
+
+void JsonWriter::field(const char* key, double value, int decimals) {
+    appendKey(key);
+    appendFixed(value, decimals);
+    need_comma = true;
+}
+
+void JsonWriter::field(const char* key, const char* value) {
+    appendKey(key);
+    append('"');
+    append(value);
+    append('"');
+    need_comma = true;
+}
@@ -0,0 +1,45 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <Arduino.h>
+
+// Streams a JSON document into a caller-owned buffer without touching the heap.
+// Output is always NUL-terminated; if the buffer is too small the document is
+// truncated and overflowed() reports it.
+class JsonWriter {
+private:
+    char* buffer;
+    const size_t capacity;
+    size_t length;
+    bool overflow;
+    bool need_comma;
+
+    void append(char c);
+    void append(const char* str);
+    void appendKey(const char* key);
+    void appendUnsigned(uint64_t value);
+    void appendFixed(double value, int decimals);
+
+public:
+    JsonWriter(char* buf, size_t buf_capacity);
+
+    void beginObject();                   // Anonymous object (document root)
+    void beginObject(const char* key);    // Named nested object
+    void endObject();
+
+    void field(const char* key, int value);
+    void field(const char* key, long value);
+    void field(const char* key, unsigned long value);
+    void field(const char* key, bool value);
+    void field(const char* key, float value, int decimals = 2);
+    void field(const char* key, double value, int decimals = 2);
+    void field(const char* key, const char* value);  // Value must not need escaping
+
+    void reset();
+
+    const char* c_str() const { return buffer; }
+    size_t size() const { return length; }
+    bool overflowed() const { return overflow; }
+};
+
+#endif // JSON_WRITER_H
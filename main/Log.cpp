@@ -0,0 +1,153 @@
+#include "Log.h"
+
+Log::Record Log::ring[Log::CAPACITY];
+std::atomic<uint32_t> Log::head(0);
+uint32_t Log::tail = 0;
+std::atomic<uint32_t> Log::dropped(0);
+uint32_t Log::reported_dropped = 0;
+uint8_t Log::runtime_level = LOG_LEVEL;
+
+static const char LEVEL_LETTERS[] = { '-', 'E', 'W', 'I', 'D' };
+
+// Bounded MPSC queue with a per-slot sequence number (Vyukov). Slot i is free for
+// the producer claiming position p when sequence == p, and holds a finished record
+// for the drain when sequence == p + 1. Producers only contend on the head CAS.
+void Log::begin() {
+    for (uint32_t i = 0; i < CAPACITY; i++) {
+        ring[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    head.store(0, std::memory_order_relaxed);
+    tail = 0;
+}
+
+void Log::commit(uint8_t level, const char* format, const LogArg* args, int count) {
+    uint32_t position = head.load(std::memory_order_relaxed);
+    Record* record;
+    for (;;) {
+        record = &ring[position & MASK];
+        int32_t diff = (int32_t)(record->sequence.load(std::memory_order_acquire) - position);
+        if (diff == 0) {
+            if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            dropped.fetch_add(1, std::memory_order_relaxed);   // Full
+            return;
+        } else {
+            position = head.load(std::memory_order_relaxed);
+        }
+    }
+
+    record->timestamp_us = micros();
+    record->format = format;
+    record->level = level;
+    record->arg_count = count;
+    for (int i = 0; i < count; i++) {
+        record->args[i] = args[i];
+    }
+    record->sequence.store(position + 1, std::memory_order_release);
+}
+
+size_t Log::drain(size_t max_records) {
+    METRICS_SCOPE(STAGE_LOG_DRAIN);
+    char line[160];
+    size_t printed = 0;
+
+    while (printed < max_records) {
+        Record& record = ring[tail & MASK];
+        if (record.sequence.load(std::memory_order_acquire) != tail + 1) {
+            break;  // Empty, or the producer of the next slot has not finished yet
+        }
+
+        format(record, line, sizeof(line));
+        record.sequence.store(tail + CAPACITY, std::memory_order_release);
+        tail++;
+
+        Serial.println(line);
+        printed++;
+    }
+
+    uint32_t total_dropped = dropped.load(std::memory_order_relaxed);
+    if (total_dropped != reported_dropped) {
+        Serial.print("WARNING: ");
+        Serial.print(total_dropped - reported_dropped);
+        Serial.println(" log records dropped (ring full)");
+        reported_dropped = total_dropped;
+    }
+    return printed;
+}
+
+// "[   12.345678] W message"; each conversion is handed to snprintf with its own argument
+void Log::format(const Record& record, char* out, size_t capacity) {
+    uint8_t level = record.level <= LOG_LEVEL_DEBUG ? record.level : 0;
+    int length = snprintf(out, capacity, "[%5lu.%06lu] %c ",
+                          (unsigned long)(record.timestamp_us / 1000000UL),
+                          (unsigned long)(record.timestamp_us % 1000000UL),
+                          LEVEL_LETTERS[level]);
+    size_t used = length > 0 ? (size_t)length : 0;
+
+    const char* p = record.format;
+    int arg = 0;
+    char spec[16];
+
+    while (*p && used + 1 < capacity) {
+        if (*p != '%') {
+            out[used++] = *p++;
+            continue;
+        }
+        if (p[1] == '%') {
+            out[used++] = '%';
+            p += 2;
+            continue;
+        }
+
+        // Copy one conversion spec, e.g. "%-8.3f" or "%lu"
+        size_t n = 0;
+        spec[n++] = *p++;
+        while (*p && strchr("-+ #0123456789.l", *p) && n < sizeof(spec) - 2) {
+            spec[n++] = *p++;
+        }
+        if (!*p) {
+            break;
+        }
+        char conversion = *p++;
+        spec[n++] = conversion;
+        spec[n] = '\0';
+
+        bool is_float = strchr("feEgG", conversion) != NULL;
+        bool is_long = strchr(spec, 'l') != NULL;
+        if (arg >= record.arg_count || (conversion == 's') != (record.args[arg].type == LogArg::STRING)) {
+            length = snprintf(out + used, capacity - used, "<?>");  // Missing or mismatched argument
+        } else {
+            const LogArg& value = record.args[arg];
+            switch (value.type) {
+                case LogArg::FLOAT:
+                    length = is_float ? snprintf(out + used, capacity - used, spec, value.f)
+                                      : snprintf(out + used, capacity - used, "%ld", (long)value.f);
+                    break;
+                case LogArg::STRING:
+                    length = snprintf(out + used, capacity - used, spec, value.s ? value.s : "(null)");
+                    break;
+                case LogArg::UINT:
+                    length = is_float ? snprintf(out + used, capacity - used, spec, (double)value.u)
+                           : is_long  ? snprintf(out + used, capacity - used, spec, (unsigned long)value.u)
+                                      : snprintf(out + used, capacity - used, spec, (unsigned int)value.u);
+                    break;
+                default:
+                    length = is_float ? snprintf(out + used, capacity - used, spec, (double)value.i)
+                           : is_long  ? snprintf(out + used, capacity - used, spec, (long)value.i)
+                                      : snprintf(out + used, capacity - used, spec, (int)value.i);
+                    break;
+            }
+        }
+        arg++;
+
+        if (length > 0) {
+            used += (size_t)length;
+        }
+        if (used >= capacity) {
+            used = capacity - 1;
+        }
+    }
+    out[used] = '\0';
+}
@@ -0,0 +1,104 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "Metrics.h"
+
+// Log levels. LOG_LEVEL removes calls above it at compile time; Log::setLevel()
+// filters the rest at run time.
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// Up to Log::MAX_ARGS integer, float or string-literal arguments with printf-style
+// %d %i %u %ld %lu %x %c %f %e %g %s formats. The format and any %s argument are
+// stored by pointer, so they must be string literals (or otherwise outlive the drain).
+#define LOG_AT(level, ...) \
+    do { if ((level) <= LOG_LEVEL && (level) <= Log::getLevel()) Log::write((level), __VA_ARGS__); } while (0)
+
+#define LOG_ERROR(...) LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_WARN(...)  LOG_AT(LOG_LEVEL_WARN, __VA_ARGS__)
+#define LOG_INFO(...)  LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#define LOG_DEBUG(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+
+// One argument, captured as raw bits plus a type tag; formatting is deferred to the drain.
+// Floating-point values are kept as double, so %.6f coordinates survive to the drain.
+struct LogArg {
+    enum Type : uint8_t { INT, UINT, FLOAT, STRING };
+    Type type;
+    union {
+        int32_t i;
+        uint32_t u;
+        double f;
+        const char* s;
+    };
+
+    LogArg() : type(INT), i(0) {}
+    LogArg(int value) : type(INT), i(value) {}
+    LogArg(long value) : type(INT), i((int32_t)value) {}
+    LogArg(unsigned int value) : type(UINT), u(value) {}
+    LogArg(unsigned long value) : type(UINT), u((uint32_t)value) {}
+    LogArg(float value) : type(FLOAT), f(value) {}
+    LogArg(double value) : type(FLOAT), f(value) {}
+    LogArg(const char* value) : type(STRING), s(value) {}
+};
+
+// Deferred logger: producers copy a fixed-size binary record into a lock-free
+// multi-producer ring (no formatting, no locks, no I/O); a low-priority task
+// calls drain() to format and print. When the ring is full, records are
+// dropped and counted rather than blocking the caller.
+class Log {
+public:
+    static const int MAX_ARGS = 6;
+
+private:
+    struct Record {
+        std::atomic<uint32_t> sequence;     // Slot protocol, see Log.cpp
+        uint32_t timestamp_us;
+        const char* format;
+        uint8_t level;
+        uint8_t arg_count;
+        LogArg args[MAX_ARGS];
+    };
+
+    static const uint32_t CAPACITY = 128;   // Power of two
+    static const uint32_t MASK = CAPACITY - 1;
+
+    static Record ring[CAPACITY];
+    static std::atomic<uint32_t> head;      // Next slot to claim (producers)
+    static uint32_t tail;                   // Next slot to drain (drain task only)
+    static std::atomic<uint32_t> dropped;
+    static uint32_t reported_dropped;       // Drain task only
+    static uint8_t runtime_level;
+
+    static void commit(uint8_t level, const char* format, const LogArg* args, int count);
+    static void format(const Record& record, char* out, size_t capacity);
+
+public:
+    static void begin();
+    static void setLevel(uint8_t level) { runtime_level = level; }
+    static uint8_t getLevel() { return runtime_level; }
+
+    static void write(uint8_t level, const char* format) {
+        commit(level, format, NULL, 0);
+    }
+
+    template <typename... Args>
+    static void write(uint8_t level, const char* format, Args... args) {
+        static_assert(sizeof...(Args) <= MAX_ARGS, "Too many log arguments");
+        const LogArg packed[] = { LogArg(args)... };
+        commit(level, format, packed, sizeof...(Args));
+    }
+
+    static size_t drain(size_t max_records = CAPACITY);  // Formats and prints; returns records printed
+    static uint32_t getDropped() { return dropped.load(std::memory_order_relaxed); }
+};
+
+#endif // LOG_H
@@ -0,0 +1,138 @@
+#include "Metrics.h"
+#include <stdarg.h>
+
+const uint32_t Metrics::BUCKET_LIMITS_US[BUCKET_COUNT] = {
+    1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 50000
+};
+
+const char* const Metrics::STAGE_NAMES[STAGE_COUNT] = {
+    "web_handle_client",
+    "web_stream",
+    "gps_parse",
+    "sensor_update",
+    "mpu_read",
+    "mpu_fifo_drain",
+    "attitude",
+    "sensor_print",
+    "log_drain",
+    "recorder_write",
+    "autopilot",
+    "mission",
+    "telemetry_downlink",
+    "control_uplink",
+};
+
+Metrics::Histogram Metrics::histograms[STAGE_COUNT];
+uint32_t Metrics::bucket_limits_cycles[BUCKET_COUNT];
+uint32_t Metrics::cycles_per_us = 240;
+uint32_t Metrics::scope_overhead_cycles = 0;
+Metrics::TaskEntry Metrics::tasks[MAX_TASKS];
+int Metrics::task_count = 0;
+
+void Metrics::begin() {
+    cycles_per_us = ESP.getCpuFreqMHz();
+    for (int i = 0; i < BUCKET_COUNT; i++) {
+        bucket_limits_cycles[i] = BUCKET_LIMITS_US[i] * cycles_per_us;
+    }
+
+    // Cost of an empty instrumented scope, measured before any task records anything
+    const int runs = 256;
+    uint32_t start = now();
+    for (int i = 0; i < runs; i++) {
+        METRICS_SCOPE(STAGE_SENSOR_PRINT);
+    }
+    scope_overhead_cycles = (now() - start) / runs;
+    memset(histograms, 0, sizeof(histograms));
+}
+
+void Metrics::registerTask(TaskHandle_t handle, const char* name) {
+    if (handle == NULL || task_count >= MAX_TASKS) {
+        return;
+    }
+    tasks[task_count].handle = handle;
+    tasks[task_count].name = name;
+    task_count++;
+}
+
+void Metrics::record(MetricsStage stage, uint32_t cycles) {
+    Histogram& histogram = histograms[stage];
+    int bucket = 0;
+    while (bucket < BUCKET_COUNT && cycles > bucket_limits_cycles[bucket]) {
+        bucket++;
+    }
+    histogram.buckets[bucket]++;
+    histogram.count++;
+    histogram.sum_cycles += cycles;
+    if (cycles > histogram.max_cycles) {
+        histogram.max_cycles = cycles;
+    }
+}
+
+// snprintf that appends and never runs past capacity
+static void append(char* buffer, size_t capacity, size_t& used, const char* format, ...) {
+    if (used + 1 >= capacity) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer + used, capacity - used, format, args);
+    va_end(args);
+    if (length > 0) {
+        used += (size_t)length;
+    }
+    if (used >= capacity) {
+        used = capacity - 1;
+    }
+}
+
+size_t Metrics::writePiece(int piece, char* buffer, size_t capacity) {
+    size_t used = 0;
+    buffer[0] = '\0';
+    double seconds_per_cycle = 1.0 / (cycles_per_us * 1000000.0);
+
+    if (piece == 0) {
+        append(buffer, capacity, used, "# TYPE aleph_uptime_seconds gauge\naleph_uptime_seconds %.3f\n", millis() / 1000.0);
+        append(buffer, capacity, used, "# TYPE aleph_heap_free_bytes gauge\naleph_heap_free_bytes %lu\n",
+               (unsigned long)ESP.getFreeHeap());
+        append(buffer, capacity, used, "# TYPE aleph_heap_min_free_bytes gauge\naleph_heap_min_free_bytes %lu\n",
+               (unsigned long)ESP.getMinFreeHeap());
+        append(buffer, capacity, used, "# TYPE aleph_heap_max_alloc_bytes gauge\naleph_heap_max_alloc_bytes %lu\n",
+               (unsigned long)ESP.getMaxAllocHeap());
+        append(buffer, capacity, used, "# HELP aleph_task_stack_free_min_bytes Stack high-water mark: least free stack seen\n"
+                                       "# TYPE aleph_task_stack_free_min_bytes gauge\n");
+        for (int i = 0; i < task_count; i++) {
+            append(buffer, capacity, used, "aleph_task_stack_free_min_bytes{task=\"%s\"} %lu\n",
+                   tasks[i].name, (unsigned long)uxTaskGetStackHighWaterMark(tasks[i].handle));
+        }
+        append(buffer, capacity, used, "# HELP aleph_metrics_scope_overhead_cycles Cost of one empty instrumented scope\n"
+                                       "# TYPE aleph_metrics_scope_overhead_cycles gauge\naleph_metrics_scope_overhead_cycles %lu\n",
+               (unsigned long)scope_overhead_cycles);
+        append(buffer, capacity, used, "# TYPE aleph_cpu_mhz gauge\naleph_cpu_mhz %lu\n", (unsigned long)cycles_per_us);
+    } else if (piece == 1) {
+        append(buffer, capacity, used, "# HELP aleph_stage_max_seconds Slowest call of each stage since boot\n"
+                                       "# TYPE aleph_stage_max_seconds gauge\n");
+        for (int stage = 0; stage < STAGE_COUNT; stage++) {
+            append(buffer, capacity, used, "aleph_stage_max_seconds{stage=\"%s\"} %.7f\n",
+                   STAGE_NAMES[stage], histograms[stage].max_cycles * seconds_per_cycle);
+        }
+        append(buffer, capacity, used, "# HELP aleph_stage_seconds Time per call of each instrumented stage\n"
+                                       "# TYPE aleph_stage_seconds histogram\n");
+    } else if (piece - 2 < STAGE_COUNT) {
+        int stage = piece - 2;
+        const Histogram& histogram = histograms[stage];
+        const char* name = STAGE_NAMES[stage];
+
+        // The recording task keeps writing; the count is derived from the buckets so the series stays consistent
+        uint32_t cumulative = 0;
+        for (int i = 0; i < BUCKET_COUNT; i++) {
+            cumulative += histogram.buckets[i];
+            append(buffer, capacity, used, "aleph_stage_seconds_bucket{stage=\"%s\",le=\"%g\"} %lu\n",
+                   name, BUCKET_LIMITS_US[i] / 1000000.0, (unsigned long)cumulative);
+        }
+        cumulative += histogram.buckets[BUCKET_COUNT];
+        append(buffer, capacity, used, "aleph_stage_seconds_bucket{stage=\"%s\",le=\"+Inf\"} %lu\n", name, (unsigned long)cumulative);
+        append(buffer, capacity, used, "aleph_stage_seconds_sum{stage=\"%s\"} %.6f\n", name, histogram.sum_cycles * seconds_per_cycle);
+        append(buffer, capacity, used, "aleph_stage_seconds_count{stage=\"%s\"} %lu\n", name, (unsigned long)cumulative);
+    }
+    return used;
+}
@@ -0,0 +1,117 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+// Set to 0 to compile every METRICS_SCOPE out
+#ifndef METRICS_ENABLED
+#define METRICS_ENABLED 1
+#endif
+
+// Instrumented stages. Each stage must only be timed from one task.
+enum MetricsStage : uint8_t {
+    STAGE_WEB_HANDLE_CLIENT,
+    STAGE_WEB_STREAM,
+    STAGE_GPS_PARSE,
+    STAGE_SENSOR_UPDATE,
+    STAGE_MPU_READ,
+    STAGE_MPU_FIFO_DRAIN,
+    STAGE_ATTITUDE,
+    STAGE_SENSOR_PRINT,
+    STAGE_LOG_DRAIN,
+    STAGE_RECORDER_WRITE,
+    STAGE_AUTOPILOT,
+    STAGE_MISSION,
+    STAGE_TELEMETRY_DOWNLINK,
+    STAGE_CONTROL_UPLINK,
+    STAGE_COUNT
+};
+
+#if METRICS_ENABLED
+#define METRICS_CONCAT_(a, b) a##b
+#define METRICS_CONCAT(a, b) METRICS_CONCAT_(a, b)
+#define METRICS_SCOPE(stage) StageTimer METRICS_CONCAT(stage_timer_, __LINE__)(stage)
+#define METRICS_SCOPE_US(stage) MicrosStageTimer METRICS_CONCAT(stage_timer_, __LINE__)(stage)
+#else
+#define METRICS_SCOPE(stage) do {} while (0)
+#define METRICS_SCOPE_US(stage) do {} while (0)
+#endif
+
+// Per-stage call latency from the CPU cycle counter, in fixed log-spaced
+// buckets (Prometheus histogram layout), plus heap and task stack gauges,
+// rendered as Prometheus text for /metrics. Recording is a cycle-counter read
+// at each end of the scope and a short bucket scan; no locks, no floats.
+//
+// The cycle counter is per core, so METRICS_SCOPE only suits code in a task
+// pinned to one core. Stages timed from unpinned tasks (the UART event task
+// behind Serial2.onReceive) use METRICS_SCOPE_US, which reads esp_timer
+// instead: 1 µs resolution, recorded in the same cycle units.
+class Metrics {
+public:
+    static const int BUCKET_COUNT = 14;         // Finite upper bounds; a +Inf bucket follows
+    static const int MAX_TASKS = 8;
+
+private:
+    struct Histogram {
+        uint32_t buckets[BUCKET_COUNT + 1];     // Non-cumulative; the last is +Inf
+        uint32_t count;
+        uint64_t sum_cycles;
+        uint32_t max_cycles;
+    };
+
+    struct TaskEntry {
+        TaskHandle_t handle;
+        const char* name;
+    };
+
+    static const uint32_t BUCKET_LIMITS_US[BUCKET_COUNT];
+    static const char* const STAGE_NAMES[STAGE_COUNT];
+
+    static Histogram histograms[STAGE_COUNT];
+    static uint32_t bucket_limits_cycles[BUCKET_COUNT];
+    static uint32_t cycles_per_us;
+    static uint32_t scope_overhead_cycles;      // Self-measured in begin()
+    static TaskEntry tasks[MAX_TASKS];
+    static int task_count;
+
+public:
+    static void begin();
+    static void registerTask(TaskHandle_t handle, const char* name);   // For stack high-water marks
+
+    static inline uint32_t now() { return ESP.getCycleCount(); }
+    static inline int64_t nowMicros() { return esp_timer_get_time(); }
+    static void record(MetricsStage stage, uint32_t cycles);
+
+    static uint32_t getScopeOverheadCycles() { return scope_overhead_cycles; }
+    static uint32_t getCyclesPerMicro() { return cycles_per_us; }
+
+    // Prometheus text, one piece at a time so the caller can stream it in small chunks.
+    // Piece 0 holds the system gauges, piece 1 the per-stage maxima, then one piece per stage histogram.
+    static int getPieceCount() { return STAGE_COUNT + 2; }
+    static size_t writePiece(int piece, char* buffer, size_t capacity);
+};
+
+// Times its own lifetime into a stage histogram; use through METRICS_SCOPE
+class StageTimer {
+private:
+    const MetricsStage stage;
+    const uint32_t start;
+
+public:
+    explicit StageTimer(MetricsStage stage) : stage(stage), start(Metrics::now()) {}
+    ~StageTimer() { Metrics::record(stage, Metrics::now() - start); }
+};
+
+// As StageTimer, from esp_timer, for tasks that may migrate between cores; use through METRICS_SCOPE_US
+class MicrosStageTimer {
+private:
+    const MetricsStage stage;
+    const int64_t start;
+
+public:
+    explicit MicrosStageTimer(MetricsStage stage) : stage(stage), start(Metrics::nowMicros()) {}
+    ~MicrosStageTimer() { Metrics::record(stage, (uint32_t)(Metrics::nowMicros() - start) * Metrics::getCyclesPerMicro()); }
+};
+
+#endif // METRICS_H
@@ -0,0 +1,240 @@
+#include "MissionEngine.h"
+
+MissionEngine::MissionEngine(SensorModule& sensor_module, ActuatorModule& actuator_module, HeadingController& autopilot)
+    : sensor_module(sensor_module), actuator_module(actuator_module), autopilot(autopilot),
+      waypoint_count(0), state(IDLE), start_pending(false), stop_pending(false),
+      leg(-1), origin_latitude(0.0), origin_longitude(0.0), meters_per_deg_lat(0.0f), meters_per_deg_lon(0.0f),
+      leg_x(0.0f), leg_y(1.0f), leg_length(0.0f), leg_bearing(0.0f),
+      last_fix_count(0), last_fix_ms(0), gps_lost(false),
+      cross_track(0.0f), along_track(0.0f), distance_remaining(0.0f), commanded_heading(0.0f),
+      nav_updates(0), nav_us_total(0), nav_us_max(0), gps_timeouts(0) {
+}
+
+// Parses into out when it is non-NULL; returns the waypoint count or -1
+int MissionEngine::parseWaypoints(const char* text, Waypoint* out, int capacity) {
+    int count = 0;
+    long motor_speed = DEFAULT_MOTOR_SPEED;     // Carried over from the previous line when omitted
+    const char* p = text;
+
+    while (*p) {
+        while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n' || *p == ';') {
+            p++;
+        }
+        if (*p == '\0') {
+            break;
+        }
+        if (*p == '#') {
+            while (*p && *p != '\n') {
+                p++;
+            }
+            continue;
+        }
+
+        char* end;
+        double latitude = strtod(p, &end);
+        if (end == p || *end != ',') {
+            return -1;
+        }
+        p = end + 1;
+        double longitude = strtod(p, &end);
+        if (end == p) {
+            return -1;
+        }
+        p = end;
+        if (*p == ',') {
+            motor_speed = strtol(p + 1, &end, 10);
+            if (end == p + 1) {
+                return -1;
+            }
+            p = end;
+        }
+        while (*p == ' ' || *p == '\t' || *p == '\r') {
+            p++;
+        }
+        if (*p && *p != '\n' && *p != ';' && *p != '#') {
+            return -1;
+        }
+
+        if (latitude < -90.0 || latitude > 90.0 || longitude < -180.0 || longitude > 180.0 || count >= capacity) {
+            return -1;
+        }
+        if (out != NULL) {
+            out[count].latitude = latitude;
+            out[count].longitude = longitude;
+            out[count].motor_speed = constrain(motor_speed, -255L, 255L);
+        }
+        count++;
+    }
+    return count;
+}
+
+int MissionEngine::load(const char* text) {
+    if (state == RUNNING || start_pending) {
+        LOG_WARN("Mission is running, stop it before uploading");
+        return -1;
+    }
+    // Validate everything before touching the current mission
+    int count = parseWaypoints(text, NULL, MAX_WAYPOINTS);
+    if (count < 0) {
+        LOG_WARN("Mission upload rejected: expected up to %d lines of lat,lon[,motor]", MAX_WAYPOINTS);
+        return -1;
+    }
+    parseWaypoints(text, waypoints, MAX_WAYPOINTS);
+    waypoint_count = count;
+    state = IDLE;
+    leg = -1;
+    LOG_INFO("Mission loaded, %d waypoints", count);
+    return count;
+}
+
+bool MissionEngine::start() {
+    if (waypoint_count == 0 || state == RUNNING) {
+        return false;
+    }
+    start_pending = true;
+    return true;
+}
+
+void MissionEngine::stop() {
+    stop_pending = true;
+}
+
+const char* MissionEngine::stateName(State value) {
+    switch (value) {
+        case RUNNING:  return "running";
+        case COMPLETE: return "complete";
+        case ABORTED:  return "aborted";
+        default:       return "idle";
+    }
+}
+
+void MissionEngine::update() {
+    METRICS_SCOPE(STAGE_MISSION);
+    if (stop_pending) {
+        stop_pending = false;
+        start_pending = false;
+        if (state == RUNNING) {
+            finish(ABORTED);
+        }
+        return;
+    }
+    if (start_pending) {
+        start_pending = false;
+        state = RUNNING;
+        leg = -1;               // The first leg starts from wherever the next fix puts the boat
+        gps_lost = false;
+        last_fix_ms = millis();
+        LOG_INFO("Mission started, %d waypoints", waypoint_count);
+    }
+    if (state != RUNNING) {
+        return;
+    }
+
+    // Somebody steered by hand: leave the boat to them
+    if (leg >= 0 && !autopilot.isEngaged()) {
+        LOG_WARN("Autopilot released during the mission, mission aborted");
+        state = ABORTED;
+        return;
+    }
+
+    SensorSnapshot snapshot;
+    sensor_module.getSnapshot(snapshot);
+    const GPSData& fix = snapshot.gps;
+
+    if (fix.fix_count == last_fix_count || !fix.valid) {
+        if (!gps_lost && millis() - last_fix_ms > GPS_TIMEOUT_MS) {
+            gps_lost = true;
+            gps_timeouts++;
+            actuator_module.stopMotor();
+            LOG_WARN("Mission lost GPS, throttle cut until fixes return");
+        }
+        return;
+    }
+    last_fix_count = fix.fix_count;
+    updateFix(fix);
+}
+
+void MissionEngine::updateFix(const GPSData& fix) {
+    if (state != RUNNING) {
+        return;
+    }
+    last_fix_ms = millis();
+    gps_lost = false;
+
+    uint32_t start = micros();
+    if (leg < 0) {
+        beginLeg(0, fix);
+    }
+    navigate(fix);
+
+    uint32_t elapsed = micros() - start;
+    nav_updates++;
+    nav_us_total += elapsed;
+    if (elapsed > nav_us_max) {
+        nav_us_max = elapsed;
+    }
+}
+
+// The only double-precision and transcendental work per leg
+void MissionEngine::beginLeg(int index, const GPSData& fix) {
+    leg = index;
+    if (index == 0) {
+        origin_latitude = fix.latitude;
+        origin_longitude = fix.longitude;
+    } else {
+        origin_latitude = waypoints[index - 1].latitude;
+        origin_longitude = waypoints[index - 1].longitude;
+    }
+    meters_per_deg_lat = METERS_PER_DEG_LAT;
+    meters_per_deg_lon = METERS_PER_DEG_LAT * cos(origin_latitude * DEG_TO_RAD);
+
+    const Waypoint& target = waypoints[index];
+    float x = (float)(target.longitude - origin_longitude) * meters_per_deg_lon;
+    float y = (float)(target.latitude - origin_latitude) * meters_per_deg_lat;
+    leg_length = sqrtf(x * x + y * y);
+    if (leg_length > 0.01f) {
+        leg_x = x / leg_length;
+        leg_y = y / leg_length;
+    } else {
+        leg_x = 0.0f;
+        leg_y = 1.0f;
+    }
+    leg_bearing = HeadingController::wrapHeading(atan2f(leg_x, leg_y) * RAD_TO_DEG);
+
+    LOG_INFO("Mission leg %d: %.0f m at %.0f°", index, leg_length, leg_bearing);
+}
+
+void MissionEngine::navigate(const GPSData& fix) {
+    for (;;) {
+        float x = (float)(fix.longitude - origin_longitude) * meters_per_deg_lon;
+        float y = (float)(fix.latitude - origin_latitude) * meters_per_deg_lat;
+        along_track = x * leg_x + y * leg_y;
+        cross_track = x * leg_y - y * leg_x;
+        distance_remaining = leg_length - along_track;
+
+        // Crossing the line through the waypoint, square to the leg, counts as arrival
+        if (distance_remaining > ACCEPTANCE_RADIUS) {
+            break;
+        }
+        if (leg + 1 >= waypoint_count) {
+            finish(COMPLETE);
+            return;
+        }
+        beginLeg(leg + 1, fix);
+    }
+
+    commanded_heading = HeadingController::wrapHeading(leg_bearing - atanf(cross_track / LOOKAHEAD) * RAD_TO_DEG);
+    autopilot.engage(commanded_heading);
+
+    int motor_speed = waypoints[leg].motor_speed;
+    if (motor_speed != actuator_module.getTargetMotorSpeed()) {
+        actuator_module.setMotorSpeed(motor_speed);
+    }
+}
+
+void MissionEngine::finish(State final_state) {
+    actuator_module.stopMotor();
+    autopilot.disengage();
+    state = final_state;
+    LOG_INFO("Mission %s at leg %d", stateName(final_state), leg);
+}
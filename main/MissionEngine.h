@@ -0,0 +1,113 @@
+#ifndef MISSION_ENGINE_H
+#define MISSION_ENGINE_H
+
+#include <Arduino.h>
+#include "SensorModule.h"
+#include "ActuatorModule.h"
+#include "HeadingController.h"
+#include "Log.h"
+#include "Metrics.h"
+
+struct Waypoint {
+    double latitude;
+    double longitude;
+    int16_t motor_speed;        // Throttle on the leg toward this waypoint, -255..255
+};
+
+// Line-following waypoint missions. Each leg is flattened once, when it starts,
+// into a local tangent plane centred on its first waypoint: per GPS fix the
+// position is two scaled differences from that origin and the cross-track and
+// along-track distances are a cross and a dot product in float. Steering goes
+// through HeadingController (line-of-sight toward a point LOOKAHEAD metres down
+// the leg) and throttle through ActuatorModule.
+//
+// Missions are uploaded and started from the web task and run from the
+// autopilot task: the waypoint list is only written while the mission is idle
+// and start/stop requests are handed over as flags.
+class MissionEngine {
+public:
+    enum State : uint8_t { IDLE, RUNNING, COMPLETE, ABORTED };
+
+    static const int MAX_WAYPOINTS = 64;
+
+private:
+    SensorModule& sensor_module;
+    ActuatorModule& actuator_module;
+    HeadingController& autopilot;
+
+    Waypoint waypoints[MAX_WAYPOINTS];
+    int waypoint_count;
+
+    volatile State state;
+    volatile bool start_pending;
+    volatile bool stop_pending;
+
+    // Current leg, in the leg's tangent plane (metres, x east, y north)
+    int leg;                    // Index of the waypoint being steered to
+    double origin_latitude;
+    double origin_longitude;
+    float meters_per_deg_lat;
+    float meters_per_deg_lon;
+    float leg_x;                // Unit vector along the leg
+    float leg_y;
+    float leg_length;
+    float leg_bearing;          // degrees true
+
+    // Guidance output (autopilot task)
+    uint32_t last_fix_count;
+    uint32_t last_fix_ms;
+    bool gps_lost;
+    float cross_track;          // m, positive right of the leg
+    float along_track;          // m from the leg start
+    float distance_remaining;   // m to the active waypoint, along the leg
+    float commanded_heading;
+
+    // Statistics
+    uint32_t nav_updates;
+    uint32_t nav_us_total;
+    uint32_t nav_us_max;
+    uint32_t gps_timeouts;
+
+    static const uint32_t GPS_TIMEOUT_MS = 3000;            // Throttle cut until fixes return
+    static constexpr float ACCEPTANCE_RADIUS = 5.0f;        // m
+    static constexpr float LOOKAHEAD = 15.0f;               // m; shorter tracks the line harder
+    static constexpr double METERS_PER_DEG_LAT = 111320.0;
+    static const int DEFAULT_MOTOR_SPEED = 128;
+
+    static int parseWaypoints(const char* text, Waypoint* out, int capacity);
+
+    void beginLeg(int index, const GPSData& fix);
+    void navigate(const GPSData& fix);
+    void finish(State final_state);
+
+public:
+    MissionEngine(SensorModule& sensor_module, ActuatorModule& actuator_module, HeadingController& autopilot);
+
+    // "lat,lon[,motor]" per line (or ';'-separated); '#' starts a comment. An omitted
+    // motor speed repeats the previous line's (DEFAULT_MOTOR_SPEED for the first).
+    // Returns the number of waypoints loaded, or -1 (mission unchanged) on a parse error or while running.
+    int load(const char* text);
+    bool start();               // From waypoint 0; steering begins on the next GPS fix
+    void stop();                // Cuts the throttle and releases the autopilot
+    void update();              // Call from the autopilot task, before HeadingController::update()
+    void updateFix(const GPSData& fix);     // Steers from one new fix; update() calls it, replays and benchmarks may too
+
+    State getState() const { return state; }
+    static const char* stateName(State value);
+    int getWaypointCount() const { return waypoint_count; }
+    const Waypoint& getWaypoint(int index) const { return waypoints[index]; }
+    int getLeg() const { return leg; }
+    bool isGPSLost() const { return gps_lost; }
+    float getCrossTrack() const { return cross_track; }
+    float getAlongTrack() const { return along_track; }
+    float getDistanceRemaining() const { return distance_remaining; }
+    float getLegBearing() const { return leg_bearing; }
+    float getCommandedHeading() const { return commanded_heading; }
+
+    uint32_t getNavUpdates() const { return nav_updates; }
+    uint32_t getNavMicrosAverage() const { return nav_updates > 0 ? nav_us_total / nav_updates : 0; }
+    uint32_t getNavMicrosMax() const { return nav_us_max; }
+    uint32_t getGPSTimeouts() const { return gps_timeouts; }
+};
+
+#endif // MISSION_ENGINE_H
@@ -0,0 +1,235 @@
+#include "NavigationFilter.h"
+
+static const double METERS_PER_DEG_LAT = 111320.0;
+static const float KNOTS_TO_MPS = 0.514444f;
+
+NavigationFilter::NavigationFilter()
+    : accel_sigma(0.5f), bias_sigma(0.01f), gps_position_sigma(3.0f),
+      gps_velocity_sigma(0.3f), baro_sigma(0.5f) {
+    reset();
+}
+
+void NavigationFilter::reset() {
+    for (int i = 0; i < 3; i++) {
+        resetAxis(axes[i], 0.0f, 1e4f, 1e2f);
+    }
+    origin_set = false;
+    origin_latitude = 0.0;
+    origin_longitude = 0.0;
+    meters_per_deg_lat = METERS_PER_DEG_LAT;
+    meters_per_deg_lon = METERS_PER_DEG_LAT;
+    baro_set = false;
+
+    heading_aligned = false;
+    heading_offset = 0.0f;
+    cos_offset = 1.0f;
+    sin_offset = 0.0f;
+
+    last_timestamp_us = 0;
+    last_fix_count = 0;
+    predict_count = 0;
+    gps_update_count = 0;
+    baro_update_count = 0;
+}
+
+void NavigationFilter::resetAxis(Axis& axis, float position, float position_var, float velocity_var) {
+    axis.x[POS] = position;
+    axis.x[VEL] = 0.0f;
+    axis.x[BIAS] = 0.0f;
+    for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 3; c++) {
+            axis.P[r][c] = 0.0f;
+        }
+    }
+    axis.P[POS][POS] = position_var;
+    axis.P[VEL][VEL] = velocity_var;
+    axis.P[BIAS][BIAS] = 0.25f;
+}
+
+// ==================== PREDICTION (IMU RATE) ====================
+
+void NavigationFilter::predict(const ImuSample& sample, const AttitudeEstimator& attitude) {
+    uint32_t dt_us = sample.timestamp_us - last_timestamp_us;
+    last_timestamp_us = sample.timestamp_us;
+    if (!origin_set || !attitude.isInitialized() || dt_us == 0 || dt_us > MAX_DT_US) {
+        return;
+    }
+    float dt = dt_us * 1e-6f;
+
+    // Rotate specific force into the attitude frame (z up): a_e = R(q) a_s
+    float q0, q1, q2, q3;
+    attitude.getQuaternion(q0, q1, q2, q3);
+    float ax = sample.accel_x;
+    float ay = sample.accel_y;
+    float az = sample.accel_z;
+
+    float ex = (1.0f - 2.0f * (q2 * q2 + q3 * q3)) * ax + 2.0f * (q1 * q2 - q0 * q3) * ay + 2.0f * (q1 * q3 + q0 * q2) * az;
+    float ey = 2.0f * (q1 * q2 + q0 * q3) * ax + (1.0f - 2.0f * (q1 * q1 + q3 * q3)) * ay + 2.0f * (q2 * q3 - q0 * q1) * az;
+    float ez = 2.0f * (q1 * q3 - q0 * q2) * ax + 2.0f * (q2 * q3 + q0 * q1) * ay + (1.0f - 2.0f * (q1 * q1 + q2 * q2)) * az;
+
+    // Horizontal acceleration only feeds north/east once yaw is tied to true north
+    if (heading_aligned) {
+        predictAxis(axes[NORTH], cos_offset * ex + sin_offset * ey, dt);
+        predictAxis(axes[EAST], sin_offset * ex - cos_offset * ey, dt);
+    } else {
+        predictAxis(axes[NORTH], 0.0f, dt);
+        predictAxis(axes[EAST], 0.0f, dt);
+    }
+    predictAxis(axes[UP], ez - GRAVITY, dt);
+
+    predict_count++;
+}
+
+// x' = F x with F = [1 dt -dt²/2; 0 1 -dt; 0 0 1], P' = F P Fᵀ + Q
+void NavigationFilter::predictAxis(Axis& axis, float accel, float dt) {
+    float half_dt2 = 0.5f * dt * dt;
+    float a = accel - axis.x[BIAS];
+
+    axis.x[POS] += axis.x[VEL] * dt + a * half_dt2;
+    axis.x[VEL] += a * dt;
+
+    float F[3][3] = {
+        { 1.0f, dt,   -half_dt2 },
+        { 0.0f, 1.0f, -dt       },
+        { 0.0f, 0.0f, 1.0f      },
+    };
+
+    float FP[3][3];
+    for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 3; c++) {
+            FP[r][c] = F[r][0] * axis.P[0][c] + F[r][1] * axis.P[1][c] + F[r][2] * axis.P[2][c];
+        }
+    }
+    for (int r = 0; r < 3; r++) {
+        for (int c = r; c < 3; c++) {
+            float value = FP[r][0] * F[c][0] + FP[r][1] * F[c][1] + FP[r][2] * F[c][2];
+            axis.P[r][c] = value;
+            axis.P[c][r] = value;
+        }
+    }
+
+    // Acceleration noise enters through G = [dt²/2, dt, 0], bias as a random walk
+    float qa = accel_sigma * accel_sigma;
+    float g0 = half_dt2;
+    float g1 = dt;
+    axis.P[POS][POS] += g0 * g0 * qa;
+    axis.P[POS][VEL] += g0 * g1 * qa;
+    axis.P[VEL][POS] += g0 * g1 * qa;
+    axis.P[VEL][VEL] += g1 * g1 * qa;
+    axis.P[BIAS][BIAS] += bias_sigma * bias_sigma * dt;
+}
+
+// ==================== CORRECTION ====================
+
+// Scalar measurement of one state (H = e_state): the error-state correction is
+// injected straight into the nominal state and the error is reset to zero
+void NavigationFilter::correctAxis(Axis& axis, int state, float measurement, float variance) {
+    float S = axis.P[state][state] + variance;
+    if (S <= 0.0f) {
+        return;
+    }
+
+    float K[3];
+    for (int r = 0; r < 3; r++) {
+        K[r] = axis.P[r][state] / S;
+    }
+
+    float innovation = measurement - axis.x[state];
+    for (int r = 0; r < 3; r++) {
+        axis.x[r] += K[r] * innovation;
+    }
+
+    float row[3] = { axis.P[state][0], axis.P[state][1], axis.P[state][2] };
+    for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 3; c++) {
+            axis.P[r][c] -= K[r] * row[c];
+        }
+    }
+}
+
+void NavigationFilter::updateGPS(const GPSData& fix, const AttitudeEstimator& attitude) {
+    if (!fix.valid || fix.fix_count == last_fix_count) {
+        return;  // Only fuse each fix once
+    }
+    last_fix_count = fix.fix_count;
+
+    if (!origin_set) {
+        origin_latitude = fix.latitude;
+        origin_longitude = fix.longitude;
+        meters_per_deg_lat = METERS_PER_DEG_LAT;
+        meters_per_deg_lon = METERS_PER_DEG_LAT * cos(origin_latitude * DEG_TO_RAD);
+        resetAxis(axes[NORTH], 0.0f, gps_position_sigma * gps_position_sigma, 1.0f);
+        resetAxis(axes[EAST], 0.0f, gps_position_sigma * gps_position_sigma, 1.0f);
+        origin_set = true;
+        gps_update_count++;
+        return;
+    }
+
+    float north = (float)((fix.latitude - origin_latitude) * meters_per_deg_lat);
+    float east = (float)((fix.longitude - origin_longitude) * meters_per_deg_lon);
+    float position_var = gps_position_sigma * gps_position_sigma;
+    correctAxis(axes[NORTH], POS, north, position_var);
+    correctAxis(axes[EAST], POS, east, position_var);
+
+    if (!fix.velocity_valid) {
+        gps_update_count++;
+        return;     // No RMC yet: position only
+    }
+    float speed = fix.speed * KNOTS_TO_MPS;
+    float course = fix.course * (float)DEG_TO_RAD;
+    float velocity_var = gps_velocity_sigma * gps_velocity_sigma;
+    correctAxis(axes[NORTH], VEL, speed * cosf(course), velocity_var);
+    correctAxis(axes[EAST], VEL, speed * sinf(course), velocity_var);
+
+    if (speed >= ALIGN_MIN_SPEED && attitude.isInitialized()) {
+        float roll, pitch, yaw;
+        attitude.getEuler(roll, pitch, yaw);
+        alignHeading(fix.course, yaw);
+    }
+
+    gps_update_count++;
+}
+
+// Assumes the sensor x axis points at the bow and the hull tracks its course
+// over ground; the offset is low-pass filtered to ride out leeway and waves
+void NavigationFilter::alignHeading(float course_deg, float yaw_deg) {
+    float measured = (course_deg + yaw_deg) * (float)DEG_TO_RAD;
+
+    if (!heading_aligned) {
+        heading_offset = measured;
+        heading_aligned = true;
+    } else {
+        float error = measured - heading_offset;
+        while (error > PI) error -= 2.0f * PI;
+        while (error < -PI) error += 2.0f * PI;
+        heading_offset += 0.2f * error;
+    }
+
+    cos_offset = cosf(heading_offset);
+    sin_offset = sinf(heading_offset);
+}
+
+void NavigationFilter::updateBaro(float altitude) {
+    if (!baro_set) {
+        resetAxis(axes[UP], altitude, baro_sigma * baro_sigma, 0.1f);
+        baro_set = true;
+        return;
+    }
+    correctAxis(axes[UP], POS, altitude, baro_sigma * baro_sigma);
+    baro_update_count++;
+}
+
+void NavigationFilter::getState(NavigationState& out) const {
+    out.valid = origin_set;
+    out.heading_aligned = heading_aligned;
+    out.north = axes[NORTH].x[POS];
+    out.east = axes[EAST].x[POS];
+    out.up = axes[UP].x[POS];
+    out.vel_north = axes[NORTH].x[VEL];
+    out.vel_east = axes[EAST].x[VEL];
+    out.vel_up = axes[UP].x[VEL];
+    out.altitude = out.up;
+    out.latitude = origin_latitude + out.north / meters_per_deg_lat;
+    out.longitude = origin_longitude + out.east / meters_per_deg_lon;
+    out.position_sigma = sqrtf(axes[NORTH].P[POS][POS] + axes[EAST].P[POS][POS]);
+}
@@ -0,0 +1,95 @@
+#ifndef NAVIGATION_FILTER_H
+#define NAVIGATION_FILTER_H
+
+#include <Arduino.h>
+#include "ImuRingBuffer.h"
+#include "AttitudeEstimator.h"
+#include "GPSData.h"
+
+// Fused position/velocity estimate, published at IMU rate
+struct NavigationState {
+    bool valid;                 // A GPS origin has been set
+    bool heading_aligned;       // IMU yaw has been aligned to true north from GPS course
+    double latitude;
+    double longitude;
+    float altitude;             // m, barometric
+    float north;                // m from the origin (first GPS fix)
+    float east;
+    float up;
+    float vel_north;            // m/s
+    float vel_east;
+    float vel_up;
+    float position_sigma;       // 1-sigma horizontal position uncertainty, m
+};
+
+// Error-state Kalman filter fusing IMU acceleration (rotated by AttitudeEstimator),
+// GPS position/velocity and barometric altitude in a local north-east-up frame.
+//
+// With the accelerometer bias modelled in the navigation frame the 9-state
+// model separates exactly into three independent [position, velocity, bias]
+// axes, so each axis runs a fixed 3x3 kernel and every measurement is a
+// scalar update: no matrix inversion and no heap.
+class NavigationFilter {
+private:
+    struct Axis {
+        float x[3];             // Nominal position, velocity, accel bias
+        float P[3][3];          // Error-state covariance
+    };
+
+    enum { NORTH = 0, EAST = 1, UP = 2 };
+    enum { POS = 0, VEL = 1, BIAS = 2 };
+
+    Axis axes[3];
+
+    // Local tangent plane origin
+    bool origin_set;
+    double origin_latitude;
+    double origin_longitude;
+    double meters_per_deg_lat;
+    double meters_per_deg_lon;
+    bool baro_set;
+
+    // Rotation from the AttitudeEstimator frame (arbitrary yaw) to north/east
+    bool heading_aligned;
+    float heading_offset;       // rad, compass heading = offset - IMU yaw
+    float cos_offset;
+    float sin_offset;
+
+    uint32_t last_timestamp_us;
+    uint32_t last_fix_count;
+
+    // Tuning (standard deviations)
+    float accel_sigma;          // m/s²
+    float bias_sigma;           // m/s² per sqrt(s)
+    float gps_position_sigma;   // m
+    float gps_velocity_sigma;   // m/s
+    float baro_sigma;           // m
+
+    uint32_t predict_count;
+    uint32_t gps_update_count;
+    uint32_t baro_update_count;
+
+    static const uint32_t MAX_DT_US = 100000;
+    static constexpr float GRAVITY = 9.80665f;
+    static constexpr float ALIGN_MIN_SPEED = 1.0f;   // m/s before GPS course is trusted for heading
+
+    void resetAxis(Axis& axis, float position, float position_var, float velocity_var);
+    void predictAxis(Axis& axis, float accel, float dt);
+    void correctAxis(Axis& axis, int state, float measurement, float variance);
+    void alignHeading(float course_deg, float yaw_deg);
+
+public:
+    NavigationFilter();
+
+    void reset();
+    void predict(const ImuSample& sample, const AttitudeEstimator& attitude);
+    void updateGPS(const GPSData& fix, const AttitudeEstimator& attitude);
+    void updateBaro(float altitude);
+
+    void getState(NavigationState& out) const;
+    uint32_t getPredictCount() const { return predict_count; }
+    uint32_t getGPSUpdateCount() const { return gps_update_count; }
+    uint32_t getBaroUpdateCount() const { return baro_update_count; }
+};
+
+#endif // NAVIGATION_FILTER_H
@@ -0,0 +1,69 @@
+#include "NmeaBenchmark.h"
+
+NmeaBenchmark::NmeaBenchmark(SensorModule& sensor_module)
+    : sensor_module(sensor_module) {
+}
+
+void NmeaBenchmark::run(uint16_t passes) {
+    if (passes == 0) {
+        passes = 1;
+    }
+    LOG_INFO("NMEA benchmark: %d corpora, %u passes each, %u-byte chunks",
+             NMEA_CORPUS_COUNT, (unsigned)passes, (unsigned)CHUNK_BYTES);
+    for (int i = 0; i < NMEA_CORPUS_COUNT; i++) {
+        runCorpus(NMEA_CORPORA[i], passes);
+    }
+    sensor_module.resetGPS();
+}
+
+void NmeaBenchmark::runCorpus(const NmeaCorpus& corpus, uint16_t passes) {
+    sensor_module.resetGPS();
+
+    uint32_t chunk_us_max = 0;
+    uint32_t start = micros();
+    for (uint16_t pass = 0; pass < passes; pass++) {
+        for (size_t offset = 0; offset < corpus.length; offset += CHUNK_BYTES) {
+            size_t length = corpus.length - offset < CHUNK_BYTES ? corpus.length - offset : CHUNK_BYTES;
+            uint32_t chunk_start = micros();
+            if (corpus.protocol == CORPUS_UBX) {
+                sensor_module.injectUBX((const uint8_t*)corpus.text + offset, length);
+            } else {
+                sensor_module.injectNMEA(corpus.text + offset, length);
+            }
+            uint32_t chunk_us = micros() - chunk_start;
+            if (chunk_us > chunk_us_max) {
+                chunk_us_max = chunk_us;
+            }
+        }
+    }
+    uint32_t elapsed_us = micros() - start;
+    if (elapsed_us == 0) {
+        elapsed_us = 1;
+    }
+
+    uint32_t chars, passed, failed;
+    sensor_module.getGPSParserStats(chars, passed, failed);
+    GPSData fix;
+    sensor_module.getGPSData(fix);
+
+    float seconds = elapsed_us / 1000000.0f;
+    LOG_INFO("NMEA %s: %lu chars/s, %lu sentences/s, %.1f us/fix, %.0f ns/char, worst chunk %lu us",
+             corpus.name, (unsigned long)(chars / seconds), (unsigned long)((passed + failed) / seconds),
+             fix.fix_count > 0 ? (float)elapsed_us / fix.fix_count : 0.0f,
+             chars > 0 ? elapsed_us * 1000.0f / chars : 0.0f, (unsigned long)chunk_us_max);
+
+    bool expected = passed == corpus.sentences_passed * passes &&
+                    failed == corpus.sentences_failed * passes &&
+                    fix.fix_count == corpus.fixes * passes;
+    if (expected) {
+        LOG_INFO("NMEA %s: %lu passed, %lu failed, %lu fixes per pass, as expected",
+                 corpus.name, (unsigned long)(passed / passes), (unsigned long)(failed / passes),
+                 (unsigned long)(fix.fix_count / passes));
+    } else {
+        LOG_WARN("NMEA %s: got %lu/%lu/%lu passed/failed/fixes over %u passes",
+                 corpus.name, (unsigned long)passed, (unsigned long)failed, (unsigned long)fix.fix_count, (unsigned)passes);
+        LOG_WARN("NMEA %s: the corpus generator expects %lu/%lu/%lu per pass",
+                 corpus.name, (unsigned long)corpus.sentences_passed, (unsigned long)corpus.sentences_failed,
+                 (unsigned long)corpus.fixes);
+    }
+}
@@ -0,0 +1,37 @@
+#ifndef NMEA_BENCHMARK_H
+#define NMEA_BENCHMARK_H
+
+#include <Arduino.h>
+#include "SensorModule.h"
+#include "NmeaCorpus.h"
+#include "Log.h"
+
+// Set to 1 to replay the NMEA and UBX corpora at boot and log parser throughput
+#ifndef NMEA_BENCHMARK_ENABLED
+#define NMEA_BENCHMARK_ENABLED 0
+#endif
+
+// Replays every corpus in NmeaCorpus.h (see tools/embed_nmea_corpus.py)
+// through SensorModule's NMEA or UBX path, the same parse-and-publish code
+// the UART callback runs. Input arrives in UART-sized chunks. For each corpus it
+// logs characters/s, sentences/s, time per fix and the slowest chunk, and
+// checks the sentence and fix counts against the corpus generator's.
+// These numbers are the baseline for judging parser changes.
+//
+// run() must finish before SensorModule::begin() starts the UART callback,
+// and it resets the GPS state when done.
+class NmeaBenchmark {
+private:
+    SensorModule& sensor_module;
+
+    static const size_t CHUNK_BYTES = 120;      // Roughly what one UART RX event delivers
+
+    void runCorpus(const NmeaCorpus& corpus, uint16_t passes);
+
+public:
+    explicit NmeaBenchmark(SensorModule& sensor_module);
+
+    void run(uint16_t passes = 10);
+};
+
+#endif // NMEA_BENCHMARK_H
@@ -0,0 +1,1109 @@
+// Generated by tools/embed_nmea_corpus.py from tools/nmea/*.nmea -- do not edit.
+#ifndef NMEA_CORPUS_H
+#define NMEA_CORPUS_H
+
+#include <Arduino.h>
+
+enum NmeaCorpusProtocol : uint8_t { CORPUS_NMEA, CORPUS_UBX };
+
+// One replayable receiver stream and what the parser should make of one pass over it
+struct NmeaCorpus {
+    const char* name;
+    NmeaCorpusProtocol protocol;
+    const char* text;
+    size_t length;
+    uint32_t sentences_passed;     // Sentences or UBX messages with a verified checksum
+    uint32_t sentences_failed;     // Checksum present but wrong
+    uint32_t fixes;                // Epochs that update the position: RMC/GGA time or UBX epoch
+};
+
+static const char NMEA_CORPUS_0[] PROGMEM =
+    "$GPTXT,01,01,02,u-blox ag - www.u-blox.com*50\r\n"
+    "$GPTXT,01,01,02,HW  UBX-G60xx  00040007 FF7FFFFFp*53\r\n"
+    "$GPTXT,01,01,02,ROM CORE 7.03 (45969) Mar 17 2011 16:18:34*59\r\n"
+    "$GPTXT,01,01,02,ANTSUPERV=AC SD PDoS SR*20\r\n"
+    "$GPTXT,01,01,02,ANTSTATUS=DONTKNOW*33\r\n"
+    "$GPRMC,120700.00,V,,,,,,,160126,,,N*7B\r\n"
+    "$GPVTG,,,,,,,,,N*30\r\n"
+    "$GPGGA,120700.00,,,,,0,00,99.99,,,,,,*62\r\n"
+    "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+    "$GPGSV,1,1,04,02,45,123,,05,60,045,,12,22,300,,14,15,200,*7F\r\n"
+    "$GPGLL,,,,,120700.00,V,N*4E\r\n"
+    "$GPRMC,120701.00,V,,,,,,,160126,,,N*7A\r\n"
+    "$GPVTG,,,,,,,,,N*30\r\n"
+    "$GPGGA,120701.00,,,,,0,01,99.99,,,,,,*62\r\n"
+    "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+    "$GPGSV,1,1,04,02,45,123,,05,60,045,,12,22,300,,14,15,200,*7F\r\n"
+    "$GPGLL,,,,,120701.00,V,N*4F\r\n"
+    "$GPRMC,120702.00,V,,,,,,,160126,,,N*79\r\n"
+    "$GPVTG,,,,,,,,,N*30\r\n"
+    "$GPGGA,120702.00,,,,,0,02,99.99,,,,,,*62\r\n"
+    "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+    "$GPGSV,1,1,04,02,45,123,,05,60,045,,12,22,300,,14,15,200,*7F\r\n"
+    "$GPGLL,,,,,120702.00,V,N*4C\r\n"
+    "$GPRMC,120703.00,V,,,,,,,160126,,,N*78\r\n"
+    "$GPVTG,,,,,,,,,N*30\r\n"
+    "$GPGGA,120703.00,,,,,0,03,99.99,,,,,,*62\r\n"
+    "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+    "$GPGSV,1,1,04,02,45,123,,05,60,045,,12,22,300,,14,15,200,*7F\r\n"
+    "$GPGLL,,,,,120703.00,V,N*4D\r\n"
+    "$GPRMC,120704.00,V,,,,,,,160126,,,N*7F\r\n"
+    "$GPVTG,,,,,,,,,N*30\r\n"
+    "$GPGGA,120704.00,,,,,0,03,99.99,,,,,,*65\r\n"
+    "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+    "$GPGSV,1,1,04,02,45,123,13,05,60,045,19,12,22,300,16,14,15,200,12*71\r\n"
+    "$GPGLL,,,,,120704.00,V,N*4A\r\n"
+    "$GPRMC,120705.00,V,,,,,,,160126,,,N*7E\r\n"
+    "$GPVTG,,,,,,,,,N*30\r\n"
+    "$GPGGA,120705.00,,,,,0,03,99.99,,,,,,*64\r\n"
+    "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+    "$GPGSV,1,1,04,02,45,123,12,05,60,045,14,12,22,300,19,14,15,200,17*77\r\n"
+    "$GPGLL,,,,,120705.00,V,N*4B\r\n"
+    "$GPRMC,120706.00,V,,,,,,,160126,,,N*7D\r\n"
+    "$GPVTG,,,,,,,,,N*30\r\n"
+    "$GPGGA,120706.00,,,,,0,03,99.99,,,,,,*67\r\n"
+    "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+    "$GPGSV,1,1,04,02,45,123,17,05,60,045,12,12,22,300,16,14,15,200,19*75\r\n"
+    "$GPGLL,,,,,120706.00,V,N*48\r\n"
+    "$GPRMC,120707.00,V,,,,,,,160126,,,N*7C\r\n"
+    "$GPVTG,,,,,,,,,N*30\r\n"
+    "$GPGGA,120707.00,,,,,0,03,99.99,,,,,,*66\r\n"
+    "$GPGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99*30\r\n"
+    "$GPGSV,1,1,04,02,45,123,15,05,60,045,18,12,22,300,20,14,15,200,20*72\r\n"
+    "$GPGLL,,,,,120707.00,V,N*49\r\n"
+    "$GPRMC,120708.00,A,3432.65818,S,05826.39447,W,0.256,95.59,160126,,,A*5E\r\n"
+    "$GPVTG,95.59,T,,M,0.256,N,0.474,K,A*0B\r\n"
+    "$GPGGA,120708.00,3432.65818,S,05826.39447,W,1,07,1.39,11.4,M,16.0,M,,*60\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,,,,,,2.21,1.21,1.71*09\r\n"
+    "$GPGSV,3,1,11,02,45,123,20,05,60,045,31,12,22,300,28,14,15,200,20*71\r\n"
+    "$GPGSV,3,2,11,25,71,010,29,29,33,250,31,31,08,160,26,21,12,080,32*7D\r\n"
+    "$GPGSV,3,3,11,26,40,310,40,16,05,020,21,18,28,095,42*45\r\n"
+    "$GPGLL,3432.65818,S,05826.39447,W,120708.00,A,A*6A\r\n"
+    "$GPRMC,120709.00,A,3432.65770,S,05826.39295,W,0.094,,160126,,,A*75\r\n"
+    "$GPVTG,,T,,M,0.094,N,0.175,K,A*2D\r\n"
+    "$GPGGA,120709.00,3432.65770,S,05826.39295,W,1,07,1.12,13.2,M,16.0,M,,*64\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,,,,,,2.26,1.21,1.71*0E\r\n"
+    "$GPGSV,3,1,11,02,45,123,38,05,60,045,29,12,22,300,33,14,15,200,24*7F\r\n"
+    "$GPGSV,3,2,11,25,71,010,34,29,33,250,36,31,08,160,38,21,12,080,40*7C\r\n"
+    "$GPGSV,3,3,11,26,40,310,34,16,05,020,18,18,28,095,38*41\r\n"
+    "$GPGLL,3432.65770,S,05826.39295,W,120709.00,A,A*63\r\n"
+    "$GPRMC,120710.00,A,3432.65857,S,05826.39319,W,0.067,,160126,,,A*7E\r\n"
+    "$GPVTG,,T,,M,0.067,N,0.124,K,A*25\r\n"
+    "$GPGGA,120710.00,3432.65857,S,05826.39319,W,1,07,1.33,12.6,M,16.0,M,,*65\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,,,,,,2.06,1.21,1.71*0C\r\n"
+    "$GPGSV,3,1,11,02,45,123,21,05,60,045,37,12,22,300,39,14,15,200,26*70\r\n"
+    "$GPGSV,3,2,11,25,71,010,27,29,33,250,41,31,08,160,24,21,12,080,30*74\r\n"
+    "$GPGSV,3,3,11,26,40,310,33,16,05,020,25,18,28,095,22*43\r\n"
+    "$GPGLL,3432.65857,S,05826.39319,W,120710.00,A,A*64\r\n"
+    "$GPRMC,120711.00,A,3432.65900,S,05826.39485,W,0.130,67.95,160126,,,A*5E\r\n"
+    "$GPVTG,67.95,T,,M,0.130,N,0.240,K,A*04\r\n"
+    "$GPGGA,120711.00,3432.65900,S,05826.39485,W,1,07,1.10,11.3,M,16.0,M,,*62\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,,,,,,2.00,1.21,1.71*0A\r\n"
+    "$GPGSV,3,1,11,02,45,123,38,05,60,045,28,12,22,300,35,14,15,200,39*74\r\n"
+    "$GPGSV,3,2,11,25,71,010,37,29,33,250,37,31,08,160,27,21,12,080,29*7F\r\n"
+    "$GPGSV,3,3,11,26,40,310,30,16,05,020,34,18,28,095,30*43\r\n"
+    "$GPGLL,3432.65900,S,05826.39485,W,120711.00,A,A*64\r\n"
+    "$GPRMC,120712.00,A,3432.65824,S,05826.39285,W,0.096,,160126,,,A*72\r\n"
+    "$GPVTG,,T,,M,0.096,N,0.177,K,A*2D\r\n"
+    "$GPGGA,120712.00,3432.65824,S,05826.39285,W,1,07,1.25,11.8,M,16.0,M,,*6D\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,,,,,,2.03,1.21,1.71*09\r\n"
+    "$GPGSV,3,1,11,02,45,123,32,05,60,045,25,12,22,300,20,14,15,200,37*79\r\n"
+    "$GPGSV,3,2,11,25,71,010,39,29,33,250,32,31,08,160,32,21,12,080,30*78\r\n"
+    "$GPGSV,3,3,11,26,40,310,20,16,05,020,34,18,28,095,31*43\r\n"
+    "$GPGLL,3432.65824,S,05826.39285,W,120712.00,A,A*66\r\n"
+    "$GPRMC,120713.00,A,3432.65899,S,05826.39378,W,0.053,,160126,,,A*7F\r\n"
+    "$GPVTG,,T,,M,0.053,N,0.099,K,A*25\r\n"
+    "$GPGGA,120713.00,3432.65899,S,05826.39378,W,1,07,1.17,11.9,M,16.0,M,,*69\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,,,,,,2.14,1.21,1.71*0F\r\n"
+    "$GPGSV,3,1,11,02,45,123,33,05,60,045,41,12,22,300,23,14,15,200,18*74\r\n"
+    "$GPGSV,3,2,11,25,71,010,18,29,33,250,35,31,08,160,21,21,12,080,26*79\r\n"
+    "$GPGSV,3,3,11,26,40,310,36,16,05,020,29,18,28,095,24*4C\r\n"
+    "$GPGLL,3432.65899,S,05826.39378,W,120713.00,A,A*62\r\n"
+    "$GPRMC,120714.00,A,3432.65803,S,05826.39314,W,0.103,147.81,160126,,,A*60\r\n"
+    "$GPVTG,147.81,T,,M,0.103,N,0.191,K,A*3D\r\n"
+    "$GPGGA,120714.00,3432.65803,S,05826.39314,W,1,07,1.26,11.6,M,16.0,M,,*6A\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,,,,,,2.19,1.21,1.71*02\r\n"
+    "$GPGSV,3,1,11,02,45,123,33,05,60,045,26,12,22,300,37,14,15,200,33*79\r\n"
+    "$GPGSV,3,2,11,25,71,010,39,29,33,250,33,31,08,160,33,21,12,080,22*7B\r\n"
+    "$GPGSV,3,3,11,26,40,310,41,16,05,020,30,18,28,095,33*42\r\n"
+    "$GPGLL,3432.65803,S,05826.39314,W,120714.00,A,A*6C\r\n"
+    "$GPRMC,120715.00,A,3432.65840,S,05826.39267,W,0.098,,160126,,,A*75\r\n"
+    "$GPVTG,,T,,M,0.098,N,0.181,K,A*2A\r\n"
+    "$GPGGA,120715.00,3432.65840,S,05826.39267,W,1,07,1.39,12.6,M,16.0,M,,*64\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,,,,,,2.12,1.21,1.71*09\r\n"
+    "$GPGSV,3,1,11,02,45,123,40,05,60,045,37,12,22,300,26,14,15,200,28*77\r\n"
+    "$GPGSV,3,2,11,25,71,010,38,29,33,250,30,31,08,160,33,21,12,080,41*7C\r\n"
+    "$GPGSV,3,3,11,26,40,310,23,16,05,020,27,18,28,095,35*46\r\n"
+    "$GPGLL,3432.65840,S,05826.39267,W,120715.00,A,A*6F\r\n"
+    "$GPRMC,120716.00,A,3432.65729,S,05826.39397,W,0.035,,160126,,,A*7F\r\n"
+    "$GPVTG,,T,,M,0.035,N,0.064,K,A*27\r\n"
+    "$GPGGA,120716.00,3432.65729,S,05826.39397,W,1,07,1.07,11.9,M,16.0,M,,*68\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,,,,,,2.21,1.21,1.71*09\r\n"
+    "$GPGSV,3,1,11,02,45,123,40,05,60,045,29,12,22,300,29,14,15,200,33*7D\r\n"
+    "$GPGSV,3,2,11,25,71,010,36,29,33,250,19,31,08,160,24,21,12,080,22*7A\r\n"
+    "$GPGSV,3,3,11,26,40,310,26,16,05,020,37,18,28,095,18*4D\r\n"
+    "$GPGLL,3432.65729,S,05826.39397,W,120716.00,A,A*62\r\n"
+    "$GPRMC,120717.00,A,3432.65900,S,05826.39336,W,0.068,,160126,,,A*78\r\n"
+    "$GPVTG,,T,,M,0.068,N,0.126,K,A*28\r\n"
+    "$GPGGA,120717.00,3432.65900,S,05826.39336,W,1,07,1.06,11.2,M,16.0,M,,*6D\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,,,,,,2.11,1.21,1.71*0A\r\n"
+    "$GPGSV,3,1,11,02,45,123,29,05,60,045,22,12,22,300,39,14,15,200,38*73\r\n"
+    "$GPGSV,3,2,11,25,71,010,25,29,33,250,37,31,08,160,28,21,12,080,22*78\r\n"
+    "$GPGSV,3,3,11,26,40,310,19,16,05,020,38,18,28,095,39*4D\r\n"
+    "$GPGLL,3432.65900,S,05826.39336,W,120717.00,A,A*6D\r\n"
+    "$GPRMC,120718.00,A,3432.65775,S,05826.39379,W,0.102,323.85,160126,,,A*6C\r\n"
+    "$GPVTG,323.85,T,,M,0.102,N,0.189,K,A*31\r\n"
+    "$GPGGA,120718.00,3432.65775,S,05826.39379,W,1,07,1.40,11.3,M,16.0,M,,*66\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,,,,,,2.00,1.21,1.71*0A\r\n"
+    "$GPGSV,3,1,11,02,45,123,40,05,60,045,35,12,22,300,22,14,15,200,37*7F\r\n"
+    "$GPGSV,3,2,11,25,71,010,20,29,33,250,23,31,08,160,37,21,12,080,38*7D\r\n"
+    "$GPGSV,3,3,11,26,40,310,26,16,05,020,38,18,28,095,32*4A\r\n"
+    "$GPGLL,3432.65775,S,05826.39379,W,120718.00,A,A*65\r\n"
+    "$GPRMC,120719.00,A,3432.65813,S,05826.39400,W,0.180,67.97,160126,,,A*51\r\n"
+    "$GPVTG,67.97,T,,M,0.180,N,0.333,K,A*08\r\n"
+    "$GPGGA,120719.00,3432.65813,S,05826.39400,W,1,07,1.28,11.0,M,16.0,M,,*6C\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,,,,,,2.15,1.21,1.71*0E\r\n"
+    "$GPGSV,3,1,11,02,45,123,42,05,60,045,32,12,22,300,32,14,15,200,35*79\r\n"
+    "$GPGSV,3,2,11,25,71,010,26,29,33,250,33,31,08,160,40,21,12,080,36*74\r\n"
+    "$GPGSV,3,3,11,26,40,310,20,16,05,020,27,18,28,095,29*48\r\n"
+    "$GPGLL,3432.65813,S,05826.39400,W,120719.00,A,A*62\r\n"
+    "$GPRMC,120720.00,A,3432.65834,S,05826.39219,W,0.256,100.73,160126,,,A*62\r\n"
+    "$GPVTG,100.73,T,,M,0.256,N,0.475,K,A*3F\r\n"
+    "$GPGGA,120720.00,3432.65834,S,05826.39219,W,1,08,1.30,12.4,M,16.0,M,,*6C\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.13,1.21,1.71*0B\r\n"
+    "$GPGSV,3,1,11,02,45,123,32,05,60,045,29,12,22,300,19,14,15,200,40*7F\r\n"
+    "$GPGSV,3,2,11,25,71,010,20,29,33,250,25,31,08,160,37,21,12,080,38*7B\r\n"
+    "$GPGSV,3,3,11,26,40,310,25,16,05,020,35,18,28,095,41*40\r\n"
+    "$GPGLL,3432.65834,S,05826.39219,W,120720.00,A,A*63\r\n"
+    "$GPRMC,120721.00,A,3432.65761,S,05826.39390,W,0.034,,160126,,,A*71\r\n"
+    "$GPVTG,,T,,M,0.034,N,0.062,K,A*20\r\n"
+    "$GPGGA,120721.00,3432.65761,S,05826.39390,W,1,08,1.13,11.9,M,16.0,M,,*6D\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.22,1.21,1.71*09\r\n"
+    "$GPGSV,3,1,11,02,45,123,31,05,60,045,28,12,22,300,20,14,15,200,23*72\r\n"
+    "$GPGSV,3,2,11,25,71,010,41,29,33,250,39,31,08,160,21,21,12,080,30*7E\r\n"
+    "$GPGSV,3,3,11,26,40,310,35,16,05,020,22,18,28,095,32*43\r\n"
+    "$GPGLL,3432.65761,S,05826.39390,W,120721.00,A,A*6D\r\n"
+    "$GPRMC,120722.00,A,3432.65804,S,05826.39512,W,0.097,,160126,,,A*7B\r\n"
+    "$GPVTG,,T,,M,0.097,N,0.179,K,A*22\r\n"
+    "$GPGGA,120722.00,3432.65804,S,05826.39512,W,1,08,1.11,12.2,M,16.0,M,,*64\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.16,1.21,1.71*0E\r\n"
+    "$GPGSV,3,1,11,02,45,123,40,05,60,045,22,12,22,300,23,14,15,200,27*79\r\n"
+    "$GPGSV,3,2,11,25,71,010,41,29,33,250,22,31,08,160,34,21,12,080,36*76\r\n"
+    "$GPGSV,3,3,11,26,40,310,30,16,05,020,25,18,28,095,25*47\r\n"
+    "$GPGLL,3432.65804,S,05826.39512,W,120722.00,A,A*6E\r\n"
+    "$GPRMC,120723.00,A,3432.65834,S,05826.39517,W,0.162,272.62,160126,,,A*6A\r\n"
+    "$GPVTG,272.62,T,,M,0.162,N,0.299,K,A*39\r\n"
+    "$GPGGA,120723.00,3432.65834,S,05826.39517,W,1,08,1.15,12.5,M,16.0,M,,*60\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.17,1.21,1.71*0F\r\n"
+    "$GPGSV,3,1,11,02,45,123,36,05,60,045,18,12,22,300,36,14,15,200,30*73\r\n"
+    "$GPGSV,3,2,11,25,71,010,24,29,33,250,42,31,08,160,28,21,12,080,30*78\r\n"
+    "$GPGSV,3,3,11,26,40,310,34,16,05,020,32,18,28,095,18*4B\r\n"
+    "$GPGLL,3432.65834,S,05826.39517,W,120723.00,A,A*69\r\n"
+    "$GPRMC,120724.00,A,3432.65979,S,05826.39237,W,0.210,257.89,160126,,,A*64\r\n"
+    "$GPVTG,257.89,T,,M,0.210,N,0.388,K,A*3C\r\n"
+    "$GPGGA,120724.00,3432.65979,S,05826.39237,W,1,08,1.34,11.5,M,16.0,M,,*6A\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.25,1.21,1.71*0E\r\n"
+    "$GPGSV,3,1,11,02,45,123,41,05,60,045,29,12,22,300,26,14,15,200,39*79\r\n"
+    "$GPGSV,3,2,11,25,71,010,23,29,33,250,22,31,08,160,23,21,12,080,40*75\r\n"
+    "$GPGSV,3,3,11,26,40,310,38,16,05,020,22,18,28,095,30*4C\r\n"
+    "$GPGLL,3432.65979,S,05826.39237,W,120724.00,A,A*63\r\n"
+    "$GPRMC,120725.00,A,3432.65791,S,05826.39394,W,0.052,,160126,,,A*7E\r\n"
+    "$GPVTG,,T,,M,0.052,N,0.096,K,A*2B\r\n"
+    "$GPGGA,120725.00,3432.65791,S,05826.39394,W,1,08,1.34,11.8,M,16.0,M,,*66\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.03,1.21,1.71*0A\r\n"
+    "$GPGSV,3,1,11,02,45,123,39,05,60,045,29,12,22,300,37,14,15,200,19*74\r\n"
+    "$GPGSV,3,2,11,25,71,010,19,29,33,250,35,31,08,160,25,21,12,080,31*7A\r\n"
+    "$GPGSV,3,3,11,26,40,310,25,16,05,020,42,18,28,095,36*40\r\n"
+    "$GPGLL,3432.65791,S,05826.39394,W,120725.00,A,A*62\r\n"
+    "$GPRMC,120726.00,A,3432.65861,S,05826.39578,W,0.050,,160126,,,A*7B\r\n"
+    "$GPVTG,,T,,M,0.050,N,0.093,K,A*2C\r\n"
+    "$GPGGA,120726.00,3432.65861,S,05826.39578,W,1,08,1.03,11.9,M,16.0,M,,*64\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.05,1.21,1.71*0C\r\n"
+    "$GPGSV,3,1,11,02,45,123,39,05,60,045,32,12,22,300,21,14,15,200,21*72\r\n"
+    "$GPGSV,3,2,11,25,71,010,40,29,33,250,23,31,08,160,19,21,12,080,39*76\r\n"
+    "$GPGSV,3,3,11,26,40,310,18,16,05,020,42,18,28,095,39*41\r\n"
+    "$GPGLL,3432.65861,S,05826.39578,W,120726.00,A,A*65\r\n"
+    "$GPRMC,120727.00,A,3432.65732,S,05826.39404,W,0.030,,160126,,,A*7F\r\n"
+    "$GPVTG,,T,,M,0.030,N,0.055,K,A*20\r\n"
+    "$GPGGA,120727.00,3432.65732,S,05826.39404,W,1,08,1.34,11.4,M,16.0,M,,*6F\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.25,1.21,1.71*0E\r\n"
+    "$GPGSV,3,1,11,02,45,123,38,05,60,045,24,12,22,300,26,14,15,200,36*75\r\n"
+    "$GPGSV,3,2,11,25,71,010,18,29,33,250,26,31,08,160,34,21,12,080,41*7E\r\n"
+    "$GPGSV,3,3,11,26,40,310,41,16,05,020,40,18,28,095,39*4F\r\n"
+    "$GPGLL,3432.65732,S,05826.39404,W,120727.00,A,A*67\r\n"
+    "$GPRMC,120728.00,A,3432.65838,S,05826.39317,W,0.186,130.34,160126,,,A*67\r\n"
+    "$GPVTG,130.34,T,,M,0.186,N,0.344,K,A*34\r\n"
+    "$GPGGA,120728.00,3432.65838,S,05826.39317,W,1,08,1.07,11.4,M,16.0,M,,*60\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.07,1.21,1.71*0E\r\n"
+    "$GPGSV,3,1,11,02,45,123,42,05,60,045,18,12,22,300,29,14,15,200,40*79\r\n"
+    "$GPGSV,3,2,11,25,71,010,28,29,33,250,31,31,08,160,39,21,12,080,19*7B\r\n"
+    "$GPGSV,3,3,11,26,40,310,29,16,05,020,22,18,28,095,18*46\r\n"
+    "$GPGLL,3432.65838,S,05826.39317,W,120728.00,A,A*68\r\n"
+    "$GPRMC,120729.00,A,3432.65776,S,05826.39398,W,0.282,31.51,160126,,,A*50\r\n"
+    "$GPVTG,31.51,T,,M,0.282,N,0.521,K,A*05\r\n"
+    "$GPGGA,120729.00,3432.65776,S,05826.39398,W,1,08,1.37,11.8,M,16.0,M,,*6C\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.19,1.21,1.71*01\r\n"
+    "$GPGSV,3,1,11,02,45,123,26,05,60,045,25,12,22,300,22,14,15,200,22*7A\r\n"
+    "$GPGSV,3,2,11,25,71,010,31,29,33,250,35,31,08,160,23,21,12,080,25*73\r\n"
+    "$GPGSV,3,3,11,26,40,310,39,16,05,020,30,18,28,095,37*49\r\n"
+    "$GPGLL,3432.65776,S,05826.39398,W,120729.00,A,A*6B\r\n"
+    "$GPRMC,120730.00,A,3432.65870,S,05826.39359,W,0.167,91.14,160126,,,A*5F\r\n"
+    "$GPVTG,91.14,T,,M,0.167,N,0.309,K,A*0A\r\n"
+    "$GPGGA,120730.00,3432.65870,S,05826.39359,W,1,08,1.19,10.6,M,16.0,M,,*63\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.28,1.21,1.71*03\r\n"
+    "$GPGSV,3,1,11,02,45,123,19,05,60,045,24,12,22,300,42,14,15,200,32*70\r\n"
+    "$GPGSV,3,2,11,25,71,010,21,29,33,250,23,31,08,160,36,21,12,080,21*75\r\n"
+    "$GPGSV,3,3,11,26,40,310,18,16,05,020,34,18,28,095,23*4B\r\n"
+    "$GPGLL,3432.65870,S,05826.39359,W,120730.00,A,A*67\r\n"
+    "$GPRMC,120731.00,A,3432.65737,S,05826.39328,W,0.294,191.09,160126,,,A*66\r\n"
+    "$GPVTG,191.09,T,,M,0.294,N,0.545,K,A*36\r\n"
+    "$GPGGA,120731.00,3432.65737,S,05826.39328,W,1,08,1.34,12.0,M,16.0,M,,*63\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.25,1.21,1.71*0E\r\n"
+    "$GPGSV,3,1,11,02,45,123,33,05,60,045,24,12,22,300,38,14,15,200,30*77\r\n"
+    "$GPGSV,3,2,11,25,71,010,22,29,33,250,42,31,08,160,32,21,12,080,18*7F\r\n"
+    "$GPGSV,3,3,11,26,40,310,28,16,05,020,31,18,28,095,26*48\r\n"
+    "$GPGLL,3432.65737,S,05826.39328,W,120731.00,A,A*6C\r\n"
+    "$GPRMC,120732.00,A,3432.65822,S,05826.39342,W,0.192,80.39,160126,,,A*55\r\n"
+    "$GPVTG,80.39,T,,M,0.192,N,0.356,K,A*05\r\n"
+    "$GPGGA,120732.00,3432.65822,S,05826.39342,W,1,08,1.19,11.3,M,16.0,M,,*68\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.05,1.21,1.71*0C\r\n"
+    "$GPGSV,3,1,11,02,45,123,20,05,60,045,31,12,22,300,37,14,15,200,37*79\r\n"
+    "$GPGSV,3,2,11,25,71,010,42,29,33,250,25,31,08,160,38,21,12,080,20*79\r\n"
+    "$GPGSV,3,3,11,26,40,310,24,16,05,020,30,18,28,095,31*43\r\n"
+    "$GPGLL,3432.65822,S,05826.39342,W,120732.00,A,A*68\r\n"
+    "$GPRMC,120733.00,A,3432.65700,S,05826.39277,W,0.094,,160126,,,A*77\r\n"
+    "$GPVTG,,T,,M,0.094,N,0.175,K,A*2D\r\n"
+    "$GPGGA,120733.00,3432.65700,S,05826.39277,W,1,08,1.33,11.2,M,16.0,M,,*68\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.16,1.21,1.71*0E\r\n"
+    "$GPGSV,3,1,11,02,45,123,42,05,60,045,33,12,22,300,29,14,15,200,28*7E\r\n"
+    "$GPGSV,3,2,11,25,71,010,40,29,33,250,36,31,08,160,30,21,12,080,26*77\r\n"
+    "$GPGSV,3,3,11,26,40,310,38,16,05,020,39,18,28,095,20*47\r\n"
+    "$GPGLL,3432.65700,S,05826.39277,W,120733.00,A,A*61\r\n"
+    "$GPRMC,120734.00,A,3432.65801,S,05826.39377,W,0.175,356.12,160126,,,A*6C\r\n"
+    "$GPVTG,356.12,T,,M,0.175,N,0.324,K,A*38\r\n"
+    "$GPGGA,120734.00,3432.65801,S,05826.39377,W,1,08,1.32,11.4,M,16.0,M,,*67\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.16,1.21,1.71*0E\r\n"
+    "$GPGSV,3,1,11,02,45,123,21,05,60,045,40,12,22,300,42,14,15,200,42*7E\r\n"
+    "$GPGSV,3,2,11,25,71,010,20,29,33,250,20,31,08,160,39,21,12,080,42*7D\r\n"
+    "$GPGSV,3,3,11,26,40,310,21,16,05,020,24,18,28,095,29*4A\r\n"
+    "$GPGLL,3432.65801,S,05826.39377,W,120734.00,A,A*69\r\n"
+    "$GPRMC,120735.00,A,3432.65892,S,05826.39220,W,0.047,,160126,,,A*79\r\n"
+    "$GPVTG,,T,,M,0.047,N,0.087,K,A*2F\r\n"
+    "$GPGGA,120735.00,3432.65892,S,05826.39220,W,1,08,1.14,11.4,M,16.0,M,,*6B\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.20,1.21,1.71*0B\r\n"
+    "$GPGSV,3,1,11,02,45,123,22,05,60,045,33,12,22,300,41,14,15,200,32*7D\r\n"
+    "$GPGSV,3,2,11,25,71,010,37,29,33,250,21,31,08,160,41,21,12,080,37*77\r\n"
+    "$GPGSV,3,3,11,26,40,310,22,16,05,020,32,18,28,095,24*43\r\n"
+    "$GPGLL,3432.65892,S,05826.39220,W,120735.00,A,A*61\r\n"
+    "$GPRMC,120736.00,A,3432.65895,S,05826.39456,W,0.207,328.20,160126,,,A*69\r\n"
+    "$GPVTG,328.20,T,,M,0.207,N,0.383,K,A*3B\r\n"
+    "$GPGGA,120736.00,3432.65895,S,05826.39456,W,1,08,1.17,11.6,M,16.0,M,,*69\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.24,1.21,1.71*0F\r\n"
+    "$GPGSV,3,1,11,02,45,123,18,05,60,045,19,12,22,300,38,14,15,200,18*7A\r\n"
+    "$GPGSV,3,2,11,25,71,010,33,29,33,250,38,31,08,160,32,21,12,080,28*71\r\n"
+    "$GPGSV,3,3,11,26,40,310,19,16,05,020,18,18,28,095,26*41\r\n"
+    "$GPGLL,3432.65895,S,05826.39456,W,120736.00,A,A*62\r\n"
+    "$GPRMC,120737.00,A,3432.65777,S,05826.39423,W,0.124,265.50,160126,,,A*64\r\n"
+    "$GPVTG,265.50,T,,M,0.124,N,0.230,K,A*3F\r\n"
+    "$GPGGA,120737.00,3432.65777,S,05826.39423,W,1,08,1.23,11.6,M,16.0,M,,*6E\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.04,1.21,1.71*0D\r\n"
+    "$GPGSV,3,1,11,02,45,123,42,05,60,045,22,12,22,300,29,14,15,200,39*7E\r\n"
+    "$GPGSV,3,2,11,25,71,010,42,29,33,250,33,31,08,160,41,21,12,080,30*71\r\n"
+    "$GPGSV,3,3,11,26,40,310,18,16,05,020,35,18,28,095,22*4B\r\n"
+    "$GPGLL,3432.65777,S,05826.39423,W,120737.00,A,A*62\r\n"
+    "$GPRMC,120738.00,A,3432.65744,S,05826.39348,W,0.479,349.02,160126,,,A*64\r\n"
+    "$GPVTG,349.02,T,,M,0.479,N,0.888,K,A*33\r\n"
+    "$GPGGA,120738.00,3432.65744,S,05826.39348,W,1,08,1.35,12.0,M,16.0,M,,*69\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.15,1.21,1.71*0D\r\n"
+    "$GPGSV,3,1,11,02,45,123,26,05,60,045,20,12,22,300,33,14,15,200,21*7C\r\n"
+    "$GPGSV,3,2,11,25,71,010,30,29,33,250,40,31,08,160,24,21,12,080,35*76\r\n"
+    "$GPGSV,3,3,11,26,40,310,23,16,05,020,32,18,28,095,28*4E\r\n"
+    "$GPGLL,3432.65744,S,05826.39348,W,120738.00,A,A*67\r\n"
+    "$GPRMC,120739.00,A,3432.65803,S,05826.39302,W,0.107,318.26,160126,,,A*69\r\n"
+    "$GPVTG,318.26,T,,M,0.107,N,0.198,K,A*35\r\n"
+    "$GPGGA,120739.00,3432.65803,S,05826.39302,W,1,08,1.28,12.4,M,16.0,M,,*62\r\n"
+    "$GPGSA,A,3,02,05,12,14,25,29,31,21,,,,,2.17,1.21,1.71*0F\r\n"
+    "$GPGSV,3,1,11,02,45,123,40,05,60,045,42,12,22,300,19,14,15,200,34*74\r\n"
+    "$GPGSV,3,2,11,25,71,010,41,29,33,250,25,31,08,160,39,21,12,080,37*7D\r\n"
+    "$GPGSV,3,3,11,26,40,310,18,16,05,020,34,18,28,095,33*4A\r\n"
+    "$GPGLL,3432.65803,S,05826.39302,W,120739.00,A,A*64\r\n";
+
+static const char NMEA_CORPUS_1[] PROGMEM =
+    "$GPRMC,120000.00,A,3432.65800,S,05826.39400,W,4.000,0.00,160126,,,A*6E\r\n"
+    "$GPGGA,120000.00,3432.65800,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*67\r\n"
+    "$GPRMC,120000.20,A,3432.65768,S,05826.39400,W,4.000,1.15,160126,,,A*68\r\n"
+    "$GPGGA,120000.20,3432.65768,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*64\r\n"
+    "$GPRMC,120000.40,A,3432.65735,S,05826.39398,W,4.000,2.29,160126,,,A*6C\r\n"
+    "$GPGGA,120000.40,3432.65735,S,05826.39398,W,1,09,0.92,11.8,M,16.0,M,,*6C\r\n"
+    "$GPRMC,120000.60,A,3432.65703,S,05826.39396,W,4.000,3.44,160126,,,A*6F\r\n"
+    "$GPGGA,120000.60,3432.65703,S,05826.39396,W,1,09,0.92,11.8,M,16.0,M,,*65\r\n"
+    "$GPRMC,120000.80,A,3432.65671,S,05826.39394,W,4.000,4.58,160126,,,A*6D\r\n"
+    "$GPGGA,120000.80,3432.65671,S,05826.39394,W,1,09,0.92,11.8,M,16.0,M,,*6D\r\n"
+    "$GPRMC,120001.00,A,3432.65639,S,05826.39390,W,4.000,5.73,160126,,,A*64\r\n"
+    "$GPGGA,120001.00,3432.65639,S,05826.39390,W,1,09,0.92,11.8,M,16.0,M,,*6C\r\n"
+    "$GPRMC,120001.20,A,3432.65606,S,05826.39386,W,4.000,6.88,160126,,,A*6A\r\n"
+    "$GPGGA,120001.20,3432.65606,S,05826.39386,W,1,09,0.92,11.8,M,16.0,M,,*65\r\n"
+    "$GPRMC,120001.40,A,3432.65574,S,05826.39381,W,4.000,8.02,160126,,,A*61\r\n"
+    "$GPGGA,120001.40,3432.65574,S,05826.39381,W,1,09,0.92,11.8,M,16.0,M,,*62\r\n"
+    "$GPRMC,120001.60,A,3432.65542,S,05826.39375,W,4.000,9.17,160126,,,A*68\r\n"
+    "$GPGGA,120001.60,3432.65542,S,05826.39375,W,1,09,0.92,11.8,M,16.0,M,,*6E\r\n"
+    "$GPRMC,120001.80,A,3432.65511,S,05826.39368,W,4.000,10.31,160126,,,A*50\r\n"
+    "$GPGGA,120001.80,3432.65511,S,05826.39368,W,1,09,0.92,11.8,M,16.0,M,,*6A\r\n"
+    "$GPRMC,120002.00,A,3432.65479,S,05826.39361,W,4.000,11.46,160126,,,A*5C\r\n"
+    "$GPGGA,120002.00,3432.65479,S,05826.39361,W,1,09,0.92,11.8,M,16.0,M,,*67\r\n"
+    "$GPRMC,120002.20,A,3432.65447,S,05826.39353,W,4.000,12.61,160126,,,A*54\r\n"
+    "$GPGGA,120002.20,3432.65447,S,05826.39353,W,1,09,0.92,11.8,M,16.0,M,,*69\r\n"
+    "$GPRMC,120002.40,A,3432.65416,S,05826.39344,W,4.000,13.75,160126,,,A*54\r\n"
+    "$GPGGA,120002.40,3432.65416,S,05826.39344,W,1,09,0.92,11.8,M,16.0,M,,*6D\r\n"
+    "$GPRMC,120002.60,A,3432.65384,S,05826.39334,W,4.000,14.90,160126,,,A*51\r\n"
+    "$GPGGA,120002.60,3432.65384,S,05826.39334,W,1,09,0.92,11.8,M,16.0,M,,*64\r\n"
+    "$GPRMC,120002.80,A,3432.65353,S,05826.39324,W,4.000,16.04,160126,,,A*5B\r\n"
+    "$GPGGA,120002.80,3432.65353,S,05826.39324,W,1,09,0.92,11.8,M,16.0,M,,*61\r\n"
+    "$GPRMC,120003.00,A,3432.65322,S,05826.39312,W,4.000,17.19,160126,,,A*5C\r\n"
+    "$GPGGA,120003.00,3432.65322,S,05826.39312,W,1,09,0.92,11.8,M,16.0,M,,*6B\r\n"
+    "$GPRMC,120003.20,A,3432.65291,S,05826.39300,W,4.000,18.33,160126,,,A*53\r\n"
+    "$GPGGA,120003.20,3432.65291,S,05826.39300,W,1,09,0.92,11.8,M,16.0,M,,*63\r\n"
+    "$GPRMC,120003.40,A,3432.65261,S,05826.39288,W,4.000,19.48,160126,,,A*56\r\n"
+    "$GPGGA,120003.40,3432.65261,S,05826.39288,W,1,09,0.92,11.8,M,16.0,M,,*6B\r\n"
+    "$GPRMC,120003.60,A,3432.65230,S,05826.39274,W,4.000,20.63,160126,,,A*50\r\n"
+    "$GPGGA,120003.60,3432.65230,S,05826.39274,W,1,09,0.92,11.8,M,16.0,M,,*6E\r\n"
+    "$GPRMC,120003.80,A,3432.65200,S,05826.39260,W,4.000,21.77,160126,,,A*5C\r\n"
+    "$GPGGA,120003.80,3432.65200,S,05826.39260,W,1,09,0.92,11.8,M,16.0,M,,*66\r\n"
+    "$GPRMC,120004.00,A,3432.65170,S,05826.39245,W,4.000,22.92,160126,,,A*58\r\n"
+    "$GPGGA,120004.00,3432.65170,S,05826.39245,W,1,09,0.92,11.8,M,16.0,M,,*6A\r\n"
+    "$GPRMC,120004.20,A,3432.65141,S,05826.39229,W,4.000,24.06,160126,,,A*59\r\n"
+    "$GPGGA,120004.20,3432.65141,S,05826.39229,W,1,09,0.92,11.8,M,16.0,M,,*60\r\n"
+    "$GPRMC,120004.40,A,3432.65111,S,05826.39213,W,4.000,25.21,160126,,,A*57\r\n"
+    "$GPGGA,120004.40,3432.65111,S,05826.39213,W,1,09,0.92,11.8,M,16.0,M,,*6A\r\n"
+    "$GPRMC,120004.60,A,3432.65082,S,05826.39196,W,4.000,26.36,160126,,,A*55\r\n"
+    "$GPGGA,120004.60,3432.65082,S,05826.39196,W,1,09,0.92,11.8,M,16.0,M,,*6D\r\n"
+    "$GPRMC,120004.80,A,3432.65053,S,05826.39178,W,4.000,27.50,160126,,,A*56\r\n"
+    "$GPGGA,120004.80,3432.65053,S,05826.39178,W,1,09,0.92,11.8,M,16.0,M,,*6F\r\n"
+    "$GPRMC,120005.00,A,3432.65025,S,05826.39160,W,4.000,28.65,160126,,,A*5E\r\n"
+    "$GPGGA,120005.00,3432.65025,S,05826.39160,W,1,09,0.92,11.8,M,16.0,M,,*6E\r\n"
+    "$GPRMC,120005.20,A,3432.64997,S,05826.39141,W,4.000,29.79,160126,,,A*52\r\n"
+    "$GPGGA,120005.20,3432.64997,S,05826.39141,W,1,09,0.92,11.8,M,16.0,M,,*6E\r\n"
+    "$GPRMC,120005.40,A,3432.64969,S,05826.39121,W,4.000,30.94,160126,,,A*58\r\n"
+    "$GPGGA,120005.40,3432.64969,S,05826.39121,W,1,09,0.92,11.8,M,16.0,M,,*6F\r\n"
+    "$GPRMC,120005.60,A,3432.64941,S,05826.39100,W,4.000,32.09,160126,,,A*55\r\n"
+    "$GPGGA,120005.60,3432.64941,S,05826.39100,W,1,09,0.92,11.8,M,16.0,M,,*64\r\n"
+    "$GPRMC,120005.80,A,3432.64914,S,05826.39079,W,4.000,33.23,160126,,,A*5D\r\n"
+    "$GPGGA,120005.80,3432.64914,S,05826.39079,W,1,09,0.92,11.8,M,16.0,M,,*65\r\n"
+    "$GPRMC,120006.00,A,3432.64887,S,05826.39057,W,4.000,34.38,160126,,,A*5C\r\n"
+    "$GPGGA,120006.00,3432.64887,S,05826.39057,W,1,09,0.92,11.8,M,16.0,M,,*69\r\n"
+    "$GPRMC,120006.20,A,3432.64860,S,05826.39035,W,4.000,35.52,160126,,,A*5E\r\n"
+    "$GPGGA,120006.20,3432.64860,S,05826.39035,W,1,09,0.92,11.8,M,16.0,M,,*66\r\n"
+    "$GPRMC,120006.40,A,3432.64834,S,05826.39012,W,4.000,36.67,160126,,,A*59\r\n"
+    "$GPGGA,120006.40,3432.64834,S,05826.39012,W,1,09,0.92,11.8,M,16.0,M,,*64\r\n"
+    "$GPRMC,120006.60,A,3432.64809,S,05826.38988,W,4.000,37.82,160126,,,A*54\r\n"
+    "$GPGGA,120006.60,3432.64809,S,05826.38988,W,1,09,0.92,11.8,M,16.0,M,,*63\r\n"
+    "$GPRMC,120006.80,A,3432.64783,S,05826.38963,W,4.000,38.96,160126,,,A*58\r\n"
+    "$GPGGA,120006.80,3432.64783,S,05826.38963,W,1,09,0.92,11.8,M,16.0,M,,*65\r\n"
+    "$GPRMC,120007.00,A,3432.64758,S,05826.38939,W,4.000,40.11,160126,,,A*58\r\n"
+    "$GPGGA,120007.00,3432.64758,S,05826.38939,W,1,09,0.92,11.8,M,16.0,M,,*65\r\n"
+    "$GPRMC,120007.20,A,3432.64734,S,05826.38913,W,4.000,41.25,160126,,,A*5E\r\n"
+    "$GPGGA,120007.20,3432.64734,S,05826.38913,W,1,09,0.92,11.8,M,16.0,M,,*65\r\n"
+    "$GPRMC,120007.40,A,3432.64710,S,05826.38887,W,4.000,42.40,160126,,,A*52\r\n"
+    "$GPGGA,120007.40,3432.64710,S,05826.38887,W,1,09,0.92,11.8,M,16.0,M,,*69\r\n"
+    "$GPRMC,120007.60,A,3432.64686,S,05826.38860,W,4.000,43.54,160126,,,A*53\r\n"
+    "$GPGGA,120007.60,3432.64686,S,05826.38860,W,1,09,0.92,11.8,M,16.0,M,,*6C\r\n"
+    "$GPRMC,120007.80,A,3432.64663,S,05826.38833,W,4.000,44.69,160126,,,A*59\r\n"
+    "$GPGGA,120007.80,3432.64663,S,05826.38833,W,1,09,0.92,11.8,M,16.0,M,,*6F\r\n"
+    "$GPRMC,120008.00,A,3432.64640,S,05826.38805,W,4.000,45.84,160126,,,A*58\r\n"
+    "$GPGGA,120008.00,3432.64640,S,05826.38805,W,1,09,0.92,11.8,M,16.0,M,,*6C\r\n"
+    "$GPRMC,120008.20,A,3432.64618,S,05826.38776,W,4.000,46.98,160126,,,A*52\r\n"
+    "$GPGGA,120008.20,3432.64618,S,05826.38776,W,1,09,0.92,11.8,M,16.0,M,,*68\r\n"
+    "$GPRMC,120008.40,A,3432.64596,S,05826.38747,W,4.000,48.13,160126,,,A*5E\r\n"
+    "$GPGGA,120008.40,3432.64596,S,05826.38747,W,1,09,0.92,11.8,M,16.0,M,,*69\r\n"
+    "$GPRMC,120008.60,A,3432.64575,S,05826.38718,W,4.000,49.27,160126,,,A*5D\r\n"
+    "$GPGGA,120008.60,3432.64575,S,05826.38718,W,1,09,0.92,11.8,M,16.0,M,,*6C\r\n"
+    "$GPRMC,120008.80,A,3432.64554,S,05826.38688,W,4.000,50.42,160126,,,A*53\r\n"
+    "$GPGGA,120008.80,3432.64554,S,05826.38688,W,1,09,0.92,11.8,M,16.0,M,,*69\r\n"
+    "$GPRMC,120009.00,A,3432.64533,S,05826.38657,W,4.000,51.57,160126,,,A*5C\r\n"
+    "$GPGGA,120009.00,3432.64533,S,05826.38657,W,1,09,0.92,11.8,M,16.0,M,,*63\r\n"
+    "$GPRMC,120009.20,A,3432.64514,S,05826.38626,W,4.000,52.71,160126,,,A*5A\r\n"
+    "$GPGGA,120009.20,3432.64514,S,05826.38626,W,1,09,0.92,11.8,M,16.0,M,,*62\r\n"
+    "$GPRMC,120009.40,A,3432.64494,S,05826.38595,W,4.000,53.86,160126,,,A*57\r\n"
+    "$GPGGA,120009.40,3432.64494,S,05826.38595,W,1,09,0.92,11.8,M,16.0,M,,*66\r\n"
+    "$GPRMC,120009.60,A,3432.64475,S,05826.38563,W,4.000,55.00,160126,,,A*5B\r\n"
+    "$GPGGA,120009.60,3432.64475,S,05826.38563,W,1,09,0.92,11.8,M,16.0,M,,*62\r\n"
+    "$GPRMC,120009.80,A,3432.64457,S,05826.38531,W,4.000,56.15,160126,,,A*55\r\n"
+    "$GPGGA,120009.80,3432.64457,S,05826.38531,W,1,09,0.92,11.8,M,16.0,M,,*6B\r\n";
+
+static const char NMEA_CORPUS_2[] PROGMEM =
+    "$GPRMC,120000.00,V,3432.65800,S,05826.39400,W,3.200,45.00,160126,,,A*5A\r\n"
+    "$GPGGA,120000.00,3432.65800,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*67\r\n"
+    "$GPRMC,120001.00,A,3432.65740,$GPGGA,120001.00,3432.65740,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*"
+    "6D\r\n"
+    "$GPRMC,120002.00,A,3432.65680,S,05826.39400,W,3.200,45.00,160126,,,A*5E\r\n"
+    "\301\253\330\200\265\270\336M\351\366x\205\305\355\177q\207\325W\345\313\200>\217$GPGGA,120002.00,34"
+    "32.65680,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*63\r\n"
+    "$GPRMC,150000.00,V,,,,,,,160126,,,N*7B\r\n"
+    "$GPGGA,,,,,,0,00,99.99,,,,,,*48\r\n"
+    "$GPRMC,120004.00,A,3432.65560,S,05826.39400,W,3.200,45.00,160126,,,A\r\n"
+    "$GPZDA,160000.00,16,01,2026,00,00*61\r\n"
+    "$GPRMC,120005.00,A,3432.65500,S,05826.39400,W,3.200,45.00,160126,,,A*52$GPGGA,120005.00,3432.65500,S"
+    ",05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*6F\r\n"
+    "$GPTXT,01,01,02,XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"
+    "XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX*4D\r"
+    "\n"
+    "$GPRMC,120006.00,A,3432.65440,S,05826.39400,W,3.200,45.00,160126,,,A*54\r\n"
+    "$GPGGA,120006.00,3432.65440,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*69\r\n"
+    "$GPRMC,120007.00,A,3432.65380,S,05826.39400,W,3.200,45.00,160126,,,A*5E\r\n"
+    "$GPGGA,120007.00,3432.65380,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*00\r\n"
+    "$GPRMC,120008.00,A,3432.65320,S,05826.39400,W,3.200,45.00,160126,,,A*5B\r\n"
+    "$GPGGA,120008.00,3432.65320,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*66\r\n"
+    "$GPRMC,120009.00,A,3432.65260,S,05826.39400,W,3.200,45.00,160126,,,A*5F\r\n"
+    "$GPGGA,120009.00,3432.65260,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*62\r\n"
+    "$GPRMC,120010.00,V,3432.65200,S,05826.39400,W,3.200,45.00,160126,,,A*51\r\n"
+    "$GPGGA,120010.00,3432.65200,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*6C\r\n"
+    "$GPRMC,120011.00,A,3432.65140,$GPGGA,120011.00,3432.65140,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*"
+    "6A\r\n"
+    "$GPRMC,120012.00,A,3432.65080,S,05826.39400,W,3.200,45.00,160126,,,A*59\r\n"
+    "\365\305\2113\244\325\316|\212\212\360\337\357r\314%\370}\273A\230bN\356$GPGGA,120012.00,3432.65080,"
+    "S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*64\r\n"
+    "$GPRMC,150000.00,V,,,,,,,160126,,,N*7B\r\n"
+    "$GPGGA,,,,,,0,00,99.99,,,,,,*48\r\n"
+    "$GPRMC,120014.00,A,3432.64960,S,05826.39400,W,3.200,45.00,160126,,,A\r\n"
+    "$GPZDA,160000.00,16,01,2026,00,00*61\r\n"
+    "$GPRMC,120015.00,A,3432.64900,S,05826.39400,W,3.200,45.00,160126,,,A*5E$GPGGA,120015.00,3432.64900,S"
+    ",05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*63\r\n"
+    "$GPTXT,01,01,02,XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"
+    "XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX*4D\r"
+    "\n"
+    "$GPRMC,120016.00,A,3432.64840,S,05826.39400,W,3.200,45.00,160126,,,A*58\r\n"
+    "$GPGGA,120016.00,3432.64840,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*65\r\n"
+    "$GPRMC,120017.00,A,3432.64780,S,05826.39400,W,3.200,45.00,160126,,,A*5A\r\n"
+    "$GPGGA,120017.00,3432.64780,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*00\r\n"
+    "$GPRMC,120018.00,A,3432.64720,S,05826.39400,W,3.200,45.00,160126,,,A*5F\r\n"
+    "$GPGGA,120018.00,3432.64720,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*62\r\n"
+    "$GPRMC,120019.00,A,3432.64660,S,05826.39400,W,3.200,45.00,160126,,,A*5B\r\n"
+    "$GPGGA,120019.00,3432.64660,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*66\r\n"
+    "$GPRMC,120020.00,V,3432.64600,S,05826.39400,W,3.200,45.00,160126,,,A*57\r\n"
+    "$GPGGA,120020.00,3432.64600,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*6A\r\n"
+    "$GPRMC,120021.00,A,3432.64540,$GPGGA,120021.00,3432.64540,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*"
+    "6C\r\n"
+    "$GPRMC,120022.00,A,3432.64480,S,05826.39400,W,3.200,45.00,160126,,,A*5F\r\n"
+    "\375s\320\323\275\230\275f\360V\2574\306\251\301\266\351.5\213\312\3010\317$GPGGA,120022.00,3432.644"
+    "80,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*62\r\n"
+    "$GPRMC,150000.00,V,,,,,,,160126,,,N*7B\r\n"
+    "$GPGGA,,,,,,0,00,99.99,,,,,,*48\r\n"
+    "$GPRMC,120024.00,A,3432.64360,S,05826.39400,W,3.200,45.00,160126,,,A\r\n"
+    "$GPZDA,160000.00,16,01,2026,00,00*61\r\n"
+    "$GPRMC,120025.00,A,3432.64300,S,05826.39400,W,3.200,45.00,160126,,,A*57$GPGGA,120025.00,3432.64300,S"
+    ",05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*6A\r\n"
+    "$GPTXT,01,01,02,XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"
+    "XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX*4D\r"
+    "\n"
+    "$GPRMC,120026.00,A,3432.64240,S,05826.39400,W,3.200,45.00,160126,,,A*51\r\n"
+    "$GPGGA,120026.00,3432.64240,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*6C\r\n"
+    "$GPRMC,120027.00,A,3432.64180,S,05826.39400,W,3.200,45.00,160126,,,A*5F\r\n"
+    "$GPGGA,120027.00,3432.64180,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*00\r\n"
+    "$GPRMC,120028.00,A,3432.64120,S,05826.39400,W,3.200,45.00,160126,,,A*5A\r\n"
+    "$GPGGA,120028.00,3432.64120,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*67\r\n"
+    "$GPRMC,120029.00,A,3432.64060,S,05826.39400,W,3.200,45.00,160126,,,A*5E\r\n"
+    "$GPGGA,120029.00,3432.64060,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*63\r\n"
+    "$GPRMC,120030.00,V,3432.64000,S,05826.39400,W,3.200,45.00,160126,,,A*50\r\n"
+    "$GPGGA,120030.00,3432.64000,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*6D\r\n"
+    "$GPRMC,120031.00,A,3432.63940,$GPGGA,120031.00,3432.63940,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*"
+    "66\r\n"
+    "$GPRMC,120032.00,A,3432.63880,S,05826.39400,W,3.200,45.00,160126,,,A*55\r\n"
+    "%\305UU=kU\226\342\357\264s#\356\277x\221\265\355]\257.\351\261$GPGGA,120032.00,3432.63880,S,05826.3"
+    "9400,W,1,09,0.92,11.8,M,16.0,M,,*68\r\n"
+    "$GPRMC,150000.00,V,,,,,,,160126,,,N*7B\r\n"
+    "$GPGGA,,,,,,0,00,99.99,,,,,,*48\r\n"
+    "$GPRMC,120034.00,A,3432.63760,S,05826.39400,W,3.200,45.00,160126,,,A\r\n"
+    "$GPZDA,160000.00,16,01,2026,00,00*61\r\n"
+    "$GPRMC,120035.00,A,3432.63700,S,05826.39400,W,3.200,45.00,160126,,,A*55$GPGGA,120035.00,3432.63700,S"
+    ",05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*68\r\n"
+    "$GPTXT,01,01,02,XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX"
+    "XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX*4D\r"
+    "\n"
+    "$GPRMC,120036.00,A,3432.63640,S,05826.39400,W,3.200,45.00,160126,,,A*53\r\n"
+    "$GPGGA,120036.00,3432.63640,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*6E\r\n"
+    "$GPRMC,120037.00,A,3432.63580,S,05826.39400,W,3.200,45.00,160126,,,A*5D\r\n"
+    "$GPGGA,120037.00,3432.63580,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*00\r\n"
+    "$GPRMC,120038.00,A,3432.63520,S,05826.39400,W,3.200,45.00,160126,,,A*58\r\n"
+    "$GPGGA,120038.00,3432.63520,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*65\r\n"
+    "$GPRMC,120039.00,A,3432.63460,S,05826.39400,W,3.200,45.00,160126,,,A*5C\r\n"
+    "$GPGGA,120039.00,3432.63460,S,05826.39400,W,1,09,0.92,11.8,M,16.0,M,,*61\r\n";
+
+static const char NMEA_CORPUS_3[] PROGMEM =
+    "\265b\001\002\034\000\000B\006\022h\307*\335H\365h\353\230l\000\000\030.\000\000\304\011\000\000\330"
+    "\016\000\000<\351\265b\001\0064\000\000B\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000"
+    "\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000"
+    "\011\000\000\000\000\0308\265b\001\022$\000\000B\006\022\315\000\000\000\000\000\000\000\000\000\000"
+    "\000\315\000\000\000\315\000\000\000\000\000\000\0002\000\000\000\220\320\003\000\215\034\265b\001!\024"
+    "\000\000B\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\000\007\315\331\265b\001\002\034"
+    "\000\310B\006\022i\307*\335~\365h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000;\031"
+    "\265b\001\0064\000\310B\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000"
+    "\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000"
+    "\000\340\330\265b\001\022$\000\310B\006\022\314\000\000\000\004\000\000\000\000\000\000\000\315\000\000"
+    "\000\315\000\000\000\237\277\001\0002\000\000\000\220\320\003\000\267\077\265b\001!\024\000\310B\006"
+    "\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\000\007\225y\265b\001\002\034\000\220C\006"
+    "\022k\307*\335\264\365h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000<|\265b\001\006"
+    "4\000\220C\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\251\253"
+    "\265b\001\022$\000\220C\006\022\314\000\000\000\010\000\000\000\000\000\000\000\315\000\000\000\315\000"
+    "\000\000\077\177\003\0002\000\000\000\220\320\003\000\346\306\265b\001!\024\000\220C\006\022(\000\000"
+    "\000\000\000\000\000\352\007\001\020\014\000\000\007^,\265b\001\002\034\000XD\006\022n\307*\335\352\365"
+    "h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000>\367\265b\001\0064\000XD\006\022\000"
+    "\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000r~\265b\001\022$\000XD\006"
+    "\022\314\000\000\000\014\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000\336>\005\0002\000"
+    "\000\000\220\320\003\000\0236\265b\001!\024\000XD\006\022(\000\000\000\000\000\000\000\352\007\001\020"
+    "\014\000\000\007'\337\265b\001\002\034\000 E\006\022r\307*\335\037\366h\353\230l\000\000\030.\000\000"
+    "\304\011\000\000\330\016\000\000A\211\265b\001\0064\000 E\006\022\000\000\000\000a\011\003\r\000\000"
+    "\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "(\000\000\000y\000\000\011\000\000\000\000;Q\265b\001\022$\000 E\006\022\314\000\000\000\020\000\000"
+    "\000\000\000\000\000\315\000\000\000\315\000\000\000~\376\006\0002\000\000\000\220\320\003\000A\263\265"
+    "b\001!\024\000 E\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\000\007\360\222\265b\001"
+    "\002\034\000\350E\006\022x\307*\335U\366h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000"
+    "E1\265b\001\0064\000\350E\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000"
+    "\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000"
+    "\000\000\003\361\265b\001\022$\000\350E\006\022\313\000\000\000\024\000\000\000\000\000\000\000\315\000"
+    "\000\000\315\000\000\000\035\276\010\0002\000\000\000\220\320\003\000m\353\265b\001!\024\000\350E\006"
+    "\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\001\007\2714\265b\001\002\034\000\260F\006"
+    "\022\200\307*\335\213\366h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000L$\265b\001\006"
+    "4\000\260F\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\314\304"
+    "\265b\001\022$\000\260F\006\022\313\000\000\000\030\000\000\000\000\000\000\000\315\000\000\000\315\000"
+    "\000\000\275}\n"
+    "\0002\000\000\000\220\320\003\000\233g\265b\001!\024\000\260F\006\022(\000\000\000\000\000\000\000\352"
+    "\007\001\020\014\000\001\007\202\347\265b\001\002\034\000xG\006\022\210\307*\335\300\366h\353\230l\000"
+    "\000\030.\000\000\304\011\000\000\330\016\000\000R\003\265b\001\0064\000xG\006\022\000\000\000\000a\011"
+    "\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000(\000\000\000y\000\000\011\000\000\000\000\225\227\265b\001\022$\000xG\006\022\312\000\000"
+    "\000\034\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000\\=\014\0002\000\000\000\220\320"
+    "\003\000\310\302\265b\001!\024\000xG\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\001"
+    "\007K\232\265b\001\002\034\000@H\006\022\222\307*\335\365\366h\353\230l\000\000\030.\000\000\304\011"
+    "\000\000\330\016\000\000Z\022\265b\001\0064\000@H\006\022\000\000\000\000a\011\003\r\000\000\000\000"
+    "\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000"
+    "\000y\000\000\011\000\000\000\000^j\265b\001\022$\000@H\006\022\312\000\000\000 \000\000\000\000\000"
+    "\000\000\315\000\000\000\315\000\000\000\374\374\r\0002\000\000\000\220\320\003\000\3654\265b\001!\024"
+    "\000@H\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\001\007\024M\265b\001\002\034\000"
+    "\010I\006\022\235\307*\335*\367h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000dL\265"
+    "b\001\0064\000\010I\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000"
+    "^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000"
+    "'=\265b\001\022$\000\010I\006\022\311\000\000\000$\000\000\000\000\000\000\000\315\000\000\000\315\000"
+    "\000\000\234\274\017\0002\000\000\000\220\320\003\000#\233\265b\001!\024\000\010I\006\022(\000\000\000"
+    "\000\000\000\000\352\007\001\020\014\000\001\007\335\000\265b\001\002\034\000\320I\006\022\251\307*\335"
+    "_\367h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000mp\265b\001\0064\000\320I\006\022"
+    "\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\357\335\265b\001\022$"
+    "\000\320I\006\022\310\000\000\000(\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000;|\021"
+    "\0002\000\000\000\220\320\003\000O\323\265b\001!\024\000\320I\006\022(\000\000\000\000\000\000\000\352"
+    "\007\001\020\014\000\002\007\246\242\265b\001\002\034\000\230J\006\022\267\307*\335\224\367h\353\230"
+    "l\000\000\030.\000\000\304\011\000\000\330\016\000\000y\337\265b\001\0064\000\230J\006\022\000\000\000"
+    "\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\270\260\265b\001\022$\000\230J\006"
+    "\022\310\000\000\000,\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000\333;\023\0002\000\000"
+    "\000\220\320\003\000}O\265b\001!\024\000\230J\006\022(\000\000\000\000\000\000\000\352\007\001\020\014"
+    "\000\002\007oU\265b\001\002\034\000`K\006\022\306\307*\335\311\367h\353\230l\000\000\030.\000\000\304"
+    "\011\000\000\330\016\000\000\206f\265b\001\0064\000`K\006\022\000\000\000\000a\011\003\r\000\000\000"
+    "\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000"
+    "\000\000y\000\000\011\000\000\000\000\201\203\265b\001\022$\000`K\006\022\307\000\000\0000\000\000\000"
+    "\000\000\000\000\315\000\000\000\315\000\000\000z\373\024\0002\000\000\000\220\320\003\000\251\240\265"
+    "b\001!\024\000`K\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\002\0078\010\265b\001\002"
+    "\034\000(L\006\022\326\307*\335\375\367h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000"
+    "\223\361\265b\001\0064\000(L\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000"
+    "\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000"
+    "\000\000JV\265b\001\022$\000(L\006\022\306\000\000\0004\000\000\000\000\000\000\000\315\000\000\000\315"
+    "\000\000\000\032\273\026\0002\000\000\000\220\320\003\000\327\007\265b\001!\024\000(L\006\022(\000\000"
+    "\000\000\000\000\000\352\007\001\020\014\000\002\007\001\273\265b\001\002\034\000\360L\006\022\347\307"
+    "*\3351\370h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\241\214\265b\001\0064\000\360"
+    "L\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\022\366\265b\001"
+    "\022$\000\360L\006\022\305\000\000\0008\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000\271"
+    "z\030\0002\000\000\000\220\320\003\000\0024\265b\001!\024\000\360L\006\022(\000\000\000\000\000\000\000"
+    "\352\007\001\020\014\000\002\007\311[\265b\001\002\034\000\270M\006\022\372\307*\335d\370h\353\230l\000"
+    "\000\030.\000\000\304\011\000\000\330\016\000\000\260K\265b\001\0064\000\270M\006\022\000\000\000\000"
+    "a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\333\311\265b\001\022$\000\270M\006\022"
+    "\303\000\000\000<\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000Y:\032\0002\000\000\000"
+    "\220\320\003\000/{\265b\001!\024\000\270M\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000"
+    "\003\007\223\020\265b\001\002\034\000\200N\006\022\016\310*\335\230\370h\353\230l\000\000\030.\000\000"
+    "\304\011\000\000\330\016\000\000\302M\265b\001\0064\000\200N\006\022\000\000\000\000a\011\003\r\000\000"
+    "\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "(\000\000\000y\000\000\011\000\000\000\000\244\234\265b\001\022$\000\200N\006\022\302\000\000\000@\000"
+    "\000\000\000\000\000\000\315\000\000\000\315\000\000\000\370\371\033\0002\000\000\000\220\320\003\000"
+    "Z\301\265b\001!\024\000\200N\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\003\007\\\303"
+    "\265b\001\002\034\000HO\006\022#\310*\335\313\370h\353\230l\000\000\030.\000\000\304\011\000\000\330"
+    "\016\000\000\323<\265b\001\0064\000HO\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000"
+    "\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000"
+    "\011\000\000\000\000mo\265b\001\022$\000HO\006\022\301\000\000\000D\000\000\000\000\000\000\000\315\000"
+    "\000\000\315\000\000\000\230\271\035\0002\000\000\000\220\320\003\000\210(\265b\001!\024\000HO\006\022"
+    "(\000\000\000\000\000\000\000\352\007\001\020\014\000\003\007%v\265b\001\002\034\000\020P\006\022:\310"
+    "*\335\375\370h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\345G\265b\001\0064\000\020"
+    "P\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\0006B\265b\001\022"
+    "$\000\020P\006\022\277\000\000\000H\000\000\000\000\000\000\000\315\000\000\000\315\000\000\0008y\037"
+    "\0002\000\000\000\220\320\003\000\265o\265b\001!\024\000\020P\006\022(\000\000\000\000\000\000\000\352"
+    "\007\001\020\014\000\003\007\356)\265b\001\002\034\000\330P\006\022Q\310*\3350\371h\353\230l\000\000"
+    "\030.\000\000\304\011\000\000\330\016\000\000\370^\265b\001\0064\000\330P\006\022\000\000\000\000a\011"
+    "\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000(\000\000\000y\000\000\011\000\000\000\000\376\342\265b\001\022$\000\330P\006\022\276\000"
+    "\000\000L\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000\3278!\0002\000\000\000\220\320"
+    "\003\000\340\234\265b\001!\024\000\330P\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000"
+    "\003\007\266\311\265b\001\002\034\000\240Q\006\022j\310*\335a\371h\353\230l\000\000\030.\000\000\304"
+    "\011\000\000\330\016\000\000\013\205\265b\001\0064\000\240Q\006\022\000\000\000\000a\011\003\r\000\000"
+    "\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "(\000\000\000y\000\000\011\000\000\000\000\307\265\265b\001\022$\000\240Q\006\022\274\000\000\000O\000"
+    "\000\000\000\000\000\000\315\000\000\000\315\000\000\000w\370\"\0002\000\000\000\220\320\003\000\013"
+    "\275\265b\001!\024\000\240Q\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\004\007\200"
+    "~\265b\001\002\034\000hR\006\022\204\310*\335\223\371h\353\230l\000\000\030.\000\000\304\011\000\000"
+    "\330\016\000\000 \330\265b\001\0064\000hR\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000"
+    "\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000"
+    "\000\011\000\000\000\000\220\210\265b\001\022$\000hR\006\022\273\000\000\000S\000\000\000\000\000\000"
+    "\000\315\000\000\000\315\000\000\000\026\270$\0002\000\000\000\220\320\003\0008\030\265b\001!\024\000"
+    "hR\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\004\007I1\265b\001\002\034\0000S\006"
+    "\022\240\310*\335\304\371h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\0006G\265b\001\006"
+    "4\0000S\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000Y[\265b\001"
+    "\022$\0000S\006\022\271\000\000\000W\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000\266"
+    "w&\0002\000\000\000\220\320\003\000dT\265b\001!\024\0000S\006\022(\000\000\000\000\000\000\000\352\007"
+    "\001\020\014\000\004\007\022\344\265b\001\002\034\000\370S\006\022\274\310*\335\364\371h\353\230l\000"
+    "\000\030.\000\000\304\011\000\000\330\016\000\000J\207\265b\001\0064\000\370S\006\022\000\000\000\000"
+    "a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000!\373\265b\001\022$\000\370S\006\022\267"
+    "\000\000\000[\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000U7(\0002\000\000\000\220\320"
+    "\003\000\217l\265b\001!\024\000\370S\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\004"
+    "\007\332\204\265b\001\002\034\000\300T\006\022\332\310*\335$\372h\353\230l\000\000\030.\000\000\304\011"
+    "\000\000\330\016\000\000b%\265b\001\0064\000\300T\006\022\000\000\000\000a\011\003\r\000\000\000\000"
+    "\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000"
+    "\000y\000\000\011\000\000\000\000\352\316\265b\001\022$\000\300T\006\022\265\000\000\000^\000\000\000"
+    "\000\000\000\000\315\000\000\000\315\000\000\000\365\366)\0002\000\000\000\220\320\003\000\271\202\265"
+    "b\001!\024\000\300T\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\004\007\2437\265b\001"
+    "\002\034\000\210U\006\022\370\310*\335T\372h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000"
+    "\000y\260\265b\001\0064\000\210U\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000"
+    "\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000"
+    "\000\000\000\263\241\265b\001\022$\000\210U\006\022\263\000\000\000b\000\000\000\000\000\000\000\315"
+    "\000\000\000\315\000\000\000\224\266+\0002\000\000\000\220\320\003\000\345\275\265b\001!\024\000\210"
+    "U\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\005\007m\354\265b\001\002\034\000PV\006"
+    "\022\030\311*\335\203\372h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\222n\265b\001"
+    "\0064\000PV\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000|t\265"
+    "b\001\022$\000PV\006\022\261\000\000\000e\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000"
+    "4v-\0002\000\000\000\220\320\003\000\021\350\265b\001!\024\000PV\006\022(\000\000\000\000\000\000\000"
+    "\352\007\001\020\014\000\005\0076\237\265b\001\002\034\000\030W\006\0229\311*\335\262\372h\353\230l\000"
+    "\000\030.\000\000\304\011\000\000\330\016\000\000\253-\265b\001\0064\000\030W\006\022\000\000\000\000"
+    "a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000EG\265b\001\022$\000\030W\006\022\257\000"
+    "\000\000i\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000\3245/\0002\000\000\000\220\320"
+    "\003\000=$\265b\001!\024\000\030W\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\005\007"
+    "\377R\265b\001\002\034\000\340W\006\022\\\311*\335\340\372h\353\230l\000\000\030.\000\000\304\011\000"
+    "\000\330\016\000\000\304\355\265b\001\0064\000\340W\006\022\000\000\000\000a\011\003\r\000\000\000\000"
+    "\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000"
+    "\000y\000\000\011\000\000\000\000\r\347\265b\001\022$\000\340W\006\022\255\000\000\000l\000\000\000\000"
+    "\000\000\000\315\000\000\000\315\000\000\000s\3650\0002\000\000\000\220\320\003\000f\026\265b\001!\024"
+    "\000\340W\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\005\007\307\362\265b\001\002\034"
+    "\000\250X\006\022\177\311*\335\r\373h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\336"
+    "\307\265b\001\0064\000\250X\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000"
+    "\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000"
+    "\000\000\326\272\265b\001\022$\000\250X\006\022\253\000\000\000p\000\000\000\000\000\000\000\315\000"
+    "\000\000\315\000\000\000\023\2652\0002\000\000\000\220\320\003\000\223]\265b\001!\024\000\250X\006\022"
+    "(\000\000\000\000\000\000\000\352\007\001\020\014\000\005\007\220\245\265b\001\002\034\000pY\006\022"
+    "\243\311*\335:\373h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\370\246\265b\001\006"
+    "4\000pY\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\237\215\265"
+    "b\001\022$\000pY\006\022\251\000\000\000s\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000"
+    "\262t4\0002\000\000\000\220\320\003\000\275q\265b\001!\024\000pY\006\022(\000\000\000\000\000\000\000"
+    "\352\007\001\020\014\000\006\007ZZ\265b\001\002\034\0008Z\006\022\311\311*\335f\373h\353\230l\000\000"
+    "\030.\000\000\304\011\000\000\330\016\000\000\023\241\265b\001\0064\0008Z\006\022\000\000\000\000a\011"
+    "\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000(\000\000\000y\000\000\011\000\000\000\000h`\265b\001\022$\0008Z\006\022\246\000\000\000"
+    "w\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000R46\0002\000\000\000\220\320\003\000\351"
+    "\230\265b\001!\024\0008Z\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\006\007#\r\265"
+    "b\001\002\034\000\000[\006\022\357\311*\335\221\373h\353\230l\000\000\030.\000\000\304\011\000\000\330"
+    "\016\000\000-\210\265b\001\0064\000\000[\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000"
+    "\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000"
+    "\011\000\000\000\00013\265b\001\022$\000\000[\006\022\244\000\000\000z\000\000\000\000\000\000\000\315"
+    "\000\000\000\315\000\000\000\361\3637\0002\000\000\000\220\320\003\000\022\242\265b\001!\024\000\000"
+    "[\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\006\007\354\300\265b\001\002\034\000\310"
+    "[\006\022\027\312*\335\274\373h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000I\233\265"
+    "b\001\0064\000\310[\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000"
+    "^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000"
+    "\371\323\265b\001\022$\000\310[\006\022\241\000\000\000}\000\000\000\000\000\000\000\315\000\000\000"
+    "\315\000\000\000\221\2639\0002\000\000\000\220\320\003\000<\212\265b\001!\024\000\310[\006\022(\000\000"
+    "\000\000\000\000\000\352\007\001\020\014\000\006\007\264`\265b\001\002\034\000\220\\\006\022@\312*\335"
+    "\347\373h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000f\312\265b\001\0064\000\220\\"
+    "\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\302\246\265b\001"
+    "\022$\000\220\\\006\022\237\000\000\000\200\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000"
+    "1s;\0002\000\000\000\220\320\003\000h\265\265b\001!\024\000\220\\\006\022(\000\000\000\000\000\000\000"
+    "\352\007\001\020\014\000\006\007}\023\265b\001\002\034\000X]\006\022i\312*\335\020\374h\353\230l\000"
+    "\000\030.\000\000\304\011\000\000\330\016\000\000\202\344\265b\001\0064\000X]\006\022\000\000\000\000"
+    "a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\213y\265b\001\022$\000X]\006\022\234\000"
+    "\000\000\204\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000\3202=\0002\000\000\000\220\320"
+    "\003\000\222\305\265b\001!\024\000X]\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\007"
+    "\007G\310\265b\001\002\034\000 ^\006\022\224\312*\3359\374h\353\230l\000\000\030.\000\000\304\011\000"
+    "\000\330\016\000\000\237\033\265b\001\0064\000 ^\006\022\000\000\000\000a\011\003\r\000\000\000\000\000"
+    "\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000"
+    "y\000\000\011\000\000\000\000TL\265b\001\022$\000 ^\006\022\232\000\000\000\207\000\000\000\000\000\000"
+    "\000\315\000\000\000\315\000\000\000p\362>\0002\000\000\000\220\320\003\000\275\346\265b\001!\024\000"
+    " ^\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\007\007\020{\265b\001\002\034\000\350"
+    "^\006\022\277\312*\335a\374h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\272#\265b"
+    "\001\0064\000\350^\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000"
+    "^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000"
+    "\034\354\265b\001\022$\000\350^\006\022\227\000\000\000\212\000\000\000\000\000\000\000\315\000\000\000"
+    "\315\000\000\000\017\262@\0002\000\000\000\220\320\003\000\346\302\265b\001!\024\000\350^\006\022(\000"
+    "\000\000\000\000\000\000\352\007\001\020\014\000\007\007\330\033\265b\001\002\034\000\260_\006\022\354"
+    "\312*\335\211\374h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\330v\265b\001\0064\000"
+    "\260_\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\345\277\265"
+    "b\001\022$\000\260_\006\022\224\000\000\000\215\000\000\000\000\000\000\000\315\000\000\000\315\000\000"
+    "\000\257qB\0002\000\000\000\220\320\003\000\020\302\265b\001!\024\000\260_\006\022(\000\000\000\000\000"
+    "\000\000\352\007\001\020\014\000\007\007\241\316\265b\001\002\034\000x`\006\022\032\313*\335\257\374"
+    "h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\366\320\265b\001\0064\000x`\006\022\000"
+    "\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\256\222\265b\001\022$\000"
+    "x`\006\022\221\000\000\000\220\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000N1D\0002\000"
+    "\000\000\220\320\003\000:\301\265b\001!\024\000x`\006\022(\000\000\000\000\000\000\000\352\007\001\020"
+    "\014\000\007\007j\201\265b\001\002\034\000@a\006\022H\313*\335\325\374h\353\230l\000\000\030.\000\000"
+    "\304\011\000\000\330\016\000\000\023\023\265b\001\0064\000@a\006\022\000\000\000\000a\011\003\r\000\000"
+    "\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "(\000\000\000y\000\000\011\000\000\000\000we\265b\001\022$\000@a\006\022\216\000\000\000\223\000\000"
+    "\000\000\000\000\000\315\000\000\000\315\000\000\000\356\360E\0002\000\000\000\220\320\003\000c\267\265"
+    "b\001!\024\000@a\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\010\00746\265b\001\002"
+    "\034\000\010b\006\022w\313*\335\372\374h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000"
+    "0Z\265b\001\0064\000\010b\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000"
+    "\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000"
+    "\000\000@8\265b\001\022$\000\010b\006\022\213\000\000\000\225\000\000\000\000\000\000\000\315\000\000"
+    "\000\315\000\000\000\215\260G\0002\000\000\000\220\320\003\000\214\232\265b\001!\024\000\010b\006\022"
+    "(\000\000\000\000\000\000\000\352\007\001\020\014\000\010\007\375\351\265b\001\002\034\000\320b\006\022"
+    "\250\313*\335\037\375h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000O\311\265b\001\006"
+    "4\000\320b\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\010\330"
+    "\265b\001\022$\000\320b\006\022\210\000\000\000\230\000\000\000\000\000\000\000\315\000\000\000\315\000"
+    "\000\000-pI\0002\000\000\000\220\320\003\000\266\202\265b\001!\024\000\320b\006\022(\000\000\000\000"
+    "\000\000\000\352\007\001\020\014\000\010\007\305\211\265b\001\002\034\000\230c\006\022\331\313*\335B"
+    "\375h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000l\030\265b\001\0064\000\230c\006\022"
+    "\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\321\253\265b\001\022$"
+    "\000\230c\006\022\205\000\000\000\233\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000\315"
+    "/K\0002\000\000\000\220\320\003\000\340\202\265b\001!\024\000\230c\006\022(\000\000\000\000\000\000\000"
+    "\352\007\001\020\014\000\010\007\216<\265b\001\002\034\000`d\006\022\013\314*\335e\375h\353\230l\000"
+    "\000\030.\000\000\304\011\000\000\330\016\000\000\213\226\265b\001\0064\000`d\006\022\000\000\000\000"
+    "a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\232~\265b\001\022$\000`d\006\022\202\000"
+    "\000\000\236\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000l\357L\0002\000\000\000\220\320"
+    "\003\000\011w\265b\001!\024\000`d\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\010\007"
+    "W\357\265b\001\002\034\000(e\006\022>\314*\335\207\375h\353\230l\000\000\030.\000\000\304\011\000\000"
+    "\330\016\000\000\251\001\265b\001\0064\000(e\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000"
+    "\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000"
+    "\000\011\000\000\000\000cQ\265b\001\022$\000(e\006\022\177\000\000\000\240\000\000\000\000\000\000\000"
+    "\315\000\000\000\315\000\000\000\014\257N\0002\000\000\000\220\320\003\0003f\265b\001!\024\000(e\006"
+    "\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\011\007!\244\265b\001\002\034\000\360e\006"
+    "\022q\314*\335\250\375h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\305=\265b\001\006"
+    "4\000\360e\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000+\361\265"
+    "b\001\022$\000\360e\006\022|\000\000\000\243\000\000\000\000\000\000\000\315\000\000\000\315\000\000"
+    "\000\253nP\0002\000\000\000\220\320\003\000[7\265b\001!\024\000\360e\006\022(\000\000\000\000\000\000"
+    "\000\352\007\001\020\014\000\011\007\351D\265b\001\002\034\000\270f\006\022\246\314*\335\310\375h\353"
+    "\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\343\260\265b\001\0064\000\270f\006\022\000"
+    "\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\364\304\265b\001\022$\000"
+    "\270f\006\022x\000\000\000\245\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000K.R\0002\000"
+    "\000\000\220\320\003\000\204\006\265b\001!\024\000\270f\006\022(\000\000\000\000\000\000\000\352\007"
+    "\001\020\014\000\011\007\262\367\265b\001\002\034\000\200g\006\022\333\314*\335\350\375h\353\230l\000"
+    "\000\030.\000\000\304\011\000\000\330\016\000\000\001#\265b\001\0064\000\200g\006\022\000\000\000\000"
+    "a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\275\227\265b\001\022$\000\200g\006\022"
+    "u\000\000\000\247\000\000\000\000\000\000\000\315\000\000\000\315\000\000\000\352\355S\0002\000\000\000"
+    "\220\320\003\000\253\324\265b\001!\024\000\200g\006\022(\000\000\000\000\000\000\000\352\007\001\020"
+    "\014\000\011\007{\252\265b\001\002\034\000Hh\006\022\021\315*\335\006\376h\353\230l\000\000\030.\000"
+    "\000\304\011\000\000\330\016\000\000 \260\265b\001\0064\000Hh\006\022\000\000\000\000a\011\003\r\000"
+    "\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000(\000\000\000y\000\000\011\000\000\000\000\206j\265b\001\022$\000Hh\006\022r\000\000\000\252\000"
+    "\000\000\000\000\000\000\315\000\000\000\315\000\000\000\212\255U\0002\000\000\000\220\320\003\000\326"
+    "\337\265b\001!\024\000Hh\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\011\007D]";
+
+static const char NMEA_CORPUS_4[] PROGMEM =
+    "\265b\001\002\034\000\000B\006\022(\307*\335H\365h\353\230l\000\000\030.\000\000\304\011\000\000\330"
+    "\016\000\000<\351\265b\001\0064\000\000B\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000"
+    "\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000"
+    "\011\000\000\000\000\0308\265b\001\022$\000\000B\006\022s\000\000\000s\000\000\000\000\000\000\000\244"
+    "\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000b\"\265b\001!\024\000\000B\006\022"
+    "(\000\000\000\000\000\000\000\352\007\001\020\014\000\000\007\315\331\265b\001\002\034\000\310B\006\022"
+    "h\307*\335\254\265b\001\0064\000\310B\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000"
+    "\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000"
+    "\011\000\000\000\000\340\330\265b\001\022$\000\310B\006\022s\000\000\000s\000\000\000\000\000\000\000"
+    "\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000*B\265b\001!\024\000\310B\006"
+    "\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\000\007\225y\265b\001\002\034\000\220C\006"
+    "\022h\307*\335\020\366h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\226w\324C\016\307"
+    "\302\244\214^\374\014\360PO\363=\r@H\\\254>Wyw\344\037\214\254\002\243V\254\266\311\316\244\235U\260"
+    "\370\265b\001\0064\000\220C\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000"
+    "\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000"
+    "\000\000\251\253\265b\001\022$\000\220C\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000\000"
+    "\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000\363\205\265b\001!\024\000\220C\006\022(\000"
+    "\000\000\000\000\000\000\352\007\001\020\014\000\000\007^,\265b\001\002\034\000XD\006\022\000\000\000"
+    "\000\000\000\000\000\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\320\247\265b\001\0064"
+    "\000XD\006\022\000\000\000\000a\011\000\000\000\000\000\000\000\000\000\000\000\000\000\000^\001\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\002\000\000\000\000[\310\265"
+    "b\001\022$\000XD\006\022\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\0002\000\000\000\220\320\003\000\200N\265b\001!\024\000XD\006\022(\000\000\000\000\000"
+    "\000\000\352\007\001\020\014\000\000\007'\337\265b\0010\310\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\371\254$GPGGA,,,,,,0,00,99.99,,,,,,*48\r"
+    "\n"
+    "\265b\001\002\034\000 E\006\022h\307*\335\330\366h\353\230l\000\000\030.\000\000\304\011\000\000\330"
+    "\016\000\000\360\r\265b\001\0064\000 E\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000"
+    "\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000"
+    "\011\000\000\000\000;Q\265b\001\022$\000 E\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000"
+    "\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000\205\013\265b\001!\024\000 E\006\022("
+    "\000\000\000\000\000\000\000\352\007\001\020\014\000\000\007\360\222\265b\005\001\002\000\006\010\026"
+    "\077\265b\001\002\034\000\350E\006\022h\307*\335<\367h\353\230l\000\000\030.\000\000\304\011\000\000"
+    "\330\016\000\000\035\320\265b\001\0064\000\350E\006\022\000\000\000\000a\011\003\r\000\000\000\000\000"
+    "\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000"
+    "y\000\000\011\000\000\000\000\003\361\265b\001\022$\000\350E\006\022s\000\000\000s\000\000\000\000\000"
+    "\000\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000M+\265b\001\002\034\000"
+    "\260F\006\022h\307*\335\240\367h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000J\233\265"
+    "b\001\0064\000\260F\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000"
+    "^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000"
+    "\314\304\265b\001\022$\000\260F\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000\000\000\244"
+    "\000\000\000 \252D\0002\000\000\000\220\320\003\000\026n\265b\001!\024\000\260F\006\022(\000\000\000"
+    "\000\000\000\000\352\007\001\020\014\000\001\007\202\347\265b\001\002\034\000xG\006\022h\307*\335\004"
+    "\370h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000xy\265b\001\0064\000xG\006\022\000"
+    "\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\225\227\265b\001\022$\000"
+    "xG\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000\000\000\244\000\000\000 \252D\0002\000\000"
+    "\000\220\320\003\000\337\261\265b\001!\024\000xG\006\022(\000\000\000\000\000\000\000\352\007\001\020"
+    "\014\000\001\007K\232\265b\001\002\034\000@H\006\022(\307*\335h\370h\353\230l\000\000\030.\000\000\304"
+    "\011\000\000\330\016\000\000\245D\265b\001\0064\000@H\006\022\000\000\000\000a\011\003\r\000\000\000"
+    "\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000"
+    "\000\000y\000\000\011\000\000\000\000^j\265b\001\022$\000@H\006\022s\000\000\000s\000\000\000\000\000"
+    "\000\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000\250\364\265b\001!\024"
+    "\000@H\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\001\007\024M\265b\001\002\034\000"
+    "\010I\006\022h\307*\335\314\265b\001\0064\000\010I\006\022\000\000\000\000a\011\003\r\000\000\000\000"
+    "\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000"
+    "\000y\000\000\011\000\000\000\000'=\265b\001\022$\000\010I\006\022s\000\000\000s\000\000\000\000\000"
+    "\000\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000q7\265b\001!\024\000\010"
+    "I\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\001\007\335\000\265b\001\002\034\000\320"
+    "I\006\022h\307*\3350\371h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\377\322\211\341"
+    "(\364\203UU\220\366\216+3\301\334\356\361u\375r5\344\324\327q\177\272n\303+\236\036n3\330\004\014\333"
+    "h\201\333\265b\001\0064\000\320I\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000"
+    "\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000"
+    "\000\000\000\357\335\265b\001\022$\000\320I\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000"
+    "\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\0009W\265b\001!\024\000\320I\006\022(\000"
+    "\000\000\000\000\000\000\352\007\001\020\014\000\002\007\246\242\265b\001\002\034\000\230J\006\022\000"
+    "\000\000\000\000\000\000\000\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\026I\265b\001"
+    "\0064\000\230J\006\022\000\000\000\000a\011\000\000\000\000\000\000\000\000\000\000\000\000\000\000^"
+    "\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\002\000\000\000\000"
+    "\241\372\265b\001\022$\000\230J\006\022\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\0002\000\000\000\220\320\003\000\306 \265b\001!\024\000\230J\006\022(\000"
+    "\000\000\000\000\000\000\352\007\001\020\014\000\002\007oU\265b\0010\310\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\371\254$GPGGA,,,,,,0,00"
+    ",99.99,,,,,,*48\r\n"
+    "\265b\001\002\034\000`K\006\022h\307*\335\370\371h\353\230l\000\000\030.\000\000\304\011\000\000\330"
+    "\016\000\000Yh\265b\001\0064\000`K\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000"
+    "\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011"
+    "\000\000\000\000\201\203\265b\001\022$\000`K\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000"
+    "\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000\313\335\265b\001!\024\000`K\006\022("
+    "\000\000\000\000\000\000\000\352\007\001\020\014\000\002\0078\010\265b\005\001\002\000\006\010\026\077"
+    "\265b\001\002\034\000(L\006\022h\307*\335\\\372h\353\230l\000\000\030.\000\000\304\011\000\000\330\016"
+    "\000\000\207F\265b\001\0064\000(L\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000"
+    "\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011"
+    "\000\000\000\000JV\265b\001\022$\000(L\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000\000"
+    "\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000\224 \265b\001\002\034\000\360L\006\022h\307"
+    "*\335\300\372h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\263\366\265b\001\0064\000"
+    "\360L\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\022\366\265"
+    "b\001\022$\000\360L\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000\000\000\244\000\000\000"
+    " \252D\0002\000\000\000\220\320\003\000\\@\265b\001!\024\000\360L\006\022(\000\000\000\000\000\000\000"
+    "\352\007\001\020\014\000\002\007\311[\265b\001\002\034\000\270M\006\022h\307*\335$\373h\353\230l\000"
+    "\000\030.\000\000\304\011\000\000\330\016\000\000\341\324\265b\001\0064\000\270M\006\022\000\000\000"
+    "\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\333\311\265b\001\022$\000\270M\006"
+    "\022s\000\000\000s\000\000\000\000\000\000\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000"
+    "\220\320\003\000%\203\265b\001!\024\000\270M\006\022(\000\000\000\000\000\000\000\352\007\001\020\014"
+    "\000\003\007\223\020\265b\001\002\034\000\200N\006\022(\307*\335\210\373h\353\230l\000\000\030.\000\000"
+    "\304\011\000\000\330\016\000\000\016\237\265b\001\0064\000\200N\006\022\000\000\000\000a\011\003\r\000"
+    "\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000(\000\000\000y\000\000\011\000\000\000\000\244\234\265b\001\022$\000\200N\006\022s\000\000\000s\000"
+    "\000\000\000\000\000\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000\356\306"
+    "\265b\001!\024\000\200N\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\003\007\\\303\265"
+    "b\001\002\034\000HO\006\022h\307*\335\354\265b\001\0064\000HO\006\022\000\000\000\000a\011\003\r\000"
+    "\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000(\000\000\000y\000\000\011\000\000\000\000mo\265b\001\022$\000HO\006\022s\000\000\000s\000\000\000"
+    "\000\000\000\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000\267\011\265b"
+    "\001!\024\000HO\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\003\007%v\265b\001\002\034"
+    "\000\020P\006\022h\307*\335P\374h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000iH\371"
+    "o\330\264}S\330\003\3029\370q\356\277\2278M\014\r]\031\356Bjr\245\275H\2414h\353\352\010\222\213~\264"
+    "1_\265b\001\0064\000\020P\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000"
+    "\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000"
+    "\000\0006B\265b\001\022$\000\020P\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000\000\000\244"
+    "\000\000\000 \252D\0002\000\000\000\220\320\003\000\200L\265b\001!\024\000\020P\006\022(\000\000\000"
+    "\000\000\000\000\352\007\001\020\014\000\003\007\356)\265b\001\002\034\000\330P\006\022\000\000\000\000"
+    "\000\000\000\000\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\\\353\265b\001\0064\000\330"
+    "P\006\022\000\000\000\000a\011\000\000\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\002\000\000\000\000\347,\265b\001"
+    "\022$\000\330P\006\022\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\0002\000\000\000\220\320\003\000\014\362\265b\001!\024\000\330P\006\022(\000\000\000\000"
+    "\000\000\000\352\007\001\020\014\000\003\007\266\311\265b\0010\310\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\371\254$GPGGA,,,,,,0,00,99.99,,"
+    ",,,,*48\r\n"
+    "\265b\001\002\034\000\240Q\006\022h\307*\335\030\375h\353\230l\000\000\030.\000\000\304\011\000\000\330"
+    "\016\000\000\303\326\265b\001\0064\000\240Q\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000"
+    "\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000"
+    "\000\011\000\000\000\000\307\265\265b\001\022$\000\240Q\006\022s\000\000\000s\000\000\000\000\000\000"
+    "\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000\021\257\265b\001!\024\000"
+    "\240Q\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\004\007\200~\265b\005\001\002\000"
+    "\006\010\026\077\265b\001\002\034\000hR\006\022h\307*\335|\375h\353\230l\000\000\030.\000\000\304\011"
+    "\000\000\330\016\000\000\360\241\265b\001\0064\000hR\006\022\000\000\000\000a\011\003\r\000\000\000\000"
+    "\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000"
+    "\000y\000\000\011\000\000\000\000\220\210\265b\001\022$\000hR\006\022s\000\000\000s\000\000\000\000\000"
+    "\000\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000\332\362\265b\001\002"
+    "\034\0000S\006\022h\307*\335\340\375h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\035"
+    "l\265b\001\0064\0000S\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000"
+    "\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000"
+    "\000Y[\265b\001\022$\0000S\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000\000\000\244\000"
+    "\000\000 \252D\0002\000\000\000\220\320\003\000\2435\265b\001!\024\0000S\006\022(\000\000\000\000\000"
+    "\000\000\352\007\001\020\014\000\004\007\022\344\265b\001\002\034\000\370S\006\022h\307*\335D\376h\353"
+    "\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000J/\265b\001\0064\000\370S\006\022\000\000\000"
+    "\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000!\373\265b\001\022$\000\370S\006\022"
+    "s\000\000\000s\000\000\000\000\000\000\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220"
+    "\320\003\000kU\265b\001!\024\000\370S\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\004"
+    "\007\332\204\265b\001\002\034\000\300T\006\022(\307*\335\250\376h\353\230l\000\000\030.\000\000\304\011"
+    "\000\000\330\016\000\000w\372\265b\001\0064\000\300T\006\022\000\000\000\000a\011\003\r\000\000\000\000"
+    "\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000"
+    "\000y\000\000\011\000\000\000\000\352\316\265b\001\022$\000\300T\006\022s\000\000\000s\000\000\000\000"
+    "\000\000\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\0004\230\265b\001!\024"
+    "\000\300T\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\004\007\2437\265b\001\002\034"
+    "\000\210U\006\022h\307*\335\014\265b\001\0064\000\210U\006\022\000\000\000\000a\011\003\r\000\000\000"
+    "\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000"
+    "\000\000y\000\000\011\000\000\000\000\263\241\265b\001\022$\000\210U\006\022s\000\000\000s\000\000\000"
+    "\000\000\000\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000\375\333\265b"
+    "\001!\024\000\210U\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\005\007m\354\265b\001"
+    "\002\034\000PV\006\022h\307*\335p\377h\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000"
+    "\322\243DF$N'\2773\r\340_\213\321fWa\342\316E\36438{\206\314\036\235\307\331^\201B\011\376\025\251\355"
+    "\315TCI\265b\001\0064\000PV\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000"
+    "\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000"
+    "\000\000|t\265b\001\022$\000PV\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000\000\000\244"
+    "\000\000\000 \252D\0002\000\000\000\220\320\003\000\306\036\265b\001!\024\000PV\006\022(\000\000\000"
+    "\000\000\000\000\352\007\001\020\014\000\005\0076\237\265b\001\002\034\000\030W\006\022\000\000\000\000"
+    "\000\000\000\000\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\243\250\265b\001\0064\000"
+    "\030W\006\022\000\000\000\000a\011\000\000\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\002\000\000\000\000.\221\265b"
+    "\001\022$\000\030W\006\022\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\0002\000\000\000\220\320\003\000S\347\265b\001!\024\000\030W\006\022(\000\000\000\000"
+    "\000\000\000\352\007\001\020\014\000\005\007\377R\265b\0010\310\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\371\254$GPGGA,,,,,,0,00,99.99,,,,,,"
+    "*48\r\n"
+    "\265b\001\002\034\000\340W\006\022h\307*\3358\000i\353\230l\000\000\030.\000\000\304\011\000\000\330"
+    "\016\000\000-C\265b\001\0064\000\340W\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000"
+    "\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000"
+    "\011\000\000\000\000\r\347\265b\001\022$\000\340W\006\022s\000\000\000s\000\000\000\000\000\000\000\244"
+    "\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000W\201\265b\001!\024\000\340W\006\022"
+    "(\000\000\000\000\000\000\000\352\007\001\020\014\000\005\007\307\362\265b\005\001\002\000\006\010\026"
+    "\077\265b\001\002\034\000\250X\006\022h\307*\335\234\000i\353\230l\000\000\030.\000\000\304\011\000\000"
+    "\330\016\000\000Z\016\265b\001\0064\000\250X\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000"
+    "\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000"
+    "\000\011\000\000\000\000\326\272\265b\001\022$\000\250X\006\022s\000\000\000s\000\000\000\000\000\000"
+    "\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000 \304\265b\001\002\034\000"
+    "pY\006\022h\307*\335\000\001i\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\210\354\265"
+    "b\001\0064\000pY\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^"
+    "\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000"
+    "\237\215\265b\001\022$\000pY\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000\000\000\244\000"
+    "\000\000 \252D\0002\000\000\000\220\320\003\000\351\007\265b\001!\024\000pY\006\022(\000\000\000\000"
+    "\000\000\000\352\007\001\020\014\000\006\007ZZ\265b\001\002\034\0008Z\006\022h\307*\335d\001i\353\230"
+    "l\000\000\030.\000\000\304\011\000\000\330\016\000\000\265\267\265b\001\0064\0008Z\006\022\000\000\000"
+    "\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000h`\265b\001\022$\0008Z\006\022s\000"
+    "\000\000s\000\000\000\000\000\000\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320"
+    "\003\000\262J\265b\001!\024\0008Z\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\006\007"
+    "#\r\265b\001\002\034\000\000[\006\022(\307*\335\310\001i\353\230l\000\000\030.\000\000\304\011\000\000"
+    "\330\016\000\000\342\202\265b\001\0064\000\000[\006\022\000\000\000\000a\011\003\r\000\000\000\000\000"
+    "\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000"
+    "y\000\000\011\000\000\000\00013\265b\001\022$\000\000[\006\022s\000\000\000s\000\000\000\000\000\000"
+    "\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000{\215\265b\001!\024\000\000"
+    "[\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\006\007\354\300\265b\001\002\034\000\310"
+    "[\006\022h\307*\335,\265b\001\0064\000\310[\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000"
+    "\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000"
+    "\000\011\000\000\000\000\371\323\265b\001\022$\000\310[\006\022s\000\000\000s\000\000\000\000\000\000"
+    "\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000C\255\265b\001!\024\000\310"
+    "[\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000\006\007\264`\265b\001\002\034\000\220"
+    "\\\006\022h\307*\335\220\002i\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000<\020\245"
+    "\334pq\266\3745\223zo\215\231\034Z\344*\353\332G\243%/@7}sG\002\246\375\013\321\313J\206\035\343\355"
+    "-\024\265b\001\0064\000\220\\\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000"
+    "\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000"
+    "\000\000\000\302\246\265b\001\022$\000\220\\\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000"
+    "\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000\014\360\265b\001!\024\000\220\\\006\022"
+    "(\000\000\000\000\000\000\000\352\007\001\020\014\000\006\007}\023\265b\001\002\034\000X]\006\022\000"
+    "\000\000\000\000\000\000\000\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\351J\265b\001"
+    "\0064\000X]\006\022\000\000\000\000a\011\000\000\000\000\000\000\000\000\000\000\000\000\000\000^\001"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\002\000\000\000\000t\303"
+    "\265b\001\022$\000X]\006\022\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\0002\000\000\000\220\320\003\000\231\271\265b\001!\024\000X]\006\022(\000\000\000"
+    "\000\000\000\000\352\007\001\020\014\000\007\007G\310\265b\0010\310\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\371\254$GPGGA,,,,,,0,00,99.99,,"
+    ",,,,*48\r\n"
+    "\265b\001\002\034\000 ^\006\022h\307*\335X\003i\353\230l\000\000\030.\000\000\304\011\000\000\330\016"
+    "\000\000\227\271\265b\001\0064\000 ^\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000"
+    "\000\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011"
+    "\000\000\000\000TL\265b\001\022$\000 ^\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000\000"
+    "\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000\236v\265b\001!\024\000 ^\006\022(\000\000"
+    "\000\000\000\000\000\352\007\001\020\014\000\007\007\020{\265b\005\001\002\000\006\010\026\077\265b\001"
+    "\002\034\000\350^\006\022h\307*\335\274\003i\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000"
+    "\000\303i\265b\001\0064\000\350^\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000"
+    "\000\000\000^\001\000\000\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000"
+    "\000\000\000\034\354\265b\001\022$\000\350^\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000"
+    "\000\000\244\000\000\000 \252D\0002\000\000\000\220\320\003\000f\226\265b\001\002\034\000\260_\006\022"
+    "h\307*\335 \004i\353\230l\000\000\030.\000\000\304\011\000\000\330\016\000\000\361G\265b\001\0064\000"
+    "\260_\006\022\000\000\000\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000"
+    "\000\000\000\000\000\000\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\345\277\265"
+    "b\001\022$\000\260_\006\022s\000\000\000s\000\000\000\000\000\000\000\244\000\000\000\244\000\000\000"
+    " \252D\0002\000\000\000\220\320\003\000/\331\265b\001!\024\000\260_\006\022(\000\000\000\000\000\000"
+    "\000\352\007\001\020\014\000\007\007\241\316\265b\001\002\034\000x`\006\022h\307*\335\204\004i\353\230"
+    "l\000\000\030.\000\000\304\011\000\000\330\016\000\000\036\022\265b\001\0064\000x`\006\022\000\000\000"
+    "\000a\011\003\r\000\000\000\000\000\000\000\000\000\000\000\000^\001\000\000\000\000\000\000\000\000"
+    "\000\000\000\000\000\000(\000\000\000y\000\000\011\000\000\000\000\256\222\265b\001\022$\000x`\006\022"
+    "s\000\000\000s\000\000\000\000\000\000\000\244\000\000\000\244\000\000\000 \252D\0002\000\000\000\220"
+    "\320\003\000\370\034\265b\001!\024\000x`\006\022(\000\000\000\000\000\000\000\352\007\001\020\014\000"
+    "\007\007j\201";
+
+static const NmeaCorpus NMEA_CORPORA[] = {
+    { "neo6m_cold_start", CORPUS_NMEA, NMEA_CORPUS_0, 17859, 309, 0, 32 },
+    { "synthetic_5hz", CORPUS_NMEA, NMEA_CORPUS_1, 7341, 100, 0, 50 },
+    { "malformed", CORPUS_NMEA, NMEA_CORPUS_2, 6148, 64, 8, 32 },
+    { "ubx_5hz", CORPUS_UBX, NMEA_CORPUS_3, 8400, 200, 0, 50 },
+    { "ubx_malformed", CORPUS_UBX, NMEA_CORPUS_4, 7930, 145, 10, 20 },
+};
+static const int NMEA_CORPUS_COUNT = 5;
+
+#endif // NMEA_CORPUS_H
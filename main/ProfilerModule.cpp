@@ -0,0 +1,79 @@
+#include "ProfilerModule.h"
+
+ProfilerModule::ProfilerModule(const char* profile_name, uint32_t report_interval)
+    : sample_count(0), next_sample(0), iteration_start(0), max_latency(0), total_iterations(0),
+      name(profile_name), report_interval_ms(report_interval), last_report(0) {
+}
+
+void ProfilerModule::beginIteration() {
+    iteration_start = micros();
+}
+
+void ProfilerModule::endIteration() {
+    recordLatency(micros() - iteration_start);
+}
+
+void ProfilerModule::recordLatency(uint32_t us) {
+    samples[next_sample] = us;
+    next_sample = (next_sample + 1) % WINDOW_SIZE;
+    if (sample_count < WINDOW_SIZE) {
+        sample_count++;
+    }
+
+    if (us > max_latency) {
+        max_latency = us;
+    }
+    total_iterations++;
+}
+
+void ProfilerModule::update() {
+    if (millis() - last_report >= report_interval_ms) {
+        printReport();
+        last_report = millis();
+    }
+}
+
+// Nearest-rank percentile over the sorted scratch window
+uint32_t ProfilerModule::percentile(int count, int pct) const {
+    int rank = (count * pct + 99) / 100;
+    if (rank < 1) rank = 1;
+    return sorted[rank - 1];
+}
+
+// Insertion sort: the window is small and mostly clustered around one value
+int ProfilerModule::sortWindow() {
+    int count = sample_count;
+    for (int i = 0; i < count; i++) {
+        uint32_t value = samples[i];
+        int j = i - 1;
+        while (j >= 0 && sorted[j] > value) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = value;
+    }
+    return count;
+}
+
+uint32_t ProfilerModule::getPercentile(int pct) {
+    int count = sortWindow();
+    return count > 0 ? percentile(count, pct) : 0;
+}
+
+void ProfilerModule::printReport() {
+    int count = sortWindow();
+    if (count == 0) {
+        return;
+    }
+
+    // Runs in the profiled task, so the line goes through the log ring rather than the UART
+    LOG_INFO("%s n: %lu  p50: %lu us  p90: %lu us  p99: %lu us  max: %lu us", name, total_iterations,
+             percentile(count, 50), percentile(count, 90), percentile(count, 99), max_latency);
+}
+
+void ProfilerModule::reset() {
+    sample_count = 0;
+    next_sample = 0;
+    max_latency = 0;
+    total_iterations = 0;
+}
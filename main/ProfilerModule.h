@@ -0,0 +1,43 @@
+#ifndef PROFILER_MODULE_H
+#define PROFILER_MODULE_H
+
+#include <Arduino.h>
+#include "Log.h"
+
+class ProfilerModule {
+private:
+    static const int WINDOW_SIZE = 512;  // Iterations kept for percentile estimation
+
+    uint32_t samples[WINDOW_SIZE];       // Iteration latencies in µs (ring buffer)
+    uint32_t sorted[WINDOW_SIZE];        // Scratch copy used when reporting
+    int sample_count;
+    int next_sample;
+
+    uint32_t iteration_start;
+    uint32_t max_latency;
+    uint32_t total_iterations;
+
+    const char* name;
+    const uint32_t report_interval_ms;
+    uint32_t last_report;
+
+    uint32_t percentile(int count, int pct) const;
+    int sortWindow();               // Fills sorted; returns the sample count
+
+public:
+    ProfilerModule(const char* profile_name, uint32_t report_interval = 10000);
+
+    void beginIteration();          // Marks the start of an iteration
+    void endIteration();            // Records the iteration latency
+    void recordLatency(uint32_t us);
+
+    uint32_t getMaxLatency() const { return max_latency; }
+    uint32_t getIterationCount() const { return total_iterations; }
+    uint32_t getPercentile(int pct);    // Nearest rank over the window; 0 before the first iteration
+
+    void update();                  // Prints a report when the interval has elapsed
+    void printReport();             // Prints p50/p90/p99/max latency to Serial
+    void reset();
+};
+
+#endif // PROFILER_MODULE_H
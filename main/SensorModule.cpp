@@ -1,38 +1,82 @@
 #include "SensorModule.h"
 
-SensorModule::SensorModule(int sda_pin, int scl_pin, uint8_t bmp_address, uint8_t mpu_address, float sea_level)
+// MPU6050 register map (subset used by FIFO mode)
+static const uint8_t MPU_REG_SMPLRT_DIV = 0x19;
+static const uint8_t MPU_REG_CONFIG = 0x1A;
+static const uint8_t MPU_REG_FIFO_EN = 0x23;
+static const uint8_t MPU_REG_INT_PIN_CFG = 0x37;
+static const uint8_t MPU_REG_INT_ENABLE = 0x38;
+static const uint8_t MPU_REG_INT_STATUS = 0x3A;
+static const uint8_t MPU_REG_TEMP_OUT_H = 0x41;
+static const uint8_t MPU_REG_USER_CTRL = 0x6A;
+static const uint8_t MPU_REG_FIFO_COUNT_H = 0x72;
+static const uint8_t MPU_REG_FIFO_R_W = 0x74;
+
+static const uint8_t MPU_FIFO_EN_ACCEL_GYRO = 0x78;   // XG, YG, ZG and ACCEL into the FIFO
+static const uint8_t MPU_USER_CTRL_FIFO_EN = 0x40;
+static const uint8_t MPU_USER_CTRL_FIFO_RESET = 0x04;
+static const uint8_t MPU_INT_DATA_RDY = 0x01;
+static const uint8_t MPU_INT_FIFO_OFLOW = 0x10;
+
+// BMP280 register map (subset used by burst reads)
+static const uint8_t BMP_REG_CALIB = 0x88;        // dig_T1 .. dig_P9, 24 bytes little-endian
+static const uint8_t BMP_REG_PRESS_MSB = 0xF7;    // press[19:0] then temp[19:0], 6 bytes
+static const uint8_t BMP_CALIB_BYTES = 24;
+static const uint8_t BMP_DATA_BYTES = 6;
+
+SensorModule::SensorModule(int sda_pin, int scl_pin, uint8_t bmp_address, uint8_t mpu_address, float sea_level,
+                           uint32_t mpu_interval, uint32_t bmp_interval)
     : i2c_sda(sda_pin), i2c_scl(scl_pin), bmp_addr(bmp_address), mpu_addr(mpu_address), 
-      sea_level_hpa(sea_level), bmp_initialized(false), mpu_initialized(false), gps_initialized(false) {
+      sea_level_hpa(sea_level), bmp_initialized(false), mpu_initialized(false), gps_initialized(false),
+      bmp_active_addr(bmp_address), bmp_temperature(0.0), bmp_pressure(0.0), bmp_altitude(0.0),
+      mpu_interval_ms(mpu_interval), bmp_interval_ms(bmp_interval),
+      last_mpu_read(0), last_bmp_read(0), last_gps_update(0), gps_fix_count(0), gps_fix_time(UINT32_MAX), gps_ubx(false),
+      ubx_config_step(UBX_CONFIG_IDLE), ubx_config_index(0), ubx_config_attempt(0), ubx_config_since(0),
+      ubx_config_baud(GPS_NMEA_BAUD), ubx_config_rate_hz(1),
+      mpu_fifo_enabled(false), mpu_int_pin(-1), mpu_sample_period_us(0), mpu_burst_samples(1),
+      mpu_irq_count(0), mpu_notify_task(NULL), mpu_fifo_overflows(0), last_mpu_temperature_read(0),
+      last_attitude_sample(0), geofence(NULL), simulated(false) {
     // Initialize GPS data structure
-    gps_data.valid = false;
-    gps_data.latitude = 0.0;
-    gps_data.longitude = 0.0;
-    gps_data.altitude = 0.0;
-    gps_data.speed = 0.0;
-    gps_data.satellites = 0;
-    gps_data.time = "";
-    gps_data.date = "";
+    memset(&gps_data, 0, sizeof(gps_data));
 }
 
 bool SensorModule::begin() {
+    beginBus();
+    bool bmp_init = beginBMP();
+    bool mpu_init = beginMPU();
+    bool gps_init = beginGPS();
+    return bmp_init || mpu_init || gps_init;
+}
+
+// Both sensors are ready for I2C within a few ms of power-on, long before the sensor task runs
+void SensorModule::beginBus() {
     Wire.begin(i2c_sda, i2c_scl);
-    delay(50);
+}
 
-    bool bmp_init = initializeBMP280();
-    bool mpu_init = initializeMPU6050();
-    bool gps_init = initializeGPS();
+bool SensorModule::beginBMP() {
+    return bmp_initialized || initializeBMP280();
+}
 
-    bmp_initialized = bmp_init;
-    mpu_initialized = mpu_init;
-    gps_initialized = gps_init;
+bool SensorModule::beginMPU() {
+    return mpu_initialized || initializeMPU6050();
+}
 
-    return bmp_init || mpu_init || gps_init;
+bool SensorModule::beginGPS() {
+    if (!gps_initialized) {
+        gps_initialized = initializeGPS();
+    }
+    return gps_initialized;
 }
 
 bool SensorModule::initializeBMP280() {
-    bmp_initialized = bmp.begin(bmp_addr) || bmp.begin(0x77);
+    bmp_active_addr = bmp_addr;
+    bmp_initialized = bmp.begin(bmp_active_addr);
     if (!bmp_initialized) {
-        Serial.println("ERROR: BMP280 not found at 0x76/0x77. Check SDO/CSB/SDA/SCL wiring.");
+        bmp_active_addr = 0x77;
+        bmp_initialized = bmp.begin(bmp_active_addr);
+    }
+    if (!bmp_initialized) {
+        LOG_DEBUG("BMP280 not found at 0x76/0x77");    // Retried; the caller reports it if it never answers
         return false;
     }
     
@@ -42,14 +86,20 @@ bool SensorModule::initializeBMP280() {
                     Adafruit_BMP280::FILTER_X16,
                     Adafruit_BMP280::STANDBY_MS_125);
     
-    Serial.println("BMP280 initialized over I2C");
+    if (!readBMPCalibration()) {
+        LOG_WARN("Failed to read BMP280 calibration");
+        bmp_initialized = false;
+        return false;
+    }
+    
+    LOG_INFO("BMP280 initialized over I2C at 0x%x", (unsigned)bmp_active_addr);
     return true;
 }
 
 bool SensorModule::initializeMPU6050() {
     mpu_initialized = mpu.begin(mpu_addr);
     if (!mpu_initialized) {
-        Serial.println("ERROR: MPU6050 not found at 0x68/0x69. Check AD0/SDA/SCL wiring.");
+        LOG_DEBUG("MPU6050 not found at 0x%x", (unsigned)mpu_addr);     // Retried, as above
         return false;
     }
     
@@ -57,34 +107,433 @@ bool SensorModule::initializeMPU6050() {
     mpu.setGyroRange(MPU6050_RANGE_500_DEG);
     mpu.setFilterBandwidth(MPU6050_BAND_21_HZ);
     
-    Serial.println("MPU6050 initialized over I2C");
+    LOG_INFO("MPU6050 initialized over I2C");
     return true;
 }
 
 bool SensorModule::initializeGPS() {
-    Serial2.begin(9600, SERIAL_8N1, 17, 16);  // RX pin 16, TX pin 17
-    delay(100);
+    Serial2.setRxBufferSize(GPS_RX_BUFFER_SIZE);  // Must precede begin()
+    Serial2.begin(GPS_NMEA_BAUD, SERIAL_8N1, 17, 16);  // RX pin 16, TX pin 17
     
-    Serial.println("GPS initialized using Serial2 with TinyGPS++ library (RX: GPIO16, TX: GPIO17)");
+    // Parse NMEA as it arrives, from the UART driver's event task, instead of polling
+    Serial2.onReceive([this]() { updateGPSData(); });
+    
+    LOG_INFO("GPS initialized using Serial2 with TinyGPS++ library (RX: GPIO16, TX: GPIO17)");
     return true; // GPS doesn't have a direct way to verify connection, so assume success
 }
 
+// ==================== UBX BINARY MODE ====================
+
+bool SensorModule::beginGPSUbx(uint32_t baud, uint16_t rate_hz) {
+    if (!gps_initialized || simulated) {
+        LOG_ERROR("GPS not initialized, UBX mode unavailable");
+        return false;
+    }
+    if (ubx_config_step != UBX_CONFIG_IDLE) {
+        return true;
+    }
+
+    // Replies are read by updateUbxConfig() while configuring, not by the UART callback
+    Serial2.onReceive(NULL);
+    ubx.reset();
+    ubx_config_baud = baud;
+    ubx_config_rate_hz = constrain(rate_hz, 1, 5);  // The NEO-6M navigates at up to 5 Hz
+
+    // Sent at the power-on baud now and again at the target baud once it is in, in case
+    // the receiver kept an earlier configuration through a warm reset
+    configureUbxPort(baud, true);
+    ubx_config_since = millis();
+    ubx_config_step = UBX_CONFIG_PORT;
+    return true;
+}
+
+// One step per call: each wait (port switch, ACK) is a check against millis(), never a delay
+void SensorModule::updateUbxConfig() {
+    uint32_t elapsed = millis() - ubx_config_since;
+
+    switch (ubx_config_step) {
+    case UBX_CONFIG_IDLE:
+        return;
+
+    case UBX_CONFIG_PORT:
+        // The settle time is longer than the frame takes to send at 9600 baud, so the TX FIFO is empty
+        if (elapsed >= UBX_PORT_SETTLE_MS) {
+            Serial2.updateBaudRate(ubx_config_baud);
+            configureUbxPort(ubx_config_baud, true);
+            ubx_config_since = millis();
+            ubx_config_step = UBX_CONFIG_PORT_SETTLE;
+        }
+        return;
+
+    case UBX_CONFIG_PORT_SETTLE:
+        if (elapsed >= UBX_PORT_SETTLE_MS) {
+            while (Serial2.available() > 0) {
+                Serial2.read();     // Whatever arrived across the baud change
+            }
+            ubx.reset();
+            ubx_config_index = 0;
+            ubx_config_attempt = 0;
+            sendUbxConfigMessage();
+            ubx_config_step = UBX_CONFIG_MESSAGES;
+        }
+        return;
+
+    case UBX_CONFIG_MESSAGES: {
+        uint8_t message_id = ubx_config_index < UBX_CONFIG_MESSAGE_COUNT - 1 ? UbxParser::CFG_MSG : UbxParser::CFG_RATE;
+        while (Serial2.available() > 0) {
+            ubx.encode((uint8_t)Serial2.read());
+            bool acked;
+            if (ubx.takeAck(UbxParser::CLASS_CFG, message_id, acked)) {
+                if (!acked) {
+                    finishUbxConfig(false);
+                } else if (++ubx_config_index == UBX_CONFIG_MESSAGE_COUNT) {
+                    finishUbxConfig(true);
+                } else {
+                    ubx_config_attempt = 0;
+                    sendUbxConfigMessage();
+                }
+                return;
+            }
+        }
+        if (elapsed >= UBX_ACK_TIMEOUT_MS) {
+            if (++ubx_config_attempt < UBX_CONFIG_ATTEMPTS) {
+                sendUbxConfigMessage();
+            } else {
+                finishUbxConfig(false);
+            }
+        }
+        return;
+    }
+
+    case UBX_CONFIG_RESTORE:
+        if (elapsed >= UBX_PORT_SETTLE_MS) {
+            Serial2.updateBaudRate(GPS_NMEA_BAUD);
+            ubx.reset();
+            ubx_config_step = UBX_CONFIG_IDLE;
+            Serial2.onReceive([this]() { updateGPSData(); });
+        }
+        return;
+    }
+}
+
+// The message at ubx_config_index: CFG-MSG for each NAV message, then CFG-RATE
+void SensorModule::sendUbxConfigMessage() {
+    static const uint8_t NAV_MESSAGES[UBX_CONFIG_MESSAGE_COUNT - 1] = {
+        UbxParser::NAV_POSLLH, UbxParser::NAV_SOL, UbxParser::NAV_VELNED, UbxParser::NAV_TIMEUTC
+    };
+    if (ubx_config_index < UBX_CONFIG_MESSAGE_COUNT - 1) {
+        uint8_t enable[3] = { UbxParser::CLASS_NAV, NAV_MESSAGES[ubx_config_index], 1 };     // Once per solution
+        sendUbx(UbxParser::CFG_MSG, enable, sizeof(enable));
+    } else {
+        uint16_t period_ms = 1000 / ubx_config_rate_hz;
+        uint8_t rate[6] = { (uint8_t)(period_ms & 0xFF), (uint8_t)(period_ms >> 8), 1, 0, 1, 0 };  // navRate 1, GPS time
+        sendUbx(UbxParser::CFG_RATE, rate, sizeof(rate));
+    }
+    ubx_config_since = millis();
+}
+
+void SensorModule::finishUbxConfig(bool ok) {
+    if (ok) {
+        gps_ubx = true;
+        ubx.reset();
+        ubx_config_step = UBX_CONFIG_IDLE;
+        Serial2.onReceive([this]() { updateGPSData(); });
+        LOG_INFO("GPS in UBX mode at %lu baud, %u Hz", (unsigned long)ubx_config_baud, (unsigned)ubx_config_rate_hz);
+        return;
+    }
+
+    // Back to NMEA at the power-on baud; the callback is reattached once the port has switched
+    gps_ubx = false;
+    configureUbxPort(GPS_NMEA_BAUD, false);
+    ubx_config_since = millis();
+    ubx_config_step = UBX_CONFIG_RESTORE;
+    LOG_ERROR("GPS did not acknowledge the UBX configuration, staying on NMEA");
+}
+
+// CFG-PRT for UART1: 8N1 at baud, UBX and NMEA accepted, one protocol sent.
+// The receiver switches once the message is in; it is not acknowledged reliably at either baud.
+void SensorModule::configureUbxPort(uint32_t baud, bool ubx_output) {
+    uint8_t port[20] = {};
+    port[0] = 1;                        // UART1
+    port[4] = 0xD0;                     // mode: 8 bits, no parity, 1 stop bit
+    port[5] = 0x08;
+    port[8] = (uint8_t)(baud & 0xFF);
+    port[9] = (uint8_t)(baud >> 8);
+    port[10] = (uint8_t)(baud >> 16);
+    port[11] = (uint8_t)(baud >> 24);
+    port[12] = 0x03;                    // inProtoMask: UBX | NMEA
+    port[14] = ubx_output ? 0x01 : 0x02;
+    sendUbx(UbxParser::CFG_PRT, port, sizeof(port));
+}
+
+void SensorModule::sendUbx(uint8_t message_id, const uint8_t* payload, uint16_t length) {
+    uint8_t frame[8 + UbxParser::MAX_PAYLOAD];
+    size_t size = UbxParser::buildMessage(frame, sizeof(frame), UbxParser::CLASS_CFG, message_id, payload, length);
+    Serial2.write(frame, size);
+}
+
+// Temperature, pressure and altitude all come from the last readBMPSample()
 float SensorModule::readBMPTemperature() {
-    return bmp.readTemperature();
+    return bmp_temperature;
 }
 
 float SensorModule::readBMPPressure(){
-    return bmp.readPressure() / 100.0;  // Convert Pa to hPa
+    return bmp_pressure;
 }
 
 float SensorModule::readBMPAltitude() {
-    return bmp.readAltitude(sea_level_hpa);
+    return bmp_altitude;
+}
+
+// ==================== BMP280 BURST READ ====================
+
+bool SensorModule::readBMPCalibration() {
+    uint8_t raw[BMP_CALIB_BYTES];
+    if (!readRegisters(bmp_active_addr, BMP_REG_CALIB, raw, BMP_CALIB_BYTES)) {
+        return false;
+    }
+
+    bmp_calib.dig_T1 = (uint16_t)(raw[1] << 8 | raw[0]);
+    bmp_calib.dig_T2 = (int16_t)(raw[3] << 8 | raw[2]);
+    bmp_calib.dig_T3 = (int16_t)(raw[5] << 8 | raw[4]);
+    bmp_calib.dig_P1 = (uint16_t)(raw[7] << 8 | raw[6]);
+    bmp_calib.dig_P2 = (int16_t)(raw[9] << 8 | raw[8]);
+    bmp_calib.dig_P3 = (int16_t)(raw[11] << 8 | raw[10]);
+    bmp_calib.dig_P4 = (int16_t)(raw[13] << 8 | raw[12]);
+    bmp_calib.dig_P5 = (int16_t)(raw[15] << 8 | raw[14]);
+    bmp_calib.dig_P6 = (int16_t)(raw[17] << 8 | raw[16]);
+    bmp_calib.dig_P7 = (int16_t)(raw[19] << 8 | raw[18]);
+    bmp_calib.dig_P8 = (int16_t)(raw[21] << 8 | raw[20]);
+    bmp_calib.dig_P9 = (int16_t)(raw[23] << 8 | raw[22]);
+    return bmp_calib.dig_P1 != 0;
+}
+
+// One 6-byte burst for pressure and temperature, then Bosch's integer compensation
+// (datasheet section 8.2) and a polynomial altitude approximation
+bool SensorModule::readBMPSample() {
+    uint8_t raw[BMP_DATA_BYTES];
+    if (!readRegisters(bmp_active_addr, BMP_REG_PRESS_MSB, raw, BMP_DATA_BYTES)) {
+        return false;
+    }
+
+    int32_t adc_P = ((int32_t)raw[0] << 12) | ((int32_t)raw[1] << 4) | (raw[2] >> 4);
+    int32_t adc_T = ((int32_t)raw[3] << 12) | ((int32_t)raw[4] << 4) | (raw[5] >> 4);
+    if (adc_T == 0x80000) {
+        return false;  // Measurement skipped / not ready
+    }
+
+    const BMPCalibration& c = bmp_calib;
+
+    int32_t var1 = ((((adc_T >> 3) - ((int32_t)c.dig_T1 << 1))) * ((int32_t)c.dig_T2)) >> 11;
+    int32_t var2 = (((((adc_T >> 4) - ((int32_t)c.dig_T1)) * ((adc_T >> 4) - ((int32_t)c.dig_T1))) >> 12) *
+                    ((int32_t)c.dig_T3)) >> 14;
+    int32_t t_fine = var1 + var2;
+    int32_t temperature_centi = (t_fine * 5 + 128) >> 8;
+
+    int64_t p1 = ((int64_t)t_fine) - 128000;
+    int64_t p2 = p1 * p1 * (int64_t)c.dig_P6;
+    p2 = p2 + ((p1 * (int64_t)c.dig_P5) << 17);
+    p2 = p2 + (((int64_t)c.dig_P4) << 35);
+    p1 = ((p1 * p1 * (int64_t)c.dig_P3) >> 8) + ((p1 * (int64_t)c.dig_P2) << 12);
+    p1 = (((((int64_t)1) << 47) + p1)) * ((int64_t)c.dig_P1) >> 33;
+    if (p1 == 0) {
+        return false;  // Avoid division by zero
+    }
+    int64_t p = 1048576 - adc_P;
+    p = (((p << 31) - p2) * 3125) / p1;
+    p1 = (((int64_t)c.dig_P9) * (p >> 13) * (p >> 13)) >> 25;
+    p2 = (((int64_t)c.dig_P8) * p) >> 19;
+    p = ((p + p1 + p2) >> 8) + (((int64_t)c.dig_P7) << 4);   // Pa in Q24.8
+
+    bmp_temperature = temperature_centi / 100.0f;
+    bmp_pressure = (float)p / (256.0f * 100.0f);               // hPa
+    bmp_altitude = pressureToAltitude(bmp_pressure);
+    return true;
+}
+
+// 44330 * (1 - (p/p0)^0.1903) without pow(): ln(x) from the atanh series and
+// exp() from its Taylor expansion. Within 1 cm of pow() between 800 and 1080 hPa.
+float SensorModule::pressureToAltitude(float pressure_hpa) const {
+    float x = pressure_hpa / sea_level_hpa;
+    float y = (x - 1.0f) / (x + 1.0f);
+    float y2 = y * y;
+    float u = 0.1903f * 2.0f * y * (1.0f + y2 * (1.0f / 3.0f + y2 * (1.0f / 5.0f)));
+    return -44330.0f * u * (1.0f + u * (0.5f + u * (1.0f / 6.0f)));
 }
 
 void SensorModule::readMPUData() {
+    METRICS_SCOPE(STAGE_MPU_READ);
     mpu.getEvent(&accel, &gyro, &temp);
 }
 
+// ==================== MPU6050 FIFO ACQUISITION ====================
+
+bool SensorModule::beginMPUFifo(uint16_t sample_rate_hz, int int_pin, uint16_t burst_samples) {
+    if (!mpu_initialized) {
+        LOG_ERROR("MPU6050 not initialized, FIFO mode unavailable");
+        return false;
+    }
+
+    sample_rate_hz = constrain(sample_rate_hz, 4, 1000);
+    uint8_t divider = 1000 / sample_rate_hz - 1;  // Sample rate = 1 kHz / (1 + divider) with the DLPF on
+    mpu_sample_period_us = 1000UL * (1 + divider);
+
+    // Keep the DLPF bandwidth under half the sample rate
+    uint8_t dlpf = sample_rate_hz >= 500 ? 1    // 184 Hz
+                 : sample_rate_hz >= 200 ? 2    // 94 Hz
+                 : sample_rate_hz >= 100 ? 3    // 44 Hz
+                 : 4;                           // 21 Hz
+
+    Wire.setClock(400000);  // 12 kB/s of FIFO data at 1 kHz needs fast mode
+
+    bool ok = writeRegister(mpu_addr, MPU_REG_CONFIG, dlpf)
+           && writeRegister(mpu_addr, MPU_REG_SMPLRT_DIV, divider)
+           && writeRegister(mpu_addr, MPU_REG_FIFO_EN, MPU_FIFO_EN_ACCEL_GYRO)
+           && writeRegister(mpu_addr, MPU_REG_INT_PIN_CFG, 0x00)  // Active high, push-pull, 50 µs pulse
+           && writeRegister(mpu_addr, MPU_REG_INT_ENABLE, (int_pin >= 0 ? MPU_INT_DATA_RDY : 0) | MPU_INT_FIFO_OFLOW);
+    if (!ok) {
+        LOG_ERROR("Failed to configure MPU6050 FIFO");
+        return false;
+    }
+
+    mpu_burst_samples = constrain(burst_samples, 1, MPU_FIFO_SIZE / MPU_FIFO_SAMPLE_BYTES / 2);
+    mpu_int_pin = int_pin;
+    if (mpu_int_pin >= 0) {
+        pinMode(mpu_int_pin, INPUT);
+        attachInterruptArg(digitalPinToInterrupt(mpu_int_pin), onMPUDataReady, this, RISING);
+    }
+
+    resetMPUFifo();
+    attitude_reader = imu_buffer.createReader();
+    mpu_fifo_enabled = true;
+
+    if (mpu_int_pin >= 0) {
+        LOG_INFO("MPU6050 FIFO enabled at %lu Hz (INT on GPIO%d)", 1000000UL / mpu_sample_period_us, mpu_int_pin);
+    } else {
+        LOG_INFO("MPU6050 FIFO enabled at %lu Hz (polled)", 1000000UL / mpu_sample_period_us);
+    }
+    return true;
+}
+
+void IRAM_ATTR SensorModule::onMPUDataReady(void* arg) {
+    SensorModule* self = static_cast<SensorModule*>(arg);
+
+    // One interrupt per sample; wake the sensor task once per burst
+    if (++self->mpu_irq_count >= self->mpu_burst_samples && self->mpu_notify_task != NULL) {
+        self->mpu_irq_count = 0;
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(self->mpu_notify_task, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+void SensorModule::waitForData(uint32_t timeout_ms) {
+    mpu_notify_task = xTaskGetCurrentTaskHandle();
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms));
+}
+
+void SensorModule::resetMPUFifo() {
+    writeRegister(mpu_addr, MPU_REG_USER_CTRL, MPU_USER_CTRL_FIFO_RESET);
+    writeRegister(mpu_addr, MPU_REG_USER_CTRL, MPU_USER_CTRL_FIFO_EN);
+}
+
+uint16_t SensorModule::drainMPUFifo() {
+    METRICS_SCOPE(STAGE_MPU_FIFO_DRAIN);
+    uint8_t buffer[MPU_MAX_BURST_SAMPLES * MPU_FIFO_SAMPLE_BYTES];
+
+    // Reading INT_STATUS also clears it
+    uint8_t status = 0;
+    if (!readRegisters(mpu_addr, MPU_REG_INT_STATUS, &status, 1) || !readRegisters(mpu_addr, MPU_REG_FIFO_COUNT_H, buffer, 2)) {
+        return 0;
+    }
+    uint16_t count = ((uint16_t)buffer[0] << 8) | buffer[1];
+
+    // After an overflow the FIFO may be misaligned mid-sample; start over
+    if ((status & MPU_INT_FIFO_OFLOW) || count >= MPU_FIFO_SIZE) {
+        mpu_fifo_overflows++;
+        LOG_WARN("MPU6050 FIFO overflow, reset (%lu total)", mpu_fifo_overflows);
+        resetMPUFifo();
+        return 0;
+    }
+
+    uint16_t pending = count / MPU_FIFO_SAMPLE_BYTES;
+    if (pending == 0) {
+        return 0;
+    }
+    uint16_t drained = pending;
+
+    // The newest sample in the FIFO was taken roughly now; older ones are one period apart
+    uint32_t newest_us = micros();
+    uint32_t timestamp_us = newest_us - (uint32_t)(pending - 1) * mpu_sample_period_us;
+
+    while (pending > 0) {
+        uint8_t burst = pending < MPU_MAX_BURST_SAMPLES ? pending : MPU_MAX_BURST_SAMPLES;
+        if (!readRegisters(mpu_addr, MPU_REG_FIFO_R_W, buffer, burst * MPU_FIFO_SAMPLE_BYTES)) {
+            resetMPUFifo();
+            return drained - pending;
+        }
+        decodeMPUFifo(buffer, burst, timestamp_us);
+        pending -= burst;
+    }
+    return drained;
+}
+
+// Converts big-endian FIFO frames, pushes them one period apart from timestamp_us
+// (left at the next sample's time) and keeps the single-sample accessors on the newest
+void SensorModule::decodeMPUFifo(const uint8_t* frames, uint16_t count, uint32_t& timestamp_us) {
+    ImuSample sample;
+    for (uint16_t i = 0; i < count; i++) {
+        const uint8_t* raw = frames + i * MPU_FIFO_SAMPLE_BYTES;
+        sample.timestamp_us = timestamp_us;
+        sample.accel_x = (int16_t)((raw[0] << 8) | raw[1]) * MPU_ACCEL_SCALE;
+        sample.accel_y = (int16_t)((raw[2] << 8) | raw[3]) * MPU_ACCEL_SCALE;
+        sample.accel_z = (int16_t)((raw[4] << 8) | raw[5]) * MPU_ACCEL_SCALE;
+        sample.gyro_x = (int16_t)((raw[6] << 8) | raw[7]) * MPU_GYRO_SCALE;
+        sample.gyro_y = (int16_t)((raw[8] << 8) | raw[9]) * MPU_GYRO_SCALE;
+        sample.gyro_z = (int16_t)((raw[10] << 8) | raw[11]) * MPU_GYRO_SCALE;
+        imu_buffer.push(sample);
+        timestamp_us += mpu_sample_period_us;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    accel.acceleration.x = sample.accel_x;
+    accel.acceleration.y = sample.accel_y;
+    accel.acceleration.z = sample.accel_z;
+    gyro.gyro.x = sample.gyro_x;
+    gyro.gyro.y = sample.gyro_y;
+    gyro.gyro.z = sample.gyro_z;
+}
+
+// The FIFO carries no temperature; read it directly at the regular MPU interval
+void SensorModule::readMPUTemperature() {
+    uint8_t raw[2];
+    if (readRegisters(mpu_addr, MPU_REG_TEMP_OUT_H, raw, 2)) {
+        temp.temperature = (int16_t)((raw[0] << 8) | raw[1]) / 340.0f + 36.53f;
+    }
+}
+
+bool SensorModule::writeRegister(uint8_t address, uint8_t reg, uint8_t value) {
+    Wire.beginTransmission(address);
+    Wire.write(reg);
+    Wire.write(value);
+    return Wire.endTransmission() == 0;
+}
+
+bool SensorModule::readRegisters(uint8_t address, uint8_t reg, uint8_t* buffer, size_t length) {
+    Wire.beginTransmission(address);
+    Wire.write(reg);
+    if (Wire.endTransmission(false) != 0) {
+        return false;
+    }
+    if (Wire.requestFrom(address, length, true) != length) {
+        return false;
+    }
+    Wire.readBytes(buffer, length);
+    return true;
+}
+
 float SensorModule::getMPUTemperature() {
     return temp.temperature;
 }
@@ -114,122 +563,471 @@ float SensorModule::getGyroZ() {
 }
 
 void SensorModule::updateGPSData() {
-    while (Serial2.available()) {
-        char c = Serial2.read();
-        if (gps.encode(c)) {
+    METRICS_SCOPE_US(STAGE_GPS_PARSE);     // Runs in the unpinned UART event task
+    // Bulk reads take the UART lock once per chunk instead of once per character
+    char chunk[GPS_READ_CHUNK];
+    int available;
+    while ((available = Serial2.available()) > 0) {
+        size_t length = Serial2.readBytes(chunk, available < (int)sizeof(chunk) ? available : sizeof(chunk));
+        if (length == 0) {
+            break;
+        }
+        if (gps_ubx) {
+            parseUBX((const uint8_t*)chunk, length);
+        } else {
+            parseNMEA(chunk, length);
+        }
+    }
+}
+
+void SensorModule::parseNMEA(const char* text, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        if (gps.encode(text[i])) {
             updateGPSDataFromLibrary();
         }
     }
 }
 
-GPSData SensorModule::getGPSData() const {
-    return gps_data;
+void SensorModule::parseUBX(const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        if (ubx.encode(data[i])) {
+            updateGPSDataFromUbx();
+        }
+    }
+}
+
+void SensorModule::resetGPS() {
+    gps = TinyGPSPlus();
+    ubx.reset();
+    gps_fix_count = 0;
+    gps_fix_time = UINT32_MAX;
+    portENTER_CRITICAL(&gps_mux);
+    memset(&gps_data, 0, sizeof(gps_data));
+    last_gps_update = 0;
+    portEXIT_CRITICAL(&gps_mux);
+}
+
+void SensorModule::getGPSParserStats(uint32_t& chars, uint32_t& passed, uint32_t& failed) const {
+    chars = gps.charsProcessed() + ubx.getBytes();
+    passed = gps.passedChecksum() + ubx.getMessages();
+    failed = gps.failedChecksum() + ubx.getChecksumFailures();
+}
+
+// ==================== SIMULATED SENSORS ====================
+
+bool SensorModule::beginSimulated(uint16_t imu_sample_rate_hz) {
+    imu_sample_rate_hz = constrain(imu_sample_rate_hz, 4, 1000);
+    mpu_sample_period_us = 1000000UL / imu_sample_rate_hz;
+    attitude_reader = imu_buffer.createReader();
+    temp.temperature = 25.0f;
+
+    // Everything downstream of the bus reads runs as it would on hardware
+    simulated = true;
+    mpu_fifo_enabled = true;
+    bmp_initialized = true;
+    mpu_initialized = true;
+    gps_initialized = true;
+
+    LOG_INFO("Sensors simulated: IMU FIFO at %lu Hz, BMP280, NMEA GPS", 1000000UL / mpu_sample_period_us);
+    return true;
+}
+
+void SensorModule::injectMPUFifo(const uint8_t* frames, uint16_t count, uint32_t timestamp_us) {
+    if (!simulated || count == 0) {
+        return;
+    }
+    METRICS_SCOPE(STAGE_MPU_FIFO_DRAIN);
+    decodeMPUFifo(frames, count, timestamp_us);
+    last_mpu_read = millis();
+}
+
+void SensorModule::injectBMP(float temperature, float pressure_hpa) {
+    if (!simulated) {
+        return;
+    }
+    bmp_temperature = temperature;
+    bmp_pressure = pressure_hpa;
+    bmp_altitude = pressureToAltitude(bmp_pressure);
+    last_bmp_read = millis();
+    navigation.updateBaro(bmp_altitude);
+}
+
+void SensorModule::injectNMEA(const char* text, size_t length) {
+    METRICS_SCOPE_US(STAGE_GPS_PARSE);
+    parseNMEA(text, length);
+}
+
+void SensorModule::injectUBX(const uint8_t* data, size_t length) {
+    METRICS_SCOPE_US(STAGE_GPS_PARSE);
+    parseUBX(data, length);
+}
+
+void SensorModule::update() {
+    METRICS_SCOPE(STAGE_SENSOR_UPDATE);
+    if (ubx_config_step != UBX_CONFIG_IDLE) {
+        updateUbxConfig();
+    }
+
+    uint32_t now = millis();
+    if (simulated) {
+        // The simulator has already pushed this tick's samples through the inject* calls
+    } else if (mpu_fifo_enabled) {
+        if (drainMPUFifo() > 0) {
+            last_mpu_read = now;
+        }
+        if (now - last_mpu_temperature_read >= mpu_interval_ms) {
+            readMPUTemperature();
+            last_mpu_temperature_read = now;
+        }
+    } else if (mpu_initialized && now - last_mpu_read >= mpu_interval_ms) {
+        readMPUData();
+        last_mpu_read = now;
+    }
+    updateAttitude();
+
+    if (bmp_initialized && !simulated && now - last_bmp_read >= bmp_interval_ms) {
+        if (readBMPSample()) {
+            last_bmp_read = now;
+            navigation.updateBaro(bmp_altitude);
+        }
+    }
+
+    // The filter ignores the copy unless the UART task has published a new fix
+    GPSData fix;
+    getGPSData(fix);
+    navigation.updateGPS(fix, attitude);
+
+    publishSnapshot();
+}
+
+void SensorModule::updateAttitude() {
+    if (!mpu_initialized) {
+        return;
+    }
+    METRICS_SCOPE(STAGE_ATTITUDE);
+
+    if (mpu_fifo_enabled) {
+        ImuSample sample;
+        while (imu_buffer.pop(attitude_reader, sample)) {
+            attitude.update(sample);
+            navigation.predict(sample, attitude);
+        }
+        return;
+    }
+
+    // Polled mode: one sample per readMPUData()
+    if (last_mpu_read == last_attitude_sample) {
+        return;
+    }
+    last_attitude_sample = last_mpu_read;
+
+    ImuSample sample;
+    sample.timestamp_us = last_mpu_read * 1000UL;
+    sample.accel_x = accel.acceleration.x;
+    sample.accel_y = accel.acceleration.y;
+    sample.accel_z = accel.acceleration.z;
+    sample.gyro_x = gyro.gyro.x;
+    sample.gyro_y = gyro.gyro.y;
+    sample.gyro_z = gyro.gyro.z;
+    attitude.update(sample);
+    navigation.predict(sample, attitude);
+}
+
+void SensorModule::publishSnapshot() {
+    SensorSnapshot snapshot;
+    snapshot.timestamp_ms = millis();
+
+    snapshot.bmp_timestamp_ms = last_bmp_read;
+    snapshot.bmp_temperature = bmp_temperature;
+    snapshot.bmp_pressure = bmp_pressure;
+    snapshot.bmp_altitude = bmp_altitude;
+
+    snapshot.mpu_timestamp_ms = last_mpu_read;
+    snapshot.mpu_temperature = temp.temperature;
+    snapshot.accel_x = accel.acceleration.x;
+    snapshot.accel_y = accel.acceleration.y;
+    snapshot.accel_z = accel.acceleration.z;
+    snapshot.gyro_x = gyro.gyro.x;
+    snapshot.gyro_y = gyro.gyro.y;
+    snapshot.gyro_z = gyro.gyro.z;
+    snapshot.mpu_sample_count = imu_buffer.getTotalSamples();
+    snapshot.mpu_fifo_overflows = mpu_fifo_overflows;
+
+    attitude.getQuaternion(snapshot.attitude_qw, snapshot.attitude_qx, snapshot.attitude_qy, snapshot.attitude_qz);
+    attitude.getEuler(snapshot.roll, snapshot.pitch, snapshot.yaw);
+    snapshot.attitude_updates = attitude.getUpdateCount();
+
+    navigation.getState(snapshot.navigation);
+    snapshot.navigation_predicts = navigation.getPredictCount();
+    snapshot.navigation_gps_updates = navigation.getGPSUpdateCount();
+
+    portENTER_CRITICAL(&gps_mux);
+    snapshot.gps_timestamp_ms = last_gps_update;
+    snapshot.gps = gps_data;
+    portEXIT_CRITICAL(&gps_mux);
+
+    snapshot_buffer.publish(snapshot);
+}
+
+void SensorModule::getSnapshot(SensorSnapshot& out) const {
+    snapshot_buffer.read(out);
+}
+
+void SensorModule::getGPSData(GPSData& out) const {
+    portENTER_CRITICAL(&gps_mux);
+    out = gps_data;
+    portEXIT_CRITICAL(&gps_mux);
 }
 
 bool SensorModule::isGPSDataValid() const {
-    return gps_data.valid;
+    portENTER_CRITICAL(&gps_mux);
+    bool valid = gps_data.valid;
+    portEXIT_CRITICAL(&gps_mux);
+    return valid;
 }
 
+// Doubles are two words on the ESP32, so even a single field can tear without the lock
 double SensorModule::getLatitude() const {
-    return gps_data.latitude;
+    portENTER_CRITICAL(&gps_mux);
+    double latitude = gps_data.latitude;
+    portEXIT_CRITICAL(&gps_mux);
+    return latitude;
 }
 
 double SensorModule::getLongitude() const {
-    return gps_data.longitude;
+    portENTER_CRITICAL(&gps_mux);
+    double longitude = gps_data.longitude;
+    portEXIT_CRITICAL(&gps_mux);
+    return longitude;
 }
 
 double SensorModule::getGPSAltitude() const {
-    return gps_data.altitude;
+    portENTER_CRITICAL(&gps_mux);
+    double altitude = gps_data.altitude;
+    portEXIT_CRITICAL(&gps_mux);
+    return altitude;
 }
 
 float SensorModule::getSpeed() const {
-    return gps_data.speed;
+    portENTER_CRITICAL(&gps_mux);
+    float speed = gps_data.speed;
+    portEXIT_CRITICAL(&gps_mux);
+    return speed;
 }
 
 int SensorModule::getSatellites() const {
-    return gps_data.satellites;
+    portENTER_CRITICAL(&gps_mux);
+    int satellites = gps_data.satellites;
+    portEXIT_CRITICAL(&gps_mux);
+    return satellites;
 }
 
-String SensorModule::getGPSTime() const {
-    return gps_data.time;
+void SensorModule::getGPSTime(char* out, size_t capacity) const {
+    if (capacity == 0) {
+        return;
+    }
+    portENTER_CRITICAL(&gps_mux);
+    strncpy(out, gps_data.time, capacity - 1);
+    portEXIT_CRITICAL(&gps_mux);
+    out[capacity - 1] = '\0';
+}
+
+void SensorModule::getGPSDate(char* out, size_t capacity) const {
+    if (capacity == 0) {
+        return;
+    }
+    portENTER_CRITICAL(&gps_mux);
+    strncpy(out, gps_data.date, capacity - 1);
+    portEXIT_CRITICAL(&gps_mux);
+    out[capacity - 1] = '\0';
 }
 
-String SensorModule::getGPSDate() const {
-    return gps_data.date;
+// Writes a value 0-99 as two ASCII digits
+static void formatTwoDigits(char* out, int value) {
+    out[0] = '0' + (value / 10) % 10;
+    out[1] = '0' + value % 10;
 }
 
+// Runs in the UART event task; builds the update locally and publishes it under gps_mux
 void SensorModule::updateGPSDataFromLibrary() {
-    gps_data.valid = gps.location.isValid();
+    GPSData update;
+    update.valid = gps.location.isValid();
+    
+    // GGA and RMC both update the location; count the epoch once, by its time
+    bool new_fix = false;
+    if (gps.location.isUpdated()) {
+        uint32_t fix_time = gps.time.isValid() ? gps.time.value() : UINT32_MAX - 1;
+        new_fix = fix_time != gps_fix_time || !gps.time.isValid();
+        gps_fix_time = fix_time;
+    }
+    if (new_fix) {
+        gps_fix_count++;
+    }
+    update.fix_count = gps_fix_count;
     
-    if (gps_data.valid) {
-        gps_data.latitude = gps.location.lat();
-        gps_data.longitude = gps.location.lng();
+    if (update.valid) {
+        update.latitude = gps.location.lat();
+        update.longitude = gps.location.lng();
     } else {
-        gps_data.latitude = 13.37;
-        gps_data.longitude = 13.37;
+        update.latitude = 13.37;
+        update.longitude = 13.37;
     }
     
     if (gps.altitude.isValid()) {
-        gps_data.altitude = gps.altitude.meters();
+        update.altitude = gps.altitude.meters();
     } else {
-        gps_data.altitude = 13.37;
+        update.altitude = 13.37;
     }
     
     if (gps.speed.isValid()) {
-        gps_data.speed = gps.speed.knots();
+        update.speed = gps.speed.knots();
     } else {
-        gps_data.speed = 13.37;
+        update.speed = 13.37;
     }
     
+    if (gps.course.isValid()) {
+        update.course = gps.course.deg();
+    } else {
+        update.course = 0.0f;
+    }
+    update.velocity_valid = gps.speed.isValid();     // Only RMC carries it
+    
     if (gps.satellites.isValid()) {
-        gps_data.satellites = gps.satellites.value();
+        update.satellites = gps.satellites.value();
     } else {
-        gps_data.satellites = -1337;
+        update.satellites = -1337;
     }
     
     if (gps.time.isValid()) {
-        char timeBuffer[10];
-        sprintf(timeBuffer, "%02d%02d%02d", gps.time.hour(), gps.time.minute(), gps.time.second());
-        gps_data.time = String(timeBuffer);
+        setGPSTime(update, gps.time.hour(), gps.time.minute(), gps.time.second());
     } else {
-        gps_data.time = "1337:00:00";
+        clearGPSTime(update);
     }
     
     if (gps.date.isValid()) {
-        char dateBuffer[8];
-        sprintf(dateBuffer, "%02d%02d%02d", gps.date.day(), gps.date.month(), gps.date.year() % 100);
-        gps_data.date = String(dateBuffer);
+        setGPSDate(update, gps.date.day(), gps.date.month(), gps.date.year());
+    } else {
+        clearGPSDate(update);
+    }
+    
+    publishGPSData(update, new_fix);
+}
+
+// Runs in the UART event task, once per complete UBX epoch; missing fields get the NMEA path's placeholders
+void SensorModule::updateGPSDataFromUbx() {
+    const UbxNavEpoch& epoch = ubx.getEpoch();
+    GPSData update;
+    update.valid = (epoch.fix_flags & 0x01) && epoch.fix_type >= 2 && epoch.fix_type <= 4;
+    if (update.valid) {
+        gps_fix_count++;
+    }
+    update.fix_count = gps_fix_count;
+
+    if (update.valid) {
+        update.latitude = epoch.latitude_e7 * 1e-7;
+        update.longitude = epoch.longitude_e7 * 1e-7;
+        update.altitude = epoch.height_msl_mm * 1e-3;
+        update.speed = epoch.ground_speed_cms * CMS_TO_KNOTS;
+        update.course = epoch.heading_e5 * 1e-5f;
+        update.velocity_valid = true;
     } else {
-        gps_data.date = "13/37";
+        update.latitude = 13.37;
+        update.longitude = 13.37;
+        update.altitude = 13.37;
+        update.speed = 13.37;
+        update.course = 0.0f;
+        update.velocity_valid = false;
     }
+    update.satellites = epoch.satellites;
+
+    if (epoch.time_valid) {
+        setGPSTime(update, epoch.hour, epoch.minute, epoch.second);
+        setGPSDate(update, epoch.day, epoch.month, epoch.year);
+    } else {
+        clearGPSTime(update);
+        clearGPSDate(update);
+    }
+
+    publishGPSData(update, update.valid);
 }
 
-void SensorModule::printSensorData() {
+void SensorModule::setGPSTime(GPSData& update, uint8_t hour, uint8_t minute, uint8_t second) {
+    update.hour = hour;
+    update.minute = minute;
+    update.second = second;
+    formatTwoDigits(update.time, hour);
+    formatTwoDigits(update.time + 2, minute);
+    formatTwoDigits(update.time + 4, second);
+    update.time[6] = '\0';
+}
+
+void SensorModule::clearGPSTime(GPSData& update) {
+    update.hour = update.minute = update.second = 0;
+    strlcpy(update.time, "1337:00:00", sizeof(update.time));
+}
+
+void SensorModule::setGPSDate(GPSData& update, uint8_t day, uint8_t month, uint16_t year) {
+    update.day = day;
+    update.month = month;
+    update.year = year;
+    formatTwoDigits(update.date, day);
+    formatTwoDigits(update.date + 2, month);
+    formatTwoDigits(update.date + 4, year % 100);
+    update.date[6] = '\0';
+}
+
+void SensorModule::clearGPSDate(GPSData& update) {
+    update.day = update.month = 0;
+    update.year = 0;
+    strlcpy(update.date, "13/37", sizeof(update.date));
+}
+
+// Publishes a parsed fix under gps_mux and runs the geofence on new positions
+void SensorModule::publishGPSData(const GPSData& update, bool new_fix) {
+    uint32_t now = millis();
+    portENTER_CRITICAL(&gps_mux);
+    gps_data = update;
+    last_gps_update = now;
+    portEXIT_CRITICAL(&gps_mux);
+    
+    // Straight from the parser, so a breach never waits for the sensor task
+    if (new_fix && update.valid && geofence != NULL) {
+        geofence->check(update.latitude, update.longitude);
+    }
+}
+
+void SensorModule::printSensorData() const {
+    METRICS_SCOPE(STAGE_SENSOR_PRINT);
+    // Reads the published snapshot, so this is safe from a task other than the sensor task
+    SensorSnapshot data;
+    getSnapshot(data);
+
     // Print BMP280 data
-    Serial.print("BMP  T: "); Serial.print(readBMPTemperature());  Serial.print(" °C  ");
-    Serial.print("P: ");      Serial.print(readBMPPressure());     Serial.print(" hPa  ");
-    Serial.print("Alt: ");    Serial.print(readBMPAltitude());     Serial.println(" m");
+    Serial.print("BMP  T: "); Serial.print(data.bmp_temperature);  Serial.print(" °C  ");
+    Serial.print("P: ");      Serial.print(data.bmp_pressure);     Serial.print(" hPa  ");
+    Serial.print("Alt: ");    Serial.print(data.bmp_altitude);     Serial.println(" m");
 
     // Print MPU6050 data
-    Serial.print("MPU  T: "); Serial.print(getMPUTemperature()); Serial.println(" °C");
-    Serial.print("Acc  x: "); Serial.print(getAccelX());
-    Serial.print("  y: ");    Serial.print(getAccelY());
-    Serial.print("  z: ");    Serial.println(getAccelZ());
+    Serial.print("MPU  T: "); Serial.print(data.mpu_temperature); Serial.println(" °C");
+    Serial.print("Acc  x: "); Serial.print(data.accel_x);
+    Serial.print("  y: ");    Serial.print(data.accel_y);
+    Serial.print("  z: ");    Serial.println(data.accel_z);
 
-    Serial.print("Gyro x: "); Serial.print(getGyroX());
-    Serial.print("  y: ");    Serial.print(getGyroY());
-    Serial.print("  z: ");    Serial.println(getGyroZ());
+    Serial.print("Gyro x: "); Serial.print(data.gyro_x);
+    Serial.print("  y: ");    Serial.print(data.gyro_y);
+    Serial.print("  z: ");    Serial.println(data.gyro_z);
 
     // Print GPS data
-    Serial.print("GPS  Valid: "); Serial.print(gps_data.valid ? "Yes" : "No");
-    Serial.print("  Sats: "); Serial.println(gps_data.satellites);
-    if (gps_data.valid) {
-        Serial.print("Lat: "); Serial.print(gps_data.latitude, 6);
-        Serial.print("  Lon: "); Serial.print(gps_data.longitude, 6);
-        Serial.print("  Alt: "); Serial.print(gps_data.altitude); Serial.println(" m");
-        Serial.print("Speed: "); Serial.print(gps_data.speed); Serial.print(" knots  ");
-        Serial.print("Time: "); Serial.print(gps_data.time);
-        Serial.print("  Date: "); Serial.println(gps_data.date);
+    const GPSData& fix = data.gps;
+    Serial.print("GPS  Valid: "); Serial.print(fix.valid ? "Yes" : "No");
+    Serial.print("  Sats: "); Serial.println(fix.satellites);
+    if (fix.valid) {
+        Serial.print("Lat: "); Serial.print(fix.latitude, 6);
+        Serial.print("  Lon: "); Serial.print(fix.longitude, 6);
+        Serial.print("  Alt: "); Serial.print(fix.altitude); Serial.println(" m");
+        Serial.print("Speed: "); Serial.print(fix.speed); Serial.print(" knots  ");
+        Serial.print("Time: "); Serial.print(fix.time);
+        Serial.print("  Date: "); Serial.println(fix.date);
     }
 
     Serial.println("-----------------------------");
@@ -7,16 +7,30 @@
 #include <Adafruit_MPU6050.h>
 #include <Adafruit_Sensor.h>
 #include <TinyGPS++.h>
+#include "ImuRingBuffer.h"
+#include "AttitudeEstimator.h"
+#include "NavigationFilter.h"
+#include "GPSData.h"
+#include "UbxParser.h"
+#include "SensorSnapshot.h"
+#include "Geofence.h"
+#include "Log.h"
+#include "Metrics.h"
 
-struct GPSData {
-    bool valid;
-    double latitude;
-    double longitude;
-    double altitude;
-    float speed;
-    int satellites;
-    String time;
-    String date;
+// BMP280 factory trimming parameters (datasheet table 17)
+struct BMPCalibration {
+    uint16_t dig_T1;
+    int16_t dig_T2;
+    int16_t dig_T3;
+    uint16_t dig_P1;
+    int16_t dig_P2;
+    int16_t dig_P3;
+    int16_t dig_P4;
+    int16_t dig_P5;
+    int16_t dig_P6;
+    int16_t dig_P7;
+    int16_t dig_P8;
+    int16_t dig_P9;
 };
 
 class SensorModule {
@@ -38,29 +52,141 @@ private:
     bool mpu_initialized;
     bool gps_initialized;
 
+    // Cached BMP280 readings, refreshed by update() from a single burst read
+    uint8_t bmp_active_addr;
+    BMPCalibration bmp_calib;
+    float bmp_temperature;
+    float bmp_pressure;
+    float bmp_altitude;
+
+    // Cache refresh intervals and the millis() at which each reading was taken
+    uint32_t mpu_interval_ms;
+    uint32_t bmp_interval_ms;
+    uint32_t last_mpu_read;
+    uint32_t last_bmp_read;
+    uint32_t last_gps_update;
+    uint32_t gps_fix_count;             // UART task only; copied into GPSData::fix_count
+    uint32_t gps_fix_time;              // UART task only; gps.time.value() of the last fix counted
+
+    // gps_data is written from the UART event task; readers copy it under this lock
+    static const size_t GPS_RX_BUFFER_SIZE = 1024;
+    static const size_t GPS_READ_CHUNK = 128;
+    static const uint32_t GPS_NMEA_BAUD = 9600;         // NEO-6M power-on default
+    static const uint32_t UBX_ACK_TIMEOUT_MS = 250;
+    static const uint32_t UBX_PORT_SETTLE_MS = 100;
+    static constexpr float CMS_TO_KNOTS = 0.0194384f;
+
+    // UBX binary mode (beginGPSUbx()); the flag is only changed while the UART callback is detached
+    UbxParser ubx;
+    bool gps_ubx;
+
+    // UBX configuration, stepped by update() so the sensor task never waits on the receiver.
+    // While it runs the UART callback is detached and replies are read here.
+    enum UbxConfigStep : uint8_t { UBX_CONFIG_IDLE, UBX_CONFIG_PORT, UBX_CONFIG_PORT_SETTLE, UBX_CONFIG_MESSAGES, UBX_CONFIG_RESTORE };
+    static const uint8_t UBX_CONFIG_MESSAGE_COUNT = 5;  // CFG-MSG for each NAV message, then CFG-RATE
+    static const uint8_t UBX_CONFIG_ATTEMPTS = 2;
+    UbxConfigStep ubx_config_step;
+    uint8_t ubx_config_index;
+    uint8_t ubx_config_attempt;
+    uint32_t ubx_config_since;          // millis() of the last frame sent
+    uint32_t ubx_config_baud;
+    uint16_t ubx_config_rate_hz;
+    mutable portMUX_TYPE gps_mux = portMUX_INITIALIZER_UNLOCKED;
+
+    SnapshotBuffer snapshot_buffer;
+
+    // MPU6050 FIFO mode: samples are drained in bursts into imu_buffer
+    static const uint16_t MPU_FIFO_SIZE = 1024;
+    static const uint8_t MPU_MAX_BURST_SAMPLES = 10;     // Fits the 128-byte Wire buffer
+    bool mpu_fifo_enabled;
+    int mpu_int_pin;
+    uint32_t mpu_sample_period_us;
+    uint16_t mpu_burst_samples;
+    volatile uint16_t mpu_irq_count;
+    TaskHandle_t mpu_notify_task;
+    uint32_t mpu_fifo_overflows;
+    uint32_t last_mpu_temperature_read;
+    ImuRingBuffer imu_buffer;
+
+    // Attitude runs at the IMU sample rate, fed from imu_buffer in FIFO mode
+    AttitudeEstimator attitude;
+    ImuRingBuffer::Reader attitude_reader;
+    uint32_t last_attitude_sample;      // millis() of the last polled sample fed to the filter
+
+    // Predicted with every attitude sample, corrected by GPS fixes and the BMP280
+    NavigationFilter navigation;
+
+    // Optional; checked from the UART task on every new fix
+    Geofence* geofence;
+
+    // Set by beginSimulated(): the bus is never touched and readings arrive through inject*()
+    bool simulated;
+
 private:
     bool initializeBMP280();
     bool initializeMPU6050();
     bool initializeGPS();
     void updateGPSDataFromLibrary();
+    void parseNMEA(const char* text, size_t length);
+    void parseUBX(const uint8_t* data, size_t length);
+    void updateGPSDataFromUbx();
+    void publishGPSData(const GPSData& update, bool new_fix);
+    static void setGPSTime(GPSData& update, uint8_t hour, uint8_t minute, uint8_t second);
+    static void clearGPSTime(GPSData& update);
+    static void setGPSDate(GPSData& update, uint8_t day, uint8_t month, uint16_t year);
+    static void clearGPSDate(GPSData& update);
+    void updateUbxConfig();
+    void sendUbxConfigMessage();
+    void finishUbxConfig(bool ok);
+    void configureUbxPort(uint32_t baud, bool ubx_output);
+    void sendUbx(uint8_t message_id, const uint8_t* payload, uint16_t length);     // CFG class
+    void publishSnapshot();
+
+    bool writeRegister(uint8_t address, uint8_t reg, uint8_t value);
+    bool readRegisters(uint8_t address, uint8_t reg, uint8_t* buffer, size_t length);
+
+    bool readBMPCalibration();
+    bool readBMPSample();
+    float pressureToAltitude(float pressure_hpa) const;
+
+    void resetMPUFifo();
+    uint16_t drainMPUFifo();            // Returns the number of samples pushed
+    void decodeMPUFifo(const uint8_t* frames, uint16_t count, uint32_t& timestamp_us);
+    void readMPUTemperature();
+    void updateAttitude();
+    static void IRAM_ATTR onMPUDataReady(void* arg);
 
 public:
+    // FIFO frame layout and scale factors for the ranges set in initializeMPU6050() (±4 g, ±500 °/s)
+    static const uint8_t MPU_FIFO_SAMPLE_BYTES = 12;                    // Accel XYZ + gyro XYZ, 16-bit big-endian
+    static constexpr float MPU_ACCEL_SCALE = 9.80665f / 8192.0f;        // LSB -> m/s²
+    static constexpr float MPU_GYRO_SCALE = (PI / 180.0f) / 65.5f;      // LSB -> rad/s
+
     SensorModule(
       int sda_pin = 21,
       int scl_pin = 22, 
       uint8_t bmp_address = 0x76, 
       uint8_t mpu_address = 0x68,
-      float sea_level = 1023
+      float sea_level = 1023,
+      uint32_t mpu_interval = 10,    // 100 Hz
+      uint32_t bmp_interval = 125    // Matches BMP280 standby time
     );
     
-    bool begin();
+    bool begin();                  // Probes every sensor once; true if any answered
+
+    // The same bring-up in steps, for a caller that retries missing sensors instead of
+    // waiting on them: beginBus() first, then each begin*() until it returns true
+    void beginBus();
+    bool beginBMP();
+    bool beginMPU();
+    bool beginGPS();               // Opens the UART; there is no way to probe the receiver
     bool isBMPInitialized() const { return bmp_initialized; }
     bool isMPUInitialized() const { return mpu_initialized; }
     bool isGPSInitialized() const { return gps_initialized; }
     
-    float readBMPTemperature();    // Returns temperature in °C
-    float readBMPPressure();       // Returns pressure in hPa
-    float readBMPAltitude();       // Returns altitude in meters
+    float readBMPTemperature();    // Returns cached temperature in °C
+    float readBMPPressure();       // Returns cached pressure in hPa
+    float readBMPAltitude();       // Returns cached altitude in meters
     
     void readMPUData();            // Updates internal sensor data
     float getMPUTemperature();  // Returns MPU temperature in °C
@@ -71,18 +197,58 @@ public:
     float getGyroY();        // Returns gyro Y in rad/s
     float getGyroZ();        // Returns gyro Z in rad/s
     
-    void updateGPSData();           // Reads and parses GPS data
-    GPSData getGPSData() const;     // Returns current GPS data
+    void updateGPSData();           // Parses pending NMEA bytes; runs on every UART RX event
+    void getGPSData(GPSData& out) const;  // Copies current GPS data
+    // Each getter reads one field under gps_mux; fields from separate calls may come from
+    // different fixes, so take getGPSData() when they must agree
     bool isGPSDataValid() const;    // Returns if GPS has valid fix
     double getLatitude() const;     // Returns latitude
     double getLongitude() const;    // Returns longitude
     double getGPSAltitude() const;  // Returns GPS altitude
     float getSpeed() const;         // Returns speed in knots
     int getSatellites() const;      // Returns number of satellites
-    String getGPSTime() const;      // Returns GPS time
-    String getGPSDate() const;      // Returns GPS date
+    void getGPSTime(char* out, size_t capacity) const;  // Copies GPS time ("hhmmss")
+    void getGPSDate(char* out, size_t capacity) const;  // Copies GPS date ("ddmmyy")
+
+    // Starts switching the receiver to UBX binary output (NAV-POSLLH/SOL/VELNED/TIMEUTC) at a
+    // higher baud and up to 5 Hz; update() carries it out over the next few hundred ms (sensor
+    // task only). If the receiver does not acknowledge, it is put back to NMEA.
+    bool beginGPSUbx(uint32_t baud = 115200, uint16_t rate_hz = 5);
+    bool isGPSConfiguring() const { return ubx_config_step != UBX_CONFIG_IDLE; }
+    bool isGPSUbx() const { return gps_ubx; }
     
-    void printSensorData();  // Prints all sensor data to Serial
+    // Switches the MPU6050 to FIFO acquisition at up to 1 kHz. With int_pin wired to the
+    // MPU INT line, waitForData() wakes once per burst; otherwise the FIFO is polled.
+    bool beginMPUFifo(uint16_t sample_rate_hz = 1000, int int_pin = -1, uint16_t burst_samples = 8);
+    bool isMPUFifoEnabled() const { return mpu_fifo_enabled; }
+    ImuRingBuffer& getIMUBuffer() { return imu_buffer; }
+    uint32_t getMPUFifoOverflows() const { return mpu_fifo_overflows; }
+    void waitForData(uint32_t timeout_ms);          // Blocks until an IMU burst is ready or the timeout expires
+    const AttitudeEstimator& getAttitude() const { return attitude; }  // Sensor task only; others use the snapshot
+    const NavigationFilter& getNavigation() const { return navigation; }
+    void setGeofence(Geofence* fence) { geofence = fence; }
+
+    void setMPUInterval(uint32_t interval_ms) { mpu_interval_ms = interval_ms; }
+    void setBMPInterval(uint32_t interval_ms) { bmp_interval_ms = interval_ms; }
+    uint32_t getMPUInterval() const { return mpu_interval_ms; }
+    uint32_t getBMPInterval() const { return bmp_interval_ms; }
+
+    // Software-in-the-loop: instead of begin(), mark every sensor present and take
+    // readings from a simulator (sensor task only). FIFO frames use the register
+    // layout, so the same decoding, attitude and navigation code runs as on hardware.
+    bool beginSimulated(uint16_t imu_sample_rate_hz = 1000);
+    bool isSimulated() const { return simulated; }
+    void injectMPUFifo(const uint8_t* frames, uint16_t count, uint32_t timestamp_us);  // timestamp of the first frame
+    void injectBMP(float temperature, float pressure_hpa);
+    void injectNMEA(const char* text, size_t length);    // Also for benchmarks; never while the UART callback runs
+    void injectUBX(const uint8_t* data, size_t length);  // Likewise, through the UBX decoder
+    void resetGPS();                                    // Forgets parser state and the last fix
+    void getGPSParserStats(uint32_t& chars, uint32_t& passed, uint32_t& failed) const;  // NMEA and UBX counters combined
+
+    void update();                                  // Polls due sensors and publishes a snapshot (sensor task only)
+    void getSnapshot(SensorSnapshot& out) const;    // Latest published snapshot, safe from any task
+
+    void printSensorData() const;  // Prints the latest snapshot to Serial, safe from any task
 };
 
 #endif // SENSOR_MODULE_H
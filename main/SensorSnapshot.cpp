@@ -0,0 +1,43 @@
+#include "SensorSnapshot.h"
+
+SnapshotBuffer::SnapshotBuffer() : latest(0), published(0) {
+    for (int i = 0; i < 2; i++) {
+        slots[i].sequence.store(0, std::memory_order_relaxed);
+        memset(&slots[i].data, 0, sizeof(SensorSnapshot));
+    }
+}
+
+void SnapshotBuffer::publish(const SensorSnapshot& snapshot) {
+    uint32_t index = latest.load(std::memory_order_relaxed) ^ 1;
+    Slot& slot = slots[index];
+
+    // Mark the slot as being written (odd sequence)
+    uint32_t seq = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.data = snapshot;
+    slot.data.sequence = ++published;
+
+    // Mark the slot as stable again and make it the one readers pick up
+    slot.sequence.store(seq + 2, std::memory_order_release);
+    latest.store(index, std::memory_order_release);
+}
+
+void SnapshotBuffer::read(SensorSnapshot& out) const {
+    for (;;) {
+        const Slot& slot = slots[latest.load(std::memory_order_acquire)];
+
+        uint32_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;  // Writer lapped us and is filling this slot, pick again
+        }
+
+        out = slot.data;
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (slot.sequence.load(std::memory_order_relaxed) == before) {
+            return;
+        }
+    }
+}
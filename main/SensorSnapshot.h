@@ -0,0 +1,77 @@
+#ifndef SENSOR_SNAPSHOT_H
+#define SENSOR_SNAPSHOT_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "GPSData.h"
+#include "NavigationFilter.h"
+
+// Plain copy of every sensor reading, published by the sensor task as one unit
+struct SensorSnapshot {
+    uint32_t sequence;          // Incremented on every publish
+    uint32_t timestamp_ms;      // millis() when the snapshot was published
+
+    // Each sensor group carries the millis() at which it was last sampled (0 = never)
+
+    // BMP280
+    uint32_t bmp_timestamp_ms;
+    float bmp_temperature;      // °C
+    float bmp_pressure;         // hPa
+    float bmp_altitude;         // m
+
+    // MPU6050
+    uint32_t mpu_timestamp_ms;
+    float mpu_temperature;      // °C
+    float accel_x;              // m/s²
+    float accel_y;
+    float accel_z;
+    float gyro_x;               // rad/s
+    float gyro_y;
+    float gyro_z;
+    uint32_t mpu_sample_count;      // Samples pushed to the IMU ring buffer (FIFO mode)
+    uint32_t mpu_fifo_overflows;
+
+    // Attitude (AttitudeEstimator)
+    float attitude_qw;
+    float attitude_qx;
+    float attitude_qy;
+    float attitude_qz;
+    float roll;                 // degrees
+    float pitch;
+    float yaw;
+    uint32_t attitude_updates;
+
+    // Fused position/velocity (NavigationFilter)
+    NavigationState navigation;
+    uint32_t navigation_predicts;
+    uint32_t navigation_gps_updates;
+
+    // GPS
+    uint32_t gps_timestamp_ms;  // Last complete NMEA sentence or UBX epoch
+    GPSData gps;
+};
+
+// Single-writer, multi-reader exchange for SensorSnapshot.
+// The writer alternates between two slots, each guarded by its own sequence
+// counter (odd while being written). Readers copy the most recently completed
+// slot and retry only if the writer lapped them, so the writer never waits.
+class SnapshotBuffer {
+private:
+    struct Slot {
+        std::atomic<uint32_t> sequence;
+        SensorSnapshot data;
+    };
+
+    Slot slots[2];
+    std::atomic<uint32_t> latest;   // Index of the last completed slot
+    uint32_t published;
+
+public:
+    SnapshotBuffer();
+
+    void publish(const SensorSnapshot& snapshot);   // Writer side, never blocks
+    void read(SensorSnapshot& out) const;           // Reader side, lock-free
+    uint32_t getPublishCount() const { return published; }
+};
+
+#endif // SENSOR_SNAPSHOT_H
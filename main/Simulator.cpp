@@ -0,0 +1,217 @@
+#include "Simulator.h"
+
+static const float GRAVITY = 9.80665f;
+static const float MPS_TO_KNOTS = 1.943844f;
+static const uint32_t GPS_START_SECONDS = 12 * 3600UL;     // Simulated UTC clock starts at noon
+
+Simulator::Simulator(SensorModule& sensor_module, ActuatorModule& actuator_module,
+                     double latitude, double longitude, float heading, uint16_t imu_sample_rate_hz)
+    : sensor_module(sensor_module), actuator_module(actuator_module),
+      imu_period_us(1000000UL / constrain(imu_sample_rate_hz, 4, 1000)),
+      origin_latitude(latitude), origin_longitude(longitude),
+      meters_per_deg_lon(METERS_PER_DEG_LAT * cos(latitude * DEG_TO_RAD)),
+      north(0.0f), east(0.0f), heading(heading), speed(0.0f), yaw_rate(0.0f), surge_accel(0.0f),
+      rudder_angle(RUDDER_CENTER), motor_duty(0.0f),
+      started(false), sim_us(0), last_bmp_us(0), last_gps_us(0),
+      steps(0), skipped_us(0), gps_sentences(0), rng_state(0x2545F491) {
+}
+
+void Simulator::update() {
+    uint32_t now = micros();
+    if (!started) {
+        // The first sensor readings go out on this call
+        sim_us = now;
+        last_bmp_us = now - BMP_PERIOD_US;
+        last_gps_us = now - GPS_PERIOD_US;
+        started = true;
+        LOG_INFO("Simulator started at %.6f, %.6f heading %.0f°", origin_latitude, origin_longitude, heading);
+    }
+
+    readActuators();
+
+    uint32_t due = (now - sim_us) / imu_period_us;
+    if (due > MAX_STEPS_PER_UPDATE) {
+        // The sensor task stalled; jump ahead rather than flood the IMU buffer
+        uint32_t skip = (due - MAX_STEPS_PER_UPDATE) * imu_period_us;
+        sim_us += skip;
+        skipped_us += skip;
+        due = MAX_STEPS_PER_UPDATE;
+    }
+
+    // One IMU frame per step, handed over in FIFO-sized batches
+    uint8_t frames[MAX_BATCH_FRAMES * SensorModule::MPU_FIFO_SAMPLE_BYTES];
+    uint16_t batch = 0;
+    uint32_t batch_start_us = 0;
+    const float dt = imu_period_us * 1e-6f;
+    while (due > 0) {
+        sim_us += imu_period_us;
+        step(dt);
+        if (batch == 0) {
+            batch_start_us = sim_us;
+        }
+        encodeImuFrame(frames + batch * SensorModule::MPU_FIFO_SAMPLE_BYTES);
+        if (++batch == MAX_BATCH_FRAMES) {
+            sensor_module.injectMPUFifo(frames, batch, batch_start_us);
+            batch = 0;
+        }
+        due--;
+    }
+    if (batch > 0) {
+        sensor_module.injectMPUFifo(frames, batch, batch_start_us);
+    }
+
+    // Slow sensors: at most one reading per call, resynchronised after a skip
+    if (sim_us - last_bmp_us >= BMP_PERIOD_US) {
+        last_bmp_us += BMP_PERIOD_US;
+        if (sim_us - last_bmp_us >= BMP_PERIOD_US) {
+            last_bmp_us = sim_us;
+        }
+        sendBMP();
+    }
+    if (sim_us - last_gps_us >= GPS_PERIOD_US) {
+        last_gps_us += GPS_PERIOD_US;
+        if (sim_us - last_gps_us >= GPS_PERIOD_US) {
+            last_gps_us = sim_us;
+        }
+        sendGPS();
+    }
+}
+
+// Held for every step of this update(), as the PWM would be between ramp ticks
+void Simulator::readActuators() {
+    rudder_angle = actuator_module.isServoInitialized()
+                 ? actuator_module.dutyToAngle(ledcRead(actuator_module.getServoChannel())) : RUDDER_CENTER;
+
+    motor_duty = 0.0f;
+    if (actuator_module.isMotorInitialized()) {
+        float magnitude = ledcRead(actuator_module.getMotorChannel()) / 255.0f;
+        bool ahead = digitalRead(actuator_module.getMotorIn1Pin()) == HIGH;
+        bool astern = digitalRead(actuator_module.getMotorIn2Pin()) == HIGH;
+        motor_duty = ahead && !astern ? magnitude : astern && !ahead ? -magnitude : 0.0f;
+    }
+}
+
+// Surge: quadratic thrust from the motor duty against quadratic drag, so full
+// ahead settles at MAX_SPEED. Yaw: first-order Nomoto, rudder authority scaled by speed.
+void Simulator::step(float dt) {
+    float duty = motor_duty;
+    float thrust = DRAG * MAX_SPEED * MAX_SPEED * duty * fabsf(duty);
+    if (duty < 0.0f) {
+        thrust *= ASTERN_EFFICIENCY;
+    }
+    surge_accel = thrust - DRAG * speed * fabsf(speed);
+    speed += surge_accel * dt;
+
+    float rudder = (rudder_angle - RUDDER_CENTER) * DEG_TO_RAD;
+    float steady_rate = NOMOTO_GAIN * rudder * (speed / MAX_SPEED) * RAD_TO_DEG;
+    yaw_rate += (steady_rate - yaw_rate) * dt / NOMOTO_TIME;
+    heading = fmodf(heading + yaw_rate * dt, 360.0f);
+    if (heading < 0.0f) {
+        heading += 360.0f;
+    }
+
+    float heading_rad = heading * DEG_TO_RAD;
+    north += speed * cosf(heading_rad) * dt;
+    east += speed * sinf(heading_rad) * dt;
+    steps++;
+}
+
+// Level boat, body axes x forward, y to port, z up. The IMU yaw axis is
+// counterclockwise-positive (see NavigationFilter), compass heading is not.
+void Simulator::encodeImuFrame(uint8_t* frame) {
+    float yaw_rate_rad = yaw_rate * DEG_TO_RAD;
+    float centripetal = -speed * yaw_rate_rad;      // Toward the inside of the turn
+
+    encodeInt16(frame + 0, surge_accel + noise(ACCEL_NOISE), SensorModule::MPU_ACCEL_SCALE);
+    encodeInt16(frame + 2, centripetal + noise(ACCEL_NOISE), SensorModule::MPU_ACCEL_SCALE);
+    encodeInt16(frame + 4, GRAVITY + noise(ACCEL_NOISE), SensorModule::MPU_ACCEL_SCALE);
+    encodeInt16(frame + 6, noise(GYRO_NOISE), SensorModule::MPU_GYRO_SCALE);
+    encodeInt16(frame + 8, noise(GYRO_NOISE), SensorModule::MPU_GYRO_SCALE);
+    encodeInt16(frame + 10, -yaw_rate_rad + noise(GYRO_NOISE), SensorModule::MPU_GYRO_SCALE);
+}
+
+void Simulator::sendBMP() {
+    sensor_module.injectBMP(WATER_TEMPERATURE + noise(0.05f), SEA_LEVEL_HPA + noise(0.02f));
+}
+
+// One GGA and one RMC per second, as the NEO-6M sends by default
+void Simulator::sendGPS() {
+    double latitude = origin_latitude + (north + noise(GPS_NOISE)) / METERS_PER_DEG_LAT;
+    double longitude = origin_longitude + (east + noise(GPS_NOISE)) / meters_per_deg_lon;
+    float knots = fabsf(speed) * MPS_TO_KNOTS;
+    float course = speed >= 0.0f ? heading : fmodf(heading + 180.0f, 360.0f);
+
+    uint32_t clock = (GPS_START_SECONDS + gps_sentences / 2) % 86400UL;
+    unsigned hour = clock / 3600;
+    unsigned minute = clock / 60 % 60;
+    unsigned second = clock % 60;
+
+    char position[48];
+    size_t length = formatCoordinate(position, sizeof(position), latitude, 2, 'N', 'S');
+    position[length++] = ',';
+    formatCoordinate(position + length, sizeof(position) - length, longitude, 3, 'E', 'W');
+
+    char body[128];
+    char sentences[256];
+    size_t used = 0;
+    snprintf(body, sizeof(body), "GPGGA,%02u%02u%02u.00,%s,1,08,0.9,0.0,M,16.0,M,,", hour, minute, second, position);
+    used += appendSentence(sentences + used, sizeof(sentences) - used, body);
+    snprintf(body, sizeof(body), "GPRMC,%02u%02u%02u.00,A,%s,%.2f,%.1f,160126,,,A",
+             hour, minute, second, position, knots, course);
+    used += appendSentence(sentences + used, sizeof(sentences) - used, body);
+
+    sensor_module.injectNMEA(sentences, used);
+    gps_sentences += 2;
+
+    if (gps_sentences % 20 == 0) {
+        LOG_INFO("Sim truth: %.6f, %.6f heading %.1f° speed %.2f m/s", getLatitude(), getLongitude(), heading, speed);
+    }
+}
+
+// Sum of four uniforms: close enough to Gaussian for sensor noise, and cheap
+float Simulator::noise(float sigma) {
+    float sum = 0.0f;
+    for (int i = 0; i < 4; i++) {
+        rng_state ^= rng_state << 13;
+        rng_state ^= rng_state >> 17;
+        rng_state ^= rng_state << 5;
+        sum += (int32_t)rng_state * (1.0f / 2147483648.0f);
+    }
+    return sum * 0.866f * sigma;    // Each uniform has variance 1/3
+}
+
+void Simulator::encodeInt16(uint8_t* out, float value, float scale) {
+    long raw = constrain(lroundf(value / scale), -32768L, 32767L);
+    out[0] = (uint8_t)((raw >> 8) & 0xFF);
+    out[1] = (uint8_t)(raw & 0xFF);
+}
+
+// Writes "$<body>*<checksum>\r\n"; returns the length written
+size_t Simulator::appendSentence(char* buffer, size_t capacity, const char* body) {
+    uint8_t checksum = 0;
+    for (const char* p = body; *p; p++) {
+        checksum ^= (uint8_t)*p;
+    }
+    int length = snprintf(buffer, capacity, "$%s*%02X\r\n", body, checksum);
+    if (length < 0) {
+        return 0;
+    }
+    return (size_t)length < capacity ? (size_t)length : capacity - 1;
+}
+
+// NMEA "ddmm.mmmmm,H" (or "dddmm.mmmmm,H"); returns the length written
+size_t Simulator::formatCoordinate(char* buffer, size_t capacity, double degrees, int degree_digits, char positive, char negative) {
+    char hemisphere = degrees < 0.0 ? negative : positive;
+    degrees = fabs(degrees);
+    int whole = (int)degrees;
+    double minutes = (degrees - whole) * 60.0;
+    if (minutes >= 59.999995) {
+        whole++;        // Would round up to 60.00000
+        minutes = 0.0;
+    }
+    int length = snprintf(buffer, capacity, "%0*d%08.5f,%c", degree_digits, whole, minutes, hemisphere);
+    if (length < 0) {
+        return 0;
+    }
+    return (size_t)length < capacity ? (size_t)length : capacity - 1;
+}
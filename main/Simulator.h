@@ -0,0 +1,108 @@
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include <Arduino.h>
+#include "SensorModule.h"
+#include "ActuatorModule.h"
+#include "Log.h"
+
+// Set to 1 to run against the simulated boat instead of the sensors (software in the loop)
+#ifndef SIMULATION_ENABLED
+#define SIMULATION_ENABLED 0
+#endif
+
+// Software-in-the-loop boat for testing without water or sensors. The hull is
+// a surge model (quadratic prop thrust against quadratic drag) plus a first
+// order Nomoto yaw model whose rudder authority grows with speed. Its inputs
+// are read back from the hardware each update(): the servo pulse and motor
+// duty from the LEDC channels (ledcRead) and the direction from the driver's
+// IN1/IN2 pins, so they are what the ramps actually wrote. Its outputs go back
+// into SensorModule as big-endian MPU6050 FIFO frames, BMP280
+// temperature/pressure and NMEA GGA/RMC sentences, so parsing, attitude,
+// navigation, geofence, autopilot and mission code all run unmodified. There
+// is no bus or UART to drive on the board, so the outputs skip the
+// register/UART reads; the host tests cover those against the device models.
+//
+// update() must be called from the sensor task, before SensorModule::update().
+// The boat is stepped at the IMU sample period up to micros(). On the board
+// that is real time; in the host build (host/) micros() is the scheduler's
+// virtual clock, so the hull, the sensor timestamps and every firmware timer
+// advance together and a long mission replays as fast as the host can step it.
+class Simulator {
+private:
+    SensorModule& sensor_module;
+    ActuatorModule& actuator_module;
+    const uint32_t imu_period_us;
+
+    // Boat state in a north/east plane around the start position
+    double origin_latitude;
+    double origin_longitude;
+    double meters_per_deg_lon;
+    float north;                // m
+    float east;                 // m
+    float heading;              // degrees, 0-360
+    float speed;                // m/s through the water, negative astern
+    float yaw_rate;             // degrees/s, positive to starboard
+    float surge_accel;          // m/s², last step
+    float rudder_angle;         // Servo angle from the LEDC pulse, degrees
+    float motor_duty;           // -1..1 from the LEDC duty and IN1/IN2
+
+    // Simulated time, kept in step with micros() (virtual on the host)
+    bool started;
+    uint32_t sim_us;
+    uint32_t last_bmp_us;
+    uint32_t last_gps_us;
+    uint32_t steps;
+    uint32_t skipped_us;        // Time dropped after the sensor task fell too far behind
+    uint32_t gps_sentences;
+    uint32_t rng_state;
+
+    static const uint16_t MAX_STEPS_PER_UPDATE = 100;   // Beyond this the backlog is dropped
+    static const uint8_t MAX_BATCH_FRAMES = 16;
+    static const uint32_t BMP_PERIOD_US = 125000;       // BMP280 standby time
+    static const uint32_t GPS_PERIOD_US = 1000000;      // NEO-6M default 1 Hz
+    static const int RUDDER_CENTER = 90;                // Servo angle for a straight rudder, as in HeadingController
+
+    // Hull and propulsion
+    static constexpr float MAX_SPEED = 2.0f;            // m/s at full ahead
+    static constexpr float DRAG = 0.25f;                // 1/m: deceleration per (m/s)²
+    static constexpr float ASTERN_EFFICIENCY = 0.6f;    // Prop thrust astern relative to ahead
+    static constexpr float NOMOTO_GAIN = 0.5f;          // Steady turn rate per rudder radian at MAX_SPEED, 1/s
+    static constexpr float NOMOTO_TIME = 1.5f;          // s
+
+    // Sensor noise (standard deviations) and environment
+    static constexpr float GYRO_NOISE = 0.002f;         // rad/s
+    static constexpr float ACCEL_NOISE = 0.05f;         // m/s²
+    static constexpr float GPS_NOISE = 1.5f;            // m per axis
+    static constexpr float SEA_LEVEL_HPA = 1023.0f;     // SensorModule's reference, so the boat reads 0 m
+    static constexpr float WATER_TEMPERATURE = 18.0f;   // °C
+    static constexpr double METERS_PER_DEG_LAT = 111320.0;
+
+    void readActuators();
+    void step(float dt);
+    void encodeImuFrame(uint8_t* frame);
+    void sendGPS();
+    void sendBMP();
+    float noise(float sigma);
+    static void encodeInt16(uint8_t* out, float value, float scale);
+    static size_t appendSentence(char* buffer, size_t capacity, const char* body);
+    static size_t formatCoordinate(char* buffer, size_t capacity, double degrees, int degree_digits, char positive, char negative);
+
+public:
+    Simulator(SensorModule& sensor_module, ActuatorModule& actuator_module,
+              double latitude = -34.5443, double longitude = -58.4399,    // Start position
+              float heading = 0.0f, uint16_t imu_sample_rate_hz = 1000);
+
+    void update();                  // Steps the boat up to now and feeds the sensor module
+
+    double getLatitude() const { return origin_latitude + north / METERS_PER_DEG_LAT; }
+    double getLongitude() const { return origin_longitude + east / meters_per_deg_lon; }
+    float getHeading() const { return heading; }
+    float getSpeed() const { return speed; }
+    float getYawRate() const { return yaw_rate; }
+    uint32_t getSteps() const { return steps; }
+    uint32_t getSkippedMicros() const { return skipped_us; }
+    uint32_t getGPSSentences() const { return gps_sentences; }
+};
+
+#endif // SIMULATOR_H
@@ -0,0 +1,110 @@
+#include "TelemetryDownlink.h"
+
+TelemetryDownlink::TelemetryDownlink(SensorModule& sensor_module, ActuatorModule& actuator_module,
+                                     uint16_t udp_port, uint32_t rate_hz)
+    : sensor_module(sensor_module), actuator_module(actuator_module),
+      port(udp_port), active(false), last_frame(0), sequence(0),
+      frames_sent(0), send_failures(0), encode_us_total(0), encode_us_max(0) {
+    setRate(rate_hz);
+}
+
+bool TelemetryDownlink::begin() {
+    if (WiFi.status() != WL_CONNECTED) {
+        LOG_ERROR("Telemetry downlink needs WiFi");
+        return false;
+    }
+
+    destination = WiFi.broadcastIP();
+    active = true;
+
+    LOG_INFO("Telemetry downlink broadcasting to %u.%u.%u.%u:%u at %lu Hz",
+             destination[0], destination[1], destination[2], destination[3], (unsigned)port, (unsigned long)rate_hz);
+    return true;
+}
+
+void TelemetryDownlink::setRate(uint32_t rate) {
+    rate_hz = constrain(rate, MIN_RATE_HZ, MAX_RATE_HZ);
+    interval_us = 1000000UL / rate_hz;
+}
+
+void TelemetryDownlink::update() {
+    if (!active || micros() - last_frame < interval_us) {
+        return;
+    }
+    // Frames are due on a fixed grid, so the web task's 1 ms tick does not stretch every interval;
+    // after a stall the grid restarts rather than sending a burst
+    last_frame += interval_us;
+    if (micros() - last_frame >= interval_us) {
+        last_frame = micros();
+    }
+    METRICS_SCOPE(STAGE_TELEMETRY_DOWNLINK);
+
+    uint32_t start = micros();
+    TelemetryFrame frame;
+    encodeFrame(frame);
+    uint32_t elapsed = micros() - start;
+    encode_us_total += elapsed;
+    if (elapsed > encode_us_max) {
+        encode_us_max = elapsed;
+    }
+
+    // Sequence numbers advance even for failed sends so the receiver sees them as loss
+    if (!udp.beginPacket(destination, port)) {
+        send_failures++;
+        return;
+    }
+    udp.write((const uint8_t*)&frame, sizeof(frame));
+    if (udp.endPacket()) {
+        frames_sent++;
+    } else {
+        send_failures++;
+    }
+}
+
+void TelemetryDownlink::encodeFrame(TelemetryFrame& frame) {
+    SensorSnapshot snapshot;
+    sensor_module.getSnapshot(snapshot);
+    const NavigationState& nav = snapshot.navigation;
+
+    frame.magic[0] = 'A';
+    frame.magic[1] = 'U';
+    frame.version = FRAME_VERSION;
+    frame.flags = (snapshot.gps.valid ? 0x01 : 0)
+                | (nav.valid ? 0x02 : 0)
+                | (nav.heading_aligned ? 0x04 : 0);
+    frame.sequence = sequence++;
+    frame.timestamp_us = micros();
+    frame.snapshot_sequence = snapshot.sequence;
+
+    frame.accel[0] = snapshot.accel_x;
+    frame.accel[1] = snapshot.accel_y;
+    frame.accel[2] = snapshot.accel_z;
+    frame.gyro[0] = snapshot.gyro_x;
+    frame.gyro[1] = snapshot.gyro_y;
+    frame.gyro[2] = snapshot.gyro_z;
+    frame.quaternion[0] = snapshot.attitude_qw;
+    frame.quaternion[1] = snapshot.attitude_qx;
+    frame.quaternion[2] = snapshot.attitude_qy;
+    frame.quaternion[3] = snapshot.attitude_qz;
+
+    frame.bmp_pressure = snapshot.bmp_pressure;
+    frame.bmp_altitude = snapshot.bmp_altitude;
+    frame.bmp_temperature = snapshot.bmp_temperature;
+
+    frame.latitude = (int32_t)lround(snapshot.gps.latitude * 1e7);
+    frame.longitude = (int32_t)lround(snapshot.gps.longitude * 1e7);
+    frame.gps_speed = snapshot.gps.speed;
+    frame.gps_course = snapshot.gps.course;
+    frame.satellites = (uint8_t)constrain(snapshot.gps.satellites, 0, 255);
+
+    frame.nav_north = nav.north;
+    frame.nav_east = nav.east;
+    frame.nav_up = nav.up;
+    frame.nav_vel_north = nav.vel_north;
+    frame.nav_vel_east = nav.vel_east;
+    frame.nav_vel_up = nav.vel_up;
+
+    frame.mpu_sample_count = snapshot.mpu_sample_count;
+    frame.servo_position = actuator_module.getPosition();
+    frame.motor_speed = actuator_module.getMotorSpeed();
+}
@@ -0,0 +1,97 @@
+#ifndef TELEMETRY_DOWNLINK_H
+#define TELEMETRY_DOWNLINK_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include "SensorModule.h"
+#include "ActuatorModule.h"
+#include "Metrics.h"
+
+// Binary telemetry frame, little-endian and packed. Any layout change must bump
+// TelemetryDownlink::FRAME_VERSION and tools/telemetry_receiver.py.
+struct __attribute__((packed)) TelemetryFrame {
+    uint8_t magic[2];           // "AU"
+    uint8_t version;
+    uint8_t flags;              // bit 0 GPS valid, 1 navigation valid, 2 heading aligned
+    uint32_t sequence;          // Per frame; gaps at the receiver are lost packets
+    uint32_t timestamp_us;      // micros() when the frame was built
+    uint32_t snapshot_sequence; // SensorSnapshot::sequence the frame was built from
+
+    float accel[3];             // m/s²
+    float gyro[3];              // rad/s
+    float quaternion[4];        // w, x, y, z
+
+    float bmp_pressure;         // hPa
+    float bmp_altitude;         // m
+    float bmp_temperature;      // °C
+
+    int32_t latitude;           // 1e-7 degrees
+    int32_t longitude;
+    float gps_speed;            // knots
+    float gps_course;           // degrees
+
+    float nav_north;            // m from the navigation origin
+    float nav_east;
+    float nav_up;
+    float nav_vel_north;        // m/s
+    float nav_vel_east;
+    float nav_vel_up;
+
+    uint32_t mpu_sample_count;
+    int16_t servo_position;     // degrees
+    int16_t motor_speed;        // -255..255
+    uint8_t satellites;
+};
+
+static_assert(sizeof(TelemetryFrame) == 117, "TelemetryFrame layout is part of the wire format");
+
+// Broadcasts TelemetryFrame over UDP at a fixed rate for ground stations.
+// Call update() from the web task; frames are built from the published
+// SensorSnapshot, so the sensor task is never touched.
+class TelemetryDownlink {
+private:
+    static const uint32_t MIN_RATE_HZ = 1;
+    static const uint32_t MAX_RATE_HZ = 200;
+
+    SensorModule& sensor_module;
+    ActuatorModule& actuator_module;
+
+    WiFiUDP udp;
+    const uint16_t port;
+    IPAddress destination;
+    bool active;
+
+    uint32_t rate_hz;
+    uint32_t interval_us;
+    uint32_t last_frame;
+    uint32_t sequence;
+
+    // Statistics
+    uint32_t frames_sent;
+    uint32_t send_failures;
+    uint32_t encode_us_total;
+    uint32_t encode_us_max;
+
+    void encodeFrame(TelemetryFrame& frame);
+
+public:
+    static const uint8_t FRAME_VERSION = 1;
+
+    TelemetryDownlink(SensorModule& sensor_module, ActuatorModule& actuator_module,
+                      uint16_t udp_port = 5005, uint32_t rate_hz = 50);
+
+    bool begin();           // Call once WiFi is connected; sends to the subnet broadcast address
+    void update();
+
+    void setRate(uint32_t rate_hz);
+    uint32_t getRate() const { return rate_hz; }
+    uint16_t getPort() const { return port; }
+    bool isActive() const { return active; }
+    uint32_t getFramesSent() const { return frames_sent; }
+    uint32_t getSendFailures() const { return send_failures; }
+    uint32_t getEncodeMicrosAverage() const { return frames_sent > 0 ? encode_us_total / frames_sent : 0; }
+    uint32_t getEncodeMicrosMax() const { return encode_us_max; }
+};
+
+#endif // TELEMETRY_DOWNLINK_H
@@ -0,0 +1,121 @@
+#include "TelemetryStream.h"
+#include <lwip/sockets.h>
+
+static const char SSE_RESPONSE_HEADER[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/event-stream\r\n"
+    "Cache-Control: no-cache\r\n"
+    "Connection: keep-alive\r\n"
+    "Access-Control-Allow-Origin: *\r\n"
+    "\r\n"
+    "retry: 2000\n\n";
+
+static const char SSE_BUSY_RESPONSE[] = "HTTP/1.1 503 Service Unavailable\r\nConnection: close\r\n\r\n";
+
+TelemetryStream::TelemetryStream(uint16_t stream_port)
+    : port(stream_port), server(stream_port), frames_sent(0), dropped_subscribers(0) {
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        subscribers[i].active = false;
+        subscribers[i].primed = false;
+    }
+}
+
+void TelemetryStream::begin() {
+    server.begin();
+    server.setNoDelay(true);
+    LOG_INFO("Telemetry stream listening on port %u", (unsigned)port);
+}
+
+void TelemetryStream::acceptSubscribers() {
+    WiFiClient client = server.available();
+    if (!client) {
+        return;
+    }
+
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        if (!subscribers[i].active) {
+            // The request line and headers carry nothing we need; discard what has arrived
+            while (client.available()) {
+                client.read();
+            }
+
+            // Same non-blocking send as the events; a new socket that cannot take the header is not kept
+            client.setNoDelay(true);
+            if (!sendNow(client, SSE_RESPONSE_HEADER, sizeof(SSE_RESPONSE_HEADER) - 1)) {
+                client.stop();
+                return;
+            }
+
+            subscribers[i].client = client;
+            subscribers[i].active = true;
+            subscribers[i].primed = false;
+            return;
+        }
+    }
+
+    // All slots taken; best effort, the connection is closed either way
+    sendNow(client, SSE_BUSY_RESPONSE, sizeof(SSE_BUSY_RESPONSE) - 1);
+    client.stop();
+}
+
+// One lwIP send that never waits for socket buffer space; true only if all of it went
+bool TelemetryStream::sendNow(WiFiClient& client, const char* data, size_t length) {
+    ssize_t sent = lwip_send(client.fd(), data, length, MSG_DONTWAIT);
+    return sent == (ssize_t)length;
+}
+
+bool TelemetryStream::needsFullFrame() const {
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        if (subscribers[i].active && !subscribers[i].primed) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TelemetryStream::publish(const char* frame, size_t length) {
+    if (length > MAX_FRAME_BYTES) {
+        return;
+    }
+    memcpy(event, "data: ", 6);
+    memcpy(event + 6, frame, length);
+    memcpy(event + 6 + length, "\n\n", 2);
+    size_t event_length = length + 8;
+
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        Subscriber& subscriber = subscribers[i];
+        if (!subscriber.active) {
+            continue;
+        }
+
+        if (!subscriber.client.connected()) {
+            dropSubscriber(subscriber);
+            continue;
+        }
+
+        // A short or refused send means the socket buffer is full: the client is not keeping up
+        if (!sendNow(subscriber.client, event, event_length)) {
+            dropSubscriber(subscriber);
+            continue;
+        }
+        subscriber.primed = true;
+    }
+    frames_sent++;
+}
+
+void TelemetryStream::dropSubscriber(Subscriber& subscriber) {
+    subscriber.client.stop();
+    subscriber.active = false;
+    subscriber.primed = false;
+    dropped_subscribers++;
+}
+
+int TelemetryStream::getSubscriberCount() const {
+    int count = 0;
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        if (subscribers[i].active) {
+            count++;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,51 @@
+#ifndef TELEMETRY_STREAM_H
+#define TELEMETRY_STREAM_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include "Log.h"
+
+// Server-Sent Events transport for telemetry frames.
+// Runs its own listener so long-lived subscriptions never tie up the WebServer,
+// which handles one client at a time. Each event goes out as one non-blocking
+// lwIP send, as is the response header; a subscriber whose socket buffer
+// cannot take the whole event is dropped, so a slow client never stalls the
+// web task.
+class TelemetryStream {
+public:
+    static const size_t MAX_FRAME_BYTES = 1536;     // Longer frames are not sent
+
+private:
+    static const int MAX_SUBSCRIBERS = 4;
+
+    struct Subscriber {
+        WiFiClient client;
+        bool active;
+        bool primed;    // Has received a full frame since connecting
+    };
+
+    const uint16_t port;
+    WiFiServer server;
+    Subscriber subscribers[MAX_SUBSCRIBERS];
+    char event[MAX_FRAME_BYTES + 8];                // "data: <frame>\n\n"
+    uint32_t frames_sent;
+    uint32_t dropped_subscribers;
+
+    static bool sendNow(WiFiClient& client, const char* data, size_t length);
+    void dropSubscriber(Subscriber& subscriber);
+
+public:
+    TelemetryStream(uint16_t stream_port = 81);
+
+    void begin();
+    void acceptSubscribers();                       // Non-blocking, call every web task iteration
+    bool needsFullFrame() const;                    // A new subscriber is waiting for a complete frame
+    void publish(const char* frame, size_t length); // Sends one "data:" event to every subscriber
+
+    uint16_t getPort() const { return port; }
+    int getSubscriberCount() const;
+    uint32_t getFramesSent() const { return frames_sent; }
+    uint32_t getDroppedSubscribers() const { return dropped_subscribers; }
+};
+
+#endif // TELEMETRY_STREAM_H
@@ -0,0 +1,194 @@
+#include "UbxParser.h"
+
+UbxParser::UbxParser() {
+    reset();
+}
+
+void UbxParser::reset() {
+    state = WAIT_SYNC_1;
+    message_class = message_id = 0;
+    length = offset = 0;
+    check_a = check_b = 0;
+    memset(&epoch, 0, sizeof(epoch));
+    have = 0;
+    ack_pending = false;
+    ack_positive = false;
+    ack_class = ack_id = 0;
+    bytes = messages = checksum_failures = oversized = epochs = 0;
+}
+
+bool UbxParser::encode(uint8_t c) {
+    bytes++;
+    switch (state) {
+    case WAIT_SYNC_1:
+        if (c == SYNC_1) {
+            state = WAIT_SYNC_2;
+        }
+        return false;
+    case WAIT_SYNC_2:
+        // A repeated first sync byte may still start the frame
+        state = c == SYNC_2 ? READ_CLASS : c == SYNC_1 ? WAIT_SYNC_2 : WAIT_SYNC_1;
+        return false;
+    case READ_CLASS:
+        message_class = c;
+        check_a = c;
+        check_b = check_a;
+        state = READ_ID;
+        return false;
+    case READ_ID:
+        message_id = c;
+        check_a += c;
+        check_b += check_a;
+        state = READ_LENGTH_1;
+        return false;
+    case READ_LENGTH_1:
+        length = c;
+        check_a += c;
+        check_b += check_a;
+        state = READ_LENGTH_2;
+        return false;
+    case READ_LENGTH_2:
+        length |= (uint16_t)c << 8;
+        check_a += c;
+        check_b += check_a;
+        if (length > MAX_PAYLOAD) {
+            // Nothing we enable is this long, and after a sync slip the length is garbage
+            oversized++;
+            state = WAIT_SYNC_1;
+            return false;
+        }
+        offset = 0;
+        state = length > 0 ? READ_PAYLOAD : READ_CHECK_A;
+        return false;
+    case READ_PAYLOAD:
+        payload[offset++] = c;
+        check_a += c;
+        check_b += check_a;
+        if (offset == length) {
+            state = READ_CHECK_A;
+        }
+        return false;
+    case READ_CHECK_A:
+        if (c != check_a) {
+            checksum_failures++;
+            state = WAIT_SYNC_1;
+            return false;
+        }
+        state = READ_CHECK_B;
+        return false;
+    case READ_CHECK_B:
+        state = WAIT_SYNC_1;
+        if (c != check_b) {
+            checksum_failures++;
+            return false;
+        }
+        messages++;
+        return handleMessage();
+    }
+    return false;
+}
+
+// Fixed offsets from the u-blox 6 receiver description (GPS.G6-SW-10018)
+bool UbxParser::handleMessage() {
+    if (message_class == CLASS_ACK && length == 2) {
+        ack_class = payload[0];
+        ack_id = payload[1];
+        ack_positive = message_id == ACK_ACK;
+        ack_pending = true;
+        return false;
+    }
+    if (message_class != CLASS_NAV || length < 4) {
+        return false;
+    }
+
+    uint32_t itow = readU4(payload);
+    uint8_t bit;
+    if (message_id == NAV_POSLLH && length == 28) {
+        bit = HAVE_POSLLH;
+    } else if (message_id == NAV_SOL && length == 52) {
+        bit = HAVE_SOL;
+    } else if (message_id == NAV_VELNED && length == 36) {
+        bit = HAVE_VELNED;
+    } else if (message_id == NAV_TIMEUTC && length == 20) {
+        bit = HAVE_TIMEUTC;
+    } else {
+        return false;
+    }
+
+    // Messages of one solution share its iTOW; a new one starts the next epoch
+    if (have == 0 || itow != epoch.itow_ms) {
+        epoch.itow_ms = itow;
+        have = 0;
+    }
+
+    switch (bit) {
+    case HAVE_POSLLH:
+        epoch.longitude_e7 = readI4(payload + 4);
+        epoch.latitude_e7 = readI4(payload + 8);
+        epoch.height_msl_mm = readI4(payload + 16);
+        break;
+    case HAVE_SOL:
+        epoch.fix_type = payload[10];
+        epoch.fix_flags = payload[11];
+        epoch.satellites = payload[47];
+        break;
+    case HAVE_VELNED:
+        epoch.ground_speed_cms = readU4(payload + 20);
+        epoch.heading_e5 = readI4(payload + 24);
+        break;
+    case HAVE_TIMEUTC:
+        epoch.year = readU2(payload + 12);
+        epoch.month = payload[14];
+        epoch.day = payload[15];
+        epoch.hour = payload[16];
+        epoch.minute = payload[17];
+        epoch.second = payload[18];
+        epoch.time_valid = (payload[19] & 0x04) != 0;
+        break;
+    }
+
+    have |= bit;
+    if (have != HAVE_ALL) {
+        return false;
+    }
+    have = 0;
+    epochs++;
+    return true;
+}
+
+bool UbxParser::takeAck(uint8_t message_class, uint8_t message_id, bool& acked) {
+    if (!ack_pending || ack_class != message_class || ack_id != message_id) {
+        return false;
+    }
+    ack_pending = false;
+    acked = ack_positive;
+    return true;
+}
+
+size_t UbxParser::buildMessage(uint8_t* out, size_t capacity, uint8_t message_class, uint8_t message_id,
+                               const uint8_t* payload, uint16_t length) {
+    size_t total = 8 + (size_t)length;
+    if (total > capacity) {
+        return 0;
+    }
+    out[0] = SYNC_1;
+    out[1] = SYNC_2;
+    out[2] = message_class;
+    out[3] = message_id;
+    out[4] = (uint8_t)(length & 0xFF);
+    out[5] = (uint8_t)(length >> 8);
+    if (length > 0) {
+        memcpy(out + 6, payload, length);
+    }
+
+    // 8-bit Fletcher over class, id, length and payload
+    uint8_t a = 0;
+    uint8_t b = 0;
+    for (size_t i = 2; i < 6 + (size_t)length; i++) {
+        a += out[i];
+        b += a;
+    }
+    out[6 + length] = a;
+    out[7 + length] = b;
+    return total;
+}
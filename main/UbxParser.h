@@ -0,0 +1,111 @@
+#ifndef UBX_PARSER_H
+#define UBX_PARSER_H
+
+#include <Arduino.h>
+
+// One navigation solution, raw from the receiver (u-blox 6 units)
+struct UbxNavEpoch {
+    uint32_t itow_ms;           // GPS time of week of the solution
+    int32_t latitude_e7;        // degrees * 1e7
+    int32_t longitude_e7;
+    int32_t height_msl_mm;
+    uint32_t ground_speed_cms;  // 2D speed, cm/s
+    int32_t heading_e5;         // Heading of motion, degrees * 1e5
+    uint8_t fix_type;           // 0 none, 1 dead reckoning, 2 2D, 3 3D, 4 GPS + dead reckoning, 5 time only
+    uint8_t fix_flags;          // NAV-SOL flags; bit 0 is gpsFixOK
+    uint8_t satellites;
+    bool time_valid;            // NAV-TIMEUTC validUTC
+    uint16_t year;
+    uint8_t month;
+    uint8_t day;
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+};
+
+// Byte-at-a-time UBX frame decoder. The NEO-6M predates NAV-PVT, so an epoch
+// is assembled from NAV-POSLLH, NAV-SOL, NAV-VELNED and NAV-TIMEUTC sharing
+// one iTOW; every field is read at its fixed offset in the little-endian
+// payload, with no text to scan. Also tracks ACK-ACK/ACK-NAK for configuration.
+class UbxParser {
+public:
+    static const uint8_t SYNC_1 = 0xB5;
+    static const uint8_t SYNC_2 = 0x62;
+    static const uint8_t CLASS_NAV = 0x01;
+    static const uint8_t CLASS_ACK = 0x05;
+    static const uint8_t CLASS_CFG = 0x06;
+    static const uint8_t NAV_POSLLH = 0x02;
+    static const uint8_t NAV_SOL = 0x06;
+    static const uint8_t NAV_VELNED = 0x12;
+    static const uint8_t NAV_TIMEUTC = 0x21;
+    static const uint8_t ACK_NAK = 0x00;
+    static const uint8_t ACK_ACK = 0x01;
+    static const uint8_t CFG_PRT = 0x00;
+    static const uint8_t CFG_MSG = 0x01;
+    static const uint8_t CFG_RATE = 0x08;
+
+    static const uint16_t MAX_PAYLOAD = 64;     // Longest message used is NAV-SOL, 52 bytes
+
+private:
+    enum State : uint8_t { WAIT_SYNC_1, WAIT_SYNC_2, READ_CLASS, READ_ID, READ_LENGTH_1, READ_LENGTH_2, READ_PAYLOAD, READ_CHECK_A, READ_CHECK_B };
+
+    static const uint8_t HAVE_POSLLH = 0x01;
+    static const uint8_t HAVE_SOL = 0x02;
+    static const uint8_t HAVE_VELNED = 0x04;
+    static const uint8_t HAVE_TIMEUTC = 0x08;
+    static const uint8_t HAVE_ALL = 0x0F;
+
+    // Frame in progress
+    State state;
+    uint8_t message_class;
+    uint8_t message_id;
+    uint16_t length;
+    uint16_t offset;
+    uint8_t check_a;
+    uint8_t check_b;
+    uint8_t payload[MAX_PAYLOAD];
+
+    // Epoch being assembled
+    UbxNavEpoch epoch;
+    uint8_t have;
+
+    // Last acknowledgement
+    bool ack_pending;
+    bool ack_positive;
+    uint8_t ack_class;
+    uint8_t ack_id;
+
+    // Counters
+    uint32_t bytes;
+    uint32_t messages;          // Checksum verified
+    uint32_t checksum_failures;
+    uint32_t oversized;         // Frames dropped for a length over MAX_PAYLOAD
+    uint32_t epochs;
+
+    bool handleMessage();
+
+    static uint16_t readU2(const uint8_t* p) { return (uint16_t)(p[0] | p[1] << 8); }
+    static uint32_t readU4(const uint8_t* p) { return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24; }
+    static int32_t readI4(const uint8_t* p) { return (int32_t)readU4(p); }
+
+public:
+    UbxParser();
+
+    bool encode(uint8_t c);                         // True when a complete epoch is ready in getEpoch()
+    const UbxNavEpoch& getEpoch() const { return epoch; }
+    void reset();                                   // Drops the partial frame, the epoch and the counters
+
+    bool takeAck(uint8_t message_class, uint8_t message_id, bool& acked);   // True once an ACK/NAK for it arrived
+
+    // Frames a message into out; returns its length, or 0 if it does not fit
+    static size_t buildMessage(uint8_t* out, size_t capacity, uint8_t message_class, uint8_t message_id,
+                               const uint8_t* payload, uint16_t length);
+
+    uint32_t getBytes() const { return bytes; }
+    uint32_t getMessages() const { return messages; }
+    uint32_t getChecksumFailures() const { return checksum_failures; }
+    uint32_t getOversized() const { return oversized; }
+    uint32_t getEpochs() const { return epochs; }
+};
+
+#endif // UBX_PARSER_H
@@ -1,65 +1,469 @@
 #include "WebModule.h"
+#include "DashboardAsset.h"
 
-WebModule::WebModule(const char* wifi_ssid, const char* wifi_password, SensorModule& sensor_module, ActuatorModule& actuator_module)
+WebModule::WebModule(const char* wifi_ssid, const char* wifi_password, SensorModule& sensor_module, ActuatorModule& actuator_module,
+                     uint32_t stream_rate)
     : ssid(wifi_ssid)
     , password(wifi_password)
     , server(80)
     , sensor_module(sensor_module)
-    , actuator_module(actuator_module) {
+    , actuator_module(actuator_module)
+    , wifi_connected(false)
+    , stream(81)
+    , last_stream_frame(0)
+    , stream_bmp_timestamp(0)
+    , stream_gps_timestamp(0)
+    , stream_servo_position(-1)
+    , stream_motor_speed(0)
+    , stream_encode_us_total(0)
+    , stream_encode_us_max(0)
+    , stream_send_us_total(0)
+    , stream_send_us_max(0)
+    , last_control_tick(0)
+    , control_updates(0)
+    , downlink(NULL)
+    , uplink(NULL), autopilot(NULL), mission(NULL), geofence(NULL), recorder(NULL), boot(NULL) {
+    setStreamRate(stream_rate);
 }
 
+// The station connects (and reconnects) in the background; the server listens
+// on every interface, so it starts answering as soon as there is an address
 bool WebModule::begin() {
-    // Connect to WiFi
-    Serial.print("Connecting to WiFi");
-    WiFi.begin(ssid, password);
-    
-    // Wait for connection with timeout
-    int attempts = 0;
-    while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-        delay(500);
-        Serial.print(".");
-        attempts++;
-    }
-    
-    if (WiFi.status() != WL_CONNECTED) {
-        Serial.println("\nFailed to connect to WiFi!");
+    WiFi.mode(WIFI_STA);
+    WiFi.setAutoReconnect(true);
+    if (WiFi.begin(ssid, password) == WL_CONNECT_FAILED) {
+        Serial.println("ERROR: WiFi could not start, check the credentials");
         return false;
     }
-    
-    Serial.println("\nConnected to WiFi");
-    Serial.print("IP address: ");
-    Serial.println(WiFi.localIP());
+    Serial.print("Connecting to WiFi ");
+    Serial.println(ssid);
     
     // Setup server routes
+    static const char* collected_headers[] = { "If-None-Match" };
+    server.collectHeaders(collected_headers, 1);
     server.on("/", [this]() { handleRoot(); });
     server.on("/data", [this]() { handleData(); });
+    server.on("/stream", [this]() { handleStream(); });
+    server.on("/logs", [this]() { handleLogs(); });
+    server.on("/downlink", [this]() { handleDownlink(); });
+    server.on("/uplink", [this]() { handleUplink(); });
+    server.on("/loglevel", [this]() { handleLogLevel(); });
+    server.on("/autopilot", [this]() { handleAutopilot(); });
+    server.on("/mission", [this]() { handleMission(); });
+    server.on("/geofence", [this]() { handleGeofence(); });
+    server.on("/metrics", [this]() { handleMetrics(); });
     server.on("/servo", [this]() { handleServo(); });
     server.on("/motor", [this]() { handleMotor(); });
+    server.on("/control", [this]() { handleControl(); });
     server.onNotFound([this]() { handle404(); });
     
     // Start server
     server.begin();
     Serial.println("HTTP server started");
+    
+    stream.begin();
     return true;
 }
 
 void WebModule::update() {
-    server.handleClient();
+    bool connected = isWiFiConnected();
+    if (connected != wifi_connected) {
+        wifi_connected = connected;
+        if (connected) {
+            IPAddress ip = WiFi.localIP();
+            LOG_INFO("Connected to WiFi, IP address %u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+        } else {
+            LOG_WARN("WiFi connection lost, reconnecting");
+        }
+    }
+    
+    {
+        METRICS_SCOPE(STAGE_WEB_HANDLE_CLIENT);
+        server.handleClient();
+    }
+    stream.acceptSubscribers();
+    
+    if (millis() - last_control_tick >= CONTROL_TICK_MS) {
+        last_control_tick = millis();
+        applyCommands();
+    }
+    
+    // Fixed grid, as in TelemetryDownlink, so the loop's 1 ms tick does not stretch every interval
+    if (micros() - last_stream_frame >= stream_interval_us) {
+        last_stream_frame += stream_interval_us;
+        if (micros() - last_stream_frame >= stream_interval_us) {
+            last_stream_frame = micros();
+        }
+        streamTelemetry();
+    }
+}
+
+// Applies whatever the handlers posted since the last tick, skipping unchanged setpoints
+void WebModule::applyCommands() {
+    ActuatorCommand command;
+    if (!commands.take(command)) {
+        return;
+    }
+    
+    bool changed = false;
+    if (command.has_servo && autopilot != NULL && autopilot->isEngaged()) {
+        autopilot->disengage();     // Manual steering takes over
+    }
+    if (command.has_servo && command.servo_angle != actuator_module.getTargetPosition()) {
+        actuator_module.setPosition(command.servo_angle);
+        changed = true;
+    }
+    if (command.stop_motor) {
+        actuator_module.stopMotor();
+        changed = true;
+    } else if (command.has_motor && command.motor_speed != actuator_module.getTargetMotorSpeed()) {
+        actuator_module.setMotorSpeed(command.motor_speed);
+        changed = true;
+    }
+    
+    if (changed) {
+        control_updates++;
+    }
+}
+
+void WebModule::setStreamRate(uint32_t rate_hz) {
+    stream_rate_hz = constrain(rate_hz, MIN_STREAM_RATE_HZ, MAX_STREAM_RATE_HZ);
+    stream_interval_us = 1000000UL / stream_rate_hz;
+}
+
+void WebModule::streamTelemetry() {
+    if (stream.getSubscriberCount() == 0) {
+        return;
+    }
+    METRICS_SCOPE(STAGE_WEB_STREAM);
+    
+    uint32_t start = micros();
+    size_t length = generateStreamFrame(stream_buffer, sizeof(stream_buffer), stream.needsFullFrame());
+    uint32_t encoded = micros();
+    if (length > 0) {
+        stream.publish(stream_buffer, length);
+    }
+    uint32_t encode_us = encoded - start;
+    uint32_t send_us = micros() - encoded;
+    
+    stream_encode_us_total += encode_us;
+    if (encode_us > stream_encode_us_max) {
+        stream_encode_us_max = encode_us;
+    }
+    stream_send_us_total += send_us;
+    if (send_us > stream_send_us_max) {
+        stream_send_us_max = send_us;
+    }
 }
 
+// The dashboard is precompressed at build time (tools/embed_dashboard.py) and
+// served straight from flash; browsers revalidate it with If-None-Match
 void WebModule::handleRoot() {
-    server.send(200, "text/html", generateHTML());
+    server.sendHeader("ETag", DASHBOARD_ETAG);
+    server.sendHeader("Cache-Control", "no-cache");
+    
+    if (server.header("If-None-Match") == DASHBOARD_ETAG) {
+        server.send(304);
+        return;
+    }
+    
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, "text/html", (PGM_P)DASHBOARD_HTML_GZ, DASHBOARD_HTML_GZ_LEN);
 }
 
 void WebModule::handleData() {
-    server.send(200, "application/json", generateJSON());
+    size_t length = generateJSON(json_buffer, sizeof(json_buffer));
+    if (length == 0) {
+        server.send(500, "application/json", "{\"status\":\"error\",\"message\":\"Sensor document too large\"}");
+        return;
+    }
+    server.send_P(200, "application/json", json_buffer, length);
+}
+
+void WebModule::handleStream() {
+    if (server.hasArg("rate")) {
+        setStreamRate(server.arg("rate").toInt());
+    }
+    
+    uint32_t frames = stream.getFramesSent();
+    JsonWriter json(json_buffer, sizeof(json_buffer));
+    json.beginObject();
+    json.field("port", (int)stream.getPort());
+    json.field("rate", (unsigned long)stream_rate_hz);
+    json.field("subscribers", stream.getSubscriberCount());
+    json.field("frames", (unsigned long)frames);
+    json.field("dropped_subscribers", (unsigned long)stream.getDroppedSubscribers());
+    json.field("encode_us_avg", (unsigned long)(frames > 0 ? stream_encode_us_total / frames : 0));
+    json.field("encode_us_max", (unsigned long)stream_encode_us_max);
+    json.field("send_us_avg", (unsigned long)(frames > 0 ? stream_send_us_total / frames : 0));
+    json.field("send_us_max", (unsigned long)stream_send_us_max);
+    json.endObject();
+    server.send_P(200, "application/json", json_buffer, json.size());
+}
+
+// Binary UDP downlink stats; ?rate= sets the frame rate
+void WebModule::handleDownlink() {
+    if (downlink == NULL) {
+        server.send(404, "application/json", "{\"status\":\"error\",\"message\":\"Downlink not enabled\"}");
+        return;
+    }
+    if (server.hasArg("rate")) {
+        downlink->setRate(server.arg("rate").toInt());
+    }
+    
+    JsonWriter json(json_buffer, sizeof(json_buffer));
+    json.beginObject();
+    json.field("active", downlink->isActive());
+    json.field("port", (int)downlink->getPort());
+    json.field("rate", (unsigned long)downlink->getRate());
+    json.field("frame_bytes", (int)sizeof(TelemetryFrame));
+    json.field("frames", (unsigned long)downlink->getFramesSent());
+    json.field("send_failures", (unsigned long)downlink->getSendFailures());
+    json.field("encode_us_avg", (unsigned long)downlink->getEncodeMicrosAverage());
+    json.field("encode_us_max", (unsigned long)downlink->getEncodeMicrosMax());
+    json.endObject();
+    server.send_P(200, "application/json", json_buffer, json.size());
+}
+
+// Serial log level (0 none .. 4 debug), set with ?level=; levels above LOG_LEVEL are compiled out
+void WebModule::handleLogLevel() {
+    if (server.hasArg("level")) {
+        Log::setLevel(constrain(server.arg("level").toInt(), LOG_LEVEL_NONE, LOG_LEVEL_DEBUG));
+    }
+    
+    JsonWriter json(json_buffer, sizeof(json_buffer));
+    json.beginObject();
+    json.field("level", (int)Log::getLevel());
+    json.field("compiled_level", (int)LOG_LEVEL);
+    json.field("dropped", (unsigned long)Log::getDropped());
+    json.endObject();
+    server.send_P(200, "application/json", json_buffer, json.size());
+}
+
+// Heading hold: ?heading=deg engages (or retargets), ?engage=0 releases, ?kp=&ki=&kd=&rate= tune.
+// jitter_us is the tick's deviation from its nominal period; compute_us is the tick's own cost.
+void WebModule::handleAutopilot() {
+    if (autopilot == NULL) {
+        server.send(404, "application/json", "{\"status\":\"error\",\"message\":\"Autopilot not enabled\"}");
+        return;
+    }
+    if (server.hasArg("kp") || server.hasArg("ki") || server.hasArg("kd")) {
+        autopilot->setGains(server.hasArg("kp") ? server.arg("kp").toFloat() : autopilot->getKp(),
+                            server.hasArg("ki") ? server.arg("ki").toFloat() : autopilot->getKi(),
+                            server.hasArg("kd") ? server.arg("kd").toFloat() : autopilot->getKd());
+    }
+    if (server.hasArg("rate")) {
+        autopilot->setRudderRateLimit(server.arg("rate").toFloat());
+    }
+    if (server.hasArg("heading")) {
+        autopilot->engage(server.arg("heading").toFloat());
+    } else if (server.hasArg("engage") && server.arg("engage").toInt() == 0) {
+        autopilot->disengage();
+    }
+    
+    JsonWriter json(json_buffer, sizeof(json_buffer));
+    json.beginObject();
+    json.field("engaged", autopilot->isEngaged());
+    json.field("heading_valid", autopilot->isHeadingValid());
+    json.field("heading", autopilot->getHeading(), 1);
+    json.field("heading_rate", autopilot->getHeadingRate(), 1);
+    json.field("target", autopilot->getTargetHeading(), 1);
+    json.field("error", autopilot->getError(), 1);
+    json.field("rudder", autopilot->getRudder(), 1);
+    json.field("integral", autopilot->getIntegral(), 2);
+    json.field("kp", autopilot->getKp(), 3);
+    json.field("ki", autopilot->getKi(), 3);
+    json.field("kd", autopilot->getKd(), 3);
+    json.field("rate", autopilot->getRudderRateLimit(), 1);
+    json.field("period_ms", (unsigned long)autopilot->getPeriodMs());
+    json.field("ticks", (unsigned long)autopilot->getTicks());
+    json.field("jitter_us_avg", (unsigned long)autopilot->getJitterMicrosAverage());
+    json.field("jitter_us_max", (unsigned long)autopilot->getJitterMicrosMax());
+    json.field("compute_us_avg", (unsigned long)autopilot->getComputeMicrosAverage());
+    json.field("compute_us_max", (unsigned long)autopilot->getComputeMicrosMax());
+    json.endObject();
+    server.send_P(200, "application/json", json_buffer, json.size());
+}
+
+// POST a body of "lat,lon[,motor]" lines to upload; ?action=start|stop; GET for progress.
+// nav_us is the per-fix guidance cost.
+void WebModule::handleMission() {
+    if (mission == NULL) {
+        server.send(404, "application/json", "{\"status\":\"error\",\"message\":\"Missions not enabled\"}");
+        return;
+    }
+    if (server.method() == HTTP_POST && server.hasArg("plain")) {
+        if (mission->load(server.arg("plain").c_str()) < 0) {
+            server.send(400, "application/json", "{\"status\":\"error\",\"message\":\"Invalid mission, or a mission is running\"}");
+            return;
+        }
+    }
+    if (server.hasArg("action")) {
+        String action = server.arg("action");
+        if (action == "start" && !mission->start()) {
+            server.send(409, "application/json", "{\"status\":\"error\",\"message\":\"No mission loaded, or already running\"}");
+            return;
+        } else if (action == "stop") {
+            mission->stop();
+        }
+    }
+    
+    JsonWriter json(json_buffer, sizeof(json_buffer));
+    json.beginObject();
+    json.field("state", MissionEngine::stateName(mission->getState()));
+    json.field("waypoints", mission->getWaypointCount());
+    json.field("leg", mission->getLeg());
+    if (mission->getLeg() >= 0) {
+        const Waypoint& target = mission->getWaypoint(mission->getLeg());
+        json.field("target_lat", target.latitude, 6);
+        json.field("target_lon", target.longitude, 6);
+    }
+    json.field("gps_lost", mission->isGPSLost());
+    json.field("leg_bearing", mission->getLegBearing(), 1);
+    json.field("heading_cmd", mission->getCommandedHeading(), 1);
+    json.field("cross_track", mission->getCrossTrack(), 1);
+    json.field("remaining", mission->getDistanceRemaining(), 1);
+    json.field("nav_updates", (unsigned long)mission->getNavUpdates());
+    json.field("nav_us_avg", (unsigned long)mission->getNavMicrosAverage());
+    json.field("nav_us_max", (unsigned long)mission->getNavMicrosMax());
+    json.field("gps_timeouts", (unsigned long)mission->getGPSTimeouts());
+    json.endObject();
+    server.send_P(200, "application/json", json_buffer, json.size());
+}
+
+// POST polygons ("in"/"out" lines, then "lat,lon" vertices) to replace the fence; ?action=arm|disarm|clear.
+// worst_case_edges bounds the edges one check tests per polygon; check_us is measured in the GPS task.
+void WebModule::handleGeofence() {
+    if (geofence == NULL) {
+        server.send(404, "application/json", "{\"status\":\"error\",\"message\":\"Geofence not enabled\"}");
+        return;
+    }
+    if (server.method() == HTTP_POST && server.hasArg("plain")) {
+        if (!geofence->load(server.arg("plain").c_str())) {
+            server.send(400, "application/json", "{\"status\":\"error\",\"message\":\"Invalid geofence\"}");
+            return;
+        }
+    }
+    if (server.hasArg("action")) {
+        String action = server.arg("action");
+        if (action == "arm") {
+            geofence->setArmed(true);
+        } else if (action == "disarm") {
+            geofence->setArmed(false);
+        } else if (action == "clear") {
+            geofence->clear();
+        } else if (action == "rearm") {
+            geofence->rearmMotor();
+        }
+    }
+    
+    JsonWriter json(json_buffer, sizeof(json_buffer));
+    json.beginObject();
+    json.field("armed", geofence->isArmed());
+    json.field("breached", geofence->isBreached());
+    json.field("motor_inhibited", actuator_module.isMotorInhibited());
+    json.field("polygons", geofence->getPolygonCount());
+    json.field("vertices", geofence->getVertexCount());
+    json.field("worst_case_edges", geofence->getWorstCaseEdges());
+    json.field("checks", (unsigned long)geofence->getChecks());
+    json.field("breaches", (unsigned long)geofence->getBreaches());
+    json.field("motor_cuts", (unsigned long)geofence->getMotorCuts());
+    json.field("edges_tested_max", (unsigned long)geofence->getEdgesTestedMax());
+    json.field("check_us_avg", (unsigned long)geofence->getCheckMicrosAverage());
+    json.field("check_us_max", (unsigned long)geofence->getCheckMicrosMax());
+    json.endObject();
+    server.send_P(200, "application/json", json_buffer, json.size());
+}
+
+// Prometheus text exposition; streamed in pieces so it fits the JSON buffer
+void WebModule::handleMetrics() {
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "text/plain; version=0.0.4", "");
+    for (int piece = 0; piece < Metrics::getPieceCount(); piece++) {
+        size_t length = Metrics::writePiece(piece, json_buffer, sizeof(json_buffer));
+        if (length > 0) {
+            server.sendContent(json_buffer, length);
+        }
+    }
+    if (boot != NULL) {
+        size_t length = boot->writeMetrics(json_buffer, sizeof(json_buffer));
+        if (length > 0) {
+            server.sendContent(json_buffer, length);
+        }
+    }
+    server.sendContent("");     // Ends the chunked response
+}
+
+// UDP control uplink stats; apply_us is packet read to actuator target set
+void WebModule::handleUplink() {
+    if (uplink == NULL) {
+        server.send(404, "application/json", "{\"status\":\"error\",\"message\":\"Uplink not enabled\"}");
+        return;
+    }
+    
+    JsonWriter json(json_buffer, sizeof(json_buffer));
+    json.beginObject();
+    json.field("active", uplink->isActive());
+    json.field("port", (int)uplink->getPort());
+    json.field("applied", (unsigned long)uplink->getCommandsApplied());
+    json.field("stale_dropped", (unsigned long)uplink->getStaleDropped());
+    json.field("invalid", (unsigned long)uplink->getInvalidPackets());
+    json.field("failsafe_stops", (unsigned long)uplink->getFailsafeStops());
+    json.field("apply_us_avg", (unsigned long)uplink->getApplyMicrosAverage());
+    json.field("apply_us_max", (unsigned long)uplink->getApplyMicrosMax());
+    json.endObject();
+    server.send_P(200, "application/json", json_buffer, json.size());
+}
+
+// Lists flight logs, or downloads one with ?file=flight_NNN.bin
+void WebModule::handleLogs() {
+    if (server.hasArg("file")) {
+        String name = server.arg("file");
+        if (!name.startsWith("flight_") || name.indexOf('/') >= 0) {
+            server.send(400, "application/json", "{\"status\":\"error\",\"message\":\"Invalid log name\"}");
+            return;
+        }
+        if (server.method() == HTTP_DELETE) {
+            // Through the recorder, which refuses the log it is writing
+            if (recorder == NULL || !recorder->deleteLog(name.c_str())) {
+                server.send(409, "application/json", "{\"status\":\"error\",\"message\":\"Log not deleted\"}");
+                return;
+            }
+            server.send(200, "application/json", "{\"status\":\"success\"}");
+            return;
+        }
+        File log = LittleFS.open("/" + name, FILE_READ);
+        if (!log) {
+            server.send(404, "application/json", "{\"status\":\"error\",\"message\":\"No such log\"}");
+            return;
+        }
+        server.streamFile(log, "application/octet-stream");
+        log.close();
+        return;
+    }
+    
+    // File name to size in bytes
+    JsonWriter json(json_buffer, sizeof(json_buffer));
+    json.beginObject();
+    File root = LittleFS.open("/");
+    if (root && root.isDirectory()) {
+        File entry = root.openNextFile();
+        while (entry) {
+            if (!entry.isDirectory()) {
+                json.field(entry.name(), (unsigned long)entry.size());
+            }
+            entry = root.openNextFile();
+        }
+    }
+    json.endObject();
+    server.send_P(200, "application/json", json_buffer, json.size());
 }
 
 void WebModule::handleServo() {
     if (server.hasArg("angle")) {
         int angle = server.arg("angle").toInt();
-        actuator_module.setPosition(angle);
-        server.send(200, "application/json", "{\"status\":\"success\",\"angle\":" + String(actuator_module.getPosition()) + "}");
+        commands.postServo(angle);
+        server.send(200, "application/json", "{\"status\":\"success\",\"angle\":" + String(angle) + "}");
     } else {
         server.send(400, "application/json", "{\"status\":\"error\",\"message\":\"Missing angle parameter\"}");
     }
@@ -68,12 +472,12 @@ void WebModule::handleServo() {
 void WebModule::handleMotor() {
     if (server.hasArg("speed")) {
         int speed = server.arg("speed").toInt();
-        actuator_module.setMotorSpeed(speed);
-        server.send(200, "application/json", "{\"status\":\"success\",\"speed\":" + String(actuator_module.getMotorSpeed()) + "}");
+        commands.postMotor(speed);
+        server.send(200, "application/json", "{\"status\":\"success\",\"speed\":" + String(speed) + "}");
     } else if (server.hasArg("action")) {
         String action = server.arg("action");
         if (action == "stop") {
-            actuator_module.stopMotor();
+            commands.postStop();
             server.send(200, "application/json", "{\"status\":\"success\",\"speed\":0}");
         } else if (action == "enable") {
             actuator_module.enableMotor();
@@ -89,271 +493,201 @@ void WebModule::handleMotor() {
     }
 }
 
+// Sets servo and/or motor in one request; both land on the same control tick.
+// Without arguments it only reports the mailbox counters.
+void WebModule::handleControl() {
+    ActuatorCommand command = {};
+    if (server.hasArg("servo")) {
+        command.has_servo = true;
+        command.servo_angle = server.arg("servo").toInt();
+    }
+    if (server.hasArg("motor")) {
+        command.has_motor = true;
+        command.motor_speed = server.arg("motor").toInt();
+    }
+    bool queued = command.has_servo || command.has_motor;
+    if (queued) {
+        commands.post(command);
+    }
+    
+    JsonWriter json(json_buffer, sizeof(json_buffer));
+    json.beginObject();
+    json.field("status", queued ? "success" : "idle");
+    if (command.has_servo) {
+        json.field("servo", command.servo_angle);
+    }
+    if (command.has_motor) {
+        json.field("motor", command.motor_speed);
+    }
+    json.field("tick_ms", (unsigned long)CONTROL_TICK_MS);
+    json.field("posted", (unsigned long)commands.getPosted());
+    json.field("coalesced", (unsigned long)commands.getCoalesced());
+    json.field("ticks", (unsigned long)commands.getTaken());
+    json.field("updates", (unsigned long)control_updates);
+    json.field("ramp_us_avg", (unsigned long)actuator_module.getRampMicrosAverage());
+    json.field("ramp_us_max", (unsigned long)actuator_module.getRampMicrosMax());
+    json.endObject();
+    server.send_P(200, "application/json", json_buffer, json.size());
+}
+
 void WebModule::handle404() {
     server.send(404, "text/plain", "Not found");
 }
 
-String WebModule::generateHTML() {
-    String html = R"END_HTML(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>ESP32 Sensor Dashboard</title>
-    <meta name="viewport" content="width=device-width, initial-scale=1">
-    <style>
-        body { font-family: Arial, sans-serif; margin: 20px; }
-        .container { max-width: 800px; margin: 0 auto; }
-        .sensor-box {
-            border: 1px solid #ddd;
-            padding: 15px;
-            margin: 10px 0;
-            border-radius: 5px;
-        }
-        .value { font-weight: bold; }
-    </style>
-</head>
-<body>
-    <div class="container">
-        <h1>ESP32 Sensor Dashboard</h1>
-        <div class="sensor-box">
-            <h2>GPS (GY-GPS6MV2)</h2>
-            <p>Status: <span id="gps-status" class="value">--</span></p>
-            <p>Satellites: <span id="gps-satellites" class="value">--</span></p>
-            <p>Latitude: <span id="gps-lat" class="value">--</span>°</p>
-            <p>Longitude: <span id="gps-lon" class="value">--</span>°</p>
-            <p>Altitude: <span id="gps-altitude" class="value">--</span> m</p>
-            <p>Speed: <span id="gps-speed" class="value">--</span> knots</p>
-            <p>Time: <span id="gps-time" class="value">--</span></p>
-            <p>Date: <span id="gps-date" class="value">--</span></p>
-        </div>
-        <div class="sensor-box">
-            <h2>Servo Control</h2>
-            <p>Current Position: <span id="servo-position" class="value">90</span>°</p>
-            <p>
-                <label for="servo-slider">Servo Angle (0-180°):</label><br>
-                <input type="range" id="servo-slider" min="0" max="180" value="90" style="width: 100%; margin: 10px 0;">
-                <span id="slider-value" class="value">90</span>°
-            </p>
-            <p>
-                <button onclick="centerServo()" style="padding: 10px 20px; margin: 5px;">Center (90°)</button>
-            </p>
-        </div>
-        <div class="sensor-box">
-            <h2>DC Motor Control (TB6612FNG)</h2>
-            <p>Current Speed: <span id="motor-speed" class="value">0</span> (<span id="motor-direction" class="value">STOPPED</span>)</p>
-            <p>
-                <label for="motor-slider">Motor Speed (-255 to 255):</label><br>
-                <input type="range" id="motor-slider" min="-255" max="255" value="0" style="width: 100%; margin: 10px 0;">
-                <span id="motor-slider-value" class="value">0</span>
-            </p>
-            <p>
-                <button onclick="setMotorSpeedPreset(150)" style="padding: 10px 20px; margin: 5px; background: #4CAF50; color: white; border: none; border-radius: 3px; cursor: pointer;">Forward</button>
-                <button onclick="setMotorSpeedPreset(-150)" style="padding: 10px 20px; margin: 5px; background: #2196F3; color: white; border: none; border-radius: 3px; cursor: pointer;">Reverse</button>
-                <button onclick="stopMotor()" style="padding: 10px 20px; margin: 5px; background: #f44336; color: white; border: none; border-radius: 3px; cursor: pointer;">Stop</button>
-            </p>
-        </div>
-        <div class="sensor-box">
-            <h2>BMP280</h2>
-            <p>Temperature: <span id="bmp-temp" class="value">--</span> °C</p>
-            <p>Pressure: <span id="bmp-pressure" class="value">--</span> hPa</p>
-            <p>Altitude: <span id="bmp-altitude" class="value">--</span> m</p>
-        </div>
-        <div class="sensor-box">
-            <h2>MPU6050</h2>
-            <p>Temperature: <span id="mpu-temp" class="value">--</span> °C</p>
-            <h3>Acceleration (m/s²)</h3>
-            <p>X: <span id="acc-x" class="value">--</span></p>
-            <p>Y: <span id="acc-y" class="value">--</span></p>
-            <p>Z: <span id="acc-z" class="value">--</span></p>
-            <h3>Gyroscope (rad/s)</h3>
-            <p>X: <span id="gyro-x" class="value">--</span></p>
-            <p>Y: <span id="gyro-y" class="value">--</span></p>
-            <p>Z: <span id="gyro-z" class="value">--</span></p>
-        </div>
-    </div>
-    <script>
-        function updateValues() {
-            fetch('/data')
-                .then(response => response.json())
-                .then(data => {
-                    // Update GPS data
-                    document.getElementById('gps-status').textContent = data.gps.valid ? 'Valid Fix' : 'No Fix';
-                    document.getElementById('gps-satellites').textContent = data.gps.satellites;
-                    document.getElementById('gps-lat').textContent = data.gps.valid ? data.gps.latitude.toFixed(6) : '--';
-                    document.getElementById('gps-lon').textContent = data.gps.valid ? data.gps.longitude.toFixed(6) : '--';
-                    document.getElementById('gps-altitude').textContent = data.gps.valid ? data.gps.altitude.toFixed(1) : '--';
-                    document.getElementById('gps-speed').textContent = data.gps.valid ? data.gps.speed.toFixed(1) : '--';
-                    document.getElementById('gps-time').textContent = data.gps.time || '--';
-                    document.getElementById('gps-date').textContent = data.gps.date || '--';
-                    
-                    // Update BMP280 data
-                    document.getElementById('bmp-temp').textContent = data.bmp.temperature.toFixed(2);
-                    document.getElementById('bmp-pressure').textContent = data.bmp.pressure.toFixed(2);
-                    document.getElementById('bmp-altitude').textContent = data.bmp.altitude.toFixed(2);
-                    
-                    // Update MPU6050 data
-                    document.getElementById('mpu-temp').textContent = data.mpu.temperature.toFixed(2);
-                    document.getElementById('acc-x').textContent = data.mpu.acceleration.x.toFixed(3);
-                    document.getElementById('acc-y').textContent = data.mpu.acceleration.y.toFixed(3);
-                    document.getElementById('acc-z').textContent = data.mpu.acceleration.z.toFixed(3);
-                    document.getElementById('gyro-x').textContent = data.mpu.gyro.x.toFixed(3);
-                    document.getElementById('gyro-y').textContent = data.mpu.gyro.y.toFixed(3);
-                    document.getElementById('gyro-z').textContent = data.mpu.gyro.z.toFixed(3);
-                    
-                    // Update actuator data
-                    if (data.actuators) {
-                        if (data.actuators.servo) {
-                            document.getElementById('servo-position').textContent = data.actuators.servo.position;
-                        }
-                        if (data.actuators.motor) {
-                            updateMotorDisplay(data.actuators.motor.speed);
-                        }
-                    }
-                })
-                .catch(error => console.error('Error fetching data:', error));
-        }
-        
-        // Servo control functions
-        const slider = document.getElementById('servo-slider');
-        const sliderValue = document.getElementById('slider-value');
-        
-        slider.addEventListener('input', function() {
-            const angle = slider.value;
-            sliderValue.textContent = angle;
-            setServoPosition(angle);
-        });
-        
-        function setServoPosition(angle) {
-            fetch('/servo?angle=' + angle, { method: 'POST' })
-                .then(response => response.json())
-                .then(data => {
-                    if (data.status === 'success') {
-                        document.getElementById('servo-position').textContent = data.angle;
-                    } else {
-                        console.error('Servo error:', data.message);
-                    }
-                })
-                .catch(error => console.error('Error setting servo position:', error));
-        }
-        
-        function centerServo() {
-            slider.value = 90;
-            sliderValue.textContent = 90;
-            setServoPosition(90);
-        }
-        
-        // Motor control functions
-        const motorSlider = document.getElementById('motor-slider');
-        const motorSliderValue = document.getElementById('motor-slider-value');
-        
-        motorSlider.addEventListener('input', function() {
-            const speed = motorSlider.value;
-            motorSliderValue.textContent = speed;
-            setMotorSpeed(speed);
-        });
-        
-        function setMotorSpeed(speed) {
-            fetch('/motor?speed=' + speed, { method: 'POST' })
-                .then(response => response.json())
-                .then(data => {
-                    if (data.status === 'success') {
-                        updateMotorDisplay(data.speed);
-                    } else {
-                        console.error('Motor error:', data.message);
-                    }
-                })
-                .catch(error => console.error('Error setting motor speed:', error));
-        }
-        
-        function setMotorSpeedPreset(speed) {
-            motorSlider.value = speed;
-            motorSliderValue.textContent = speed;
-            setMotorSpeed(speed);
-        }
-        
-        function stopMotor() {
-            motorSlider.value = 0;
-            motorSliderValue.textContent = 0;
-            fetch('/motor?action=stop', { method: 'POST' })
-                .then(response => response.json())
-                .then(data => {
-                    if (data.status === 'success') {
-                        updateMotorDisplay(0);
-                    } else {
-                        console.error('Motor error:', data.message);
-                    }
-                })
-                .catch(error => console.error('Error stopping motor:', error));
-        }
-        
-        function updateMotorDisplay(speed) {
-            document.getElementById('motor-speed').textContent = speed;
-            const direction = speed > 0 ? 'FORWARD' : speed < 0 ? 'REVERSE' : 'STOPPED';
-            document.getElementById('motor-direction').textContent = direction;
-        }
-        
-        setInterval(updateValues, 1000);
-        updateValues();
-    </script>
-</body>
-</html>
-)END_HTML";
-    return html;
+// Sample time and age in ms; age is -1 if the sensor has never been sampled
+void WebModule::writeSampleTime(JsonWriter& json, uint32_t timestamp_ms, uint32_t now) {
+    json.field("timestamp", (unsigned long)timestamp_ms);
+    json.field("age_ms", timestamp_ms == 0 ? -1L : (long)(now - timestamp_ms));
+}
+
+void WebModule::writeBMP(JsonWriter& json, const SensorSnapshot& snapshot, uint32_t now) {
+    json.beginObject("bmp");
+    writeSampleTime(json, snapshot.bmp_timestamp_ms, now);
+    json.field("temperature", snapshot.bmp_temperature);
+    json.field("pressure", snapshot.bmp_pressure);
+    json.field("altitude", snapshot.bmp_altitude);
+    json.endObject();
+}
+
+void WebModule::writeMPU(JsonWriter& json, const SensorSnapshot& snapshot, uint32_t now) {
+    json.beginObject("mpu");
+    writeSampleTime(json, snapshot.mpu_timestamp_ms, now);
+    json.field("temperature", snapshot.mpu_temperature);
+    json.beginObject("acceleration");
+    json.field("x", snapshot.accel_x);
+    json.field("y", snapshot.accel_y);
+    json.field("z", snapshot.accel_z);
+    json.endObject();
+    json.beginObject("gyro");
+    json.field("x", snapshot.gyro_x);
+    json.field("y", snapshot.gyro_y);
+    json.field("z", snapshot.gyro_z);
+    json.endObject();
+    json.field("samples", (unsigned long)snapshot.mpu_sample_count);
+    json.field("fifo_overflows", (unsigned long)snapshot.mpu_fifo_overflows);
+    json.endObject();
 }
 
-String WebModule::generateJSON() {
-    // Update MPU and GPS data
-    sensor_module.readMPUData();
-    sensor_module.updateGPSData();
+void WebModule::writeAttitude(JsonWriter& json, const SensorSnapshot& snapshot) {
+    json.beginObject("attitude");
+    json.field("qw", snapshot.attitude_qw, 4);
+    json.field("qx", snapshot.attitude_qx, 4);
+    json.field("qy", snapshot.attitude_qy, 4);
+    json.field("qz", snapshot.attitude_qz, 4);
+    json.field("roll", snapshot.roll, 1);
+    json.field("pitch", snapshot.pitch, 1);
+    json.field("yaw", snapshot.yaw, 1);
+    json.field("updates", (unsigned long)snapshot.attitude_updates);
+    json.endObject();
+}
+
+void WebModule::writeNavigation(JsonWriter& json, const SensorSnapshot& snapshot) {
+    const NavigationState& nav = snapshot.navigation;
+    json.beginObject("navigation");
+    json.field("valid", nav.valid);
+    json.field("heading_aligned", nav.heading_aligned);
+    json.field("latitude", nav.latitude, 7);
+    json.field("longitude", nav.longitude, 7);
+    json.field("altitude", nav.altitude);
+    json.field("north", nav.north);
+    json.field("east", nav.east);
+    json.field("vel_north", nav.vel_north);
+    json.field("vel_east", nav.vel_east);
+    json.field("vel_up", nav.vel_up);
+    json.field("sigma", nav.position_sigma);
+    json.field("predicts", (unsigned long)snapshot.navigation_predicts);
+    json.field("gps_updates", (unsigned long)snapshot.navigation_gps_updates);
+    json.endObject();
+}
+
+void WebModule::writeGPS(JsonWriter& json, const SensorSnapshot& snapshot, uint32_t now) {
+    json.beginObject("gps");
+    writeSampleTime(json, snapshot.gps_timestamp_ms, now);
+    json.field("valid", snapshot.gps.valid);
+    json.field("latitude", snapshot.gps.latitude, 6);
+    json.field("longitude", snapshot.gps.longitude, 6);
+    json.field("altitude", snapshot.gps.altitude);
+    json.field("speed", snapshot.gps.speed);
+    json.field("course", snapshot.gps.course, 1);
+    json.field("satellites", snapshot.gps.satellites);
+    json.field("time", snapshot.gps.time);
+    json.field("date", snapshot.gps.date);
+    json.endObject();
+}
+
+void WebModule::writeActuators(JsonWriter& json) {
+    json.beginObject("actuators");
+    json.beginObject("servo");
+    json.field("position", actuator_module.getPosition());
+    json.endObject();
+    json.beginObject("motor");
+    json.field("speed", actuator_module.getMotorSpeed());
+    json.endObject();
+    json.endObject();
+}
+
+size_t WebModule::generateJSON(char* buffer, size_t capacity) {
+    // Read the latest published readings; the sensor task owns the I2C bus and GPS UART
+    SensorSnapshot snapshot;
+    sensor_module.getSnapshot(snapshot);
+    uint32_t now = millis();
     
-    // Create JSON string with all sensor data
-    String json = "{";
+    JsonWriter json(buffer, capacity);
+    json.beginObject();
+    json.field("timestamp", (unsigned long)now);
+    writeBMP(json, snapshot, now);
+    writeMPU(json, snapshot, now);
+    writeAttitude(json, snapshot);
+    writeNavigation(json, snapshot);
+    writeGPS(json, snapshot, now);
+    writeActuators(json);
+    json.endObject();
     
-    // BMP280 data
-    json += "\"bmp\":{";
-    json += "\"temperature\":" + String(sensor_module.readBMPTemperature()) + ",";
-    json += "\"pressure\":" + String(sensor_module.readBMPPressure()) + ",";
-    json += "\"altitude\":" + String(sensor_module.readBMPAltitude());
-    json += "},";
+    // A cut-off document is invalid JSON; never send one
+    if (json.overflowed()) {
+        LOG_WARN("/data JSON does not fit, increase JSON_BUFFER_SIZE");
+        return 0;
+    }
+    return json.size();
+}
+
+// Stream frames always carry the IMU, attitude and navigation estimate; slower sources are only included when
+// they have a new sample (or when a new subscriber needs a full frame)
+size_t WebModule::generateStreamFrame(char* buffer, size_t capacity, bool full) {
+    SensorSnapshot snapshot;
+    sensor_module.getSnapshot(snapshot);
+    uint32_t now = millis();
+    
+    JsonWriter json(buffer, capacity);
+    json.beginObject();
+    json.field("timestamp", (unsigned long)now);
     
-    // MPU6050 data
-    json += "\"mpu\":{";
-    json += "\"temperature\":" + String(sensor_module.getMPUTemperature()) + ",";
-    json += "\"acceleration\":{";
-    json += "\"x\":" + String(sensor_module.getAccelX()) + ",";
-    json += "\"y\":" + String(sensor_module.getAccelY()) + ",";
-    json += "\"z\":" + String(sensor_module.getAccelZ());
-    json += "},";
-    json += "\"gyro\":{";
-    json += "\"x\":" + String(sensor_module.getGyroX()) + ",";
-    json += "\"y\":" + String(sensor_module.getGyroY()) + ",";
-    json += "\"z\":" + String(sensor_module.getGyroZ());
-    json += "}";
-    json += "},";
+    writeMPU(json, snapshot, now);
+    writeAttitude(json, snapshot);
+    writeNavigation(json, snapshot);
     
-    // GPS data
-    json += "\"gps\":{";
-    json += "\"valid\":" + String(sensor_module.isGPSDataValid() ? "true" : "false") + ",";
-    json += "\"latitude\":" + String(sensor_module.getLatitude(), 6) + ",";
-    json += "\"longitude\":" + String(sensor_module.getLongitude(), 6) + ",";
-    json += "\"altitude\":" + String(sensor_module.getGPSAltitude()) + ",";
-    json += "\"speed\":" + String(sensor_module.getSpeed()) + ",";
-    json += "\"satellites\":" + String(sensor_module.getSatellites()) + ",";
-    json += "\"time\":\"" + sensor_module.getGPSTime() + "\",";
-    json += "\"date\":\"" + sensor_module.getGPSDate() + "\"";
-    json += "},";
+    if (full || snapshot.bmp_timestamp_ms != stream_bmp_timestamp) {
+        writeBMP(json, snapshot, now);
+        stream_bmp_timestamp = snapshot.bmp_timestamp_ms;
+    }
     
-    // Actuator data
-    json += "\"actuators\":{";
-    json += "\"servo\":{";
-    json += "\"position\":" + String(actuator_module.getPosition());
-    json += "},";
-    json += "\"motor\":{";
-    json += "\"speed\":" + String(actuator_module.getMotorSpeed());
-    json += "}";
-    json += "}";
+    if (full || snapshot.gps_timestamp_ms != stream_gps_timestamp) {
+        writeGPS(json, snapshot, now);
+        stream_gps_timestamp = snapshot.gps_timestamp_ms;
+    }
     
-    json += "}";
+    int servo_position = actuator_module.getPosition();
+    int motor_speed = actuator_module.getMotorSpeed();
+    if (full || servo_position != stream_servo_position || motor_speed != stream_motor_speed) {
+        writeActuators(json);
+        stream_servo_position = servo_position;
+        stream_motor_speed = motor_speed;
+    }
     
-    return json;
+    json.endObject();
+    if (json.overflowed()) {
+        LOG_WARN("Stream frame does not fit, increase JSON_BUFFER_SIZE");
+        return 0;
+    }
+    return json.size();
 }
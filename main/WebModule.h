@@ -4,8 +4,19 @@
 #include <Arduino.h>
 #include <WiFi.h>
 #include <WebServer.h>
+#include <LittleFS.h>
 #include "SensorModule.h"
 #include "ActuatorModule.h"
+#include "JsonWriter.h"
+#include "TelemetryStream.h"
+#include "TelemetryDownlink.h"
+#include "ControlUplink.h"
+#include "HeadingController.h"
+#include "MissionEngine.h"
+#include "FlightRecorder.h"
+#include "CommandMailbox.h"
+#include "BootSequence.h"
+#include "Metrics.h"
 
 class WebModule {
 private:
@@ -14,22 +25,88 @@ private:
     WebServer server;
     SensorModule& sensor_module;
     ActuatorModule& actuator_module;
+    bool wifi_connected;                 // Last state seen by update(), for connect/disconnect logging
+    
+    static const size_t JSON_BUFFER_SIZE = 1536;
+    char json_buffer[JSON_BUFFER_SIZE];  // Reused for every /data response
+    
+    // Push telemetry (Server-Sent Events)
+    static const uint32_t MIN_STREAM_RATE_HZ = 10;
+    static const uint32_t MAX_STREAM_RATE_HZ = 50;
+    TelemetryStream stream;
+    char stream_buffer[JSON_BUFFER_SIZE];
+    uint32_t stream_rate_hz;
+    uint32_t stream_interval_us;
+    uint32_t last_stream_frame;
+    uint32_t stream_bmp_timestamp;       // Last sample times already sent, for incremental frames
+    uint32_t stream_gps_timestamp;
+    int stream_servo_position;
+    int stream_motor_speed;
+    uint32_t stream_encode_us_total;     // Per-frame cost of building the JSON
+    uint32_t stream_encode_us_max;
+    uint32_t stream_send_us_total;       // and of sending it to every subscriber
+    uint32_t stream_send_us_max;
+    
+    // HTTP actuator requests are queued here and applied once per control tick
+    static const uint32_t CONTROL_TICK_MS = 20;
+    CommandMailbox commands;
+    uint32_t last_control_tick;
+    uint32_t control_updates;            // Ticks that changed an actuator
+    
+    TelemetryDownlink* downlink;         // Optional, for /downlink
+    ControlUplink* uplink;               // Optional, for /uplink
+    HeadingController* autopilot;        // Optional, for /autopilot
+    MissionEngine* mission;              // Optional, for /mission
+    Geofence* geofence;                  // Optional, for /geofence
+    FlightRecorder* recorder;            // Optional, for deleting logs through /logs
+    const BootSequence* boot;            // Optional, for /metrics
     
     void handleRoot();
     void handleData();
+    void handleStream();
+    void handleLogs();
+    void handleDownlink();
+    void handleUplink();
+    void handleLogLevel();
+    void handleAutopilot();
+    void handleMission();
+    void handleGeofence();
+    void handleMetrics();
     void handleServo();
     void handleMotor();
+    void handleControl();
     void handle404();
     
-    String generateHTML();
-    String generateJSON();
+    size_t generateJSON(char* buffer, size_t capacity);     // 0 if the document does not fit
+    size_t generateStreamFrame(char* buffer, size_t capacity, bool full);  // Likewise
+    void streamTelemetry();
+    void applyCommands();
+    
+    void writeSampleTime(JsonWriter& json, uint32_t timestamp_ms, uint32_t now);
+    void writeBMP(JsonWriter& json, const SensorSnapshot& snapshot, uint32_t now);
+    void writeMPU(JsonWriter& json, const SensorSnapshot& snapshot, uint32_t now);
+    void writeAttitude(JsonWriter& json, const SensorSnapshot& snapshot);
+    void writeNavigation(JsonWriter& json, const SensorSnapshot& snapshot);
+    void writeGPS(JsonWriter& json, const SensorSnapshot& snapshot, uint32_t now);
+    void writeActuators(JsonWriter& json);
     
 public:
-    WebModule(const char* wifi_ssid, const char* wifi_password, SensorModule& sensor_module, ActuatorModule& actuator_module);
+    WebModule(const char* wifi_ssid, const char* wifi_password, SensorModule& sensor_module, ActuatorModule& actuator_module,
+              uint32_t stream_rate = 20);
     
-    bool begin();
+    bool begin();           // Starts connecting and serving without waiting for the access point
     void update();
     
+    void setStreamRate(uint32_t rate_hz);  // Clamped to 10-50 Hz
+    uint32_t getStreamRate() const { return stream_rate_hz; }
+    void setTelemetryDownlink(TelemetryDownlink* telemetry_downlink) { downlink = telemetry_downlink; }
+    void setControlUplink(ControlUplink* control_uplink) { uplink = control_uplink; }
+    void setHeadingController(HeadingController* heading_controller) { autopilot = heading_controller; }
+    void setMissionEngine(MissionEngine* mission_engine) { mission = mission_engine; }
+    void setGeofence(Geofence* fence) { geofence = fence; }
+    void setFlightRecorder(FlightRecorder* flight_recorder) { recorder = flight_recorder; }
+    void setBootSequence(const BootSequence* boot_sequence) { boot = boot_sequence; }
+    
     bool isWiFiConnected() const { return WiFi.status() == WL_CONNECTED; }
     IPAddress getIP() const { return WiFi.localIP(); }
 };
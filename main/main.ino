@@ -2,6 +2,18 @@
 #include "SensorModule.h"
 #include "ActuatorModule.h"
 #include "WebModule.h"
+#include "ProfilerModule.h"
+#include "FlightRecorder.h"
+#include "TelemetryDownlink.h"
+#include "ControlUplink.h"
+#include "HeadingController.h"
+#include "MissionEngine.h"
+#include "Geofence.h"
+#include "Log.h"
+#include "Metrics.h"
+#include "BootSequence.h"
+#include "Simulator.h"
+#include "NmeaBenchmark.h"
 
 const char* WIFI_SSID = "ALWAYS MONEY IN THE BANANA STAND";     // Replace with your WiFi SSID
 const char* WIFI_PASSWORD = "crazyivan42";  // Replace with your WiFi password
@@ -9,40 +21,285 @@ const char* WIFI_PASSWORD = "crazyivan42";  // Replace with your WiFi password
 SensorModule sensor_module;
 ActuatorModule actuator_module;  // Servo on pin 25
 WebModule web_module(WIFI_SSID, WIFI_PASSWORD, sensor_module, actuator_module);
+ProfilerModule sensor_profiler("SENSOR");  // Reports sensor task latency percentiles every 10 s
+ProfilerModule web_profiler("WEB");        // Reports web task latency percentiles every 10 s
+TelemetryDownlink telemetry_downlink(sensor_module, actuator_module);  // UDP broadcast, port 5005 at 50 Hz
+ControlUplink control_uplink(actuator_module);  // UDP steering commands on port 5006
+FlightRecorder flight_recorder(sensor_module, actuator_module);  // 50 Hz records to LittleFS
+HeadingController autopilot(sensor_module, actuator_module);  // Heading hold, 50 Hz tick
+MissionEngine mission(sensor_module, actuator_module, autopilot);  // Waypoint line following
+Geofence geofence(actuator_module);  // Keep-in/keep-out polygons, checked on every GPS fix
+BootSequence boot;  // Time-to-ready per subsystem; anything missing degrades instead of halting
 
-void setup() {
-  Serial.begin(115200);
-  delay(200);
+// Bring-up deadlines, in ms from reset. A subsystem still down by then is reported failed and the
+// rest run without it; the missing sensors are probed again every SENSOR_PROBE_INTERVAL_MS until then,
+// and every SENSOR_REPROBE_INTERVAL_MS after, so a sensor reseated in the field still comes up.
+const uint32_t SENSOR_BOOT_DEADLINE_MS = 3000;
+const uint32_t SENSOR_PROBE_INTERVAL_MS = 250;
+const uint32_t SENSOR_REPROBE_INTERVAL_MS = 5000;
+const uint32_t GPS_BOOT_DEADLINE_MS = 10000;
+const uint32_t WIFI_BOOT_DEADLINE_MS = 15000;
+const uint32_t RECORDER_BOOT_DEADLINE_MS = 10000;  // LittleFS formats itself on the first boot
+
+// Sensor acquisition runs on the application core, away from the WiFi stack
+const BaseType_t SENSOR_TASK_CORE = 1;
+const UBaseType_t SENSOR_TASK_PRIORITY = 5;
+const uint32_t SENSOR_TASK_PERIOD_MS = 5;
+
+// MPU6050 FIFO acquisition; the MPU INT line is not routed on the Jorge board, so it is polled
+const uint16_t IMU_SAMPLE_RATE_HZ = 1000;
+const int IMU_INT_PIN = -1;
+
+// NEO-6M binary output; falls back to 9600 baud NMEA if the receiver does not acknowledge
+const bool GPS_USE_UBX = true;
+const uint32_t GPS_UBX_BAUD = 115200;
+const uint16_t GPS_UBX_RATE_HZ = 5;
+
+#if NMEA_BENCHMARK_ENABLED
+NmeaBenchmark nmea_benchmark(sensor_module);  // Replays the NMEA corpora through the GPS parser at boot
+#endif
+
+#if SIMULATION_ENABLED
+Simulator simulator(sensor_module, actuator_module);  // Stands in for the hull, the water and the sensors
+#endif
+
+// The autopilot tick is timed by vTaskDelayUntil so its period does not drift with its own run time;
+// it sits just under the sensor task on the same core
+const BaseType_t AUTOPILOT_TASK_CORE = 1;
+const UBaseType_t AUTOPILOT_TASK_PRIORITY = 4;
+
+// Web serving shares the protocol core with WiFi so a slow client never stalls sensing
+const BaseType_t WEB_TASK_CORE = 0;
+const UBaseType_t WEB_TASK_PRIORITY = 2;
+
+// Flash writes can stall for tens of ms during erases, so they get their own lowest-priority task
+const BaseType_t RECORDER_TASK_CORE = 0;
+const UBaseType_t RECORDER_TASK_PRIORITY = 1;
+const uint32_t RECORDER_TASK_PERIOD_MS = 100;
+
+// Serial output is drained here so no other task ever blocks on the UART
+const BaseType_t LOG_TASK_CORE = 0;
+const UBaseType_t LOG_TASK_PRIORITY = 1;
+const uint32_t LOG_TASK_PERIOD_MS = 20;
+
+// Brings up whatever has not answered yet, failed sensors included; the sensors that have are
+// already being sampled. The I2C bus and the GPS configuration are only ever touched from the sensor task.
+void probeSensors() {
+  if (!boot.isUp(BOOT_BAROMETER) && sensor_module.beginBMP()) {
+    boot.setReady(BOOT_BAROMETER);
+  }
+
+  if (!boot.isUp(BOOT_IMU) && sensor_module.beginMPU()) {
+    if (sensor_module.beginMPUFifo(IMU_SAMPLE_RATE_HZ, IMU_INT_PIN)) {
+      boot.setReady(BOOT_IMU);
+    } else {
+      boot.setDegraded(BOOT_IMU, "FIFO setup failed, polling at 100 Hz");
+    }
+  }
 
-  if (!sensor_module.begin()) {
-    Serial.println("Failed to initialize all sensors. Check wiring and addresses.");
-    while (1) delay(10);
+  // The receiver cannot be probed; it is up once it has sent something that parses
+  if (!boot.isUp(BOOT_GPS) && !sensor_module.isGPSConfiguring()) {
+    uint32_t chars, passed, failed;
+    sensor_module.getGPSParserStats(chars, passed, failed);
+    if (passed == 0) {
+      return;
+    }
+    if (GPS_USE_UBX && !sensor_module.isGPSUbx()) {
+      boot.setDegraded(BOOT_GPS, "UBX configuration not acknowledged, NMEA at 1 Hz");
+    } else {
+      boot.setReady(BOOT_GPS);
+    }
   }
+}
+
+void sensorTask(void* /* param */) {
+#if !SIMULATION_ENABLED
+  sensor_module.beginBus();
+  sensor_module.beginGPS();
+  if (GPS_USE_UBX) {
+    sensor_module.beginGPSUbx(GPS_UBX_BAUD, GPS_UBX_RATE_HZ);  // Carried out by update(); falls back to NMEA on its own
+  }
+  unsigned long lastProbe = millis() - SENSOR_PROBE_INTERVAL_MS;
+#endif
+
+  for (;;) {
+#if !SIMULATION_ENABLED
+    if (!boot.isUp(BOOT_GPS) || !boot.isUp(BOOT_IMU) || !boot.isUp(BOOT_BAROMETER)) {
+      bool pending = boot.isPending(BOOT_GPS) || boot.isPending(BOOT_IMU) || boot.isPending(BOOT_BAROMETER);
+      uint32_t interval = pending ? SENSOR_PROBE_INTERVAL_MS : SENSOR_REPROBE_INTERVAL_MS;
+      if (millis() - lastProbe >= interval) {  // Outside the profiled iteration: a probe can take 100+ ms
+        probeSensors();
+        lastProbe = millis();
+      }
+    }
+#endif
+    sensor_profiler.beginIteration();
+#if SIMULATION_ENABLED
+    simulator.update();  // Feeds the readings the bus and UART would have delivered
+#endif
+    sensor_module.update();
+    flight_recorder.update();
 
-  if (!actuator_module.begin()) {
-    Serial.println("Failed to initialize servo. Check servo wiring.");
-    while (1) delay(10);
+    sensor_profiler.endIteration();
+    sensor_profiler.update();
+    sensor_module.waitForData(SENSOR_TASK_PERIOD_MS);  // Woken early by the IMU interrupt, if wired
   }
+}
+
+void autopilotTask(void* /* param */) {
+  const TickType_t period = pdMS_TO_TICKS(autopilot.getPeriodMs());
+  TickType_t last_wake = xTaskGetTickCount();
 
-  if (!actuator_module.beginMotor()) {
-    Serial.println("Failed to initialize motor. Check motor wiring.");
-    while (1) delay(10);
+  for (;;) {
+    mission.update();  // Sets the autopilot's heading from each new GPS fix
+    autopilot.update();
+    vTaskDelayUntil(&last_wake, period);
   }
+}
+
+// The UDP links need an address, so they start with the first WiFi connection, however late
+void startNetworkLinks() {
+  bool downlink_ok = telemetry_downlink.begin();
+  if (downlink_ok) {
+    web_module.setTelemetryDownlink(&telemetry_downlink);
+  }
+
+  bool uplink_ok = control_uplink.begin();
+  if (uplink_ok) {
+    web_module.setControlUplink(&control_uplink);
+  }
+
+  if (downlink_ok && uplink_ok) {
+    boot.setReady(BOOT_WIFI);
+  } else {
+    boot.setDegraded(BOOT_WIFI, "UDP telemetry or control link unavailable");
+  }
+}
+
+void webTask(void* /* param */) {
+  bool linksStarted = false;
 
+  for (;;) {
+    if (!linksStarted && web_module.isWiFiConnected()) {
+      startNetworkLinks();
+      linksStarted = true;
+    }
+
+    web_profiler.beginIteration();
+    control_uplink.update();  // Same task as the HTTP handlers, so actuator access stays single-threaded
+    web_module.update();
+    telemetry_downlink.update();
+    web_profiler.endIteration();
+    web_profiler.update();
+    vTaskDelay(1);  // Let the idle task and WiFi stack run
+  }
+}
+
+void recorderTask(void* /* param */) {
+  if (!flight_recorder.begin()) {
+    boot.setFailed(BOOT_RECORDER, "flight log storage unavailable, continuing without logging");
+    vTaskDelete(NULL);
+  }
+  boot.setReady(BOOT_RECORDER);
+  Metrics::registerTask(xTaskGetCurrentTaskHandle(), "recorder");  // Only once it is known to stay
+
+  unsigned long lastReport = 0;
+
+  for (;;) {
+    flight_recorder.writeBlocks();
+
+    if (millis() - lastReport >= 10000) {
+      flight_recorder.printReport();
+      lastReport = millis();
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(RECORDER_TASK_PERIOD_MS));
+  }
+}
+
+void logTask(void* /* param */) {
+  unsigned long lastPrint = 0;
+
+  for (;;) {
+    Log::drain();
+    boot.update();
+
+    if (millis() - lastPrint >= 1000) {  // Print every second
+      sensor_module.printSensorData();
+      lastPrint = millis();
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(LOG_TASK_PERIOD_MS));
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  Log::begin();
+
+  // Actuators first: the rudder is centred and the motor stopped within milliseconds of reset
+  bool servo_ok = actuator_module.begin();
+  bool motor_ok = actuator_module.beginMotor();
+  if (servo_ok && motor_ok) {
+    boot.setReady(BOOT_ACTUATORS);
+  } else if (servo_ok) {
+    boot.setDegraded(BOOT_ACTUATORS, "motor unavailable, check motor wiring");
+  } else if (motor_ok) {
+    boot.setDegraded(BOOT_ACTUATORS, "servo unavailable, check servo wiring");
+  } else {
+    boot.setFailed(BOOT_ACTUATORS, "servo and motor unavailable");
+  }
+#if SIMULATION_ENABLED
+  actuator_module.disableMotor();  // The simulator reads the PWM output; the propeller stays still on the bench
+#endif
+
+  // The access point is joined in the background while everything else comes up
   if (!web_module.begin()) {
-    Serial.println("Failed to initialize web server. Check WiFi credentials.");
-    while (1) delay(10);
+    boot.setFailed(BOOT_WIFI, "WiFi could not start, check the credentials");
   }
+
+#if NMEA_BENCHMARK_ENABLED
+  nmea_benchmark.run();  // Before Metrics::begin() so the replay stays out of the gps_parse histogram
+#endif
+  Metrics::begin();
+
+  boot.setDeadline(BOOT_IMU, SENSOR_BOOT_DEADLINE_MS, "MPU6050 not found at 0x68/0x69, check AD0/SDA/SCL wiring");
+  boot.setDeadline(BOOT_BAROMETER, SENSOR_BOOT_DEADLINE_MS, "BMP280 not found at 0x76/0x77, check SDO/CSB/SDA/SCL wiring");
+  boot.setDeadline(BOOT_GPS, GPS_BOOT_DEADLINE_MS, "nothing received from the GPS, check RX/TX wiring");
+  boot.setDeadline(BOOT_WIFI, WIFI_BOOT_DEADLINE_MS, "access point not joined, still retrying");
+  boot.setDeadline(BOOT_RECORDER, RECORDER_BOOT_DEADLINE_MS, "LittleFS still mounting");
+
+  sensor_module.setGeofence(&geofence);  // Before the sensor task starts the GPS callbacks
+  geofence.setMissionEngine(&mission);
+#if SIMULATION_ENABLED
+  sensor_module.beginSimulated(IMU_SAMPLE_RATE_HZ);
+  boot.setReady(BOOT_IMU);
+  boot.setReady(BOOT_BAROMETER);
+  boot.setReady(BOOT_GPS);
+#endif
+
+  control_uplink.setHeadingController(&autopilot);
+  web_module.setHeadingController(&autopilot);
+  web_module.setMissionEngine(&mission);
+  web_module.setGeofence(&geofence);
+  web_module.setFlightRecorder(&flight_recorder);
+  web_module.setBootSequence(&boot);
+
+  // Sensors, WiFi and flash come up in their own tasks from here. Handles are kept only for
+  // the stack high-water marks on /metrics; the recorder registers itself once it is running.
+  TaskHandle_t handle;
+  xTaskCreatePinnedToCore(logTask, "log", 4096, NULL, LOG_TASK_PRIORITY, &handle, LOG_TASK_CORE);
+  Metrics::registerTask(handle, "log");
+  xTaskCreatePinnedToCore(sensorTask, "sensor", 4096, NULL, SENSOR_TASK_PRIORITY, &handle, SENSOR_TASK_CORE);
+  Metrics::registerTask(handle, "sensor");
+  xTaskCreatePinnedToCore(autopilotTask, "autopilot", 4096, NULL, AUTOPILOT_TASK_PRIORITY, &handle, AUTOPILOT_TASK_CORE);
+  Metrics::registerTask(handle, "autopilot");
+  xTaskCreatePinnedToCore(webTask, "web", 8192, NULL, WEB_TASK_PRIORITY, &handle, WEB_TASK_CORE);
+  Metrics::registerTask(handle, "web");
+  xTaskCreatePinnedToCore(recorderTask, "recorder", 4096, NULL, RECORDER_TASK_PRIORITY, NULL, RECORDER_TASK_CORE);
 }
 
 void loop() {
-  web_module.update();
-  sensor_module.updateGPSData();  // Update GPS data continuously
-  
-  static unsigned long lastPrint = 0;
-  if (millis() - lastPrint >= 1000) {  // Print every second
-    sensor_module.readMPUData();
-    sensor_module.printSensorData();
-    lastPrint = millis();
-  }
+  // All work happens in the tasks created in setup()
+  vTaskDelete(NULL);
 }
@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+"""Send servo/motor commands over the UDP control uplink and measure latency.
+
+Sends ControlPacket commands (main/ControlUplink.h) at a fixed rate and
+matches the boat's acks to report round-trip time and the on-board
+packet-to-target time once a second. The target is what the ramp generator
+moves the PWM toward on its next 5 ms tick; the host build's
+uplink_benchmark measures the command-to-PWM latency through the firmware:
+
+    python3 tools/control_sender.py 192.168.1.50 --servo 90 --motor 0
+    python3 tools/control_sender.py 192.168.1.50 --sweep --rate 50
+
+--loopback runs the benchmark against an emulated boat on 127.0.0.1 that
+applies the same stale-packet rules as the firmware, with some packets
+deliberately reordered, so the sequence handling can be checked without
+hardware.
+"""
+
+import argparse
+import math
+import socket
+import struct
+import sys
+import threading
+import time
+
+PACKET = struct.Struct("<2sBBIIhh")
+ACK = struct.Struct("<2sBBIII")
+PACKET_VERSION = 1
+DEFAULT_PORT = 5006
+FLAG_NEW_SESSION = 0x01
+
+
+def now_us():
+    return int(time.monotonic() * 1e6) & 0xFFFFFFFF
+
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(p / 100.0 * len(ordered)))]
+
+
+class EmulatedBoat(threading.Thread):
+    """Mirrors ControlUplink::handlePacket: drop non-newer sequences, ack the rest."""
+
+    def __init__(self):
+        super().__init__(daemon=True)
+        self.sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.sock.bind(("127.0.0.1", 0))
+        self.sock.settimeout(0.2)
+        self.address = self.sock.getsockname()
+        self.last_sequence = None
+        self.applied = 0
+        self.stale = 0
+        self.running = True
+
+    def run(self):
+        while self.running:
+            try:
+                data, source = self.sock.recvfrom(64)
+            except socket.timeout:
+                continue
+            received = time.perf_counter()
+            magic, version, flags, sequence, sender_time_us, servo, motor = PACKET.unpack(data)
+            if magic != b"AC" or version != PACKET_VERSION:
+                continue
+            delta = (sequence - self.last_sequence) & 0xFFFFFFFF if self.last_sequence is not None else 1
+            newer = 0 < delta < 0x80000000
+            if not (flags & FLAG_NEW_SESSION) and not newer:
+                self.stale += 1
+                continue
+            self.last_sequence = sequence
+            self.applied += 1
+            apply_us = int((time.perf_counter() - received) * 1e6)
+            self.sock.sendto(ACK.pack(b"AK", PACKET_VERSION, 0, sequence, sender_time_us, apply_us), source)
+
+
+def run(host, port, args):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setblocking(False)
+    interval = 1.0 / args.rate
+
+    sequence = 0
+    sent = 0
+    rtts_ms = []
+    apply_us = []
+    acked = 0
+    window_start = time.monotonic()
+    next_send = time.monotonic()
+    deadline = time.monotonic() + args.duration if args.duration else None
+    held = None     # With --reorder-every, a packet held back to be sent after its successor
+
+    try:
+        while deadline is None or time.monotonic() < deadline:
+            now = time.monotonic()
+            if now >= next_send:
+                next_send += interval
+                servo = args.servo
+                if args.sweep:
+                    servo = int(90 + 60 * math.sin(2 * math.pi * 0.25 * now))
+                flags = FLAG_NEW_SESSION if sequence == 0 else 0
+                packet = PACKET.pack(b"AC", PACKET_VERSION, flags, sequence, now_us(), servo, args.motor)
+                if args.reorder_every and sequence > 0 and sequence % args.reorder_every == 0:
+                    held = packet
+                else:
+                    sock.sendto(packet, (host, port))
+                    if held is not None:
+                        sock.sendto(held, (host, port))
+                        held = None
+                sequence = (sequence + 1) & 0xFFFFFFFF
+                sent += 1
+
+            try:
+                while True:
+                    data = sock.recv(64)
+                    magic, version, _, _, sender_time_us, boat_apply_us = ACK.unpack(data)
+                    if magic == b"AK" and version == PACKET_VERSION:
+                        rtts_ms.append(((now_us() - sender_time_us) & 0xFFFFFFFF) / 1000.0)
+                        apply_us.append(boat_apply_us)
+                        acked += 1
+            except (BlockingIOError, struct.error):
+                pass
+
+            if time.monotonic() - window_start >= 1.0:
+                print("sent %d  acked %d  rtt p50 %.2f p99 %.2f max %.2f ms  to target avg %.0f us" % (
+                    sent, acked, percentile(rtts_ms, 50), percentile(rtts_ms, 99),
+                    max(rtts_ms) if rtts_ms else 0.0,
+                    sum(apply_us) / len(apply_us) if apply_us else 0.0))
+                window_start = time.monotonic()
+
+            time.sleep(min(0.001, max(0.0, next_send - time.monotonic())))
+    except KeyboardInterrupt:
+        pass
+
+    return sent, acked, rtts_ms
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host", nargs="?", help="boat IP address")
+    parser.add_argument("--port", type=int, default=DEFAULT_PORT, help="UDP port (default %d)" % DEFAULT_PORT)
+    parser.add_argument("--rate", type=float, default=50.0, help="commands per second (default 50)")
+    parser.add_argument("--servo", type=int, default=90, help="servo angle, degrees")
+    parser.add_argument("--motor", type=int, default=0, help="motor speed, -255..255")
+    parser.add_argument("--sweep", action="store_true", help="sweep the servo 30-150 degrees at 0.25 Hz")
+    parser.add_argument("--duration", type=float, default=0, help="seconds to run (default: until Ctrl-C)")
+    parser.add_argument("--loopback", action="store_true", help="benchmark against an emulated boat on 127.0.0.1")
+    parser.add_argument("--reorder-every", type=int, default=0,
+                        help="swap every Nth packet with its successor to exercise stale dropping")
+    args = parser.parse_args()
+
+    if args.loopback:
+        boat = EmulatedBoat()
+        boat.start()
+        args.duration = args.duration or 5.0
+        args.reorder_every = args.reorder_every or 25
+        sent, acked, rtts_ms = run(boat.address[0], boat.address[1], args)
+        time.sleep(0.1)
+        boat.running = False
+        swapped = (sent - 1) // args.reorder_every
+        print("loopback: %d sent, %d applied, %d stale dropped (%d reordered), rtt p50 %.3f ms" % (
+            sent, boat.applied, boat.stale, swapped, percentile(rtts_ms, 50)))
+        sys.exit(0 if boat.stale <= swapped and boat.applied + boat.stale <= sent else 1)
+
+    if not args.host:
+        parser.error("host is required unless --loopback is given")
+    run(args.host, args.port, args)
+
+
+if __name__ == "__main__":
+    main()
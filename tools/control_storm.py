@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""Fire a burst of /control requests at the boat and check they coalesce.
+
+Simulates a fast slider drag (or several dashboards at once) and reports
+request latency plus the mailbox counters from /control: with coalescing,
+"ticks" grows by at most one per 20 ms control tick however many requests
+arrive, and latency stays flat instead of growing with the burst.
+
+    python3 tools/control_storm.py 192.168.1.50 --requests 500 --concurrency 4
+"""
+
+import argparse
+import json
+import threading
+import time
+import urllib.request
+
+
+def get_json(url, method="GET"):
+    request = urllib.request.Request(url, method=method)
+    with urllib.request.urlopen(request, timeout=5) as response:
+        return json.load(response)
+
+
+def percentile(values, p):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(p / 100.0 * len(ordered)))] if ordered else 0.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host", help="boat IP address")
+    parser.add_argument("--requests", type=int, default=300, help="total requests (default 300)")
+    parser.add_argument("--concurrency", type=int, default=4, help="parallel connections (default 4)")
+    args = parser.parse_args()
+
+    base = "http://%s" % args.host
+    before = get_json(base + "/control")
+
+    latencies_ms = []
+    failures = []
+    lock = threading.Lock()
+    counter = iter(range(args.requests))
+
+    def worker():
+        while True:
+            with lock:
+                i = next(counter, None)
+            if i is None:
+                return
+            angle = 30 + (i * 7) % 120     # Sweeps like a dragged slider
+            start = time.perf_counter()
+            try:
+                get_json("%s/control?servo=%d" % (base, angle), method="POST")
+                with lock:
+                    latencies_ms.append((time.perf_counter() - start) * 1000.0)
+            except OSError as error:
+                with lock:
+                    failures.append(error)
+
+    threads = [threading.Thread(target=worker) for _ in range(args.concurrency)]
+    start = time.perf_counter()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    elapsed = time.perf_counter() - start
+
+    time.sleep(0.1)     # Let the last tick apply
+    after = get_json(base + "/control")
+
+    posted = after["posted"] - before["posted"]
+    ticks = after["ticks"] - before["ticks"]
+    print("%d requests in %.2f s (%.0f req/s), %d failed" % (
+        len(latencies_ms), elapsed, len(latencies_ms) / elapsed, len(failures)))
+    print("latency p50 %.1f  p90 %.1f  p99 %.1f  max %.1f ms" % (
+        percentile(latencies_ms, 50), percentile(latencies_ms, 90),
+        percentile(latencies_ms, 99), max(latencies_ms) if latencies_ms else 0.0))
+    print("mailbox: %d posted, %d coalesced, %d control ticks applied, %d actuator updates" % (
+        posted, after["coalesced"] - before["coalesced"], ticks, after["updates"] - before["updates"]))
+    max_ticks = int(elapsed * 1000 / after["tick_ms"]) + 2
+    print("ticks bounded by the control rate: %s (%d <= %d)" % ("yes" if ticks <= max_ticks else "NO", ticks, max_ticks))
+
+
+if __name__ == "__main__":
+    main()
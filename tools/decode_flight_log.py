@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""Decode a flight_NNN.bin log written by FlightRecorder into CSV.
+
+Logs can be listed at http://<boat>/logs and downloaded with
+http://<boat>/logs?file=flight_NNN.bin:
+
+    python3 tools/decode_flight_log.py flight_000.bin > flight_000.csv
+    python3 tools/decode_flight_log.py flight_000.bin -o flight_000.csv
+
+A summary (records, bytes per record, record rate, dropped records) is
+printed to stderr. The block and field layout must match main/FlightRecorder.h.
+"""
+
+import argparse
+import csv
+import struct
+import sys
+
+BLOCK_SIZE = 4096
+HEADER = struct.Struct("<4sBBHII")
+MAGIC = b"ALOG"
+FORMAT_VERSION = 1
+
+# (column, scale) in FlightRecorder::Field order; values are divided by scale
+FIELDS = [
+    ("timestamp_ms", 1),
+    ("accel_x", 1000), ("accel_y", 1000), ("accel_z", 1000),
+    ("gyro_x", 1000), ("gyro_y", 1000), ("gyro_z", 1000),
+    ("roll", 100), ("pitch", 100), ("yaw", 100),
+    ("bmp_temperature", 100),
+    ("bmp_pressure", 100),
+    ("bmp_altitude", 100),
+    ("gps_fix_count", 1),
+    ("gps_latitude", 10000000), ("gps_longitude", 10000000),
+    ("gps_speed", 100),
+    ("gps_course", 100),
+    ("gps_satellites", 1),
+    ("nav_north", 100), ("nav_east", 100), ("nav_up", 100),
+    ("nav_vel_north", 100), ("nav_vel_east", 100),
+    ("servo_position", 1),
+    ("motor_speed", 1),
+    ("flags", 1),
+]
+
+
+def to_int32(value):
+    value &= 0xFFFFFFFF
+    return value - 0x100000000 if value & 0x80000000 else value
+
+
+def read_varint(data, offset):
+    result = 0
+    shift = 0
+    while True:
+        byte = data[offset]
+        offset += 1
+        result |= (byte & 0x7F) << shift
+        if not byte & 0x80:
+            return result, offset
+        shift += 7
+
+
+def decode_block(block, field_count):
+    """Yield raw integer records; each block restarts the delta chain at zero."""
+    _, _, _, payload_bytes, _, _ = HEADER.unpack_from(block)
+    end = HEADER.size + payload_bytes
+    previous = [0] * field_count
+    offset = HEADER.size
+    while offset < end:
+        record = []
+        for i in range(field_count):
+            zigzag, offset = read_varint(block, offset)
+            delta = (zigzag >> 1) ^ -(zigzag & 1)
+            previous[i] = to_int32(previous[i] + delta)
+            record.append(previous[i])
+        yield record
+
+
+def format_value(value, scale):
+    if scale == 1:
+        return str(value)
+    digits = len(str(scale)) - 1
+    return "%.*f" % (digits, value / scale)
+
+
+def decode(path, out):
+    writer = csv.writer(out)
+    writer.writerow([name for name, _ in FIELDS])
+
+    records = 0
+    payload = 0
+    dropped = 0
+    blocks = 0
+    skipped = 0
+    first_ms = last_ms = None
+
+    with open(path, "rb") as log:
+        while True:
+            block = log.read(BLOCK_SIZE)
+            if len(block) < HEADER.size:
+                break
+            magic, version, field_count, payload_bytes, _, block_dropped = HEADER.unpack_from(block)
+            if magic != MAGIC or version != FORMAT_VERSION or len(block) < BLOCK_SIZE:
+                skipped += 1
+                continue
+            if field_count != len(FIELDS):
+                sys.exit("%s: expected %d fields, block has %d" % (path, len(FIELDS), field_count))
+
+            blocks += 1
+            payload += payload_bytes
+            dropped += block_dropped
+            for record in decode_block(block, field_count):
+                writer.writerow(format_value(v, scale) for v, (_, scale) in zip(record, FIELDS))
+                records += 1
+                if first_ms is None:
+                    first_ms = record[0]
+                last_ms = record[0]
+
+    print("%s: %d records in %d blocks" % (path, records, blocks), file=sys.stderr)
+    if records:
+        print("  %.1f bytes/record (%.1f including block overhead)"
+              % (payload / records, blocks * BLOCK_SIZE / records), file=sys.stderr)
+        span_s = ((last_ms - first_ms) & 0xFFFFFFFF) / 1000.0
+        if span_s > 0:
+            print("  %.1f s, %.1f records/s" % (span_s, (records - 1) / span_s), file=sys.stderr)
+    if dropped:
+        print("  %d records dropped on the device (writer fell behind)" % dropped, file=sys.stderr)
+    if skipped:
+        print("  %d blocks skipped (bad header or truncated)" % skipped, file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("log", help="flight_NNN.bin downloaded from /logs")
+    parser.add_argument("-o", "--output", help="CSV file to write (default: stdout)")
+    args = parser.parse_args()
+
+    if args.output:
+        with open(args.output, "w", newline="") as out:
+            decode(args.log, out)
+    else:
+        decode(args.log, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
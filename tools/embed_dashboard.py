@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""Compress main/web/dashboard.html into main/DashboardAsset.h.
+
+The firmware serves the dashboard straight from flash as a gzip body with a
+content-derived ETag, so this must be re-run whenever dashboard.html changes:
+
+    python3 tools/embed_dashboard.py          # regenerate the header
+    python3 tools/embed_dashboard.py --check  # fail if the header is stale
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE = os.path.join(ROOT, "main", "web", "dashboard.html")
+HEADER = os.path.join(ROOT, "main", "DashboardAsset.h")
+
+
+def minify(html):
+    # Indentation and blank lines are most of the page; newlines are kept so
+    # inline scripts that rely on automatic semicolon insertion still parse.
+    lines = (line.strip() for line in html.splitlines())
+    return "\n".join(line for line in lines if line) + "\n"
+
+
+def render_header(html):
+    raw = minify(html).encode("utf-8")
+    compressed = gzip.compress(raw, compresslevel=9, mtime=0)
+    etag = hashlib.sha1(raw).hexdigest()[:16]
+
+    rows = []
+    for i in range(0, len(compressed), 16):
+        chunk = compressed[i:i + 16]
+        rows.append("    " + ", ".join("0x%02x" % b for b in chunk) + ",")
+
+    return "\n".join([
+        "// Generated by tools/embed_dashboard.py from main/web/dashboard.html -- do not edit.",
+        "// %d bytes of HTML compressed to %d bytes." % (len(raw), len(compressed)),
+        "#ifndef DASHBOARD_ASSET_H",
+        "#define DASHBOARD_ASSET_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "static const char DASHBOARD_ETAG[] = \"\\\"%s\\\"\";" % etag,
+        "static const size_t DASHBOARD_HTML_GZ_LEN = %d;" % len(compressed),
+        "static const uint8_t DASHBOARD_HTML_GZ[] PROGMEM = {",
+        *rows,
+        "};",
+        "",
+        "#endif // DASHBOARD_ASSET_H",
+        "",
+    ])
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--check", action="store_true", help="verify the header is up to date")
+    args = parser.parse_args()
+
+    with open(SOURCE, encoding="utf-8") as f:
+        header = render_header(f.read())
+
+    if args.check:
+        try:
+            with open(HEADER, encoding="utf-8") as f:
+                current = f.read()
+        except FileNotFoundError:
+            current = None
+        if current != header:
+            print("DashboardAsset.h is out of date, run tools/embed_dashboard.py", file=sys.stderr)
+            return 1
+        return 0
+
+    with open(HEADER, "w", encoding="utf-8") as f:
+        f.write(header)
+    print("Wrote %s" % os.path.relpath(HEADER, ROOT))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,419 @@
+#!/usr/bin/env python3
+"""Build the GPS parser benchmark corpora into main/NmeaCorpus.h.
+
+Every tools/nmea/*.nmea file (raw Serial2 NMEA captures, CRLF line endings)
+and every *.ubx file (raw UBX captures) becomes one corpus, named after the
+file. Four corpora are generated on top. Two of them are NMEA: a 5 Hz
+RMC+GGA stream and a malformed one with bad checksums, truncated sentences,
+missing line endings, line noise, sentences without a checksum and overlong
+fields. The other two are UBX: the same 5 Hz trajectory as NAV-POSLLH/SOL/
+VELNED/TIMEUTC epochs, and a malformed UBX stream. The expected counts
+embedded with each corpus come from the reference models below, which apply
+TinyGPS++'s sentence rules and UbxParser's framing and epoch rules. The
+benchmark reports any disagreement.
+
+    python3 tools/embed_nmea_corpus.py          # regenerate the header
+    python3 tools/embed_nmea_corpus.py --check  # fail if the header is stale
+"""
+
+import argparse
+import glob
+import math
+import os
+import random
+import struct
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+CAPTURES = os.path.join(ROOT, "tools", "nmea", "*")
+HEADER = os.path.join(ROOT, "main", "NmeaCorpus.h")
+
+TERM_CHARS = 14     # TinyGPS++ keeps the first 14 characters of each field
+UBX_MAX_PAYLOAD = 64
+UBX_NAV_LENGTHS = {0x02: 28, 0x06: 52, 0x12: 36, 0x21: 20}     # POSLLH, SOL, VELNED, TIMEUTC
+
+
+def checksum(body):
+    value = 0
+    for c in body.encode("ascii"):
+        value ^= c
+    return value
+
+
+def sentence(body):
+    return "$%s*%02X\r\n" % (body, checksum(body))
+
+
+def time_value(term):
+    """TinyGPS++'s time value, hhmmsscc, of an RMC/GGA time term."""
+    whole, _, fraction = term.partition(b".")
+    digits = (fraction + b"00")[:2]
+    if not whole.isdigit() or not digits.isdigit():
+        return 0
+    return int(whole) * 100 + int(digits)
+
+
+def count_sentences(data):
+    """Reference model of TinyGPS++'s encode() and SensorModule's fix count:
+    returns (passed, failed, fixes). RMC and GGA of one epoch share a time and
+    count as one fix."""
+    passed = failed = fixes = 0
+    parity = 0
+    term = b""
+    term_number = 0
+    sentence_type = None
+    has_fix = False
+    sentence_time = None
+    fix_time = None
+    checksum_term = False
+
+    for c in data:
+        if c in b",\r\n*":
+            if c == ord(","):
+                parity ^= c
+            if checksum_term:
+                digits = term[:2]
+                given = int(digits, 16) if len(digits) == 2 and all(d in b"0123456789ABCDEFabcdef" for d in digits) else None
+                if given is not None and given == parity:
+                    passed += 1
+                    if has_fix and sentence_type is not None and sentence_time != fix_time:
+                        fixes += 1
+                        fix_time = sentence_time
+                else:
+                    failed += 1
+            elif term_number == 0:
+                sentence_type = term[2:] if term[2:] in (b"RMC", b"GGA") and term[:2] in (b"GP", b"GN") else None
+            elif sentence_type is not None and term_number == 1:
+                sentence_time = time_value(term)
+            elif sentence_type == b"RMC" and term_number == 2:
+                has_fix = term[:1] == b"A"
+            elif sentence_type == b"GGA" and term_number == 6:
+                has_fix = term[:1] > b"0"
+            term_number += 1
+            term = b""
+            checksum_term = c == ord("*")
+        elif c == ord("$"):
+            term_number = 0
+            term = b""
+            parity = 0
+            sentence_type = None
+            checksum_term = False
+            has_fix = False
+            sentence_time = None
+        else:
+            if len(term) < TERM_CHARS:
+                term += bytes([c])
+            if not checksum_term:
+                parity ^= c
+    return passed, failed, fixes
+
+
+def count(ubx, data):
+    return count_ubx(data) if ubx else count_sentences(data)
+
+
+def count_ubx(data):
+    """Reference model of UbxParser::encode(): returns (passed, failed, fixes)."""
+    passed = failed = fixes = 0
+    state = "sync1"
+    have = 0
+    itow = None
+    fix_ok = False
+    frame = []
+    length = 0
+    a = b = 0
+
+    for c in data:
+        if state == "sync1":
+            state = "sync2" if c == 0xB5 else "sync1"
+        elif state == "sync2":
+            state = "header" if c == 0x62 else "sync2" if c == 0xB5 else "sync1"
+            frame = []
+            a = b = 0
+        elif state == "header":
+            frame.append(c)
+            a = (a + c) & 0xFF
+            b = (b + a) & 0xFF
+            if len(frame) == 4:
+                length = frame[2] | frame[3] << 8
+                state = "sync1" if length > UBX_MAX_PAYLOAD else "payload" if length else "check_a"
+        elif state == "payload":
+            frame.append(c)
+            a = (a + c) & 0xFF
+            b = (b + a) & 0xFF
+            if len(frame) == 4 + length:
+                state = "check_a"
+        elif state == "check_a":
+            if c != a:
+                failed += 1
+                state = "sync1"
+            else:
+                state = "check_b"
+        elif state == "check_b":
+            state = "sync1"
+            if c != b:
+                failed += 1
+                continue
+            passed += 1
+            message_class, message_id, payload = frame[0], frame[1], bytes(frame[4:])
+            if message_class != 0x01 or UBX_NAV_LENGTHS.get(message_id) != length:
+                continue
+            message_itow = struct.unpack_from("<I", payload)[0]
+            if have == 0 or message_itow != itow:
+                itow = message_itow
+                have = 0
+            if message_id == 0x06:
+                fix_ok = bool(payload[11] & 0x01) and 2 <= payload[10] <= 4
+            have |= {0x02: 1, 0x06: 2, 0x12: 4, 0x21: 8}[message_id]
+            if have == 0x0F:
+                have = 0
+                fixes += fix_ok
+    return passed, failed, fixes
+
+
+def ubx_frame(message_class, message_id, payload):
+    body = bytes([message_class, message_id, len(payload) & 0xFF, len(payload) >> 8]) + payload
+    a = b = 0
+    for c in body:
+        a = (a + c) & 0xFF
+        b = (b + a) & 0xFF
+    return b"\xb5\x62" + body + bytes([a, b])
+
+
+def ubx_epoch(t, latitude, longitude, knots, course, fix_type=3, satellites=9):
+    itow = int(302400000 + t * 1000)        # Friday noon, GPS time of week in ms
+    flags = 0x0D if fix_type >= 2 else 0x00
+    clock = 12 * 3600 + int(t)
+    speed = int(knots / 0.0194384)          # cm/s
+    return [
+        ubx_frame(0x01, 0x02, struct.pack("<IiiiiII", itow, int(round(longitude * 1e7)), int(round(latitude * 1e7)),
+                                          27800, 11800, 2500, 3800)),
+        ubx_frame(0x01, 0x06, struct.pack("<IihBBiiiIiiiIHBBI", itow, 0, 2401, fix_type, flags,
+                                          0, 0, 0, 350, 0, 0, 0, 40, 121, 0, satellites, 0)),
+        ubx_frame(0x01, 0x12, struct.pack("<IiiiIIiII", itow,
+                                          int(speed * math.cos(math.radians(course))),
+                                          int(speed * math.sin(math.radians(course))), 0,
+                                          speed, speed, int(course * 1e5), 50, 250000)),
+        ubx_frame(0x01, 0x21, struct.pack("<IIiHBBBBBB", itow, 40, 0, 2026, 1, 16,
+                                          clock // 3600, clock // 60 % 60, clock % 60, 0x07)),
+    ]
+
+
+def coordinate(degrees, digits, positive, negative):
+    hemisphere = positive if degrees >= 0 else negative
+    degrees = abs(degrees)
+    whole = int(degrees)
+    minutes = (degrees - whole) * 60.0
+    return "%0*d%08.5f,%s" % (digits, whole, minutes, hemisphere)
+
+
+def fix_sentences(t, latitude, longitude, knots, course, quality=1):
+    clock = "%02d%02d%05.2f" % (12 + int(t // 3600), int(t // 60) % 60, t % 60)
+    position = "%s,%s" % (coordinate(latitude, 2, "N", "S"), coordinate(longitude, 3, "E", "W"))
+    return [
+        sentence("GPRMC,%s,A,%s,%.3f,%.2f,160126,,,A" % (clock, position, knots, course)),
+        sentence("GPGGA,%s,%s,%d,09,0.92,11.8,M,16.0,M,," % (clock, position, quality)),
+    ]
+
+
+def circle_5hz():
+    # Ten seconds at 5 Hz of a boat circling at 4 knots
+    for i in range(50):
+        t = i * 0.2
+        angle = t * 0.1
+        latitude = -34.5443 + 30.0 * math.sin(angle) / 111320.0
+        longitude = -58.4399 + 30.0 * (1.0 - math.cos(angle)) / 91720.0
+        yield t, latitude, longitude, 4.0, math.degrees(angle) % 360.0
+
+
+def synthetic_5hz():
+    lines = []
+    for epoch in circle_5hz():
+        lines += fix_sentences(*epoch)
+    return "".join(lines)
+
+
+def ubx_5hz():
+    frames = []
+    for epoch in circle_5hz():
+        frames += ubx_epoch(*epoch)
+    return b"".join(frames)
+
+
+def ubx_malformed():
+    rng = random.Random(4242)
+    parts = []
+    for i in range(40):
+        epoch = ubx_epoch(i * 0.2, -34.5443 + i * 1e-5, -58.4399, 3.2, 45.0)
+        kind = i % 8
+        if kind == 0:
+            # Corrupted payload byte: that message fails, so the epoch never completes
+            bad = bytearray(epoch[0])
+            bad[10] ^= 0x40
+            parts += [bytes(bad)] + epoch[1:]
+        elif kind == 1:
+            # Frame cut short; the decoder eats into the next one before resynchronising
+            parts += [epoch[0][:15]] + epoch[1:]
+        elif kind == 2:
+            # Line noise between frames
+            parts += [epoch[0], bytes(rng.randrange(256) for _ in range(40))] + epoch[1:]
+        elif kind == 3:
+            # No fix yet
+            parts += ubx_epoch(i * 0.2, 0.0, 0.0, 0.0, 0.0, fix_type=0, satellites=2)
+        elif kind == 4:
+            # A long message that is never enabled, and NMEA left over from before the switch
+            parts += [ubx_frame(0x01, 0x30, bytes(8 + 12 * 16)), sentence("GPGGA,,,,,,0,00,99.99,,,,,,").encode("ascii")] + epoch
+        elif kind == 5:
+            # An ACK in the stream, and an epoch missing its TIMEUTC
+            parts += [ubx_frame(0x05, 0x01, bytes([0x06, 0x08]))] + epoch[:3]
+        else:
+            parts += epoch
+    return b"".join(parts)
+
+
+def malformed():
+    rng = random.Random(1337)
+    noise_bytes = [b for b in range(0x20, 0x100) if b not in b"$*,\r\n"]
+    parts = []
+    for i in range(40):
+        good = fix_sentences(i, -34.5443 + i * 1e-5, -58.4399, 3.2, 45.0)
+        kind = i % 10
+        if kind == 0:
+            # One flipped character, so the checksum fails
+            bad = good[0].replace(",A,", ",V,", 1)
+            bad = bad[:bad.index("*")] + good[0][good[0].index("*"):]
+            parts += [bad, good[1]]
+        elif kind == 1:
+            # Truncated mid-sentence, the next one starts without a line ending
+            parts += [good[0][:30], good[1]]
+        elif kind == 2:
+            # Line noise between sentences
+            parts += [good[0], bytes(rng.choice(noise_bytes) for _ in range(24)).decode("latin-1"), good[1]]
+        elif kind == 3:
+            # No fix yet: empty fields with a valid checksum
+            parts += [sentence("GPRMC,%02d0000.00,V,,,,,,,160126,,,N" % (12 + i % 10)), sentence("GPGGA,,,,,,0,00,99.99,,,,,,")]
+        elif kind == 4:
+            # Checksum missing entirely, and a sentence type the parser skips
+            parts += [good[0][:good[0].index("*")] + "\r\n", sentence("GPZDA,%02d0000.00,16,01,2026,00,00" % (12 + i % 10))]
+        elif kind == 5:
+            # Line ending lost between two sentences
+            parts += [good[0].rstrip("\r\n"), good[1]]
+        elif kind == 6:
+            # Overlong field, far past the 82-character NMEA limit
+            parts += [sentence("GPTXT,01,01,02," + "X" * 180), good[0], good[1]]
+        elif kind == 7:
+            # Bad checksum on a sentence that carries a fix
+            parts += [good[0], good[1][:-4] + "00\r\n"]
+        else:
+            parts += good
+    return "".join(parts)
+
+
+def c_string(data):
+    rows = []
+    line = ""
+    for b in data:
+        c = chr(b)
+        if c == "\\":
+            piece = "\\\\"
+        elif c == "\"":
+            piece = "\\\""
+        elif c == "\r":
+            piece = "\\r"
+        elif c == "\n":
+            piece = "\\n"
+        elif 0x20 <= b < 0x7f and c != "?":
+            piece = c
+        else:
+            piece = "\\%03o" % b
+        line += piece
+        if c == "\n" or len(line) >= 100:
+            rows.append("    \"%s\"" % line)
+            line = ""
+    if line:
+        rows.append("    \"%s\"" % line)
+    return rows
+
+
+def render_header(corpora):
+    out = [
+        "// Generated by tools/embed_nmea_corpus.py from tools/nmea/*.nmea -- do not edit.",
+        "#ifndef NMEA_CORPUS_H",
+        "#define NMEA_CORPUS_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "enum NmeaCorpusProtocol : uint8_t { CORPUS_NMEA, CORPUS_UBX };",
+        "",
+        "// One replayable receiver stream and what the parser should make of one pass over it",
+        "struct NmeaCorpus {",
+        "    const char* name;",
+        "    NmeaCorpusProtocol protocol;",
+        "    const char* text;",
+        "    size_t length;",
+        "    uint32_t sentences_passed;     // Sentences or UBX messages with a verified checksum",
+        "    uint32_t sentences_failed;     // Checksum present but wrong",
+        "    uint32_t fixes;                // Epochs that update the position: RMC/GGA time or UBX epoch",
+        "};",
+        "",
+    ]
+    for index, (name, ubx, data) in enumerate(corpora):
+        out.append("static const char NMEA_CORPUS_%d[] PROGMEM =" % index)
+        rows = c_string(data)
+        rows[-1] += ";"
+        out += rows
+        out.append("")
+
+    out.append("static const NmeaCorpus NMEA_CORPORA[] = {")
+    for index, (name, ubx, data) in enumerate(corpora):
+        passed, failed, fixes = count(ubx, data)
+        out.append("    { \"%s\", %s, NMEA_CORPUS_%d, %d, %d, %d, %d }," %
+                   (name, "CORPUS_UBX" if ubx else "CORPUS_NMEA", index, len(data), passed, failed, fixes))
+    out += [
+        "};",
+        "static const int NMEA_CORPUS_COUNT = %d;" % len(corpora),
+        "",
+        "#endif // NMEA_CORPUS_H",
+        "",
+    ]
+    return "\n".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--check", action="store_true", help="verify the header is up to date")
+    args = parser.parse_args()
+
+    corpora = []
+    for path in sorted(glob.glob(CAPTURES)):
+        name, extension = os.path.splitext(os.path.basename(path))
+        if extension in (".nmea", ".ubx"):
+            with open(path, "rb") as f:
+                corpora.append((name, extension == ".ubx", f.read()))
+    corpora.append(("synthetic_5hz", False, synthetic_5hz().encode("ascii")))
+    corpora.append(("malformed", False, malformed().encode("latin-1")))
+    corpora.append(("ubx_5hz", True, ubx_5hz()))
+    corpora.append(("ubx_malformed", True, ubx_malformed()))
+    header = render_header(corpora)
+
+    if args.check:
+        try:
+            with open(HEADER, encoding="utf-8") as f:
+                current = f.read()
+        except FileNotFoundError:
+            current = None
+        if current != header:
+            print("NmeaCorpus.h is out of date, run tools/embed_nmea_corpus.py", file=sys.stderr)
+            return 1
+        return 0
+
+    with open(HEADER, "w", encoding="utf-8") as f:
+        f.write(header)
+    print("Wrote %s" % os.path.relpath(HEADER, ROOT))
+    for name, ubx, data in corpora:
+        print("  %-16s %6d bytes  passed %d  failed %d  fixes %d" % ((name, len(data)) + count(ubx, data)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+"""Reference ground-station receiver for the binary UDP telemetry downlink.
+
+Listens for TelemetryFrame broadcasts (main/TelemetryDownlink.h) and prints
+the frame rate, packet loss and latest state once a second:
+
+    python3 tools/telemetry_receiver.py                 # listen on UDP 5005
+    python3 tools/telemetry_receiver.py --csv out.csv   # also log every frame
+
+--loopback exercises the same decoder without a boat: it sends synthetic
+frames to itself over 127.0.0.1, deliberately skipping some sequence numbers,
+and reports frames/s, the loss it detected and the per-frame encode cost.
+
+--replay decodes a capture instead of a socket: packets as a 2-byte
+little-endian length followed by the payload, as the host build's
+TelemetryDownlinkTest writes them from the firmware's own frames.
+"""
+
+import argparse
+import csv
+import socket
+import struct
+import sys
+import time
+
+FRAME = struct.Struct("<2sBBIII3f3f4f3fii2f6fIhhB")
+MAGIC = b"AU"
+FRAME_VERSION = 1
+DEFAULT_PORT = 5005
+
+COLUMNS = [
+    "sequence", "timestamp_us", "snapshot_sequence", "flags",
+    "accel_x", "accel_y", "accel_z", "gyro_x", "gyro_y", "gyro_z",
+    "qw", "qx", "qy", "qz",
+    "bmp_pressure", "bmp_altitude", "bmp_temperature",
+    "latitude", "longitude", "gps_speed", "gps_course",
+    "nav_north", "nav_east", "nav_up", "nav_vel_north", "nav_vel_east", "nav_vel_up",
+    "mpu_sample_count", "servo_position", "motor_speed", "satellites",
+]
+
+
+def decode(packet):
+    """Return a dict for a valid frame, or None."""
+    if len(packet) != FRAME.size:
+        return None
+    values = FRAME.unpack(packet)
+    magic, version, flags, sequence, timestamp_us, snapshot_sequence = values[:6]
+    if magic != MAGIC or version != FRAME_VERSION:
+        return None
+    rest = values[6:]
+    frame = {
+        "sequence": sequence,
+        "timestamp_us": timestamp_us,
+        "snapshot_sequence": snapshot_sequence,
+        "flags": flags,
+    }
+    frame.update(zip(COLUMNS[4:], rest))
+    frame["latitude"] /= 1e7
+    frame["longitude"] /= 1e7
+    return frame
+
+
+def encode(frame):
+    values = [frame[name] for name in COLUMNS[4:]]
+    values[COLUMNS.index("latitude") - 4] = int(round(frame["latitude"] * 1e7))
+    values[COLUMNS.index("longitude") - 4] = int(round(frame["longitude"] * 1e7))
+    return FRAME.pack(MAGIC, FRAME_VERSION, frame["flags"], frame["sequence"],
+                      frame["timestamp_us"], frame["snapshot_sequence"], *values)
+
+
+class LinkStats:
+    """Counts frames and sequence gaps; a late (reordered) frame is taken back out of the loss count."""
+
+    def __init__(self):
+        self.received = 0
+        self.lost = 0
+        self.out_of_order = 0
+        self.invalid = 0
+        self.next_sequence = None
+
+    def add(self, sequence):
+        self.received += 1
+        if self.next_sequence is None:
+            self.next_sequence = sequence + 1
+            return
+        gap = (sequence - self.next_sequence) & 0xFFFFFFFF
+        if gap < 0x80000000:
+            self.lost += gap
+            self.next_sequence = (sequence + 1) & 0xFFFFFFFF
+        else:
+            # Older than expected: it was counted as lost when the gap opened
+            self.out_of_order += 1
+            self.lost = max(0, self.lost - 1)
+
+    def loss_percent(self):
+        total = self.received + self.lost
+        return 100.0 * self.lost / total if total else 0.0
+
+
+def receive(args):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("", args.port))
+    sock.settimeout(0.5)
+
+    writer = None
+    csv_file = None
+    if args.csv:
+        csv_file = open(args.csv, "w", newline="")
+        writer = csv.writer(csv_file)
+        writer.writerow(COLUMNS)
+
+    stats = LinkStats()
+    window_start = time.monotonic()
+    window_frames = 0
+    last = None
+    print("Listening on UDP %d" % args.port, file=sys.stderr)
+
+    try:
+        while True:
+            try:
+                packet, _ = sock.recvfrom(2048)
+                frame = decode(packet)
+                if frame is None:
+                    stats.invalid += 1
+                else:
+                    stats.add(frame["sequence"])
+                    window_frames += 1
+                    last = frame
+                    if writer:
+                        writer.writerow(frame[name] for name in COLUMNS)
+            except socket.timeout:
+                pass
+
+            now = time.monotonic()
+            if now - window_start >= 1.0:
+                rate = window_frames / (now - window_start)
+                line = "%6.1f frames/s  received %d  lost %d (%.2f%%)  reordered %d  invalid %d" % (
+                    rate, stats.received, stats.lost, stats.loss_percent(), stats.out_of_order, stats.invalid)
+                if last:
+                    line += "  seq %d  acc %.2f %.2f %.2f  nav %.1f N %.1f E" % (
+                        last["sequence"], last["accel_x"], last["accel_y"], last["accel_z"],
+                        last["nav_north"], last["nav_east"])
+                print(line)
+                window_start = now
+                window_frames = 0
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if csv_file:
+            csv_file.close()
+
+
+def loopback(args):
+    """Send synthetic frames through 127.0.0.1 and check what the receiver reports."""
+    rx = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    rx.bind(("127.0.0.1", 0))
+    rx.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 1 << 22)
+    rx.settimeout(1.0)
+    tx = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    address = rx.getsockname()
+
+    template = {name: 0 for name in COLUMNS}
+    template.update(qw=1.0, latitude=-34.6037, longitude=-58.3816, accel_z=9.81)
+
+    stats = LinkStats()
+    skipped = 0
+    encode_s = 0.0
+    start = time.perf_counter()
+    for sequence in range(args.frames):
+        if args.skip_every and sequence % args.skip_every == args.skip_every // 2:
+            skipped += 1
+            continue
+        template["sequence"] = sequence
+        template["timestamp_us"] = sequence * 1000
+        t0 = time.perf_counter()
+        packet = encode(template)
+        encode_s += time.perf_counter() - t0
+        tx.sendto(packet, address)
+
+        packet = rx.recv(2048)
+        frame = decode(packet)
+        if frame is None:
+            stats.invalid += 1
+        else:
+            stats.add(frame["sequence"])
+    elapsed = time.perf_counter() - start
+
+    sent = args.frames - skipped
+    print("%d frames of %d bytes in %.2f s: %.0f frames/s" % (sent, FRAME.size, elapsed, sent / elapsed))
+    print("encode %.2f us/frame (Python reference encoder)" % (1e6 * encode_s / sent))
+    print("skipped %d sequence numbers, detected %d lost, %d invalid" % (skipped, stats.lost, stats.invalid))
+    return 0 if stats.lost == skipped and stats.invalid == 0 else 1
+
+
+def replay(args):
+    """Decode a length-prefixed capture and report what the receiver would have."""
+    stats = LinkStats()
+    packets = 0
+    with open(args.replay, "rb") as capture:
+        while True:
+            header = capture.read(2)
+            if len(header) < 2:
+                break
+            (length,) = struct.unpack("<H", header)
+            packet = capture.read(length)
+            packets += 1
+            frame = decode(packet)
+            if frame is None:
+                stats.invalid += 1
+            else:
+                stats.add(frame["sequence"])
+
+    print("replayed %d packets: received %d lost %d (%.2f%%) reordered %d invalid %d" % (
+        packets, stats.received, stats.lost, stats.loss_percent(), stats.out_of_order, stats.invalid))
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--port", type=int, default=DEFAULT_PORT, help="UDP port (default %d)" % DEFAULT_PORT)
+    parser.add_argument("--csv", help="write every received frame to this CSV file")
+    parser.add_argument("--loopback", action="store_true", help="self-test over 127.0.0.1 instead of listening")
+    parser.add_argument("--replay", metavar="FILE", help="decode a length-prefixed capture instead of listening")
+    parser.add_argument("--frames", type=int, default=100000, help="frames to send in --loopback mode")
+    parser.add_argument("--skip-every", type=int, default=100,
+                        help="in --loopback mode, drop every Nth sequence number to test loss detection")
+    args = parser.parse_args()
+
+    if args.loopback:
+        sys.exit(loopback(args))
+    if args.replay:
+        sys.exit(replay(args))
+    receive(args)
+
+
+if __name__ == "__main__":
+    main()